@@ -24,6 +24,22 @@ def defaultAnalysis(feProb,steps= 1):
     result= analysis.analyze(steps) #Same with the number of steps.
     return result
 
+class LinearSuperpositionAnalysis(object):
+    '''Analysis procedure for saveAll method that obtains the results
+       of each combination by superposition of the load pattern
+       solutions. The stiffness matrix is factored only once and 
+       each load pattern is solved only once, so it is much faster 
+       than defaultAnalysis when there are many combinations. Only for 
+       linear models.'''
+    def __init__(self):
+        self.feProblem= None
+        self.analysis= None
+    def __call__(self,feProb,steps= 1):
+        if(self.feProblem is not feProb):
+            self.feProblem= feProb
+            self.analysis= predefined_solutions.simple_linear_superposition(feProb)
+        return self.analysis.analyze(steps)
+
 class LimitStateData(object):
     check_results_directory= './' #Path to verifRsl* files.
     internal_forces_results_directory= './' #Path to esf_el* f
@@ -65,6 +81,10 @@ class LimitStateData(object):
                                one desired for the displaying of internal forces
                                (The use of this factor won't be allowed in
                                 future versions)
+        :param analysisToPerform: analysis procedure (defaults to 
+                                  defaultAnalysis, use an instance of
+                                  LinearSuperpositionAnalysis to speed up
+                                  the analysis of linear models).
         :param lstSteelBeams: list of steel beams to analyze (defaults to None)
         '''
         if fConvIntForc != 1.0:
@@ -85,6 +85,14 @@ class SolutionProcedure(object):
         self.solver= self.soe.newSolver("band_spd_lin_lapack_solver")
         self.analysis= self.solu.newAnalysis("static_analysis","analysisAggregation","")
         return self.analysis
+
+    def simpleLinearSuperposition(self,prb):
+        '''Linear static analysis that obtains the results of each load
+           combination by superposition of the load pattern solutions
+           (the stiffness matrix is factored only once).'''
+        self.simpleStaticLinear(prb)
+        self.analysis= self.solu.newAnalysis("linear_superposition_analysis","analysisAggregation","")
+        return self.analysis
       
     def plainLinearNewmark(self,prb):
         self.solu= prb.getSoluProc
@@ -270,6 +278,11 @@ def simple_static_linear(prb):
     solution= SolutionProcedure()
     return solution.simpleStaticLinear(prb)
 
+#Linear static analysis by superposition of load pattern solutions.
+def simple_linear_superposition(prb):
+    solution= SolutionProcedure()
+    return solution.simpleLinearSuperposition(prb)
+
 #Linear static analysis.
 def simple_newton_raphson(prb):
     solution= SolutionProcedure()
@@ -375,6 +375,8 @@
 #define GraphNUMBERER_TAG_SimpleNumberer   	2
 #define GraphNUMBERER_TAG_MyRCM   		3
 #define GraphNUMBERER_TAG_Metis   		4
+#define GraphNUMBERER_TAG_AMD   		5
+#define GraphNUMBERER_TAG_NestedDissection   	6
 
 
 #define AnaMODEL_TAGS_AnalysisModel 	1
@@ -457,6 +459,7 @@
 #define LinSOE_TAGS_SparseGenRowLinSOE		20
 #define LinSOE_TAGS_DistributedSparseGenRowLinSOE       21
 #define LinSOE_TAGS_DistributedDiagonalSOE 22
+#define LinSOE_TAGS_SymSparseColLinSOE 23
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
 #define SOLVER_TAGS_BandGenLinLapackSolver  	2
@@ -480,6 +483,10 @@
 #define SOLVER_TAGS_DiagonalDirectSolver 20
 #define SOLVER_TAGS_PetscSparseSeqSolver 21
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
+#define SOLVER_TAGS_SupernodalLDLSolver 23
+#define SOLVER_TAGS_PCGSolver 24
+#define SOLVER_TAGS_MINRESSolver 25
+#define SOLVER_TAGS_GMRESSolver 26
 
 
 #define RECORDER_TAGS_ElementRecorder		1
@@ -210,10 +210,20 @@ void XC::Domain::setDeadSRF(const double &d)
 bool XC::Domain::addElement(Element *element)
   { return mesh.addElement(element); }
 
+//! @brief Adds to the domain the elements being passed as parameter
+//! (see Mesh::addElements).
+size_t XC::Domain::addElements(const std::vector<Element *> &elements)
+  { return mesh.addElements(elements); }
+
 //! @brief Adds to the domain the node being passed as parameter.
 bool XC::Domain::addNode(Node * node)
   { return mesh.addNode(node); }
 
+//! @brief Adds to the domain the nodes being passed as parameter
+//! (see Mesh::addNodes).
+size_t XC::Domain::addNodes(const std::vector<Node *> &nodes)
+  { return mesh.addNodes(nodes); }
+
 //! @brief Adds a single freedom constraint to the domain.
 //!
 //! To add the single point constraint pointed to by spConstraint to the
@@ -425,7 +435,11 @@ bool XC::Domain::removeMRMFreedom_Constraint(int tag)
 //! addComponent(theLd)} on the container for the LoadPatterns. The domain
 //! is responsible for invoking {\em setDomain(this)} on the load. The
 //! call returns \p true if the load was added, otherwise a warning is
-//! raised and \p false is returned.
+//! raised and \p false is returned. The domain is marked as changed
+//! only if the load pattern has single freedom constraints (as in
+//! removeLoadPattern), so activating load patterns doesn't force
+//! the analysis to renumber the DOFs and to assemble and factor
+//! the system of equations again.
 //!
 //! @param lp: pointer to the load pattern to ask for.
 bool XC::Domain::addLoadPattern(LoadPattern *lp)
@@ -434,7 +448,10 @@ bool XC::Domain::addLoadPattern(LoadPattern *lp)
     if(result)
       {
         lp->setDomain(this);
-        domainChange();
+        // the constraint handlers have to be redone
+        // only if the load pattern has SPs.
+        if(lp->getNumSPs()>0)
+          domainChange();
       }
     else
       {
@@ -801,12 +818,13 @@ int XC::Domain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 //! and elements to set there committed state as given by their current
 //! state. The domain will then set its committed time variable to be
 //! equal to the current time and lastly increments its commit tag by \f$1\f$.  
+//! Returns the value returned by the commit of the mesh (0 if successful).
 int XC::Domain::commit(void)
   {
     //
     // first invoke commit on all nodes and elements in the domain
     //
-    mesh.commit();
+    const int retval= mesh.commit();
 
     // set the new committed time in the domain
     setCommittedTime(timeTracker.getCurrentTime());
@@ -815,7 +833,7 @@ int XC::Domain::commit(void)
 
     // update the commitTag
     commitTag++;
-    return 0;
+    return retval;
   }
 
 //! @brief Return the domain to its last committed state.
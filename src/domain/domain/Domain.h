@@ -151,7 +151,9 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
     // methods to populate a domain
     virtual bool addElement(Element *);
+    size_t addElements(const std::vector<Element *> &);
     virtual bool addNode(Node *);
+    size_t addNodes(const std::vector<Node *> &);
     virtual bool addSFreedom_Constraint(SFreedom_Constraint *);
     virtual bool addMFreedom_Constraint(MFreedom_Constraint *);
     virtual bool addMRMFreedom_Constraint(MRMFreedom_Constraint *);
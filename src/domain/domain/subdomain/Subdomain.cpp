@@ -345,13 +345,13 @@ int XC::Subdomain::getNumNodes(void) const
 //! all the Nodes in the Subdomain, invoking commitState() on the Nodes.
 int XC::Subdomain::commit(void)
   {
-    Domain::commit();
+    const int retval= Domain::commit();
 
     NodeIter &theNodes = this->getNodes();
     Node *nodePtr;
     while ((nodePtr = theNodes()) != nullptr)
       nodePtr->commitState();
-    return 0;
+    return retval;
   }
 
 int XC::Subdomain::revertToLastCommit(void)
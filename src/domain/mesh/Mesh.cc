@@ -52,6 +52,9 @@
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
 
 #include "utility/actor/actor/MovableVector.h"
+#include "utility/parallel/ThreadPool.h"
+#include "utility/matrix/ID.h"
+#include <boost/python/extract.hpp>
 
 //! @brief Frees memory occupied by mesh components.
 //! this calls delete on all components of the model,
@@ -113,7 +116,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), numThreads(1)
   {
     alloc_containers();
     alloc_iters();
@@ -125,7 +128,7 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this), numThreads(1)
   {
     // init the iters
     alloc_iters();
@@ -144,7 +147,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), numThreads(1)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -217,6 +220,43 @@ void XC::Mesh::add_elements_to_domain(void)
       }
   }
 
+//! @brief Adds the component being passed as parameter to the
+//! container (used by addNode, addNodes, addElement and addElements).
+//!
+//! Checks that the pointer is not null and that no other component
+//! with the same tag exists in the container. Returns true if the
+//! component is added.
+//! @param container: container for the nodes or the elements.
+//! @param c: component to add.
+//! @param what: name of the component type (for the error messages).
+//! @param functionName: name of the calling method (for the error messages).
+bool XC::Mesh::add_component(TaggedObjectStorage &container,TaggedObject *c,const std::string &what,const std::string &functionName)
+  {
+    if(!c)
+      {
+        std::cerr << getClassName() << "::" << functionName
+	          << "; pointer to " << what << " is null." << std::endl;
+        return false;
+      }
+    const int tag= c->getTag();
+
+    // check if a component with the same tag already exists in the container
+    if(container.getComponentPtr(tag))
+      {
+        std::clog << getClassName() << "::" << functionName
+		  << "; " << what << " with tag " << tag
+		  << " already exists in model.\n";
+        return false;
+      }
+
+    const bool retval= container.addComponent(c);
+    if(!retval)
+      std::cerr << getClassName() << "::" << functionName
+		<< "; " << what << " with tag " << tag
+		<< " could not be added to container.\n";
+    return retval;
+  }
+
 //! @brief Appends to the mesh the element being passed as parameter.
 //!
 //! To add the element pointed to by theElementPtr to the domain. 
@@ -230,33 +270,10 @@ void XC::Mesh::add_elements_to_domain(void)
 //! displayed ant false is returned.
 bool XC::Mesh::addElement(Element *element)
   {
-    if(!element)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-	          << "; pointer to element is null." << std::endl;
-        return false;
-      }
-    const int eleTag = element->getTag();
-
-    // check if an Element with the same tag already exists in the XC::Mesh
-    TaggedObject *other = theElements->getComponentPtr(eleTag);
-    if(other)
-      {
-        std::clog << getClassName() << "::" << __FUNCTION__
-		  << "; element with tag " << eleTag
-		  << " already exists in model.\n";
-        return false;
-      }
-
-    // add the element to the container object for the elements
-    bool result = theElements->addComponent(element);
-    if(result)
+    const bool retval= add_component(*theElements,element,"element",__FUNCTION__);
+    if(retval)
       add_element_to_domain(element);
-    else
-      std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; element " << eleTag
-		<< " could not be added to container.\n";
-    return result;
+    return retval;
   }
 
 //! @brief Actualiza los límites del domain.
@@ -320,24 +337,66 @@ void XC::Mesh::add_nodes_to_domain(void)
 //! node was added, otherwise an error is printed and false is returned.
 bool XC::Mesh::addNode(Node * node)
   {
-    int nodTag = node->getTag();
+    const bool retval= add_component(*theNodes,node,"node",__FUNCTION__);
+    if(retval)
+      add_node_to_domain(node);
+    return retval;
+  }
 
-    TaggedObject *other = theNodes->getComponentPtr(nodTag);
-    if(other)
+//! @brief Adds to the mesh the nodes being passed as parameter.
+//!
+//! Same as addNode but the domain is marked as changed and the
+//! KD-tree is rebuilt only once for the whole batch.
+//! Returns the number of nodes added.
+size_t XC::Mesh::addNodes(const std::vector<Node *> &nodes)
+  {
+    Domain *dom= getDomain();
+    std::vector<Node *> added;
+    added.reserve(nodes.size());
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
       {
-        std::clog << getClassName() << "::" << __FUNCTION__
-	          << "; node with tag " << nodTag
-		  << " already exists in model.\n";
-        return false;
+        Node *node= *i;
+        if(add_component(*theNodes,node,"node",__FUNCTION__))
+          {
+            node->setDomain(dom);
+            update_bounds(node->getCrds());
+            added.push_back(node);
+          }
       }
-    bool result= theNodes->addComponent(node);
-    if(result)
-      add_node_to_domain(node);
-    else
-      std::cerr << getClassName() << "::" << __FUNCTION__
-	        << "; node with tag " << nodTag
-		<< " could not be added to container.\n";
-    return result;
+    if(!added.empty())
+      {
+        dom->domainChange();
+        kdtreeNodes.insert(added.begin(),added.end());
+      }
+    return added.size();
+  }
+
+//! @brief Adds to the mesh the elements being passed as parameter.
+//!
+//! Same as addElement but the domain is marked as changed and the
+//! KD-tree is rebuilt only once for the whole batch.
+//! Returns the number of elements added.
+size_t XC::Mesh::addElements(const std::vector<Element *> &elements)
+  {
+    Domain *dom= getDomain();
+    std::vector<Element *> added;
+    added.reserve(elements.size());
+    for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        Element *element= *i;
+        if(add_component(*theElements,element,"element",__FUNCTION__))
+          {
+            element->setDomain(dom);
+            element->update();
+            added.push_back(element);
+          }
+      }
+    if(!added.empty())
+      {
+        dom->domainChange();
+        kdtreeElements.insert(added.begin(),added.end());
+      }
+    return added.size();
   }
 
 
@@ -353,18 +412,16 @@ bool XC::Mesh::addNode(Node * node)
 //! domainChange()} on itself before a pointer to the element is returned. 
 bool XC::Mesh::removeElement(int tag)
   {
+    // remove the object from the KD-tree (before it's removed
+    // from the container).
+    Element *elem= getElement(tag);
+    if(elem) kdtreeElements.erase(*elem);
+
     // remove the object from the container
     bool res= theElements->removeComponent(tag);
     
     if(res)
-      {
-        Domain *dom= getDomain();
-
-        Element *elem= dom->getElement(tag);
-        if(elem) kdtreeElements.erase(*elem);
-
-        dom->domainChange(); //mark the domain as having changed
-      }
+      getDomain()->domainChange(); //mark the domain as having changed
     return res;
   }
 
@@ -379,19 +436,16 @@ bool XC::Mesh::removeElement(int tag)
 bool XC::Mesh::removeNode(int tag)
   {
 
+    // remove the object from the KD-tree (before it's removed
+    // from the container).
+    Node *nod= getNode(tag);
+    if(nod) kdtreeNodes.erase(*nod);
+
     // remove the object from the container
     bool res= theNodes->removeComponent(tag);
 
     if(res)
-      {
-        Domain *dom= getDomain();
-
-        Node *nod= dom->getNode(tag);
-        if(nod) kdtreeNodes.erase(*nod);
-
-        // mark the domain has having changed
-        dom->domainChange();
-      }
+      getDomain()->domainChange(); // mark the domain has having changed
     return res;
   }
 
@@ -461,6 +515,57 @@ const XC::Element *XC::Mesh::getNearestElement(const Pos3d &p) const
     return this_no_const->getNearestElement(p);
   }
 
+//! @brief Returns the tags of the objects being passed as parameter.
+template <class T>
+static XC::ID get_tags(const std::vector<const T *> &objs)
+  {
+    XC::ID retval(objs.size());
+    for(size_t i= 0;i<objs.size();i++)
+      retval[i]= objs[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the positions of the Python list being passed as parameter.
+static std::vector<Pos3d> get_positions(const boost::python::list &l)
+  {
+    const size_t sz= len(l);
+    std::vector<Pos3d> retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= boost::python::extract<Pos3d>(l[i]);
+    return retval;
+  }
+
+//! @brief Returns a Python list with the tags of each vector of objects.
+template <class T>
+static boost::python::list get_tags_list(const std::vector<std::vector<const T *> > &v)
+  {
+    boost::python::list retval;
+    for(typename std::vector<std::vector<const T *> >::const_iterator i= v.begin();i!=v.end();i++)
+      retval.append(get_tags(*i));
+    return retval;
+  }
+
+//! @brief Returns the tags of the k elements closest to the point
+//! being passed as parameter (sorted by distance).
+XC::ID XC::Mesh::getKNearestElementTags(const Pos3d &p,const size_t &k) const
+  { return get_tags(kdtreeElements.getKNearest(p,k)); }
+
+//! @brief Returns the tags of the elements whose distance to the point
+//! being passed as parameter is not greater than r (sorted by distance).
+XC::ID XC::Mesh::getElementTagsInRadius(const Pos3d &p,const double &r) const
+  { return get_tags(kdtreeElements.getInRadius(p,r)); }
+
+//! @brief Returns a list with the tags of the k elements closest to each
+//! one of the points of the list (queries are run using numThreads threads).
+boost::python::list XC::Mesh::getKNearestElementTagsPy(const boost::python::list &l,const size_t &k) const
+  { return get_tags_list(kdtreeElements.getKNearest(get_positions(l),k,numThreads)); }
+
+//! @brief Returns a list with the tags of the elements whose distance to
+//! each one of the points of the list is not greater than r (queries
+//! are run using numThreads threads).
+boost::python::list XC::Mesh::getElementTagsInRadiusPy(const boost::python::list &l,const double &r) const
+  { return get_tags_list(kdtreeElements.getInRadius(get_positions(l),r,numThreads)); }
+
 //! @brief Returns true if the mesh has a node with the tag being passed as parameter.
 bool XC::Mesh::existNode(int tag)
  { return theNodes->existComponent(tag); }
@@ -501,6 +606,27 @@ const XC::Node *XC::Mesh::getNearestNode(const Pos3d &p) const
     return this_no_const->getNearestNode(p);
   }
 
+//! @brief Returns the tags of the k nodes closest to the point
+//! being passed as parameter (sorted by distance).
+XC::ID XC::Mesh::getKNearestNodeTags(const Pos3d &p,const size_t &k) const
+  { return get_tags(kdtreeNodes.getKNearest(p,k)); }
+
+//! @brief Returns the tags of the nodes whose distance to the point
+//! being passed as parameter is not greater than r (sorted by distance).
+XC::ID XC::Mesh::getNodeTagsInRadius(const Pos3d &p,const double &r) const
+  { return get_tags(kdtreeNodes.getInRadius(p,r)); }
+
+//! @brief Returns a list with the tags of the k nodes closest to each
+//! one of the points of the list (queries are run using numThreads threads).
+boost::python::list XC::Mesh::getKNearestNodeTagsPy(const boost::python::list &l,const size_t &k) const
+  { return get_tags_list(kdtreeNodes.getKNearest(get_positions(l),k,numThreads)); }
+
+//! @brief Returns a list with the tags of the nodes whose distance to
+//! each one of the points of the list is not greater than r (queries
+//! are run using numThreads threads).
+boost::python::list XC::Mesh::getNodeTagsInRadiusPy(const boost::python::list &l,const double &r) const
+  { return get_tags_list(kdtreeNodes.getInRadius(get_positions(l),r,numThreads)); }
+
 //! @brief Freezes inactive nodes (prescribes zero displacement for all DOFs
 //! on inactive nodes).
 void XC::Mesh::freeze_dead_nodes(const std::string &nmbLocker)
@@ -766,21 +892,102 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
     return result;
   }
 
-//! @brief Commits mesh state.
-int XC::Mesh::commit(void)
+//! @brief Set the number of threads used to update, commit,... the nodes
+//! and elements of the mesh (a value of zero means as many threads as
+//! the hardware supports).
+//!
+//! The parallel sweeps are used only if all the elements of the mesh
+//! can be updated concurrently (see Element::isThreadSafe).
+void XC::Mesh::setNumThreads(const size_t &n)
   {
-    // invoke commit on all nodes and elements in the mesh
+    if(n>0)
+      numThreads= n;
+    else
+      numThreads= ThreadPool::getDefaultNumThreads();
+  }
+
+//! @brief Return the pointers to the nodes of the mesh.
+std::vector<XC::Node *> XC::Mesh::get_node_ptrs(void)
+  {
+    std::vector<Node *> retval;
+    retval.reserve(getNumNodes());
     Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
+    NodeIter &theNodeIter= this->getNodes();
+    while((nodePtr= theNodeIter()) != nullptr)
+      retval.push_back(nodePtr);
+    return retval;
+  }
 
+//! @brief Return the pointers to the elements of the mesh.
+std::vector<XC::Element *> XC::Mesh::get_element_ptrs(void)
+  {
+    std::vector<Element *> retval;
+    retval.reserve(getNumElements());
     Element *elePtr= nullptr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->commitState(); }
+    ElementIter &theElemIter= this->getElements();
+    while((elePtr= theElemIter()) != nullptr)
+      retval.push_back(elePtr);
+    return retval;
+  }
 
-    return 0;
+//! @brief Return true if the elements being passed as parameter
+//! must be processed concurrently.
+bool XC::Mesh::use_threads(const std::vector<Element *> &elements) const
+  {
+    bool retval= (numThreads>1);
+    if(retval)
+      for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+        if(!(*i)->isThreadSafe())
+          {
+            retval= false;
+            break;
+          }
+    return retval;
+  }
+
+//! @brief Call f on each of the objects being passed as parameter
+//! and return the sum of the returned values.
+//!
+//! If nThreads is greater than one the calls are made concurrently;
+//! each thread accumulates its own partial sum and then they are added
+//! in thread order.
+template <class T, class F>
+static int sum_over(const std::vector<T *> &objects, const size_t &nThreads, const F &f)
+  {
+    int retval= 0;
+    if(nThreads<2)
+      {
+        for(typename std::vector<T *>::const_iterator i= objects.begin();i!=objects.end();i++)
+          retval+= f(*i);
+      }
+    else
+      {
+        XC::ThreadPool &pool= XC::ThreadPool::getThreadPool();
+        std::vector<int> partial(pool.getNumThreads(nThreads),0);
+        pool.parallel_for(0,objects.size(),[&](const size_t &i, const size_t &iThread)
+          { partial[iThread]+= f(objects[i]); },nThreads);
+        for(std::vector<int>::const_iterator i= partial.begin();i!=partial.end();i++)
+          retval+= *i;
+      }
+    return retval;
+  }
+
+//! @brief Commits the state of the nodes and elements of the mesh
+//! (see setNumThreads). Returns the sum of the values returned by
+//! the nodes and elements (0 if successful).
+int XC::Mesh::commit(void)
+  {
+    const std::vector<Element *> elements= get_element_ptrs();
+    const size_t nThreads= use_threads(elements) ? numThreads : 1;
+    // invoke commit on all nodes and elements in the mesh
+    int retval= sum_over(get_node_ptrs(),nThreads,[](Node *n)
+                         { return n->commitState(); });
+    retval+= sum_over(elements,nThreads,[](Element *e)
+                      { return e->commitState(); });
+    if(retval != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; mesh failed in commit.\n";
+    return retval;
   }
 
 //! @brief Returns the mesh to its last committed state.
@@ -789,17 +996,12 @@ int XC::Mesh::revertToLastCommit(void)
     //
     // first invoke revertToLastCommit  on all nodes and elements in the mesh
     //
-
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
-
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->revertToLastCommit(); }
-
+    const std::vector<Element *> elements= get_element_ptrs();
+    const size_t nThreads= use_threads(elements) ? numThreads : 1;
+    sum_over(get_node_ptrs(),nThreads,[](Node *n)
+             { return n->revertToLastCommit(); });
+    sum_over(elements,nThreads,[](Element *e)
+             { return e->revertToLastCommit(); });
     return update();
   }
 
@@ -810,34 +1012,28 @@ int XC::Mesh::revertToStart(void)
     // first invoke revertToStart  on all nodes and
     // elements in the mesh
     //
-
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToStart();
-
-    Element *elePtr;
-    ElementIter &theElements = this->getElements();
-    while((elePtr = theElements()) != 0)
-      { elePtr->revertToStart(); }
-
+    const std::vector<Element *> elements= get_element_ptrs();
+    const size_t nThreads= use_threads(elements) ? numThreads : 1;
+    sum_over(get_node_ptrs(),nThreads,[](Node *n)
+             { return n->revertToStart(); });
+    sum_over(elements,nThreads,[](Element *e)
+             { return e->revertToStart(); });
     return update();
   }
 
 //! @brief Update the element's state.
 //! 
 //! Called by the domain to update the state of the
-//! mesh. Iterates over all the elements and invokes {\em update()}. 
+//! mesh. Iterates over all the elements and invokes {\em update()}
+//! (concurrently if more than one thread is used, see setNumThreads).
+//! Returns the sum of the values returned by the elements. 
 int XC::Mesh::update(void)
   {
-    int ok = 0;
-
+    const std::vector<Element *> elements= get_element_ptrs();
+    const size_t nThreads= use_threads(elements) ? numThreads : 1;
     // invoke update on all the ele's
-    ElementIter &theEles = this->getElements();
-    Element *theEle;
-    while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
-
+    const int ok= sum_over(elements,nThreads,[](Element *e)
+                           { return e->update(); });
     if(ok != 0)
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; mesh failed in update.\n";
@@ -35,12 +35,14 @@
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
 #include "element/utils/KDTreeElements.h"
+#include <boost/python/list.hpp>
 
 class Pos3d;
 
 namespace XC {
 class Element;
 class Node;
+class ID;
 
 class ElementIter;
 class NodeIter;
@@ -51,6 +53,7 @@ class Graph;
 class NodeGraph;
 class ElementGraph;
 class FEM_ObjectBroker;
+class TaggedObject;
 class TaggedObjectStorage;
 class RayleighDampingFactors;
 
@@ -84,16 +87,21 @@ class Mesh: public MeshComponentContainer
     int tagNodeCheckReactionException;//!< Exception for checking reactions (see Domain::checkNodalReactions).
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
+    size_t numThreads; //!< Number of threads used to update, commit,... nodes and elements.
 
     void alloc_containers(void);
     void alloc_iters(void);
     bool check_containers(void) const;
     void init_bounds(void);
     void update_bounds(const Vector &);
+    bool add_component(TaggedObjectStorage &,TaggedObject *,const std::string &,const std::string &);
     void add_node_to_domain(Node *);
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    std::vector<Node *> get_node_ptrs(void);
+    std::vector<Element *> get_element_ptrs(void);
+    bool use_threads(const std::vector<Element *> &) const;
 
     Mesh(const Mesh &otra);
     Mesh &operator=(const Mesh &otra);
@@ -110,9 +118,11 @@ class Mesh: public MeshComponentContainer
 
     // methods to populate a mesh
     virtual bool addNode(Node *);
+    size_t addNodes(const std::vector<Node *> &);
     virtual bool removeNode(int tag);
 
     virtual bool addElement(Element *);
+    size_t addElements(const std::vector<Element *> &);
     virtual bool removeElement(int tag);
 
     virtual void clearAll(void);
@@ -148,11 +158,19 @@ class Mesh: public MeshComponentContainer
     virtual const Element *getElement(int tag) const;
     Element *getNearestElement(const Pos3d &p);
     const Element *getNearestElement(const Pos3d &p) const;
+    ID getKNearestElementTags(const Pos3d &,const size_t &) const;
+    ID getElementTagsInRadius(const Pos3d &,const double &) const;
+    boost::python::list getKNearestElementTagsPy(const boost::python::list &,const size_t &) const;
+    boost::python::list getElementTagsInRadiusPy(const boost::python::list &,const double &) const;
     bool existNode(int tag);
     virtual Node *getNode(int tag);
     virtual const Node *getNode(int tag) const;
     Node *getNearestNode(const Pos3d &p);
     const Node *getNearestNode(const Pos3d &p) const;
+    ID getKNearestNodeTags(const Pos3d &,const size_t &) const;
+    ID getNodeTagsInRadius(const Pos3d &,const double &) const;
+    boost::python::list getKNearestNodeTagsPy(const boost::python::list &,const size_t &) const;
+    boost::python::list getNodeTagsInRadiusPy(const boost::python::list &,const double &) const;
 
     // methods to query the state of the mesh
     virtual int getNumElements(void) const;
@@ -177,6 +195,11 @@ class Mesh: public MeshComponentContainer
     virtual Graph &getElementGraph(void);
     virtual Graph &getNodeGraph(void);
 
+    //! @brief Return the number of threads used to update, commit,...
+    //! the nodes and elements of the mesh.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
     virtual int commit(void);
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
@@ -63,6 +63,11 @@ class ElemWithMaterial : public ElementBase<NNODOS>
     void setPhysicalProperties(const PhysProp &);
     inline virtual std::set<std::string> getMaterialNames(void) const
       { return physicalProperties.getMaterialNames(); }
+    //! @brief The element can't be evaluated concurrently with
+    //! other elements if any of its materials is not thread safe
+    //! (see Material::isThreadSafe).
+    inline virtual bool isThreadSafe(void) const
+      { return (ElementBase<NNODOS>::isThreadSafe() && physicalProperties.isThreadSafe()); }
   };
 
 template <int NNODOS,class PhysProp>
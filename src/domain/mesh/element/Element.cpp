@@ -87,9 +87,9 @@
 #include "utility/actor/actor/CommMetaData.h"
 #include "vtkCellType.h"
 
-std::deque<XC::Matrix> XC::Element::theMatrices;
-std::deque<XC::Vector> XC::Element::theVectors1;
-std::deque<XC::Vector> XC::Element::theVectors2;
+thread_local std::deque<XC::Matrix> XC::Element::theMatrices;
+thread_local std::deque<XC::Vector> XC::Element::theVectors1;
+thread_local std::deque<XC::Vector> XC::Element::theVectors2;
 double XC::Element::dead_srf= 1e-6;//Stiffness reduction factor for dead (non active) elements.
 XC::DefaultTag XC::Element::defaultTag;
 
@@ -140,6 +140,24 @@ int XC::Element::update(void)
 int XC::Element::revertToStart(void)
   { return 0; }
 
+//! @brief Returns the index of the work arrays (matrix and vectors) of size
+//! ndof, creating them if they don't exist yet.
+//!
+//! The work arrays are thread local so the index is searched in the
+//! containers of the calling thread (it may differ from the one stored
+//! in the element if the containers were filled by other thread).
+size_t XC::Element::get_work_arrays_index(const int &ndof)
+  {
+    const size_t numMatrices= theMatrices.size();
+    for(size_t i=0; i<numMatrices; i++)
+      if(theMatrices[i].noRows() == ndof)
+        return i;
+    theMatrices.push_back(Matrix(ndof,ndof));
+    theVectors1.push_back(Vector(ndof));
+    theVectors2.push_back(Vector(ndof));
+    return numMatrices;
+  }
+
 //! @brief Set Rayleigh damping factors.
 int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) const
   {
@@ -148,18 +166,7 @@ int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) con
     // check that memory has been allocated to store compute/return
     // damping matrix & residual force calculations
     if(index == -1)
-      {
-        int numDOF = this->getNumDOF();
-
-        setup_matrices(theMatrices,numDOF);
-        if(theVectors1.size()<theMatrices.size())
-          {
-            Vector theVector1(numDOF);
-            Vector theVector2(numDOF);
-            theVectors1.push_back(theVector1);
-            theVectors2.push_back(theVector2);
-         }
-      }
+      index= get_work_arrays_index(getNumDOF());
     // if need storage for Kc go get it
     if(rayFactors.getBetaKc() != 0.0)
       Kc= Matrix(this->getTangentStiff());
@@ -234,7 +241,8 @@ const XC::Matrix &XC::Element::getDamp(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    const size_t iw= get_work_arrays_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[iw];
     compute_damping_matrix(theMatrix);
     // return the computed matrix
     return theMatrix;
@@ -255,7 +263,8 @@ const XC::Matrix &XC::Element::getMass(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // zero the matrix & return it
-    Matrix &theMatrix= theMatrices[index];
+    const size_t iw= get_work_arrays_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[iw];
     theMatrix.Zero();
     return theMatrix;
   }
@@ -267,9 +276,10 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Zeroes dumping factors.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const size_t iw= get_work_arrays_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[iw];
+    Vector &theVector= theVectors2[iw];
+    Vector &theVector2= theVectors1[iw];
 
     //
     // perform: R = P(U) - Pext(t);
@@ -323,7 +333,7 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
 //! node.
 const XC::Vector &XC::Element::getNodeResistingComponents(const size_t &iNod,const Vector &rf) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     const int ndof= getNodePtrs()[iNod]->getNumberDOF(); // number of DOFs in the node.
     retval.resize(ndof);
     for(int i=0;i<ndof;i++)
@@ -391,9 +401,10 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const size_t iw= get_work_arrays_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[iw];
+    Vector &theVector= theVectors2[iw];
+    Vector &theVector2= theVectors1[iw];
 
     //
     // perform: R = (rayFactors.getAlphaM() * M + rayFactors.getBetaK0() * K0 + rayFactors.getBetaK() * K) * v
@@ -424,6 +435,13 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
 bool XC::Element::isSubdomain(void)
   { return false; }
 
+//! @brief Returns true if the element state determination (tangent,
+//! resisting force,...) of different elements can run concurrently
+//! (see IncrementalIntegrator::addElementTangents). Elements that
+//! share mutable data between instances must redefine this method.
+bool XC::Element::isThreadSafe(void) const
+  { return true; }
+
 //! setResponse() is a method invoked to determine if the element
 //! will respond to a request for a certain of information. The
 //! information requested of the element is passed in the array of char
@@ -477,19 +495,19 @@ int XC::Element::activateParameter(int parameterID)
 
 const XC::Vector &XC::Element::getResistingForceSensitivity(int gradNumber)
   {
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getInitialStiffSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getMassSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
@@ -508,7 +526,8 @@ const XC::Matrix &XC::Element::getDampSensitivity(int gradNumber)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    const size_t iw= get_work_arrays_index(getNumDOF());
+    Matrix &theMatrix= theMatrices[iw];
     theMatrix.Zero();
     if(rayFactors.getAlphaM() != 0.0)
       theMatrix.addMatrix(0.0, this->getMassSensitivity(gradNumber), rayFactors.getAlphaM());
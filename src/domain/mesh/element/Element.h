@@ -118,9 +118,10 @@ class Element: public MeshComponent
   private:
     int nodeIndex;
 
-    static std::deque<Matrix> theMatrices;
-    static std::deque<Vector> theVectors1;
-    static std::deque<Vector> theVectors2;
+    static thread_local std::deque<Matrix> theMatrices;
+    static thread_local std::deque<Vector> theVectors1;
+    static thread_local std::deque<Vector> theVectors2;
+    static size_t get_work_arrays_index(const int &);
 
     void compute_damping_matrix(Matrix &) const;
     static DefaultTag defaultTag; //<! default tag for next new element.
@@ -176,6 +177,7 @@ class Element: public MeshComponent
     virtual int revertToStart(void);
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void) const;
 
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -176,7 +176,7 @@ int XC::QuadBase4N<PhysProp>::addLoad(ElementalLoad *theLoad, double loadFactor)
       {
         if(const BidimStrainLoad *strainLoad= dynamic_cast<const BidimStrainLoad *>(theLoad)) //Prescribed strains.
           {
-            static std::vector<Vector> initStrains;
+            static thread_local std::vector<Vector> initStrains;
             initStrains= strainLoad->getStrains();
             for(std::vector<Vector>::iterator i= initStrains.begin();i!=initStrains.end();i++)
               (*i)*= loadFactor;
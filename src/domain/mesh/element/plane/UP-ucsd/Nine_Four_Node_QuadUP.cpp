@@ -52,14 +52,14 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "domain/load/ElementalLoad.h"
 
-XC::Matrix XC::NineFourNodeQuadUP::K(22,22);
-XC::Vector XC::NineFourNodeQuadUP::P(22);
+thread_local XC::Matrix XC::NineFourNodeQuadUP::K(22,22);
+thread_local XC::Vector XC::NineFourNodeQuadUP::P(22);
 
-double XC::NineFourNodeQuadUP::shgu[3][9][9];
+thread_local double XC::NineFourNodeQuadUP::shgu[3][9][9];
 
-double XC::NineFourNodeQuadUP::shgp[3][4][4];
+thread_local double XC::NineFourNodeQuadUP::shgp[3][4][4];
 
-double XC::NineFourNodeQuadUP::shgq[3][9][4];
+thread_local double XC::NineFourNodeQuadUP::shgq[3][9][4];
 
 double XC::NineFourNodeQuadUP::shlu[3][9][9];
 
@@ -71,11 +71,11 @@ double XC::NineFourNodeQuadUP::wu[9];
 
 double XC::NineFourNodeQuadUP::wp[4];
 
-double XC::NineFourNodeQuadUP::dvolu[9];
+thread_local double XC::NineFourNodeQuadUP::dvolu[9];
 
-double XC::NineFourNodeQuadUP::dvolp[4];
+thread_local double XC::NineFourNodeQuadUP::dvolp[4];
 
-double XC::NineFourNodeQuadUP::dvolq[4];
+thread_local double XC::NineFourNodeQuadUP::dvolq[4];
 
 const int XC::NineFourNodeQuadUP::nintu=9;
 
@@ -197,7 +197,7 @@ void XC::NineFourNodeQuadUP::setDomain(Domain *theDomain)
 int XC::NineFourNodeQuadUP::update(void)
   {
 
-    static double u[2][9];
+    static thread_local double u[2][9];
 
     for(int i = 0; i < nenu; i++)
       {
@@ -215,7 +215,7 @@ int XC::NineFourNodeQuadUP::update(void)
 	  }
       }
 
-    static Vector eps(3);
+    static thread_local Vector eps(3);
     int ret = 0;
     // Determine Jacobian for this integration point
     this->globalShapeFunction(dvolu, wu, nintu, nenu, 0);
@@ -248,8 +248,8 @@ const XC::Matrix &XC::NineFourNodeQuadUP::getTangentStiff() const
   {
 
     int j2, j2m1, ik, ib, jk, jb;
-    static Matrix B(3,nenu*2);
-    static Matrix BTDB(nenu*2,nenu*2);
+    static thread_local Matrix B(3,nenu*2);
+    static thread_local Matrix BTDB(nenu*2,nenu*2);
 
     B.Zero();
     BTDB.Zero();
@@ -318,8 +318,8 @@ const XC::Matrix &XC::NineFourNodeQuadUP::getInitialStiff(void) const
 
 	int j2, j2m1, ik, ib, jk, jb;
 
-	static Matrix B(3,nenu*2);
-	static Matrix BTDB(nenu*2,nenu*2);
+	static thread_local Matrix B(3,nenu*2);
+	static thread_local Matrix BTDB(nenu*2,nenu*2);
 
 	B.Zero();
 	BTDB.Zero();
@@ -388,7 +388,7 @@ const XC::Matrix &XC::NineFourNodeQuadUP::getInitialStiff(void) const
 const XC::Matrix &XC::NineFourNodeQuadUP::getDamp(void) const
   {
 
-    static Matrix Kdamp(22,22);
+    static thread_local Matrix Kdamp(22,22);
 
     Kdamp.Zero();
     if(rayFactors.getBetaK() != 0.0)
@@ -655,7 +655,7 @@ int XC::NineFourNodeQuadUP::addInertiaLoadToUnbalance(const Vector &accel)
 
 
 
-  static Vector ra(22);
+  static thread_local Vector ra(22);
 
   int i, j, ik;
 
@@ -836,7 +836,7 @@ const XC::Vector &XC::NineFourNodeQuadUP::getResistingForceIncInertia(void) cons
 
   int i, j, ik;
 
-  static double a[22];
+  static thread_local double a[22];
 
 
 
@@ -1186,7 +1186,7 @@ void XC::NineFourNodeQuadUP::globalShapeFunction(double *dvol, double *w, int ni
 
   {
 
-    static double coord[2][9], xs[2][2], det, temp;
+    static thread_local double coord[2][9], xs[2][2], det, temp;
 
     for(int i=0; i<3; i++)
       {
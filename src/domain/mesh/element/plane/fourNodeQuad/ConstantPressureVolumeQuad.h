@@ -66,11 +66,11 @@ class ConstantPressureVolumeQuad: public QuadBase4N<NDMaterialPhysicalProperties
     double xl[2][4]; //!< nodal coordinates, two coordinates for each of four nodes
 
     //static data
-    static double matrixData[64];  // array data for matrix
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local double matrixData[64];  // array data for matrix
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
     
     //volume-pressure constants
     static double one3 ;
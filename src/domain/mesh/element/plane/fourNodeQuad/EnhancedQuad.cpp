@@ -61,13 +61,13 @@
 
 
 //static data
-double XC::EnhancedQuad::xl[2][4] ;
-XC::Matrix XC::EnhancedQuad::stiff(8,8) ;
-XC::Vector XC::EnhancedQuad::resid(8) ;
-XC::Matrix XC::EnhancedQuad::mass(8,8) ;
+thread_local double XC::EnhancedQuad::xl[2][4] ;
+thread_local XC::Matrix XC::EnhancedQuad::stiff(8,8) ;
+thread_local XC::Vector XC::EnhancedQuad::resid(8) ;
+thread_local XC::Matrix XC::EnhancedQuad::mass(8,8) ;
 
-double XC::EnhancedQuad::stressData[3][4] ;
-double XC::EnhancedQuad::tangentData[3][3][4] ;
+thread_local double XC::EnhancedQuad::stressData[3][4] ;
+thread_local double XC::EnhancedQuad::tangentData[3][3][4] ;
 
 
 //quadrature data
@@ -194,59 +194,59 @@ const XC::Matrix&  XC::EnhancedQuad::getInitialStiff(void) const
   int i, j, k, p, q ;
   int jj, kk ;
 
-  static double xsj[numberGauss] ;  // determinant jacaobian matrix
+  static thread_local double xsj[numberGauss] ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static XC::Vector strain(nstress) ;  //strain
+  static thread_local XC::Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static XC::Vector residJ(ndf) ; //nodeJ residual
+  static thread_local XC::Vector residJ(ndf) ; //nodeJ residual
 
-  static XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static XC::Matrix stiffKJ(ndf,ndf) ; //nodeKJ stiffness
+  static thread_local XC::Matrix stiffKJ(ndf,ndf) ; //nodeKJ stiffness
 
-  static XC::Vector stress(nstress) ;  //stress
+  static thread_local XC::Vector stress(nstress) ;  //stress
 
-  static XC::Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local XC::Matrix dd(nstress,nstress) ;  //material tangent
 
-  static XC::Matrix J0(ndm,ndm) ; //Jacobian matrix at center of element
+  static thread_local XC::Matrix J0(ndm,ndm) ; //Jacobian matrix at center of element
 
-  static XC::Matrix J0inv(ndm,ndm) ; //inverse of above
+  static thread_local XC::Matrix J0inv(ndm,ndm) ; //inverse of above
 
 
-  static XC::Matrix Kee(nEnhanced,nEnhanced) ;
+  static thread_local XC::Matrix Kee(nEnhanced,nEnhanced) ;
 
-  static XC::Vector residE(nEnhanced) ;
+  static thread_local XC::Vector residE(nEnhanced) ;
 
-  static XC::Vector Umode(ndf) ;
+  static thread_local XC::Vector Umode(ndf) ;
 
-  static XC::Vector dalpha(nEnhanced) ;
+  static thread_local XC::Vector dalpha(nEnhanced) ;
 
-  static XC::Matrix Kue(numberDOF,nEnhanced) ;
+  static thread_local XC::Matrix Kue(numberDOF,nEnhanced) ;
 
-  static XC::Matrix Keu(nEnhanced,numberDOF) ;
+  static thread_local XC::Matrix Keu(nEnhanced,numberDOF) ;
 
-  static XC::Matrix KeeInvKeu(nEnhanced,numberDOF) ;
+  static thread_local XC::Matrix KeeInvKeu(nEnhanced,numberDOF) ;
 
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,nstress) ;
+    static thread_local XC::Matrix BJtran(ndf,nstress) ;
 
-    static XC::Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local XC::Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static XC::Matrix BKtran(ndf,nstress) ;
+    static thread_local XC::Matrix BKtran(ndf,nstress) ;
 
-    static XC::Matrix BJtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BJtranD(ndf,nstress) ;
 
-    static XC::Matrix BKtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BKtranD(ndf,nstress) ;
   //-------------------------------------------------------
 
 
@@ -514,7 +514,7 @@ const XC::Vector &XC::EnhancedQuad::getResistingForce(void) const
 const XC::Vector &XC::EnhancedQuad::getResistingForceIncInertia(void) const
   {
     int tang_flag = 0 ; //don't get the tangent
-    static Vector res(8);
+    static thread_local Vector res(8);
 
     //do tangent and residual here
     formResidAndTangent( tang_flag ) ;
@@ -557,9 +557,9 @@ void XC::EnhancedQuad::formInertiaTerms( int tangFlag ) const
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static XC::Vector momentum(ndf) ;
+  static thread_local XC::Vector momentum(ndf) ;
 
   int i, j, k, p ;
   int jj, kk ;
@@ -664,59 +664,59 @@ void  XC::EnhancedQuad::formResidAndTangent(int tang_flag) const
 
   int success ;
 
-  static double xsj[numberGauss] ;  // determinant jacaobian matrix
+  static thread_local double xsj[numberGauss] ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static XC::Vector strain(nstress) ;  //strain
+  static thread_local XC::Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static XC::Vector residJ(ndf) ; //nodeJ residual
+  static thread_local XC::Vector residJ(ndf) ; //nodeJ residual
 
-  static XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local XC::Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static XC::Matrix stiffKJ(ndf,ndf) ; //nodeKJ stiffness
+  static thread_local XC::Matrix stiffKJ(ndf,ndf) ; //nodeKJ stiffness
 
-  static XC::Vector stress(nstress) ;  //stress
+  static thread_local XC::Vector stress(nstress) ;  //stress
 
-  static XC::Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local XC::Matrix dd(nstress,nstress) ;  //material tangent
 
-  static XC::Matrix J0(ndm,ndm) ; //Jacobian matrix at center of element
+  static thread_local XC::Matrix J0(ndm,ndm) ; //Jacobian matrix at center of element
 
-  static XC::Matrix J0inv(ndm,ndm) ; //inverse of above
+  static thread_local XC::Matrix J0inv(ndm,ndm) ; //inverse of above
 
 
-  static XC::Matrix Kee(nEnhanced,nEnhanced) ;
+  static thread_local XC::Matrix Kee(nEnhanced,nEnhanced) ;
 
-  static XC::Vector residE(nEnhanced) ;
+  static thread_local XC::Vector residE(nEnhanced) ;
 
-  static XC::Vector Umode(ndf) ;
+  static thread_local XC::Vector Umode(ndf) ;
 
-  static XC::Vector dalpha(nEnhanced) ;
+  static thread_local XC::Vector dalpha(nEnhanced) ;
 
-  static XC::Matrix Kue(numberDOF,nEnhanced) ;
+  static thread_local XC::Matrix Kue(numberDOF,nEnhanced) ;
 
-  static XC::Matrix Keu(nEnhanced,numberDOF) ;
+  static thread_local XC::Matrix Keu(nEnhanced,numberDOF) ;
 
-  static XC::Matrix KeeInvKeu(nEnhanced,numberDOF) ;
+  static thread_local XC::Matrix KeeInvKeu(nEnhanced,numberDOF) ;
 
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local XC::Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,nstress) ;
+    static thread_local XC::Matrix BJtran(ndf,nstress) ;
 
-    static XC::Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local XC::Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static XC::Matrix BKtran(ndf,nstress) ;
+    static thread_local XC::Matrix BKtran(ndf,nstress) ;
 
-    static XC::Matrix BJtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BJtranD(ndf,nstress) ;
 
-    static XC::Matrix BKtranD(ndf,nstress) ;
+    static thread_local XC::Matrix BKtranD(ndf,nstress) ;
   //-------------------------------------------------------
 
 
@@ -1100,7 +1100,7 @@ void XC::EnhancedQuad::computeBasis(void) const
 const XC::Matrix &XC::EnhancedQuad::computeB( int node, const double shp[3][4] ) const
 {
 
-  static XC::Matrix B(3,2) ;
+  static thread_local XC::Matrix B(3,2) ;
 
 //---B XC::Matrix in standard {1,2,3} mechanics notation---------------
 //
@@ -1132,13 +1132,13 @@ const XC::Matrix &XC::EnhancedQuad::computeBenhanced( int node,
                                          double j,
                                          const XC::Matrix &Jinv ) const
 {
-  static XC::Matrix B(3,2) ;
+  static thread_local XC::Matrix B(3,2) ;
 
-  static double JinvTran[2][2] ;
+  static thread_local double JinvTran[2][2] ;
 
-  static double shape[2] ;
+  static thread_local double shape[2] ;
 
-  static double parameter ;
+  static thread_local double parameter ;
 
 
   //compute JinvTran
@@ -1193,7 +1193,7 @@ void XC::EnhancedQuad::computeJacobian(double L1, double L2,const double x[2][4]
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static double shp[2][4] ;
+  static thread_local double shp[2][4] ;
 
   double ss = L1 ;
   double tt = L2 ;
@@ -1242,8 +1242,8 @@ void XC::EnhancedQuad::shape2d( double ss, double tt, const double x[2][4], doub
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static XC::Matrix xs(2,2) ;
-  static XC::Matrix sx(2,2) ;
+  static thread_local XC::Matrix xs(2,2) ;
+  static thread_local XC::Matrix sx(2,2) ;
 
   for( i = 0; i < 4; i++ ) {
       shp[2][i] = ( 0.5 + s[i]*ss )*( 0.5 + t[i]*tt ) ;
@@ -1295,7 +1295,7 @@ const XC::Matrix &XC::EnhancedQuad::transpose(const XC::Matrix &M )
 
     static int dim1 = 2 ;
     static int dim2 = 3 ;
-    static Matrix Mtran(dim1,dim2) ;
+    static thread_local Matrix Mtran(dim1,dim2) ;
 
     for(register int i = 0; i < dim1; i++)
       {
@@ -66,10 +66,10 @@ class EnhancedQuad : public QuadBase4N<NDMaterialPhysicalProperties>
     mutable Matrix *Ki;
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
     //quadrature data
     static const double sg[4];
@@ -77,13 +77,13 @@ class EnhancedQuad : public QuadBase4N<NDMaterialPhysicalProperties>
     static const double wg[4];
 
     
-    static double stressData[][4]; //!< stress data
-    static double tangentData[][3][4]; //!< tangent data 
+    static thread_local double stressData[][4]; //!< stress data
+    static thread_local double tangentData[][3][4]; //!< tangent data 
 
 
     //local nodal coordinates, two coordinates for each of four nodes
     //    static double xl[2][4]; 
-    static double xl[][4]; 
+    static thread_local double xl[][4]; 
 
     //save stress and tangent data
     static void saveData(int gp, const Vector &stress,const Matrix &tangent);
@@ -67,10 +67,10 @@
 
 
 //static data
-XC::Matrix  XC::NineNodeMixedQuad::stiff(18,18)   ;
-XC::Vector  XC::NineNodeMixedQuad::resid(18)     ;
-XC::Matrix  XC::NineNodeMixedQuad::mass(18,18)    ;
-double  XC::NineNodeMixedQuad::xl[2][9];
+thread_local XC::Matrix  XC::NineNodeMixedQuad::stiff(18,18)   ;
+thread_local XC::Vector  XC::NineNodeMixedQuad::resid(18)     ;
+thread_local XC::Matrix  XC::NineNodeMixedQuad::mass(18,18)    ;
+thread_local double  XC::NineNodeMixedQuad::xl[2][9];
 
 //quadrature data
 double   XC::NineNodeMixedQuad::root06 = sqrt(0.6) ;
@@ -174,35 +174,35 @@ const XC::Matrix &XC::NineNodeMixedQuad::getInitialStiff(void) const
     int i, j, k, p, q, r, s;
     int jj, kk;
 
-    static double volume;
-    static double xsj;  // determinant jacaobian matrix
-    static double dvol[numberGauss]; //volume element
-    static double gaussPoint[ndm];
-    static double natCoorArray[ndm][numberGauss];
-    static XC::Vector strain(nstress);  //strain
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
-    static double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
-    static double shpBar[nShape][numberNodes][nMixed]; //mean value of shape functions
-    static double rightHandSide[nShape][numberNodes][nMixed];
-    static XC::Vector residJ(ndf); //nodeJ residual
-    static XC::Matrix stiffJK(ndf,ndf); //nodeJK stiffness
-    static XC::Vector stress(nstress);  //stress
-    static XC::Matrix dd(nstress,nstress);  //material tangent
-    static double interp[nMixed];
-    static XC::Matrix Proj(3,3);   //projection matrix
-    static XC::Matrix ProjInv(3,3);
-
-    static XC::Matrix Iden(3,3);
+    static thread_local double volume;
+    static thread_local double xsj;  // determinant jacaobian matrix
+    static thread_local double dvol[numberGauss]; //volume element
+    static thread_local double gaussPoint[ndm];
+    static thread_local double natCoorArray[ndm][numberGauss];
+    static thread_local XC::Vector strain(nstress);  //strain
+    static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
+    static thread_local double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
+    static thread_local double shpBar[nShape][numberNodes][nMixed]; //mean value of shape functions
+    static thread_local double rightHandSide[nShape][numberNodes][nMixed];
+    static thread_local XC::Vector residJ(ndf); //nodeJ residual
+    static thread_local XC::Matrix stiffJK(ndf,ndf); //nodeJK stiffness
+    static thread_local XC::Vector stress(nstress);  //stress
+    static thread_local XC::Matrix dd(nstress,nstress);  //material tangent
+    static thread_local double interp[nMixed];
+    static thread_local XC::Matrix Proj(3,3);   //projection matrix
+    static thread_local XC::Matrix ProjInv(3,3);
+
+    static thread_local XC::Matrix Iden(3,3);
     Iden(0,0) = 1.0;
     Iden(1,1) = 1.0;
     Iden(2,2) = 1.0;
 
     //---------B-matrices------------------------------------
 
-      static XC::Matrix BJ(nstress,ndf);      // B matrix node J
-      static XC::Matrix BJtran(ndf,nstress);
-      static XC::Matrix BK(nstress,ndf);      // B matrix node k
-      static XC::Matrix BJtranD(ndf,nstress);
+      static thread_local XC::Matrix BJ(nstress,ndf);      // B matrix node J
+      static thread_local XC::Matrix BJtran(ndf,nstress);
+      static thread_local XC::Matrix BK(nstress,ndf);      // B matrix node k
+      static thread_local XC::Matrix BJtranD(ndf,nstress);
 
     //-------------------------------------------------------
 
@@ -437,7 +437,7 @@ const XC::Vector &XC::NineNodeMixedQuad::getResistingForceIncInertia(void) const
   {
     int tang_flag = 0; //don't get the tangent
 
-    static Vector res(18);
+    static thread_local Vector res(18);
 
     //do tangent and residual here
     formResidAndTangent( tang_flag );
@@ -482,13 +482,13 @@ void XC::NineNodeMixedQuad::formInertiaTerms( int tangFlag ) const
 
   double dvol; //volume element
 
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
 
-  static XC::Vector momentum(ndf);
+  static thread_local XC::Vector momentum(ndf);
 
-  static XC::Matrix sx(ndm,ndm);
+  static thread_local XC::Matrix sx(ndm,ndm);
 
-  static double GaussPoint[2];
+  static thread_local double GaussPoint[2];
 
   int j, k, p, q, r;
   int jj, kk;
@@ -593,53 +593,53 @@ void XC::NineNodeMixedQuad::formResidAndTangent( int tang_flag ) const
 
   int success;
 
-  static double volume;
+  static thread_local double volume;
 
-  static double xsj;  // determinant jacaobian matrix
+  static thread_local double xsj;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss]; //volume element
+  static thread_local double dvol[numberGauss]; //volume element
 
-  static double gaussPoint[ndm];
+  static thread_local double gaussPoint[ndm];
 
-  static double natCoorArray[ndm][numberGauss];
+  static thread_local double natCoorArray[ndm][numberGauss];
 
-  static XC::Vector strain(nstress);  //strain
+  static thread_local XC::Vector strain(nstress);  //strain
 
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
 
-  static double shpBar[nShape][numberNodes][nMixed]; //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes][nMixed]; //mean value of shape functions
 
-  static double rightHandSide[nShape][numberNodes][nMixed];
+  static thread_local double rightHandSide[nShape][numberNodes][nMixed];
 
-  static XC::Vector residJ(ndf); //nodeJ residual
+  static thread_local XC::Vector residJ(ndf); //nodeJ residual
 
-  static XC::Matrix stiffJK(ndf,ndf); //nodeJK stiffness
+  static thread_local XC::Matrix stiffJK(ndf,ndf); //nodeJK stiffness
 
-  static XC::Vector stress(nstress);  //stress
+  static thread_local XC::Vector stress(nstress);  //stress
 
-  static XC::Matrix dd(nstress,nstress);  //material tangent
+  static thread_local XC::Matrix dd(nstress,nstress);  //material tangent
 
-  static double interp[nMixed];
+  static thread_local double interp[nMixed];
 
-  static XC::Matrix Proj(3,3);   //projection matrix
-  static XC::Matrix ProjInv(3,3);
+  static thread_local XC::Matrix Proj(3,3);   //projection matrix
+  static thread_local XC::Matrix ProjInv(3,3);
 
-  static XC::Matrix Iden(3,3);
+  static thread_local XC::Matrix Iden(3,3);
   Iden(0,0) = 1.0;
   Iden(1,1) = 1.0;
   Iden(2,2) = 1.0;
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(nstress,ndf);      // B matrix node J
+    static thread_local XC::Matrix BJ(nstress,ndf);      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,nstress);
+    static thread_local XC::Matrix BJtran(ndf,nstress);
 
-    static XC::Matrix BK(nstress,ndf);      // B matrix node k
+    static thread_local XC::Matrix BK(nstress,ndf);      // B matrix node k
 
-    static XC::Matrix BJtranD(ndf,nstress);
+    static thread_local XC::Matrix BJtranD(ndf,nstress);
 
   //-------------------------------------------------------
 
@@ -885,17 +885,17 @@ const XC::Matrix &XC::NineNodeMixedQuad::computeBbar( int node,
                             double shpBar[3][9][3] ) const
   {
 
-  static XC::Matrix Bbar(4,2);
+  static thread_local XC::Matrix Bbar(4,2);
 
-  static double Bdev[3][2];
+  static thread_local double Bdev[3][2];
 
-  static double BbarVol[3][2];
+  static thread_local double BbarVol[3][2];
 
   static const double one3 = 1.0/3.0;
 
-  static double interp[3];
+  static thread_local double interp[3];
 
-  static double c0, c1;
+  static thread_local double c0, c1;
 
   int i, j;
 
@@ -996,8 +996,8 @@ void XC::NineNodeMixedQuad::shape2dNine( double coor[2], const double x[2][9], d
 
   int i, j, k, q;
 
-  static double xs[ndm][ndm];
-  static double sx[ndm][ndm];
+  static thread_local double xs[ndm][ndm];
+  static thread_local double sx[ndm][ndm];
 
   double ss = coor[0];
   double tt = coor[1];
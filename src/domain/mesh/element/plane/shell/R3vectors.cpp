@@ -107,11 +107,11 @@ XC::Vector XC::LovelyEig(const Matrix &M )
     int     rot, its, i, j , k;
     double  g, h, aij, sm, thresh, t, c, s, tau;
 
-    static Matrix  v(3,3);
-    static Vector  d(3);
-    static Vector  a(3);
-    static Vector  b(3); 
-    static Vector  z(3);
+    static thread_local Matrix  v(3,3);
+    static thread_local Vector  d(3);
+    static thread_local Vector  a(3);
+    static thread_local Vector  b(3); 
+    static thread_local Vector  z(3);
 
     static const double tol = 1.0e-08;
  
@@ -215,7 +215,7 @@ XC::Vector XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Vecto
 //! @brief Returns the matrix in global coordinates.
 XC::Matrix XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Matrix &kl) const
   {
-    static Matrix tmp(24,24);
+    static thread_local Matrix tmp(24,24);
 
     // Transform local matrix to global system
     // First compute kl*T_{lg}
@@ -309,7 +309,7 @@ void XC::ShellCrdTransf3dBase::getGlobalResidAndTangent(Vector &resid,Matrix &st
 const XC::Vector &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const Vector &localCoords) const
   {
     const Matrix &R= getTrfMatrix();
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     // retval = Rlj'*localCoords (Multiplica el vector por R traspuesta).
     retval(0)= R(0,0)*localCoords(0) + R(1,0)*localCoords(1) + R(2,0)*localCoords(2);
     retval(1)= R(0,1)*localCoords(0) + R(1,1)*localCoords(1) + R(2,1)*localCoords(2);
@@ -321,7 +321,7 @@ const XC::Vector &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const
 const XC::Matrix &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const Matrix &localCoords) const
   {
     const Matrix &R= getTrfMatrix();
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of vectors to transform
     retval.resize(numPts,3);
     for(size_t i= 0;i<numPts;i++)
@@ -337,7 +337,7 @@ const XC::Matrix &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const
 //! @brief Returns the vector expresado en local coordinates.
 const XC::Vector &XC::ShellCrdTransf3dBase::getVectorLocalCoordFromGlobal(const Vector &globalCoords) const
   {
-    static Vector vectorCoo(3);
+    static thread_local Vector vectorCoo(3);
     const Matrix &R= getTrfMatrix();
     vectorCoo[0]= R(0,0)*globalCoords[0] + R(0,1)*globalCoords[1] + R(0,2)*globalCoords[2];
     vectorCoo[1]= R(1,0)*globalCoords[0] + R(1,1)*globalCoords[1] + R(1,2)*globalCoords[2];
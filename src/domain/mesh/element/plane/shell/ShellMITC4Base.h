@@ -43,7 +43,7 @@ class ShellMITC4Base : public Shell4NBase
     FVectorShell p0; //!< Reactions in the basic system due to element loads
     std::vector<Vector> inicDisp; //!< Initial displacements.
 
-    static ShellBData BData; //!< B-bar data
+    static thread_local ShellBData BData; //!< B-bar data
 
     void setupInicDisp(void);
     void capturaInicDisp(void);
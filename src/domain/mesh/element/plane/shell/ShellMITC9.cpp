@@ -54,9 +54,9 @@
 #include "domain/load/plane/ShellUniformLoad.h"
 
 //static data
-XC::Matrix  XC::ShellMITC9::stiff(54,54);
-XC::Vector  XC::ShellMITC9::resid(54); 
-XC::Matrix  XC::ShellMITC9::mass(54,54);
+thread_local XC::Matrix  XC::ShellMITC9::stiff(54,54);
+thread_local XC::Vector  XC::ShellMITC9::resid(54); 
+thread_local XC::Matrix  XC::ShellMITC9::mass(54,54);
 
 //! @brief null constructor
 XC::ShellMITC9::ShellMITC9(void)
@@ -79,8 +79,8 @@ void XC::ShellMITC9::setDomain(Domain *theDomain )
   {
     QuadBase9N<SectionFDPhysicalProperties>::setDomain(theDomain);
 
-    static Vector eig(3);
-    static Matrix ddMembrane(3,3);
+    static thread_local Vector eig(3);
+    static thread_local Matrix ddMembrane(3,3);
 
 
     //compute drilling stiffness penalty parameter
@@ -167,31 +167,31 @@ const XC::Matrix &XC::ShellMITC9::getInitialStiff(void) const
 
 	double volume= 0.0;
 
-	static double xsj;  // determinant jacaobian matrix 
-	static double dvol[ngauss]; //volume element
-	static double shp[3][numnodes];  //shape functions at a gauss point
+	static thread_local double xsj;  // determinant jacaobian matrix 
+	static thread_local double dvol[ngauss]; //volume element
+	static thread_local double shp[3][numnodes];  //shape functions at a gauss point
 
-	static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-	static Matrix dd(nstress,nstress);  //material tangent
+	static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+	static thread_local Matrix dd(nstress,nstress);  //material tangent
 
 	//static Matrix J0(2,2);  //Jacobian at center
 
 	//static Matrix J0inv(2,2); //inverse of Jacobian at center
 
 	//---------B-matrices------------------------------------
-	static Matrix BJ(nstress,ndf);      // B matrix node J
-	static Matrix BJtran(ndf,nstress);
-	static Matrix BK(nstress,ndf);      // B matrix node k
-	static Matrix BJtranD(ndf,nstress);
-	static Matrix Bbend(3,3);  // bending B matrix
-	static Matrix Bshear(2,3); // shear B matrix
-	static Matrix Bmembrane(3,2); // membrane B matrix
-	static double BdrillJ[ndf]; //drill B matrix
-	static double BdrillK[ndf];  
+	static thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+	static thread_local Matrix BJtran(ndf,nstress);
+	static thread_local Matrix BK(nstress,ndf);      // B matrix node k
+	static thread_local Matrix BJtranD(ndf,nstress);
+	static thread_local Matrix Bbend(3,3);  // bending B matrix
+	static thread_local Matrix Bshear(2,3); // shear B matrix
+	static thread_local Matrix Bmembrane(3,2); // membrane B matrix
+	static thread_local double BdrillJ[ndf]; //drill B matrix
+	static thread_local double BdrillK[ndf];  
 
 	double *drillPointer;
 
-	static double saveB[nstress][ndf][numnodes];
+	static thread_local double saveB[nstress][ndf][numnodes];
 
 	//-------------------------------------------------------
 	stiff.Zero();
@@ -396,7 +396,7 @@ const XC::Vector &XC::ShellMITC9::getResistingForce(void) const
 //! @brief get residual with inertia terms
 const XC::Vector &XC::ShellMITC9::getResistingForceIncInertia(void) const
   {
-    static Vector res(54);
+    static thread_local Vector res(54);
     res= getResistingForce();
 
     formInertiaTerms(0);
@@ -420,8 +420,8 @@ void XC::ShellMITC9::formInertiaTerms(int tangFlag) const
 
     double xsj;  // determinant jacobian matrix 
     double dvol; //volume element
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
-    static Vector momentum(ndf);
+    static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
+    static thread_local Vector momentum(ndf);
 
 
     double temp, rhoH, massJK;
@@ -531,33 +531,33 @@ void XC::ShellMITC9::formResidAndTangent(int tang_flag) const
   
     double volume= 0.0;
 
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static Vector strain(nstress);  //strain
-    static double shp[3][numnodes];  //shape functions at a gauss point
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
+    static thread_local double xsj;  // determinant jacaobian matrix 
+    static thread_local double dvol[ngauss]; //volume element
+    static thread_local Vector strain(nstress);  //strain
+    static thread_local double shp[3][numnodes];  //shape functions at a gauss point
+    static thread_local Vector residJ(ndf); //nodeJ residual 
+    static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    static thread_local Vector stress(nstress);  //stress resultants
+    static thread_local Matrix dd(nstress,nstress);  //material tangent
 
     double epsDrill= 0.0;  //drilling "strain"
     double tauDrill= 0.0; //drilling "stress"
 
     //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    static thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress);
+    static thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress);
+    static thread_local Matrix Bbend(3,3);  // bending B matrix
+    static thread_local Matrix Bshear(2,3); // shear B matrix
+    static thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    static thread_local double BdrillJ[ndf]; //drill B matrix
+    static thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //-------------------------------------------------------
    
@@ -727,10 +727,10 @@ void XC::ShellMITC9::computeBasis(void)
 //! @brief compute Bdrill
 double *XC::ShellMITC9::computeBdrill( int node, const double shp[3][9] ) const
   {
-    static double Bdrill[6];
-    static double B1;
-    static double B2;
-    static double B6;
+    static thread_local double Bdrill[6];
+    static thread_local double B1;
+    static thread_local double B2;
+    static thread_local double B6;
 
     //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
     //             -                                       -
@@ -763,12 +763,12 @@ const XC::Matrix &XC::ShellMITC9::assembleB( const Matrix &Bmembrane, const Matr
     //Matrix Bshear(2,3); // plate shear B matrix
     //Matrix Bmembrane(3,2); // plate membrane B matrix
 
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3); 
-    static Matrix BbendShell(3,3); 
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
+    static thread_local Matrix B(8,6);
+    static thread_local Matrix BmembraneShell(3,3); 
+    static thread_local Matrix BbendShell(3,3); 
+    static thread_local Matrix BshearShell(2,6);
+    static thread_local Matrix Gmem(2,3);
+    static thread_local Matrix Gshear(3,6);
     int pp;
 
     // For Shell : 
@@ -852,7 +852,7 @@ const XC::Matrix &XC::ShellMITC9::assembleB( const Matrix &Bmembrane, const Matr
 //! @brief compute Bmembrane matrix
 const XC::Matrix &XC::ShellMITC9::computeBmembrane( int node, const double shp[3][9] ) const
   {
-    static Matrix Bmembrane(3,2);
+    static thread_local Matrix Bmembrane(3,2);
 
     //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
     //                -             -
@@ -876,7 +876,7 @@ const XC::Matrix &XC::ShellMITC9::computeBmembrane( int node, const double shp[3
 //! @brief compute Bbend matrix
 const XC::Matrix &XC::ShellMITC9::computeBbend( int node, const double shp[3][9] ) const
   {
-    static Matrix Bbend(3,2);
+    static thread_local Matrix Bbend(3,2);
 
     //---Bbend Matrix in standard {1,2,3} mechanics notation---------
     //            -             -
@@ -899,7 +899,7 @@ const XC::Matrix &XC::ShellMITC9::computeBbend( int node, const double shp[3][9]
 //! @brief compute standard Bshear matrix
 const XC::Matrix &XC::ShellMITC9::computeBshear( int node, const double shp[3][9] ) const
   {
-    static Matrix Bshear(2,3);
+    static thread_local Matrix Bshear(2,3);
 
     //---Bshear Matrix in standard {1,2,3} mechanics notation------
     //             -                -
@@ -923,8 +923,8 @@ void XC::ShellMITC9::shape2d( double ss, double tt,const double x[2][9], double
   {
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
-    static double xs[2][2];
-    static double sx[2][2];
+    static thread_local double xs[2][2];
+    static thread_local double sx[2][2];
 
     for(int i= 0; i < 4; i++ )
       {
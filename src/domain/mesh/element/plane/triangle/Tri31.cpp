@@ -69,10 +69,10 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 
-double XC::Tri31::matrixData[36];
-XC::Matrix XC::Tri31::K(matrixData, 6, 6);
-XC::Vector XC::Tri31::P(6);
-double XC::Tri31::shp[3][3];
+thread_local double XC::Tri31::matrixData[36];
+thread_local XC::Matrix XC::Tri31::K(matrixData, 6, 6);
+thread_local XC::Vector XC::Tri31::P(6);
+thread_local double XC::Tri31::shp[3][3];
 
 XC::Tri31::Tri31(int tag, int nd1, int nd2, int nd3,
              NDMaterial &m, const std::string &type, double t,
@@ -143,7 +143,7 @@ int XC::Tri31::update()
     const Vector &disp2 = theNodes[1]->getTrialDisp();
     const Vector &disp3 = theNodes[2]->getTrialDisp();
        
-    static double u[2][3];
+    static thread_local double u[2][3];
 
     u[0][0] = disp1(0);
     u[1][0] = disp1(1);
@@ -152,7 +152,7 @@ int XC::Tri31::update()
     u[0][2] = disp3(0);
     u[1][2] = disp3(1);
 
-    static Vector eps(3);
+    static thread_local Vector eps(3);
 
     int ret = 0;
 
@@ -303,7 +303,7 @@ const XC::Matrix &XC::Tri31::getMass(void) const
   {
     K.Zero();
 
-    static Vector rhoi; //numgp
+    static thread_local Vector rhoi; //numgp
     rhoi= physicalProperties.getRhoi();
     double sum = 0.0;
     for(int i = 0; i < rhoi.Size(); i++)
@@ -347,7 +347,7 @@ int XC::Tri31::addLoad(ElementalLoad *theLoad, double loadFactor)
 
 int XC::Tri31::addInertiaLoadToUnbalance(const Vector &accel)
   {
-    static Vector rhoi; //numgp
+    static thread_local Vector rhoi; //numgp
     rhoi= physicalProperties.getRhoi();
     double sum = 0.0;
     for(size_t i = 0; i < physicalProperties.size(); i++)
@@ -366,7 +366,7 @@ int XC::Tri31::addInertiaLoadToUnbalance(const Vector &accel)
         return -1;
     }
 
-    static double ra[6];
+    static thread_local double ra[6];
 
     ra[0] = Raccel1(0);
     ra[1] = Raccel1(1);
@@ -435,7 +435,7 @@ const XC::Vector &XC::Tri31::getResistingForce(void) const
 
 const XC::Vector &XC::Tri31::getResistingForceIncInertia() const
   {
-    static Vector rhoi; //numgp
+    static thread_local Vector rhoi; //numgp
     rhoi= physicalProperties.getRhoi();
     double sum = 0.0;
     for(int i = 0; i < rhoi.Size(); i++)
@@ -456,7 +456,7 @@ const XC::Vector &XC::Tri31::getResistingForceIncInertia() const
     const Vector &accel2 = theNodes[1]->getTrialAccel();
     const Vector &accel3 = theNodes[2]->getTrialAccel();
    
-    static double a[6];
+    static thread_local double a[6];
 
     a[0] = accel1(0);
     a[1] = accel1(1);
@@ -553,8 +553,8 @@ void XC::Tri31::Print(std::ostream &s, int flag)
             // spit out the section location & invoke print on the scetion
             const int numMaterials = physicalProperties.size();
 
-            static Vector avgStress(nstress);
-            static Vector avgStrain(nstress);
+            static thread_local Vector avgStress(nstress);
+            static thread_local Vector avgStrain(nstress);
             avgStress.Zero();
             avgStrain.Zero();
             for(int i=0; i<numMaterials; i++) {
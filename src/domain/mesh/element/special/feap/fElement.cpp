@@ -926,6 +926,12 @@ XC::fElement::readyfRoutine(bool incInertia)
 
 
 
+//! @brief The FEAP work arrays (s, r, ul, xl, tl, ix,...) are
+//! shared by all the elements of the class so they can't be evaluated
+//! concurrently.
+bool XC::fElement::isThreadSafe(void) const
+  { return false; }
+
 int XC::fElement::update(void)
   {
     // determine nst
@@ -145,6 +145,7 @@ class fElement : public Element
     virtual int revertToLastCommit(void);        
     virtual int revertToStart(void);        
     virtual int update(void);
+    virtual bool isThreadSafe(void) const;
     
     virtual const Matrix &getTangentStiff(void) const;
     const Matrix &getInitialStiff(void) const;
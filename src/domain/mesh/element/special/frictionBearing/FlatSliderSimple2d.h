@@ -79,8 +79,8 @@ class FlatSliderSimple2d: public FrictionElementBase
     // committed history variables
     double ubPlasticC;  // plastic displacement in basic system
     
-    static Matrix theMatrix;
-    static Vector theVector;
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
     // private methods
     void setUp();
     double sgn(double x);
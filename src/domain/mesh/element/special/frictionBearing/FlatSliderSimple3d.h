@@ -54,8 +54,8 @@ class FlatSliderSimple3d: public FrictionElementBase
     // committed history variables
     Vector ubPlasticC;  // plastic displacements in basic system
 
-    static Matrix theMatrix;
-    static Vector theVector;
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
 
     // private methods
     void setUp();
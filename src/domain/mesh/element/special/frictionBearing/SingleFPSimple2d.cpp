@@ -39,8 +39,8 @@
 #include "material/uniaxial/UniaxialMaterial.h"
 
 // initialize the class wide variables
-XC::Matrix XC::SingleFPSimple2d::theMatrix(6,6);
-XC::Vector XC::SingleFPSimple2d::theVector(6);
+thread_local XC::Matrix XC::SingleFPSimple2d::theMatrix(6,6);
+thread_local XC::Vector XC::SingleFPSimple2d::theVector(6);
 
 
 XC::SingleFPSimple2d::SingleFPSimple2d(int tag, int Nd1, int Nd2,const FrictionModel &thefrnmdl,const double &r,const double &_h, const double &_uy,const std::vector<UniaxialMaterial *> &theMaterials,const Vector &_y,const Vector &_x,const double &m,const int &maxiter,const double &_tol)
@@ -150,7 +150,7 @@ int XC::SingleFPSimple2d::update()
     const Vector &vel1 = theNodes[0]->getTrialVel();
     const Vector &vel2 = theNodes[1]->getTrialVel();
     
-    static Vector ug(6), ugdot(6), uldot(6), ubdot(3);
+    static thread_local Vector ug(6), ugdot(6), uldot(6), ubdot(3);
     for (int i=0; i<3; i++)  {
         ug(i)   = dsp1(i);  ugdot(i)   = vel1(i);
         ug(i+3) = dsp2(i);  ugdot(i+3) = vel2(i);
@@ -251,7 +251,7 @@ const XC::Matrix& XC::SingleFPSimple2d::getTangentStiff(void)
     theMatrix.Zero();
     
     // transform from basic to local system
-    static Matrix kl(6,6);
+    static thread_local Matrix kl(6,6);
     kl.addMatrixTripleProduct(0.0, Tlb, kb, 1.0);
     
     // add geometric stiffness to local stiffness
@@ -273,7 +273,7 @@ const XC::Matrix& XC::SingleFPSimple2d::getInitialStiff(void)
     theMatrix.Zero();
     
     // transform from basic to local system
-    static Matrix kl(6,6);
+    static thread_local Matrix kl(6,6);
     kl.addMatrixTripleProduct(0.0, Tlb, kbInit, 1.0);
     
     // transform from local to global system
@@ -348,7 +348,7 @@ const XC::Vector& XC::SingleFPSimple2d::getResistingForce()
     theVector.Zero();
     
     // determine resisting forces in local system
-    static Vector ql(6);
+    static thread_local Vector ql(6);
     ql = Tlb^qb;
     
     // add P-Delta moments to local forces
@@ -62,8 +62,8 @@ class SingleFPSimple2d : public FrictionElementBase
     // committed history variables
     double ubPlasticC;  // plastic displacement in basic system
 
-    static Matrix theMatrix;
-    static Vector theVector;
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
     
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
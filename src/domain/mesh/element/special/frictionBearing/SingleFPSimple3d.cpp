@@ -40,8 +40,8 @@
 
 
 // initialize the class wide variables
-XC::Matrix XC::SingleFPSimple3d::theMatrix(12,12);
-XC::Vector XC::SingleFPSimple3d::theVector(12);
+thread_local XC::Matrix XC::SingleFPSimple3d::theMatrix(12,12);
+thread_local XC::Vector XC::SingleFPSimple3d::theVector(12);
 
 
 XC::SingleFPSimple3d::SingleFPSimple3d(int tag, int Nd1, int Nd2,const FrictionModel &thefrnmdl,const double &r, const double &_h,const double &_uy,const std::vector<UniaxialMaterial *> &materials,const Vector &_y, const Vector &_x,const double &m, const int &maxiter, const double &_tol)
@@ -157,7 +157,7 @@ int XC::SingleFPSimple3d::update()
     const Vector &vel1 = theNodes[0]->getTrialVel();
     const Vector &vel2 = theNodes[1]->getTrialVel();
     
-    static Vector ug(12), ugdot(12), uldot(12), ubdot(6);
+    static thread_local Vector ug(12), ugdot(12), uldot(12), ubdot(6);
     for (int i=0; i<6; i++)  {
         ug(i)   = dsp1(i);  ugdot(i)   = vel1(i);
         ug(i+6) = dsp2(i);  ugdot(i+6) = vel2(i);
@@ -286,7 +286,7 @@ const XC::Matrix& XC::SingleFPSimple3d::getTangentStiff()
     theMatrix.Zero();
     
     // transform from basic to local system
-    static Matrix kl(12,12);
+    static thread_local Matrix kl(12,12);
     kl.addMatrixTripleProduct(0.0, Tlb, kb, 1.0);
     
     // add geometric stiffness to local stiffness
@@ -316,7 +316,7 @@ const XC::Matrix& XC::SingleFPSimple3d::getInitialStiff()
     theMatrix.Zero();
     
     // transform from basic to local system
-    static Matrix kl(12,12);
+    static thread_local Matrix kl(12,12);
     kl.addMatrixTripleProduct(0.0, Tlb, kbInit, 1.0);
     
     // transform from local to global system
@@ -391,7 +391,7 @@ const XC::Vector& XC::SingleFPSimple3d::getResistingForce()
     theVector.Zero();
     
     // determine resisting forces in local system
-    static Vector ql(12);
+    static thread_local Vector ql(12);
     ql = Tlb^qb;
     
     // add P-Delta moments to local forces
@@ -59,8 +59,8 @@ class SingleFPSimple3d : public FrictionElementBase
     // committed history variables
     Vector ubPlasticC;  // plastic displacements in basic system
 
-    static Matrix theMatrix;
-    static Vector theVector;
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
     // private methods
     void setUp();
     double sgn(double x);
@@ -68,8 +68,8 @@
 #include <utility/recorder/response/ElementResponse.h>
 
 // class wide matrices
- XC::Matrix XC::BeamColumnJoint3d::Transf(12,24);
- XC::Matrix XC::BeamColumnJoint3d::Tran(3,6);
+ thread_local XC::Matrix XC::BeamColumnJoint3d::Transf(12,24);
+ thread_local XC::Matrix XC::BeamColumnJoint3d::Tran(3,6);
 
 // full constructors:
 XC::BeamColumnJoint3d::BeamColumnJoint3d(int tag,int Nd1, int Nd2, int Nd3, int Nd4, const UniaxialMaterial &theMat1, const UniaxialMaterial &theMat2, const UniaxialMaterial &theMat3, const UniaxialMaterial &theMat4, const UniaxialMaterial &theMat5, const UniaxialMaterial &theMat6, const UniaxialMaterial &theMat7, const UniaxialMaterial &theMat8, const UniaxialMaterial &theMat9, const UniaxialMaterial &theMat10, const UniaxialMaterial &theMat11, const UniaxialMaterial &theMat12, const UniaxialMaterial &theMat13):
@@ -1008,10 +1008,10 @@ XC::Response *XC::BeamColumnJoint3d::setResponse(const std::vector<std::string>
 int
 XC::BeamColumnJoint3d::getResponse(int responseID, Information &eleInfo)
 {
-        static XC::Vector delta(13);
-        static XC::Vector def(4);
-        static XC::Vector U(16);
-        static XC::Vector Utemp(12);
+        static thread_local XC::Vector delta(13);
+        static thread_local XC::Vector def(4);
+        static thread_local XC::Vector U(16);
+        static thread_local XC::Vector Utemp(12);
         double bsFa, bsFb, bsFc, bsFd;
         double bsFac, bsFbd, isFac, isFbd;
 
@@ -117,8 +117,8 @@ class BeamColumnJoint3d : public ElemWithMaterial<4,BeamColumnJointPhysicalPrope
   mutable Vector R; //!< element residual matrix
   
   // static transformation matrices
-  static Matrix Transf;
-  static Matrix Tran;
+  static thread_local Matrix Transf;
+  static thread_local Matrix Tran;
   
   public:
     // default constructor
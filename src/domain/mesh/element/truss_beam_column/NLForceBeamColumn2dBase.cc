@@ -31,9 +31,9 @@
 
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
-XC::Matrix XC::NLForceBeamColumn2dBase::theMatrix(6,6);
-XC::Vector XC::NLForceBeamColumn2dBase::theVector(6);
-double XC::NLForceBeamColumn2dBase::workArea[100];
+thread_local XC::Matrix XC::NLForceBeamColumn2dBase::theMatrix(6,6);
+thread_local XC::Vector XC::NLForceBeamColumn2dBase::theVector(6);
+thread_local double XC::NLForceBeamColumn2dBase::workArea[100];
 
 //! @brief Allocate section flexibility matrices and section deformation vectors
 void XC::NLForceBeamColumn2dBase::resizeMatrices(const size_t &nSections)
@@ -92,7 +92,7 @@ const XC::Matrix &XC::NLForceBeamColumn2dBase::getTangentStiff(void) const
   {
     // Will remove once we clean up the corotational 2d transformation -- MHS
     theCoordTransf->update();
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getGlobalStiffMatrix(kv, Se);
     if(isDead())
       K*=dead_srf;
@@ -105,7 +105,7 @@ const XC::Vector &XC::NLForceBeamColumn2dBase::getResistingForce(void) const
     // Will remove once we clean up the corotational 2d transformation -- MHS
     theCoordTransf->update();
     Vector p0Vec= p0.getVector();
-    static Vector retval;
+    static thread_local Vector retval;
     retval= theCoordTransf->getGlobalResistingForce(Se, p0Vec);
     if(isDead())
       retval*=dead_srf;
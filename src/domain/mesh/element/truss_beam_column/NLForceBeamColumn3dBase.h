@@ -76,9 +76,9 @@ class NLForceBeamColumn3dBase: public BeamColumnWithSectionFDTrf3d
 
     mutable Matrix Ki;
 
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
+    static thread_local double workArea[];
 
     void resizeMatrices(const size_t &nSections);
     void initializeSectionHistoryVariables(void);
@@ -211,7 +211,7 @@ void XC::beam2d03::setDomain(Domain *theDomain)
 
 const XC::Matrix &XC::beam2d03::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= k;
     if(isDead())
       K*=dead_srf;
@@ -221,7 +221,7 @@ const XC::Matrix &XC::beam2d03::getTangentStiff(void) const
 
 const XC::Matrix &XC::beam2d03::getInitialStiff(void) const
   { 
-    static Matrix K;
+    static thread_local Matrix K;
     K= k;
     if(isDead())
       K*=dead_srf;
@@ -66,9 +66,9 @@
 #include <cmath>
 #include <cstdlib>
 
-XC::Matrix XC::beam3dBase::k(12,12);
-XC::Matrix XC::beam3dBase::m(12,12);  // these beam members have no mass or damping matrices.
-XC::Matrix XC::beam3dBase::d(12,12);
+thread_local XC::Matrix XC::beam3dBase::k(12,12);
+thread_local XC::Matrix XC::beam3dBase::m(12,12);  // these beam members have no mass or damping matrices.
+thread_local XC::Matrix XC::beam3dBase::d(12,12);
 
 
 XC::beam3dBase::beam3dBase(int tag, int classTag)
@@ -69,9 +69,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
-XC::Matrix XC::BeamWithHinges2d::theMatrix(6,6);
-XC::Vector XC::BeamWithHinges2d::theVector(6);
-double XC::BeamWithHinges2d::workArea[100];
+thread_local XC::Matrix XC::BeamWithHinges2d::theMatrix(6,6);
+thread_local XC::Vector XC::BeamWithHinges2d::theVector(6);
+thread_local double XC::BeamWithHinges2d::workArea[100];
 
 //! @brief Default Constructor.
 //!
@@ -339,7 +339,7 @@ int XC::BeamWithHinges2d::revertToStart(void)
 //! \end{equation}
 const XC::Matrix &XC::BeamWithHinges2d::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getGlobalStiffMatrix(kb, q);
     if(isDead())
       K*= dead_srf;
@@ -364,10 +364,10 @@ const XC::Matrix &XC::BeamWithHinges2d::getInitialStiff(void) const
     xi[1] = L-0.5*lp[1];
 
     // element properties
-    static Matrix f(3,3);        // element flexibility
-    static Vector vr(3);        // Residual element deformations
+    static thread_local Matrix f(3,3);        // element flexibility
+    static thread_local Vector vr(3);        // Residual element deformations
 
-    static Matrix Iden(3,3);   // an identity matrix for matrix inverse
+    static thread_local Matrix Iden(3,3);   // an identity matrix for matrix inverse
     Iden.Zero();
     for(int i = 0; i < 3; i++)
       Iden(i,i) = 1.0;
@@ -379,12 +379,12 @@ const XC::Matrix &XC::BeamWithHinges2d::getInitialStiff(void) const
     const double Lover6EI = 0.5*Lover3EI;
 
     // Elastic flexibility of element interior
-    static Matrix fe(2,2);
+    static thread_local Matrix fe(2,2);
     fe(0,0) = fe(1,1) =  Lover3EI;
     fe(0,1) = fe(1,0) = -Lover6EI;
 
     // Equilibrium transformation matrix
-    static Matrix B(2,2);
+    static thread_local Matrix B(2,2);
     B(0,0) = 1.0 - beta1;
     B(1,1) = 1.0 - beta2;
     B(0,1) = -beta1;
@@ -392,7 +392,7 @@ const XC::Matrix &XC::BeamWithHinges2d::getInitialStiff(void) const
 
     // Transform the elastic flexibility of the element
     // interior to the basic system
-    static Matrix fElastic(2,2);
+    static thread_local Matrix fElastic(2,2);
     fElastic.addMatrixTripleProduct(0.0, B, fe, 1.0);
 
     // Set element flexibility to flexibility of elastic region
@@ -491,11 +491,11 @@ const XC::Matrix &XC::BeamWithHinges2d::getInitialStiff(void) const
 
     // calculate element stiffness matrix
     //invert3by3Matrix(f, kb);
-    static Matrix kbInit(3,3);
+    static thread_local Matrix kbInit(3,3);
     if(f.Solve(Iden,kbInit) < 0)
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; could not invert flexibility.\n";
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getInitialGlobalStiffMatrix(kbInit);
     if(isDead())
       K*=dead_srf;
@@ -628,7 +628,7 @@ int XC::BeamWithHinges2d::addInertiaLoadToUnbalance(const XC::Vector &accel)
 const XC::Vector &XC::BeamWithHinges2d::getResistingForce(void) const
   {
     Vector p0Vec= p0.getVector();
-    static Vector retval;
+    static thread_local Vector retval;
     retval= theCoordTransf->getGlobalResistingForce(q, p0Vec);
     if(isDead())
       retval*=dead_srf;
@@ -826,10 +826,10 @@ int XC::BeamWithHinges2d::update(void)
     theCoordTransf->update();
 
     // Convert to basic system from local coord's (eliminate rb-modes)
-    static Vector v(3); // basic system deformations
+    static thread_local Vector v(3); // basic system deformations
     v = theCoordTransf->getBasicTrialDisp();
 
-    static XC::Vector dv(3);
+    static thread_local XC::Vector dv(3);
     dv = theCoordTransf->getBasicIncrDeltaDisp();
 
     double L = theCoordTransf->getInitialLength();
@@ -848,10 +848,10 @@ int XC::BeamWithHinges2d::update(void)
     xi[1] = L-0.5*lp[1];
 
     // element properties
-    static XC::Matrix f(3,3);        // element flexibility
-    static XC::Vector vr(3);        // Residual element deformations
+    static thread_local XC::Matrix f(3,3);        // element flexibility
+    static thread_local XC::Vector vr(3);        // Residual element deformations
 
-    static XC::Matrix Iden(3,3);   // an identity matrix for matrix inverse
+    static thread_local XC::Matrix Iden(3,3);   // an identity matrix for matrix inverse
     Iden.Zero();
     for(int i = 0; i < 3; i++)
       Iden(i,i) = 1.0;
@@ -863,12 +863,12 @@ int XC::BeamWithHinges2d::update(void)
     const double Lover6EI = 0.5*Lover3EI;
 
     // Elastic flexibility of element interior
-    static XC::Matrix fe(2,2);
+    static thread_local XC::Matrix fe(2,2);
     fe(0,0) = fe(1,1) =  Lover3EI;
     fe(0,1) = fe(1,0) = -Lover6EI;
 
     // Equilibrium transformation matrix
-    static XC::Matrix B(2,2);
+    static thread_local XC::Matrix B(2,2);
     B(0,0) = 1.0 - beta1;
     B(1,1) = 1.0 - beta2;
     B(0,1) = -beta1;
@@ -876,11 +876,11 @@ int XC::BeamWithHinges2d::update(void)
 
     // Transform the elastic flexibility of the element
     // interior to the basic system
-    static XC::Matrix fElastic(2,2);
+    static thread_local XC::Matrix fElastic(2,2);
     fElastic.addMatrixTripleProduct(0.0, B, fe, 1.0);
 
     // calculate nodal force increments and update nodal forces
-    static XC::Vector dq(3);
+    static thread_local XC::Vector dq(3);
     //dq = kb * dv;   // using previous stiff matrix k,i
     dq.addMatrixVector(0.0, kb, dv, 1.0);
 
@@ -1227,8 +1227,8 @@ XC::Response* XC::BeamWithHinges2d::setResponse(const std::vector<std::string> &
 int XC::BeamWithHinges2d::getResponse(int responseID, Information &eleInfo)
   {
     const double L = theCoordTransf->getInitialLength();
-    static Vector force(6);
-    static Vector def(3);
+    static thread_local Vector force(6);
+    static thread_local Vector def(3);
     double V= 0.0;
     switch (responseID)
       {
@@ -103,9 +103,9 @@ class BeamWithHinges2d: public BeamColumnWithSectionFDTrf2d
     FVectorBeamColumn2d p0; //!< Reactions in the basic system due to element loads
     FVectorBeamColumn2d v0; //!< Basic deformations due to element loads on the interior
   
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
+    static thread_local double workArea[];
   
     void setHinges(void);
   
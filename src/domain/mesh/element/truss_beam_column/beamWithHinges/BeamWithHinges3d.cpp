@@ -67,9 +67,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
-XC::Matrix XC::BeamWithHinges3d::theMatrix(12,12);
-XC::Vector XC::BeamWithHinges3d::theVector(12);
-double XC::BeamWithHinges3d::workArea[200];
+thread_local XC::Matrix XC::BeamWithHinges3d::theMatrix(12,12);
+thread_local XC::Vector XC::BeamWithHinges3d::theVector(12);
+thread_local double XC::BeamWithHinges3d::workArea[200];
 
 XC::BeamWithHinges3d::BeamWithHinges3d(int tag)
   :BeamColumnWithSectionFDTrf3d(tag, ELE_TAG_BeamWithHinges3d,2),
@@ -254,7 +254,7 @@ int XC::BeamWithHinges3d::revertToStart(void)
 
 const XC::Matrix &XC::BeamWithHinges3d::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getGlobalStiffMatrix(kb, q);
     if(isDead())
       K*=dead_srf;
@@ -280,8 +280,8 @@ const XC::Matrix &XC::BeamWithHinges3d::getInitialStiff(void) const
     xi[1] = L-0.5*lp[1];
 
     // element properties
-    static XC::Matrix f(6,6);        // element flexibility
-    static XC::Matrix Iden(6,6);   // an identity matrix for matrix inverse
+    static thread_local XC::Matrix f(6,6);        // element flexibility
+    static thread_local XC::Matrix Iden(6,6);   // an identity matrix for matrix inverse
     Iden.Zero();
     int i;
     for(i = 0; i < 6; i++)
@@ -297,14 +297,14 @@ const XC::Matrix &XC::BeamWithHinges3d::getInitialStiff(void) const
     const double LoverGJ   = Le/(ctes_scc.GJ());
 
     // Elastic flexibility of element interior
-    static XC::Matrix fe(4,4);
+    static thread_local XC::Matrix fe(4,4);
     fe(0,0) = fe(1,1) =  Lover3EIz;
     fe(0,1) = fe(1,0) = -Lover6EIz;
     fe(2,2) = fe(3,3) =  Lover3EIy;
     fe(2,3) = fe(3,2) = -Lover6EIy;
 
     // Equilibrium transformation matrix
-    static XC::Matrix B(4,4);
+    static thread_local XC::Matrix B(4,4);
     B(0,0) = B(2,2) = 1.0 - beta1;
     B(1,1) = B(3,3) = 1.0 - beta2;
     B(0,1) = B(2,3) = -beta1;
@@ -312,7 +312,7 @@ const XC::Matrix &XC::BeamWithHinges3d::getInitialStiff(void) const
 
     // Transform the elastic flexibility of the element
     // interior to the basic system
-    static XC::Matrix fElastic(4,4);
+    static thread_local XC::Matrix fElastic(4,4);
     fElastic.addMatrixTripleProduct(0.0, B, fe, 1.0);
 
     // Set element flexibility to flexibility of elastic region
@@ -450,10 +450,10 @@ const XC::Matrix &XC::BeamWithHinges3d::getInitialStiff(void) const
 
   }
   // calculate element stiffness matrix
-  static Matrix kbInit(6,6);
+  static thread_local Matrix kbInit(6,6);
     if(f.Solve(Iden,kbInit) < 0)
       std::cerr << "XC::BeamWithHinges3d::update() -- could not invert flexibility\n";
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getInitialGlobalStiffMatrix(kbInit);
     if(isDead())
       K*=dead_srf;
@@ -546,7 +546,7 @@ int XC::BeamWithHinges3d::addInertiaLoadToUnbalance(const XC::Vector &accel)
 const XC::Vector &XC::BeamWithHinges3d::getResistingForce(void) const
   {
     Vector p0Vec= p0.getVector();
-    static Vector retval;
+    static thread_local Vector retval;
     retval= theCoordTransf->getGlobalResistingForce(q, p0Vec);
     if(isDead())
       retval*=dead_srf;
@@ -745,10 +745,10 @@ int XC::BeamWithHinges3d::update(void)
   theCoordTransf->update();
 
   // Convert to basic system from local coord's (eliminate rb-modes)
-  static XC::Vector v(6); // basic system deformations
+  static thread_local XC::Vector v(6); // basic system deformations
   v = theCoordTransf->getBasicTrialDisp();
 
-  static XC::Vector dv(6);
+  static thread_local XC::Vector dv(6);
   dv = theCoordTransf->getBasicIncrDeltaDisp();
 
   double L = theCoordTransf->getInitialLength();
@@ -766,10 +766,10 @@ int XC::BeamWithHinges3d::update(void)
   xi[1] = L-0.5*lp[1];
 
   // element properties
-  static XC::Matrix f(6,6);        // element flexibility
-  static XC::Vector vr(6);        // Residual element deformations
+  static thread_local XC::Matrix f(6,6);        // element flexibility
+  static thread_local XC::Vector vr(6);        // Residual element deformations
 
-  static XC::Matrix Iden(6,6);   // an identity matrix for matrix inverse
+  static thread_local XC::Matrix Iden(6,6);   // an identity matrix for matrix inverse
   Iden.Zero();
   for(int i = 0; i < 6; i++)
     Iden(i,i) = 1.0;
@@ -784,14 +784,14 @@ int XC::BeamWithHinges3d::update(void)
   double LoverGJ   = Le/(ctes_scc.GJ());
 
   // Elastic flexibility of element interior
-  static XC::Matrix fe(4,4);
+  static thread_local XC::Matrix fe(4,4);
   fe(0,0) = fe(1,1) =  Lover3EIz;
   fe(0,1) = fe(1,0) = -Lover6EIz;
   fe(2,2) = fe(3,3) =  Lover3EIy;
   fe(2,3) = fe(3,2) = -Lover6EIy;
 
   // Equilibrium transformation matrix
-  static XC::Matrix B(4,4);
+  static thread_local XC::Matrix B(4,4);
   B(0,0) = B(2,2) = 1.0 - beta1;
   B(1,1) = B(3,3) = 1.0 - beta2;
   B(0,1) = B(2,3) = -beta1;
@@ -799,11 +799,11 @@ int XC::BeamWithHinges3d::update(void)
 
   // Transform the elastic flexibility of the element
   // interior to the basic system
-  static XC::Matrix fElastic(4,4);
+  static thread_local XC::Matrix fElastic(4,4);
   fElastic.addMatrixTripleProduct(0.0, B, fe, 1.0);
 
   // calculate nodal force increments and update nodal forces
-  static XC::Vector dq(6);
+  static thread_local XC::Vector dq(6);
   //dq = kb * dv;   // using previous stiff matrix k,i
   dq.addMatrixVector(0.0, kb, dv, 1.0);
 
@@ -1235,8 +1235,8 @@ int XC::BeamWithHinges3d::getResponse(int responseID, Information &eleInfo)
   {
     double V, N, T, M1, M2;
     const double L = theCoordTransf->getInitialLength();
-    static XC::Vector force(12);
-    static XC::Vector def(6);
+    static thread_local XC::Vector force(12);
+    static thread_local XC::Vector def(6);
 
     switch (responseID)
       {
@@ -72,7 +72,7 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::GaussQuadRule1d01 XC::DispBeamColumn2d::quadRule;
+thread_local XC::GaussQuadRule1d01 XC::DispBeamColumn2d::quadRule;
 
 XC::DispBeamColumn2d::DispBeamColumn2d(int tag, int nd1, int nd2,
 				       int numSec,const std::vector<PrismaticBarCrossSection *> &s, CrdTransf2d &coordTransf, double r)
@@ -203,7 +203,7 @@ void XC::DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial) const
 
 const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
   {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   this->getBasicStiff(kb);
   // Zero for integral
@@ -303,7 +303,7 @@ const XC::Matrix &XC::DispBeamColumn2d::getTangentStiff(void) const
 
 const XC::Matrix &XC::DispBeamColumn2d::getInitialBasicStiff(void) const
   {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -514,8 +514,8 @@ int XC::DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if(responseID == 4) {
-    static XC::Vector vp(3);
-    static XC::Vector ve(3);
+    static thread_local XC::Vector vp(3);
+    static thread_local XC::Vector ve(3);
     const XC::Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -707,11 +707,11 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 
         // Zero for integration
         q.Zero();
-        static XC::Vector qsens(3);
+        static thread_local XC::Vector qsens(3);
         qsens.Zero();
 
         // Some extra declarations
-        static XC::Matrix kbmine(3,3);
+        static thread_local XC::Matrix kbmine(3,3);
         kbmine.Zero();
 
         int j, k;
@@ -719,7 +719,7 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -831,18 +831,18 @@ const XC::Vector &XC::DispBeamColumn2d::getResistingForceSensitivity(int gradNum
 
         }
 
-        static XC::Vector dqdh(3);
+        static thread_local XC::Vector dqdh(3);
         const XC::Vector &dAdh_u = theCoordTransf->getBasicTrialDispShapeSensitivity();
         //dqdh = (1.0/L) * (kbmine * dAdh_u);
         dqdh.addMatrixVector(0.0, kbmine, dAdh_u, oneOverL);
 
-        static XC::Vector dkbdh_v(3);
+        static thread_local XC::Vector dkbdh_v(3);
         const XC::Vector &A_u = theCoordTransf->getBasicTrialDisp();
         //dkbdh_v = (d1oLdh) * (kbmine * A_u);
         dkbdh_v.addMatrixVector(0.0, kbmine, A_u, d1oLdh);
 
         // Transform forces
-        static XC::Vector dummy(3);                // No distributed loads
+        static thread_local XC::Vector dummy(3);                // No distributed loads
 
         // Term 5
         P = theCoordTransf->getGlobalResistingForce(qsens,dummy);
@@ -869,7 +869,7 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
     // Get basic deformation and sensitivities
         const XC::Vector &v = theCoordTransf->getBasicTrialDisp();
 
-        static XC::Vector vsens(3);
+        static thread_local XC::Vector vsens(3);
         vsens = theCoordTransf->getBasicDisplSensitivity(gradNumber);
 
         double L = theCoordTransf->getInitialLength();
@@ -882,7 +882,7 @@ int XC::DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -78,7 +78,7 @@ class DispBeamColumn2d: public DispBeamColumn2dBase
   private:
     const Matrix &getInitialBasicStiff(void) const;
     void getBasicStiff(Matrix &kb, int initial = 0) const;
-    static GaussQuadRule1d01 quadRule;
+    static thread_local GaussQuadRule1d01 quadRule;
   public:
     DispBeamColumn2d(int tag, int nd1, int nd2,
 		     int numSections,const std::vector<PrismaticBarCrossSection *> &s,
@@ -72,9 +72,9 @@
 #include "utility/actor/actor/MovableVector.h"
 #include "domain/mesh/element/truss_beam_column/forceBeamColumn/beam_integration/BeamIntegration.h"
 
- XC::Matrix XC::DispBeamColumn2dBase::K(6,6);
- XC::Vector XC::DispBeamColumn2dBase::P(6);
-double XC::DispBeamColumn2dBase::workArea[100];
+ thread_local XC::Matrix XC::DispBeamColumn2dBase::K(6,6);
+ thread_local XC::Vector XC::DispBeamColumn2dBase::P(6);
+thread_local double XC::DispBeamColumn2dBase::workArea[100];
 
 XC::DispBeamColumn2dBase::DispBeamColumn2dBase(int tag, int classTag, int nd1, int nd2, int numSec,const std::vector<PrismaticBarCrossSection *> &s, CrdTransf2d &coordTransf, double r)
   : BeamColumnWithSectionFDTrf2d(tag, classTag,numSec), q(3), rho(r)
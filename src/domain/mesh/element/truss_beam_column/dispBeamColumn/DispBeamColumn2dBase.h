@@ -85,10 +85,10 @@ class DispBeamColumn2dBase : public BeamColumnWithSectionFDTrf2d
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
-    static double workArea[];
+    static thread_local double workArea[];
 
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
@@ -68,10 +68,10 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::DispBeamColumn3d::K(12,12);
-XC::Vector XC::DispBeamColumn3d::P(12);
-double XC::DispBeamColumn3d::workArea[200];
-XC::GaussQuadRule1d01 XC::DispBeamColumn3d::quadRule;
+thread_local XC::Matrix XC::DispBeamColumn3d::K(12,12);
+thread_local XC::Vector XC::DispBeamColumn3d::P(12);
+thread_local double XC::DispBeamColumn3d::workArea[200];
+thread_local XC::GaussQuadRule1d01 XC::DispBeamColumn3d::quadRule;
 
 XC::DispBeamColumn3d::DispBeamColumn3d(int tag, int nd1, int nd2,
 				       int numSec,const std::vector<PrismaticBarCrossSection *> &s,
@@ -218,7 +218,7 @@ int XC::DispBeamColumn3d::update(void)
 
 const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
   {
-    static Matrix kb(6,6);
+    static thread_local Matrix kb(6,6);
 
     // Zero for integral
     kb.Zero();
@@ -351,7 +351,7 @@ const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
 
 const XC::Matrix &XC::DispBeamColumn3d::getInitialBasicStiff(void) const
 {
-  static XC::Matrix kb(6,6);
+  static thread_local XC::Matrix kb(6,6);
 
   // Zero for integral
   kb.Zero();
@@ -797,8 +797,8 @@ int XC::DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if(responseID == 4) {
-    static XC::Vector vp(6);
-    static XC::Vector ve(6);
+    static thread_local XC::Vector vp(6);
+    static thread_local XC::Vector ve(6);
     const XC::Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
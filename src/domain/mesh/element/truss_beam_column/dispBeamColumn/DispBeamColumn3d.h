@@ -84,13 +84,13 @@ class DispBeamColumn3d : public BeamColumnWithSectionFDTrf3d
 
     const Matrix &getInitialBasicStiff(void) const;
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
 
-    static double workArea[];
+    static thread_local double workArea[];
 
-    static GaussQuadRule1d01 quadRule;
+    static thread_local GaussQuadRule1d01 quadRule;
   protected:
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
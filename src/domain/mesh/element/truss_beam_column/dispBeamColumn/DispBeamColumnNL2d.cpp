@@ -185,7 +185,7 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
 
       Matrix B(order,3);
       Matrix C(order,3);
-      static Matrix C1(1,3);
+      static thread_local Matrix C1(1,3);
       for(j = 0; j < order; j++) {
 	switch(code(j)) {
 	case SECTION_RESPONSE_P:
@@ -214,7 +214,7 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
       kb.addMatrixTransposeProduct(1.0, B, kC, theta*wts(i));
 
       Matrix ks1(1,order);
-      static Matrix ksB(1,3);
+      static thread_local Matrix ksB(1,3);
 
       for(j = 0; j < order; j++) {
 	if (code(j) == SECTION_RESPONSE_P) {
@@ -281,7 +281,7 @@ void XC::DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial) const
 
 const XC::Matrix &XC::DispBeamColumnNL2d::getTangentStiff(void)
   {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
 
     this->getBasicStiff(kb);
 
@@ -633,7 +633,7 @@ int XC::DispBeamColumnNL2d::getResponse(int responseID, Information &eleInfo)
 
     else if (responseID == 19)
       {
-        static Matrix kb(3,3);
+        static thread_local Matrix kb(3,3);
         this->getBasicStiff(kb);
         return eleInfo.setMatrix(kb);
       }
@@ -719,7 +719,7 @@ int XC::DispBeamColumnNL2d::getResponseSensitivity(int responseID, int gradNumbe
 
   // Basic force sensitivity
   else if (responseID == 9) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     dqdh.Zero();
 
@@ -877,7 +877,7 @@ int XC::DispBeamColumnNL2d::activateParameter(int passedParameterID)
 
 const XC::Matrix &XC::DispBeamColumnNL2d::getInitialStiffSensitivity(int gradNumber)
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -976,7 +976,7 @@ const XC::Vector &XC::DispBeamColumnNL2d::getResistingForceSensitivity(int gradN
 
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1139,7 +1139,7 @@ const XC::Vector &XC::DispBeamColumnNL2d::getResistingForceSensitivity(int gradN
 
 
   // Transform forces
-  static Vector dp0dh(3);		// No distributed loads
+  static thread_local Vector dp0dh(3);		// No distributed loads
   dp0dh.Zero();
 
   P.Zero();
@@ -1150,7 +1150,7 @@ const XC::Vector &XC::DispBeamColumnNL2d::getResistingForceSensitivity(int gradN
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3,3);
+    static thread_local Matrix kbmine(3,3);
     this->getBasicStiff(kbmine);
     
     // k dAdh u
@@ -1176,7 +1176,7 @@ int XC::DispBeamColumnNL2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = theCoordTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = theCoordTransf->getInitialLength();
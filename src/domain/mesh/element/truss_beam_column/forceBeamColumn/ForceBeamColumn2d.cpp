@@ -103,6 +103,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
+#include "utility/parallel/ThreadPool.h"
 
 
 void XC::ForceBeamColumn2d::free_mem(void)
@@ -121,12 +122,12 @@ void XC::ForceBeamColumn2d::alloc(const BeamIntegration &bi)
 // constructor:
 // invoked by a FEM_ObjectBroker, recvSelf() needs to be invoked on this object.
 XC::ForceBeamColumn2d::ForceBeamColumn2d(int tag)
-  : NLForceBeamColumn2dBase(tag,ELE_TAG_ForceBeamColumn2d), beamIntegr(nullptr), v0()
+  : NLForceBeamColumn2dBase(tag,ELE_TAG_ForceBeamColumn2d), beamIntegr(nullptr), v0(), numSectionThreads(1)
   {}
 
 //! @brief Copy constructor.
 XC::ForceBeamColumn2d::ForceBeamColumn2d(const ForceBeamColumn2d &other)
-  : NLForceBeamColumn2dBase(other), beamIntegr(nullptr), v0(other.v0), maxSubdivisions(other.maxSubdivisions)
+  : NLForceBeamColumn2dBase(other), beamIntegr(nullptr), v0(other.v0), maxSubdivisions(other.maxSubdivisions), numSectionThreads(other.numSectionThreads)
   {
     if(other.beamIntegr)
       alloc(*other.beamIntegr);
@@ -148,7 +149,7 @@ XC::ForceBeamColumn2d &XC::ForceBeamColumn2d::operator=(const ForceBeamColumn2d
 
 //! @brief Constructor.
 XC::ForceBeamColumn2d::ForceBeamColumn2d(int tag,int numSec,const Material *m,const CrdTransf *trf,const BeamIntegration *integ):
-  NLForceBeamColumn2dBase(tag,ELE_TAG_ForceBeamColumn2d,numSec,m,trf), beamIntegr(nullptr), v0()
+  NLForceBeamColumn2dBase(tag,ELE_TAG_ForceBeamColumn2d,numSec,m,trf), beamIntegr(nullptr), v0(), numSectionThreads(1)
   {
     if(integ) alloc(*integ);
   }
@@ -161,7 +162,7 @@ XC::ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
                                           BeamIntegration &bi,
                                           CrdTransf2d &coordTransf, double massDensPerUnitLength,
                                           int maxNumIters, double tolerance):
-  NLForceBeamColumn2dBase(tag,ELE_TAG_ForceBeamColumn2d,0),beamIntegr(nullptr), v0()
+  NLForceBeamColumn2dBase(tag,ELE_TAG_ForceBeamColumn2d,0),beamIntegr(nullptr), v0(), numSectionThreads(1)
   {
     theNodes.set_id_nodes(nodeI,nodeJ);
 
@@ -322,15 +323,236 @@ const XC::Matrix &XC::ForceBeamColumn2d::getInitialStiff(void) const
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD, NEBD); // element flexibility matrix
+        static thread_local Matrix f(NEBD, NEBD); // element flexibility matrix
         this->getInitialFlexibility(f);
-        static Matrix kvInit(NEBD, NEBD);
+        static thread_local Matrix kvInit(NEBD, NEBD);
         f.Invert(kvInit);
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
       }
     return Ki;
   }
 
+//! @brief Computes the response of the i-th section for the element
+//! forces SeTrial: sets the trial deformation of the section and returns
+//! its flexibility times the force interpolation matrix and the weight
+//! (fb) and its total deformation (section deformation plus residual, vsTot).
+//!
+//! Only the data of the i-th section are modified, so the sections
+//! can be computed concurrently (see computeSectionResponses).
+int XC::ForceBeamColumn2d::computeSectionResponse(const size_t &i,const int &l,const int &j,const double &xL,const double &wtL,const double &oneOverL,const Vector &SeTrial,Matrix &fb,Vector &vsTot)
+  {
+    const int order= theSections[i]->getOrder();
+    const ID &code = theSections[i]->getType();
+    static thread_local Vector Ss;
+    static thread_local Vector dSs;
+    static thread_local Vector dvs;
+
+    Ss.setData(workArea, order);
+    dSs.setData(&workArea[order], order);
+    dvs.setData(&workArea[2*order], order);
+
+    const double xL1= xL-1.0;
+
+    // calculate total section forces
+    // Ss = b*Se + bp*currDistrLoad;
+    // Ss.addMatrixVector(0.0, b[i], Se, 1.0);
+    for(int ii= 0;ii<order;ii++)
+      {
+        switch(code(ii))
+          {
+          case SECTION_RESPONSE_P:
+            Ss(ii)= SeTrial(0);
+            break;
+          case SECTION_RESPONSE_MZ:
+            Ss(ii)=  xL1*SeTrial(1) + xL*SeTrial(2);
+            break;
+          case SECTION_RESPONSE_VY:
+            Ss(ii)= oneOverL*(SeTrial(1)+SeTrial(2));
+            break;
+          default:
+            Ss(ii)= 0.0;
+            break;
+          }
+      }
+
+    // Add the effects of element loads, if present
+    if(!sp.isEmpty())
+      {
+        const Matrix &s_p = sp;
+        for(int ii=0;ii<order;ii++)
+          {
+            switch(code(ii))
+              {
+              case SECTION_RESPONSE_P:
+                Ss(ii) += s_p(0,i);
+                break;
+              case SECTION_RESPONSE_MZ:
+                Ss(ii) += s_p(1,i);
+                break;
+              case SECTION_RESPONSE_VY:
+                Ss(ii) += s_p(2,i);
+                break;
+              default:
+                break;
+              }
+          }
+      }
+
+    // dSs = Ss - Ssr[i];
+    dSs= Ss;
+    dSs.addVector(1.0, section_matrices.getSsrSubdivide()[i], -1.0);
+
+    // compute section deformation increments
+    if(l==0)
+      {
+        //  regular newton
+        //    vs += fs * dSs;
+        dvs.addMatrixVector(0.0, section_matrices.getFsSubdivide()[i], dSs, 1.0);
+      }
+    else if(l == 2)
+      {
+        //  newton with initial tangent if first iteration
+        //    vs += fs0 * dSs;
+        //  otherwise regular newton
+        //    vs += fs * dSs;
+        if(j == 0)
+          {
+            const Matrix &fs0 = theSections[i]->getInitialFlexibility();
+            dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
+          }
+        else
+          dvs.addMatrixVector(0.0, section_matrices.getFsSubdivide()[i], dSs, 1.0);
+      }
+    else
+      {
+        //  newton with initial tangent
+        //    vs += fs0 * dSs;
+        const Matrix &fs0 = theSections[i]->getInitialFlexibility();
+        dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
+      }
+
+    // set section deformations
+    if(initialFlag != 0)
+      section_matrices.getVsSubdivide()[i]+= dvs;
+
+    if(theSections[i]->setTrialSectionDeformation(section_matrices.getVsSubdivide()[i]) < 0)
+      {
+        std::cerr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
+        return -1;
+      }
+
+    // get section resisting forces
+    section_matrices.getSsrSubdivide()[i] = theSections[i]->getStressResultant();
+
+    // get section flexibility matrix
+    section_matrices.getFsSubdivide()[i] = theSections[i]->getSectionFlexibility();
+
+    // calculate section residual deformations
+    // dvs = fs * (Ss - Ssr);
+    dSs = Ss;
+    dSs.addVector(1.0, section_matrices.getSsrSubdivide()[i], -1.0);  // dSs = Ss - Ssr[i];
+
+    dvs.addMatrixVector(0.0, section_matrices.getFsSubdivide()[i], dSs, 1.0);
+
+    // integrate element flexibility matrix
+    // f = f + (b^ fs * b) * wtL;
+    //f.addMatrixTripleProduct(1.0, b[i], fs[i], wtL);
+
+    const Matrix &fSec = section_matrices.getFsSubdivide()[i];
+    fb.Zero();
+    double tmp;
+    for(int ii = 0; ii < order; ii++)
+      {
+        switch(code(ii))
+          {
+          case SECTION_RESPONSE_P:
+            for(int jj= 0;jj<order;jj++)
+              fb(jj,0) += fSec(jj,ii)*wtL;
+            break;
+          case SECTION_RESPONSE_MZ:
+            for(int jj= 0;jj<order;jj++)
+              {
+                tmp= fSec(jj,ii)*wtL;
+                fb(jj,1)+= xL1*tmp;
+                fb(jj,2)+= xL*tmp;
+              }
+            break;
+          case SECTION_RESPONSE_VY:
+            for(int jj= 0;jj<order;jj++)
+              {
+                tmp = oneOverL*fSec(jj,ii)*wtL;
+                fb(jj,1) += tmp;
+                fb(jj,2) += tmp;
+              }
+            break;
+          default:
+            break;
+          }
+      }
+
+    dvs.addVector(1.0, section_matrices.getVsSubdivide()[i], 1.0);
+    vsTot= dvs;
+    return 0;
+  }
+
+//! @brief Computes the response of all the sections (see
+//! computeSectionResponse) storing the results in fbs and vsTots.
+//!
+//! When numSectionThreads is greater than one the sections are
+//! computed in parallel on the shared thread pool, using at most
+//! numSectionThreads threads. If the element is already being processed
+//! by a pool task (i.e. the elements are assembled in parallel) the
+//! sections are computed serially. The contributions of the sections
+//! are added by the caller in section order, so the element flexibility
+//! and residual don't depend on the number of threads.
+int XC::ForceBeamColumn2d::computeSectionResponses(const int &l,const int &j,const double *xi,const double *wt,const double &L,const Vector &SeTrial,std::vector<Matrix> &fbs,std::vector<Vector> &vsTots)
+  {
+    const size_t numSections= getNumSections();
+    const double oneOverL= 1.0/L;
+    if(fbs.size()<numSections)
+      {
+        fbs.resize(numSections);
+        vsTots.resize(numSections);
+      }
+    for(size_t i=0; i<numSections; i++)
+      {
+        const int order= theSections[i]->getOrder();
+        if((fbs[i].noRows()!=order) || (fbs[i].noCols()!=int(NEBD)))
+          fbs[i].resize(order,NEBD);
+        if(vsTots[i].Size()!=order)
+          vsTots[i].resize(order);
+      }
+    int retval= 0;
+    if((numSectionThreads>1) && (numSections>1) && !ThreadPool::inParallelRegion())
+      {
+        std::vector<int> err(numSections,0);
+        ThreadPool &pool= ThreadPool::getThreadPool();
+        pool.parallel_for(0,numSections,[&](const size_t &i,const size_t &)
+          { err[i]= computeSectionResponse(i,l,j,xi[i],wt[i]*L,oneOverL,SeTrial,fbs[i],vsTots[i]); },numSectionThreads);
+        for(size_t i=0; i<numSections; i++)
+          if(err[i]<0)
+            retval= -1;
+      }
+    else
+      for(size_t i=0; i<numSections; i++)
+        if(computeSectionResponse(i,l,j,xi[i],wt[i]*L,oneOverL,SeTrial,fbs[i],vsTots[i])<0)
+          {
+            retval= -1;
+            break;
+          }
+    return retval;
+  }
+
+//! @brief Sets the number of threads used to compute the
+//! section responses (0: default number of threads, 1: serial).
+void XC::ForceBeamColumn2d::setNumSectionThreads(const size_t &n)
+  {
+    if(n>0)
+      numSectionThreads= n;
+    else
+      numSectionThreads= ThreadPool::getDefaultNumThreads();
+  }
+
 //NEWTON , SUBDIVIDE AND INITIAL ITERATIONS
 int XC::ForceBeamColumn2d::update(void)
   {
@@ -345,13 +567,13 @@ int XC::ForceBeamColumn2d::update(void)
     // get basic displacements and increments
     const Vector &v= theCoordTransf->getBasicTrialDisp();
 
-    static Vector dv(NEBD);
+    static thread_local Vector dv(NEBD);
     dv= theCoordTransf->getBasicIncrDeltaDisp();
 
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && (sp.isEmpty()))
       return 0;
 
-    static Vector vin(NEBD);
+    static thread_local Vector vin(NEBD);
     vin= v;
     vin-= dv;
     const double L= theCoordTransf->getInitialLength();
@@ -364,10 +586,10 @@ int XC::ForceBeamColumn2d::update(void)
     std::vector<double> wt(section_matrices.getMaxNumSections());
     beamIntegr->getSectionWeights(numSections, L, &wt[0]);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                   // section strain energy (work) norm
 
     I.Zero();
@@ -376,16 +598,18 @@ int XC::ForceBeamColumn2d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static thread_local Vector dSe(NEBD);
+    static thread_local Vector dvToDo(NEBD);
+    static thread_local Vector dvTrial(NEBD);
+    static thread_local Vector SeTrial(NEBD);
+    static thread_local Matrix kvTrial(NEBD, NEBD);
+    static thread_local std::vector<Matrix> fbSec; // section flexibilities times b and weight.
+    static thread_local std::vector<Vector> vsTotSec; // section total deformations.
 
     dvToDo= dv;
     dvTrial= dvToDo;
 
-    static double factor = 10;
+    static thread_local double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions= 4; //XXX 10
@@ -444,162 +668,20 @@ int XC::ForceBeamColumn2d::update(void)
                     vr(1)+= v0[1];
                     vr(2)+= v0[2];
 
+                    // compute the response of the sections and add their
+                    // contributions in section order.
+                    if(computeSectionResponses(l,j,xi,wt,L,SeTrial,fbSec,vsTotSec)<0)
+                      return -1;
                     for(size_t i=0;i<numSections; i++)
                       {
                         const int order= theSections[i]->getOrder();
                         const ID &code = theSections[i]->getType();
-                        static Vector Ss;
-                        static Vector dSs;
-                        static Vector dvs;
-                        static Matrix fb;
-    
-                        Ss.setData(workArea, order);
-                        dSs.setData(&workArea[order], order);
-                        dvs.setData(&workArea[2*order], order);
-                        fb.setData(&workArea[3*order], order, NEBD);
-    
+                        const Matrix &fb= fbSec[i];
+                        const Vector &dvs= vsTotSec[i];
                         const double xL= xi[i];
                         const double xL1= xL-1.0;
                         const double wtL= wt[i]*L;
-    
-                        // calculate total section forces
-                        // Ss = b*Se + bp*currDistrLoad;
-                        // Ss.addMatrixVector(0.0, b[i], Se, 1.0);
-                        for(int ii= 0;ii<order;ii++)
-                          {
-                            switch(code(ii))
-                              {
-                              case SECTION_RESPONSE_P:
-                                Ss(ii)= SeTrial(0);
-                                break;
-                              case SECTION_RESPONSE_MZ:
-                                Ss(ii)=  xL1*SeTrial(1) + xL*SeTrial(2);
-                                break;
-                              case SECTION_RESPONSE_VY:
-                                Ss(ii)= oneOverL*(SeTrial(1)+SeTrial(2));
-                                break;
-                              default:
-                                Ss(ii)= 0.0;
-                                break;
-                              }
-                          }
-    
-                        // Add the effects of element loads, if present
-                        if(!sp.isEmpty())
-                          {
-                            const Matrix &s_p = sp;
-                            for(int ii=0;ii<order;ii++)
-                              {
-                                switch(code(ii))
-                                  {
-                                  case SECTION_RESPONSE_P:
-                                    Ss(ii) += s_p(0,i);
-                                    break;
-                                  case SECTION_RESPONSE_MZ:
-                                    Ss(ii) += s_p(1,i);
-                                    break;
-                                  case SECTION_RESPONSE_VY:
-                                    Ss(ii) += s_p(2,i);
-                                    break;
-                                  default:
-                                    break;
-                                  }
-                              }
-                          }
-    
-                        // dSs = Ss - Ssr[i];
-                        dSs= Ss;
-                        dSs.addVector(1.0, section_matrices.getSsrSubdivide()[i], -1.0);
-    
-                        // compute section deformation increments
-                        if(l==0)
-                          {
-                            //  regular newton
-                            //    vs += fs * dSs;
-                            dvs.addMatrixVector(0.0, section_matrices.getFsSubdivide()[i], dSs, 1.0);
-                          }
-                        else if(l == 2)
-                          {
-                            //  newton with initial tangent if first iteration
-                            //    vs += fs0 * dSs;
-                            //  otherwise regular newton
-                            //    vs += fs * dSs;
-                            if(j == 0)
-                              {
-                                const Matrix &fs0 = theSections[i]->getInitialFlexibility();
-                                dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
-                              }
-                            else
-                              dvs.addMatrixVector(0.0, section_matrices.getFsSubdivide()[i], dSs, 1.0);
-                          }
-                        else
-                          {
-                            //  newton with initial tangent
-                            //    vs += fs0 * dSs;
-                            const Matrix &fs0 = theSections[i]->getInitialFlexibility();
-                            dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
-                          }
-
-                        // set section deformations
-                        if(initialFlag != 0)
-                          section_matrices.getVsSubdivide()[i]+= dvs;
-    
-                        if(theSections[i]->setTrialSectionDeformation(section_matrices.getVsSubdivide()[i]) < 0)
-                          {
-                            std::cerr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
-                            return -1;
-                          }
-    
-                        // get section resisting forces
-                        section_matrices.getSsrSubdivide()[i] = theSections[i]->getStressResultant();
-    
-                        // get section flexibility matrix
-                        section_matrices.getFsSubdivide()[i] = theSections[i]->getSectionFlexibility();
-    
-                        // calculate section residual deformations
-                        // dvs = fs * (Ss - Ssr);
-                        dSs = Ss;
-                        dSs.addVector(1.0, section_matrices.getSsrSubdivide()[i], -1.0);  // dSs = Ss - Ssr[i];
-
-    
-                        dvs.addMatrixVector(0.0, section_matrices.getFsSubdivide()[i], dSs, 1.0);
-    
-                        // integrate element flexibility matrix
-                        // f = f + (b^ fs * b) * wtL;
-                        //f.addMatrixTripleProduct(1.0, b[i], fs[i], wtL);
-    
-                        const Matrix &fSec = section_matrices.getFsSubdivide()[i];
-                        fb.Zero();
                         double tmp;
-                        for(int ii = 0; ii < order; ii++)
-                          {
-                            switch(code(ii))
-                              {
-                              case SECTION_RESPONSE_P:
-                                for(int jj= 0;jj<order;jj++)
-                                  fb(jj,0) += fSec(jj,ii)*wtL;
-                                break;
-                              case SECTION_RESPONSE_MZ:
-                                for(int jj= 0;jj<order;jj++)
-                                  {
-                                    tmp= fSec(jj,ii)*wtL;
-                                    fb(jj,1)+= xL1*tmp;
-                                    fb(jj,2)+= xL*tmp;
-                                  }
-                                break;
-                              case SECTION_RESPONSE_VY:
-                                for(int jj= 0;jj<order;jj++)
-                                  {
-                                    tmp = oneOverL*fSec(jj,ii)*wtL;
-                                    fb(jj,1) += tmp;
-                                    fb(jj,2) += tmp;
-                                  }
-                                break;
-                              default:
-                                break;
-                              }
-                          }
-    
                         for(int ii = 0; ii < order; ii++)
                           {
                             switch(code(ii))
@@ -628,11 +710,10 @@ int XC::ForceBeamColumn2d::update(void)
                                 break;
                               }
                            }
-    
+
                         // integrate residual deformations
                         // vr += (b^ (vs + dvs)) * wtL;
                         //vr.addMatrixTransposeVector(1.0, b[i], vs[i] + dvs, wtL);
-                        dvs.addVector(1.0, section_matrices.getVsSubdivide()[i], 1.0);
 
                         double dei;
                         for(int ii= 0;ii<order;ii++)
@@ -1050,7 +1131,7 @@ int XC::ForceBeamColumn2d::getInitialFlexibility(Matrix &fe) const
 void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectionCoords,std::vector<Vector> &sectionDispls) const
   {
     // get basic displacements and increments
-    static Vector ub(NEBD);
+    static thread_local Vector ub(NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     const double L = theCoordTransf->getInitialLength();
@@ -1059,7 +1140,7 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
     //   const XC::Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
     // get integration point positions and weights
     const size_t numSections= getNumSections();
-    static double pts[SectionMatrices::maxNumSections];
+    static thread_local double pts[SectionMatrices::maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, pts);
 
     // setup Vandermode and CBDI influence matrices
@@ -1071,7 +1152,7 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
 
     // get section curvatures
     Vector kappa(numSections);  // curvature
-    static XC::Vector vs;              // section deformations
+    static thread_local XC::Vector vs;              // section deformations
 
     for(size_t i=0; i<numSections; i++)
       {
@@ -1097,8 +1178,8 @@ void XC::ForceBeamColumn2d::compSectionDisplacements(std::vector<Vector> &sectio
       }
 
      Vector w(numSections);
-     static XC::Vector xl(NDM), uxb(NDM);
-     static XC::Vector xg(NDM), uxg(NDM);
+     static thread_local XC::Vector xl(NDM), uxb(NDM);
+     static thread_local XC::Vector xg(NDM), uxg(NDM);
 
      // w = ls * kappa;
      w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -1153,8 +1234,8 @@ void XC::ForceBeamColumn2d::Print(std::ostream &s, int flag)
         s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << std::endl;
 
         // plastic hinge rotation
-        static Vector vp(3);
-        static Matrix fe(3,3);
+        static thread_local Vector vp(3);
+        static thread_local Matrix fe(3,3);
         this->getInitialFlexibility(fe);
         vp= theCoordTransf->getBasicTrialDisp();
         vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -1269,8 +1350,8 @@ XC::Response *XC::ForceBeamColumn2d::setResponse(const std::vector<std::string>
 
 int XC::ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector vp(3);
-    static XC::Matrix fe(3,3);
+    static thread_local XC::Vector vp(3);
+    static thread_local XC::Matrix fe(3,3);
 
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
@@ -1364,7 +1445,7 @@ int XC::ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
         d3+= beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-        static XC::Vector d(2);
+        static thread_local XC::Vector d(2);
         d(0) = d2;
         d(1) = d3;
         return eleInfo.setVector(d);
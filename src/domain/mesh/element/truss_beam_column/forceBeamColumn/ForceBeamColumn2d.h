@@ -76,6 +76,7 @@ class ForceBeamColumn2d: public NLForceBeamColumn2dBase
 
     // following are added for subdivision of displacement increment
     int maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
+    size_t numSectionThreads; //!< number of threads used to compute the section responses.
 
     void free_mem(void);
     void alloc(const BeamIntegration &);
@@ -101,6 +102,10 @@ class ForceBeamColumn2d: public NLForceBeamColumn2dBase
     int revertToLastCommit(void);        
     int revertToStart(void);
     int update(void);    
+    //! @brief Return the number of threads used to compute the section responses.
+    inline size_t getNumSectionThreads(void) const
+      { return numSectionThreads; }
+    void setNumSectionThreads(const size_t &);
   
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;    
@@ -133,6 +138,8 @@ class ForceBeamColumn2d: public NLForceBeamColumn2dBase
     void getForceInterpolatMatrix(double xi, Matrix &b, const ID &code);
     void getDistrLoadInterpolatMatrix(double xi, Matrix &bp, const ID &code);
     void compSectionDisplacements(std::vector<Vector> &,std::vector<Vector> &) const;
+    int computeSectionResponse(const size_t &,const int &,const int &,const double &,const double &,const double &,const Vector &,Matrix &,Vector &);
+    int computeSectionResponses(const int &,const int &,const double *,const double *,const double &,const Vector &,std::vector<Matrix> &,std::vector<Vector> &);
   };
 
 std::ostream &operator<<(std::ostream &, ForceBeamColumn2d &);
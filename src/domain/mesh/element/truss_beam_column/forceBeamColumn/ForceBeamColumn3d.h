@@ -72,6 +72,8 @@ class ForceBeamColumn3d: public NLForceBeamColumn3dBase
     void getForceInterpolatMatrix(double xi, Matrix &b, const ID &code);
     void getDistrLoadInterpolatMatrix(double xi, Matrix &bp, const ID &code);
     void compSectionDisplacements(std::vector<Vector> &,std::vector<Vector> &) const;
+    int computeSectionResponse(const size_t &,const int &,const int &,const double &,const double &,const double &,const EsfBeamColumn3d &,Matrix &,Vector &);
+    int computeSectionResponses(const int &,const int &,const double *,const double *,const double &,const EsfBeamColumn3d &,std::vector<Matrix> &,std::vector<Vector> &);
   
     // internal data
     BeamIntegration *beamIntegr;
@@ -80,6 +82,7 @@ class ForceBeamColumn3d: public NLForceBeamColumn3dBase
   
     // following are added for subdivision of displacement increment
     int maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
+    size_t numSectionThreads; //!< number of threads used to compute the section responses.
   
 
   protected:
@@ -106,6 +109,10 @@ class ForceBeamColumn3d: public NLForceBeamColumn3dBase
     int revertToLastCommit(void);        
     int revertToStart(void);
     int update(void);    
+    //! @brief Return the number of threads used to compute the section responses.
+    inline size_t getNumSectionThreads(void) const
+      { return numSectionThreads; }
+    void setNumSectionThreads(const size_t &);
   
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;    
@@ -83,7 +83,7 @@ void XC::BeamIntegration::getWeightsDeriv(int nIP, double L, double dLdh,double
 //! @brief Returns the weights (entre 0 y 1).
 const XC::Vector &XC::BeamIntegration::getIntegrPointWeights(int numSections, double L) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::vector<double> wi(numSections);
     getSectionWeights(numSections,L,&wi[0]);
     retval= Vector(&wi[0],numSections);
@@ -93,7 +93,7 @@ const XC::Vector &XC::BeamIntegration::getIntegrPointWeights(int numSections, do
 //! @brief Returns the normalized coordinates (entre 0 y 1).
 const XC::Matrix &XC::BeamIntegration::getIntegrPointCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     std::vector<double> xi(numSections);
     getSectionLocations(numSections,L,&xi[0]);
     retval= Matrix(&xi[0],numSections,1);
@@ -103,7 +103,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointCoords(int numSections, dou
 //! @brief Returns the coordenadas naturales (entre -1 y 1) a partir de las normalizadas.
 const XC::Matrix &XC::BeamIntegration::getIntegrPointNaturalCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getIntegrPointCoords(numSections,L); //normalized coordinates.
     for(int i = 0;i<numSections; i++)
       retval(i,1)= 2.0*retval(i,1) - 1.0;
@@ -113,7 +113,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointNaturalCoords(int numSectio
 //! @brief Returns the coordenadas locales (entre 0 y L) a partir de las normalizadas.
 const XC::Matrix &XC::BeamIntegration::getIntegrPointLocalCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getIntegrPointCoords(numSections,L); //normalized coordinates.
     for(int i = 0;i<numSections; i++)
       retval(i,1)*= L;
@@ -132,7 +132,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointNormalizedCoords(int nIP,co
 const XC::Matrix &XC::BeamIntegration::getIntegrPointLocalCoords(int nIP,const CrdTransf &trf) const
   {
     const Matrix tmp= getIntegrPointLocalCoords(nIP,trf.getInitialLength());
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval.resize(nIP,3);
     retval.Zero();
     for(int i= 0;i<nIP;i++)
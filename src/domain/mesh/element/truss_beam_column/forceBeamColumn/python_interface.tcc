@@ -22,9 +22,11 @@
 //python_interface.tcc
 
 class_<XC::ForceBeamColumn2d, bases<XC::NLForceBeamColumn2dBase>, boost::noncopyable >("ForceBeamColumn2d", no_init)
+  .add_property("numSectionThreads",&XC::ForceBeamColumn2d::getNumSectionThreads,&XC::ForceBeamColumn2d::setNumSectionThreads,"Number of threads used to compute the section responses (0: default, 1: serial).")
    ;
 
 class_<XC::ForceBeamColumn3d, bases<XC::NLForceBeamColumn3dBase>, boost::noncopyable >("ForceBeamColumn3d", no_init)
+  .add_property("numSectionThreads",&XC::ForceBeamColumn3d::getNumSectionThreads,&XC::ForceBeamColumn3d::setNumSectionThreads,"Number of threads used to compute the section responses (0: default, 1: serial).")
    ;
 
 #include "beam_integration/python_interface.tcc"
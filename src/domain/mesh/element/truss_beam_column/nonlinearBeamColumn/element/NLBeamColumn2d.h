@@ -101,7 +101,7 @@ class NLBeamColumn2d: public NLForceBeamColumn2dBase
     void getDistrLoadInterpolatMatrix(double xi, Matrix &bp, const ID &code);
     void compSectionDisplacements(std::vector<Vector> &,std::vector<Vector> &) const;
     
-    static GaussLobattoQuadRule1d01 quadRule;
+    static thread_local GaussLobattoQuadRule1d01 quadRule;
 
   protected:
     int sendData(CommParameters &);
@@ -87,7 +87,7 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::GaussLobattoQuadRule1d01 XC::NLBeamColumn3d::quadRule;
+thread_local XC::GaussLobattoQuadRule1d01 XC::NLBeamColumn3d::quadRule;
 
 // constructor:
 // invoked by a FEM_ObjectBroker, recvSelf() needs to be invoked on this object.
@@ -283,8 +283,8 @@ const XC::Matrix &XC::NLBeamColumn3d::getInitialStiff(void) const
     const Matrix &xi_pt= quadRule.getIntegrPointCoords(nSections);
     const Vector &weight= quadRule.getIntegrPointWeights(nSections);
 
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
 
     I.Zero();
     for(size_t i=0; i<NEBD; i++)
@@ -421,7 +421,7 @@ const XC::Matrix &XC::NLBeamColumn3d::getInitialStiff(void) const
       f(5,5) = DefaultLoverGJ;
 
     // calculate element stiffness matrix
-    static XC::Matrix kvInit(NEBD, NEBD);
+    static thread_local XC::Matrix kvInit(NEBD, NEBD);
     if(f.Solve(I,kvInit) < 0)
       std::cerr << "XC::NLBeamColumn3d::updateElementState() - could not invert flexibility\n";
 
@@ -442,8 +442,8 @@ int XC::NLBeamColumn3d::update(void)
     theCoordTransf->update();
 
     // get basic displacements and increments
-    static Vector v(NEBD);
-    static Vector dv(NEBD);
+    static thread_local Vector v(NEBD);
+    static thread_local Vector dv(NEBD);
 
     v = theCoordTransf->getBasicTrialDisp();
     dv = theCoordTransf->getBasicIncrDeltaDisp();
@@ -453,10 +453,10 @@ int XC::NLBeamColumn3d::update(void)
     const Matrix &xi_pt = quadRule.getIntegrPointCoords(nSections);
     const Vector &weight = quadRule.getIntegrPointWeights(nSections);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm
 
     I.Zero();
@@ -464,7 +464,7 @@ int XC::NLBeamColumn3d::update(void)
       I(i,i) = 1.0;
 
     // calculate nodal force increments and update nodal forces
-    static XC::Vector dSe(NEBD);
+    static thread_local XC::Vector dSe(NEBD);
 
     // dSe = kv * dv;
     dSe.addMatrixVector(0.0, kv, dv, 1.0);
@@ -1003,7 +1003,7 @@ void XC::NLBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectionCo
     theCoordTransf->update();
 
     // get basic displacements and increments
-    static XC::Vector ub(NEBD);
+    static thread_local XC::Vector ub(NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     // get integration point positions and weights
@@ -1021,7 +1021,7 @@ void XC::NLBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectionCo
     // get section curvatures
     Vector kappa_y(nSections);  // curvature
     Vector kappa_z(nSections);  // curvature
-    static XC::Vector vs;                // section deformations
+    static thread_local XC::Vector vs;                // section deformations
 
     for(size_t i=0; i<nSections; i++)
       {
@@ -1056,8 +1056,8 @@ void XC::NLBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectionCo
       }
 
     Vector v(nSections), w(nSections);
-    static XC::Vector xl(NDM), uxb(NDM);
-    static XC::Vector xg(NDM), uxg(NDM);
+    static thread_local XC::Vector xl(NDM), uxb(NDM);
+    static thread_local XC::Vector xg(NDM), uxg(NDM);
     // double theta;                             // angle of twist of the sections
 
     // v = ls * kappa_z;
@@ -1126,9 +1126,9 @@ void XC::NLBeamColumn3d::Print(std::ostream &s, int flag)
    }
 
    else if(flag == 1) {
-     static XC::Vector xAxis(3);
-     static XC::Vector yAxis(3);
-     static XC::Vector zAxis(3);
+     static thread_local XC::Vector xAxis(3);
+     static thread_local XC::Vector yAxis(3);
+     static thread_local XC::Vector zAxis(3);
 
      theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1222,8 +1222,8 @@ XC::Response *XC::NLBeamColumn3d::setResponse(const std::vector<std::string> &ar
 
 int XC::NLBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
-  static XC::Vector force(12);
-  static XC::Vector defoAndForce(24);
+  static thread_local XC::Vector force(12);
+  static thread_local XC::Vector defoAndForce(24);
   double V, N, T, M1, M2;
   int i;
   const double L = theCoordTransf->getInitialLength();
@@ -80,7 +80,7 @@ class GaussLobattoQuadRule1d01;
 class NLBeamColumn3d: public  NLForceBeamColumn3dBase
   {
   private:
-    static GaussLobattoQuadRule1d01 quadRule;
+    static thread_local GaussLobattoQuadRule1d01 quadRule;
 
     void getGlobalDispls(Vector &dg) const;
     void getGlobalAccels(Vector &ag) const;             
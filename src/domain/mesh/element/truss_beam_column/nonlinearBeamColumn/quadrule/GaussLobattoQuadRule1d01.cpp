@@ -61,6 +61,10 @@
 #include <utility/matrix/Matrix.h>
 
 #include "GaussLobattoQuadRule1d01.h"
+#include <mutex>
+
+//! @brief Serializes the (lazy) initialization of the class-wide tables.
+static std::mutex dataSetMutex;
 
 bool XC::GaussLobattoQuadRule1d01::dataSet = false;
 
@@ -90,6 +94,7 @@ double XC::GaussLobattoQuadRule1d01::wtsArray[maxOrder*(maxOrder+1)/2];
 XC::GaussLobattoQuadRule1d01::GaussLobattoQuadRule1d01()
   :order(0), myPts(0), myWts(0)
 {
+  std::lock_guard<std::mutex> lock(dataSetMutex);
   if (dataSet == false) {
 
     // Not used!!!
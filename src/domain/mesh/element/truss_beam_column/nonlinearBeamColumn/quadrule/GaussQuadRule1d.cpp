@@ -59,6 +59,10 @@
 #include <utility/matrix/Matrix.h>
 
 #include "GaussQuadRule1d.h"
+#include <mutex>
+
+//! @brief Serializes the (lazy) initialization of the class-wide tables.
+static std::mutex dataSetMutex;
 
 bool XC::GaussQuadRule1d::dataSet = false;
 
@@ -90,6 +94,7 @@ double XC::GaussQuadRule1d::wtsArray[maxOrder*(maxOrder+1)/2];
 XC::GaussQuadRule1d::GaussQuadRule1d()
   :order(0), myPts(0), myWts(0)
 {
+  std::lock_guard<std::mutex> lock(dataSetMutex);
   if (dataSet == false) {
     // One point
     ptsArray[0] = 0.0;
@@ -59,6 +59,10 @@
 #include <utility/matrix/Matrix.h>
 
 #include "GaussQuadRule1d01.h"
+#include <mutex>
+
+//! @brief Serializes the (lazy) initialization of the class-wide tables.
+static std::mutex dataSetMutex;
 
 bool XC::GaussQuadRule1d01::dataSet = false;
 
@@ -90,6 +94,7 @@ double XC::GaussQuadRule1d01::wtsArray[maxOrder*(maxOrder+1)/2];
 XC::GaussQuadRule1d01::GaussQuadRule1d01()
   :order(0), myPts(0), myWts(0)
 {
+  std::lock_guard<std::mutex> lock(dataSetMutex);
   if (dataSet == false) {
     // One point
     ptsArray[0] = 0.0;
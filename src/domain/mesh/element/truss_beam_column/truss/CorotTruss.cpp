@@ -298,7 +298,7 @@ int XC::CorotTruss::update(void)
 //! @brief Return tangent stiffness matrix.
 const XC::Matrix &XC::CorotTruss::getTangentStiff(void) const
   {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -329,10 +329,10 @@ const XC::Matrix &XC::CorotTruss::getTangentStiff(void) const
       }
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_class_wide_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -348,14 +348,14 @@ const XC::Matrix &XC::CorotTruss::getTangentStiff(void) const
           }
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 //! @brief Return initial stiffness matrix.
 const XC::Matrix &XC::CorotTruss::getInitialStiff(void) const
   {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     if(A<1e-8)
       std::clog << getClassName() << "::" << __FUNCTION__
@@ -366,10 +366,10 @@ const XC::Matrix &XC::CorotTruss::getInitialStiff(void) const
     kl(0,0)= A*theMaterial->getInitialTangent() / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_class_wide_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -385,8 +385,8 @@ const XC::Matrix &XC::CorotTruss::getInitialStiff(void) const
           }
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 const XC::Material *XC::CorotTruss::getMaterial(void) const
@@ -399,7 +399,7 @@ double XC::CorotTruss::getRho(void) const
 
 const XC::Matrix &XC::CorotTruss::getMass(void) const
   {
-    Matrix &Mass = *theMatrix;
+    Matrix &Mass = get_class_wide_matrix();
     Mass.Zero();
 
     const double rho= getRho();
@@ -415,8 +415,8 @@ const XC::Matrix &XC::CorotTruss::getMass(void) const
         Mass(i+numDOF2,i+numDOF2) = M;
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 //! @brief Zeroes loads on element.
@@ -468,16 +468,16 @@ const XC::Vector &XC::CorotTruss::getResistingForce(void) const
     double SA= getAxialForce();
     SA /= Ln;
 
-    static Vector ql(3);
+    static thread_local Vector ql(3);
 
     ql(0) = d21[0]*SA;
     ql(1) = d21[1]*SA;
     ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    static thread_local Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = get_class_wide_vector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -488,15 +488,15 @@ const XC::Vector &XC::CorotTruss::getResistingForce(void) const
         P(i+numDOF2) =  qg(i);
       }
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_class_wide_vector()*=dead_srf;
+    return get_class_wide_vector();
   }
 
 
 
 const XC::Vector &XC::CorotTruss::getResistingForceIncInertia(void) const
   {
-    Vector &P = *theVector;
+    Vector &P = get_class_wide_vector();
     P = this->getResistingForce();
 
     const double rho= getRho();
@@ -516,11 +516,11 @@ const XC::Vector &XC::CorotTruss::getResistingForceIncInertia(void) const
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullValues())
-      *theVector+= this->getRayleighDampingForces();
+      get_class_wide_vector()+= this->getRayleighDampingForces();
 
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_class_wide_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_class_wide_vector();
   }
 
 
@@ -293,7 +293,7 @@ int XC::CorotTrussSection::update(void)
         int order = theSection->getOrder();
         const XC::ID &code = theSection->getType();
 
-        static double data[10];
+        static thread_local double data[10];
         Vector e(data, order);
         for(i = 0; i < order; i++) {
                 if(code(i) == SECTION_RESPONSE_P)
@@ -308,7 +308,7 @@ int XC::CorotTrussSection::update(void)
 
 const XC::Matrix &XC::CorotTrussSection::getTangentStiff(void) const
   {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -349,10 +349,10 @@ const XC::Matrix &XC::CorotTrussSection::getTangentStiff(void) const
     }
 
     // Compute R'*kl*R
-    static XC::Matrix kg(3,3);
+    static thread_local XC::Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_class_wide_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -366,13 +366,13 @@ const XC::Matrix &XC::CorotTrussSection::getTangentStiff(void) const
         }
     }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 const XC::Matrix &XC::CorotTrussSection::getInitialStiff(void) const
   {
-    static Matrix kl(3,3);
+    static thread_local Matrix kl(3,3);
 
     // Material stiffness
     //
@@ -394,10 +394,10 @@ const XC::Matrix &XC::CorotTrussSection::getInitialStiff(void) const
     kl(0,0) = EA / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    static thread_local Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_class_wide_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -411,8 +411,8 @@ const XC::Matrix &XC::CorotTrussSection::getInitialStiff(void) const
       }
     }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
 }
 
 const XC::Material *XC::CorotTrussSection::getMaterial(void) const
@@ -426,7 +426,7 @@ double XC::CorotTrussSection::getRho(void) const
 
 const XC::Matrix &XC::CorotTrussSection::getMass(void) const
   {
-    Matrix &Mass = *theMatrix;
+    Matrix &Mass = get_class_wide_matrix();
     Mass.Zero();
 
     const double rho= getRho();
@@ -442,8 +442,8 @@ const XC::Matrix &XC::CorotTrussSection::getMass(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 int XC::CorotTrussSection::addLoad(ElementalLoad *theLoad, double loadFactor)
@@ -473,16 +473,16 @@ const XC::Vector &XC::CorotTrussSection::getResistingForce(void) const
 
         SA /= Ln;
 
-    static XC::Vector ql(3);
+    static thread_local XC::Vector ql(3);
 
         ql(0) = d21[0]*SA;
         ql(1) = d21[1]*SA;
         ql(2) = d21[2]*SA;
 
-    static XC::Vector qg(3);
+    static thread_local XC::Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = get_class_wide_vector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -493,13 +493,13 @@ const XC::Vector &XC::CorotTrussSection::getResistingForce(void) const
     }
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_class_wide_vector()*=dead_srf;
+    return get_class_wide_vector();
 }
 
 const XC::Vector &XC::CorotTrussSection::getResistingForceIncInertia(void) const
   {
-    Vector &P = *theVector;
+    Vector &P = get_class_wide_vector();
     P = this->getResistingForce();
 
     const double rho= getRho();
@@ -518,11 +518,11 @@ const XC::Vector &XC::CorotTrussSection::getResistingForceIncInertia(void) const
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullValues())
-      *theVector+= this->getRayleighDampingForces();
+      get_class_wide_vector()+= this->getRayleighDampingForces();
 
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_class_wide_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_class_wide_vector();
   }
 
 int XC::CorotTrussSection::sendSelf(CommParameters &cp)
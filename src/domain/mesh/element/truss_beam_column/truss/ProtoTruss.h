@@ -46,24 +46,24 @@ class ProtoTruss : public Element1D
   protected:
     int numDOF; //!< number of dof for truss
     int dimSpace; //!< truss in 2 or 3d domain
-    Matrix *theMatrix; //!< pointer to objects matrix (a class wide Matrix)
-    Vector *theVector; //!< pointer to objects vector (a class wide Vector)
 
-    // static data - single copy for all objects of the class	
-    static Matrix trussM2;   // class wide matrix for 2*2
-    static Matrix trussM3;   // class wide matrix for 3*3
-    static Matrix trussM4;   // class wide matrix for 4*4
-    static Matrix trussM6;   // class wide matrix for 6*6
-    static Matrix trussM12;  // class wide matrix for 12*12
-    static Vector trussV2;   // class wide Vector for size 2
-    static Vector trussV3;   // class wide Vector for size 3
-    static Vector trussV4;   // class wide Vector for size 44
-    static Vector trussV6;   // class wide Vector for size 6
-    static Vector trussV12;  // class wide Vector for size 12
+    // static data - single copy (per thread) for all objects of the class	
+    static thread_local Matrix trussM2;   // class wide matrix for 2*2
+    static thread_local Matrix trussM3;   // class wide matrix for 3*3
+    static thread_local Matrix trussM4;   // class wide matrix for 4*4
+    static thread_local Matrix trussM6;   // class wide matrix for 6*6
+    static thread_local Matrix trussM12;  // class wide matrix for 12*12
+    static thread_local Vector trussV2;   // class wide Vector for size 2
+    static thread_local Vector trussV3;   // class wide Vector for size 3
+    static thread_local Vector trussV4;   // class wide Vector for size 44
+    static thread_local Vector trussV6;   // class wide Vector for size 6
+    static thread_local Vector trussV12;  // class wide Vector for size 12
 
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
     void setup_matrix_vector_ptrs(int dofNd1);
+    Matrix &get_class_wide_matrix(void) const;
+    Vector &get_class_wide_vector(void) const;
 
   public:
     ProtoTruss(int tag, int classTag,int Nd1,int Nd2,int ndof,int dimSpace);
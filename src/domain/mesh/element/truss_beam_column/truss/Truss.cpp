@@ -222,8 +222,6 @@ void XC::Truss::setDomain(Domain *theDomain)
       {
         // fill this in so don't segment fault later
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
         return;
       }
 
@@ -242,8 +240,6 @@ void XC::Truss::setDomain(Domain *theDomain)
 
         // fill this in so don't segment fault later
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
         return;
       }
 
@@ -317,14 +313,14 @@ const XC::Matrix &XC::Truss::getTangentStiff(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_class_wide_matrix().Zero();
+        return get_class_wide_matrix();
       }
 
     double E = theMaterial->getTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff= *theMatrix;
+    Matrix &stiff= get_class_wide_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -350,14 +346,14 @@ const XC::Matrix &XC::Truss::getInitialStiff(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_class_wide_matrix().Zero();
+        return get_class_wide_matrix();
       }
 
     const double E = theMaterial->getInitialTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = get_class_wide_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -373,8 +369,8 @@ const XC::Matrix &XC::Truss::getInitialStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 //! @brief Returns the damping matrix.
@@ -382,14 +378,14 @@ const XC::Matrix &XC::Truss::getDamp(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_class_wide_matrix().Zero();
+        return get_class_wide_matrix();
       }
 
     double eta = theMaterial->getDampTangent();
 
     // come back later and redo this if too slow
-    Matrix &damp = *theMatrix;
+    Matrix &damp = get_class_wide_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -422,7 +418,7 @@ double XC::Truss::getRho(void) const
 const XC::Matrix &XC::Truss::getMass(void) const
   {
     // zero the matrix
-    Matrix &mass= *theMatrix;
+    Matrix &mass= get_class_wide_matrix();
     mass.Zero();
 
     const double rho= getRho();
@@ -604,8 +600,8 @@ const XC::Vector &XC::Truss::getResistingForce(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theVector->Zero();
-        return *theVector;
+        get_class_wide_vector().Zero();
+        return get_class_wide_vector();
       }
 
     // R = Ku - Pext
@@ -616,16 +612,16 @@ const XC::Vector &XC::Truss::getResistingForce(void) const
     for(int i = 0; i < getNumDIM(); i++)
       {
         temp = cosX[i]*force;
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        get_class_wide_vector()(i) = -temp;
+        get_class_wide_vector()(i+numDOF2) = temp;
       }
 
     // subtract external load:  Ku - P
-    (*theVector)-= *getLoad();
+    get_class_wide_vector()-= *getLoad();
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_class_wide_vector()*=dead_srf;
+    return get_class_wide_vector();
   }
 
 //! @brief Returns the reaction of the element includin inertia forces.
@@ -645,23 +641,23 @@ const XC::Vector &XC::Truss::getResistingForceIncInertia(void) const
         const double M = 0.5*rho*L;
         for(int i = 0; i < getNumDIM(); i++)
           {
-            (*theVector)(i) += M*accel1(i);
-            (*theVector)(i+numDOF2) += M*accel2(i);
+            get_class_wide_vector()(i) += M*accel1(i);
+            get_class_wide_vector()(i+numDOF2) += M*accel2(i);
           }
 
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullValues())
-          (*theVector)+= this->getRayleighDampingForces();
+          get_class_wide_vector()+= this->getRayleighDampingForces();
       }
     else
       {
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullKValues())
-          (*theVector) += this->getRayleighDampingForces();
+          get_class_wide_vector() += this->getRayleighDampingForces();
       }
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_class_wide_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_class_wide_vector();
   }
 
 //! @brief Returns a vector to store the dbTags
@@ -750,10 +746,10 @@ void XC::Truss::Print(std::ostream &s, int flag)
             for(int i = 0; i < getNumDIM(); i++)
               {
                 temp = cosX[i]*force;
-                (*theVector)(i) = -temp;
-                (*theVector)(i+numDOF2) = temp;
+                get_class_wide_vector()(i) = -temp;
+                get_class_wide_vector()(i+numDOF2) = temp;
               }
-            s << " \n\t unbalanced load: " << *theVector;
+            s << " \n\t unbalanced load: " << get_class_wide_vector();
           }
         s << " \t XC::Material: " << *theMaterial;
         s << std::endl;
@@ -817,7 +813,7 @@ XC::Response *XC::Truss::setResponse(const std::vector<std::string> &argv, Infor
       return new ElementResponse(this, 2, 0.0);
     // tangent stiffness matrix
     else if(argv[0] == "stiff")
-      return new ElementResponse(this, 3, *theMatrix);
+      return new ElementResponse(this, 3, get_class_wide_matrix());
     // a material quantity
     else if(argv[0] == "material" || argv[0] == "-material")
       return  setMaterialResponse(theMaterial,argv,1,eleInfo);
@@ -901,7 +897,7 @@ int XC::Truss::activateParameter(int passedParameterID)
 
 const XC::Matrix &XC::Truss::getKiSensitivity(int gradNumber)
   {
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = get_class_wide_matrix();
     stiff.Zero();
 
     if(parameterID == 0)
@@ -952,7 +948,7 @@ const XC::Matrix &XC::Truss::getKiSensitivity(int gradNumber)
 
 const XC::Matrix &XC::Truss::getMassSensitivity(int gradNumber)
   {
-    Matrix &mass = *theMatrix;
+    Matrix &mass = get_class_wide_matrix();
     mass.Zero();
 
     if(parameterID == 2)
@@ -971,7 +967,7 @@ const XC::Matrix &XC::Truss::getMassSensitivity(int gradNumber)
 
 const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
   {
-    theVector->Zero();
+    get_class_wide_vector().Zero();
 
     // Initial declarations
     int i;
@@ -1078,15 +1074,15 @@ const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
     if(parameterID == 1) {            // Cross-sectional area
       for(i = 0; i < getNumDIM(); i++) {
         temp = (stress + A*stressSensitivity)*cosX[i];
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        get_class_wide_vector()(i) = -temp;
+        get_class_wide_vector()(i+numDOF2) = temp;
       }
     }
     else {        // Density, material parameter or nodal coordinate
       for(i = 0; i < getNumDIM(); i++) {
         temp = A*(stressSensitivity*cosX[i] + stress*dcosXdh[i]);
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        get_class_wide_vector()(i) = -temp;
+        get_class_wide_vector()(i+numDOF2) = temp;
       }
     }
 
@@ -1094,9 +1090,9 @@ const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
     if(!theLoadSens)
       set_load_sens(Vector(numDOF));
 
-    (*theVector)-= *theLoadSens;
+    get_class_wide_vector()-= *theLoadSens;
 
-    return *theVector;
+    return get_class_wide_vector();
   }
 
 int XC::Truss::commitSensitivity(int gradNumber, int numGrads)
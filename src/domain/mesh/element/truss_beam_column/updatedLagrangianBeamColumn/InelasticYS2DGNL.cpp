@@ -47,7 +47,7 @@
 #define TAG_InelasticYS2DGNL -1
 
 // Vector XC::InelasticYS2DGNL::trialForce(6);
- XC::Vector XC::InelasticYS2DGNL::elasticForce(6);
+ thread_local XC::Vector XC::InelasticYS2DGNL::elasticForce(6);
  XC::Vector XC::InelasticYS2DGNL::F1(6);
  XC::Vector XC::InelasticYS2DGNL::F2(6);
  XC::Vector XC::InelasticYS2DGNL::Fs(6);
@@ -120,6 +120,11 @@ XC::InelasticYS2DGNL::~InelasticYS2DGNL(void)
           //~ delete theMap;
   }
 
+//! @brief Returns false; the class-wide data (storage) is modified
+//! during the state determination.
+bool XC::InelasticYS2DGNL::isThreadSafe(void) const
+  { return false; }
+
 // do everything here
 int XC::InelasticYS2DGNL::update(void) const
 {
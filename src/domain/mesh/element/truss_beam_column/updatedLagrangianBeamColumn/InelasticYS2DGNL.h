@@ -43,7 +43,7 @@ namespace XC {
 class InelasticYS2DGNL : public UpdatedLagrangianBeam2D
 {
  protected:
-  static Vector elasticForce;
+  static thread_local Vector elasticForce;
   static Vector F1, F2, Fs;
   
 
@@ -81,6 +81,7 @@ class InelasticYS2DGNL : public UpdatedLagrangianBeam2D
   virtual const	Matrix &getTangentStiff(void) const;
   virtual int commitState(void);
   virtual int update(void) const;
+  virtual bool isThreadSafe(void) const;
   void Print(std::ostream &s, int flag =0);
   int sendSelf(CommParameters &);
   int recvSelf(const CommParameters &);
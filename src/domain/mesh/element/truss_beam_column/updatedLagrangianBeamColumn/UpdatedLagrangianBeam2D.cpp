@@ -62,15 +62,15 @@
  XC::Matrix XC::UpdatedLagrangianBeam2D::K(6,6);
  XC::Matrix XC::UpdatedLagrangianBeam2D::Kg(6,6);
  XC::Matrix XC::UpdatedLagrangianBeam2D::Kt(6,6);
- XC::Matrix XC::UpdatedLagrangianBeam2D::M(6,6);
- XC::Matrix XC::UpdatedLagrangianBeam2D::D(6,6);
- XC::Matrix XC::UpdatedLagrangianBeam2D::T(6,6);
- XC::Vector XC::UpdatedLagrangianBeam2D::force(6);
- XC::Vector XC::UpdatedLagrangianBeam2D::disp(6);
- XC::Vector XC::UpdatedLagrangianBeam2D::ZeroVector(6);
- XC::Matrix XC::UpdatedLagrangianBeam2D::ZeroMatrix(6,6);
- XC::Vector XC::UpdatedLagrangianBeam2D::end1IncrDisp(3);
- XC::Vector XC::UpdatedLagrangianBeam2D::end2IncrDisp(3);
+ thread_local XC::Matrix XC::UpdatedLagrangianBeam2D::M(6,6);
+ thread_local XC::Matrix XC::UpdatedLagrangianBeam2D::D(6,6);
+ thread_local XC::Matrix XC::UpdatedLagrangianBeam2D::T(6,6);
+ thread_local XC::Vector XC::UpdatedLagrangianBeam2D::force(6);
+ thread_local XC::Vector XC::UpdatedLagrangianBeam2D::disp(6);
+ thread_local XC::Vector XC::UpdatedLagrangianBeam2D::ZeroVector(6);
+ thread_local XC::Matrix XC::UpdatedLagrangianBeam2D::ZeroMatrix(6,6);
+ thread_local XC::Vector XC::UpdatedLagrangianBeam2D::end1IncrDisp(3);
+ thread_local XC::Vector XC::UpdatedLagrangianBeam2D::end2IncrDisp(3);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
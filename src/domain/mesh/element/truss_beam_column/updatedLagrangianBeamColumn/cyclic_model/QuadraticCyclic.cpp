@@ -29,7 +29,7 @@
 #include "QuadraticCyclic.h"
 #include <cmath>
 
-XC::Matrix XC::QuadraticCyclic::X(3,3);
+thread_local XC::Matrix XC::QuadraticCyclic::X(3,3);
 XC::Vector XC::QuadraticCyclic::Y(3);
 XC::Vector XC::QuadraticCyclic::A(3);
 
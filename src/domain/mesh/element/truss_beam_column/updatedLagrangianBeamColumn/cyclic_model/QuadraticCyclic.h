@@ -41,7 +41,7 @@ class QuadraticCyclic : public CyclicModel
     double a, b, c;
     double weightFactor, facty;
     double qx1, qy1, qx2, qy2, qx3, qy3;
-    static Matrix X;
+    static thread_local Matrix X;
     static Vector Y, A;
   public:
     QuadraticCyclic(int tag, double wt=0.9, double qy=0.33);
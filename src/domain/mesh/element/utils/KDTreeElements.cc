@@ -40,47 +40,116 @@ XC::ElemPos::ElemPos(const Pos3d &p)
   
 //! @brief Constructor.
 XC::KDTreeElements::KDTreeElements(void)
-  : tree_type(std::ptr_fun(ElemPos::tac)), pend_optimizar(0) {}
-
+  : tree_type() {}
 
+//! @brief Inserts the element in the tree.
 void XC::KDTreeElements::insert(const Element &n)
-  {
-    tree_type::insert(n);
-  }
+  { tree_type::insert(ElemPos(n)); }
 
+//! @brief Removes the element from the tree.
 void XC::KDTreeElements::erase(const Element &n)
-  {
-    tree_type::erase(n);
-    pend_optimizar++;
-    if(pend_optimizar>=10)
-      {
-	tree_type::optimise();
-        pend_optimizar= 0;
-      }
-  }
+  { tree_type::erase(ElemPos(n)); }
 
+//! @brief Removes all the items of the tree.
 void XC::KDTreeElements::clear(void)
   { tree_type::clear(); }
 
-//! @brief Returns the node closest to the position being passed as parameter.
+//! @brief Return the elements of the positions being passed as parameter.
+static std::vector<const XC::Element *> get_elements(const XC::KDTreeElements::tree_type::result_type &found)
+  {
+    std::vector<const XC::Element *> retval;
+    retval.reserve(found.size());
+    for(XC::KDTreeElements::tree_type::result_type::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back((*i)->getElementPtr());
+    return retval;
+  }
+
+//! @brief Return the positions to search for.
+static std::vector<XC::ElemPos> get_targets(const std::vector<Pos3d> &positions)
+  {
+    std::vector<XC::ElemPos> retval;
+    retval.reserve(positions.size());
+    for(std::vector<Pos3d>::const_iterator i= positions.begin();i!=positions.end();i++)
+      retval.push_back(XC::ElemPos(*i));
+    return retval;
+  }
+
+//! @brief Returns the element closest to the position being passed as parameter.
 const XC::Element *XC::KDTreeElements::getNearest(const Pos3d &pos) const
   {
     const Element *retval= nullptr;
-    ElemPos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target);
-    if(found.first != end())
-      retval= found.first->getElementPtr();
+    const ElemPos *found= find_nearest(ElemPos(pos));
+    if(found)
+      retval= found->getElementPtr();
     return retval;
   }
 
-//! @brief Returns the element closest to the position
-//! being passed as parameter.
+//! @brief Returns the element closest to the position being passed as parameter
+//! whose distance is not greater than r.
 const XC::Element *XC::KDTreeElements::getNearest(const Pos3d &pos, const double &r) const
   {
     const Element *retval= nullptr;
-    ElemPos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target,r);
-    if(found.first != end())
-      retval= found.first->getElementPtr();
+    const ElemPos *found= find_nearest(ElemPos(pos),r);
+    if(found)
+      retval= found->getElementPtr();
+    return retval;
+  }
+
+//! @brief Returns the elements closest to each one of the positions
+//! being passed as parameter.
+//! @param positions: positions to search for.
+//! @param nThreads: number of threads used to run the queries.
+std::vector<const XC::Element *> XC::KDTreeElements::getNearest(const std::vector<Pos3d> &positions,const size_t &nThreads) const
+  {
+    const tree_type::result_type found= find_nearest(get_targets(positions),nThreads);
+    std::vector<const Element *> retval(found.size(),nullptr);
+    for(size_t i= 0;i<found.size();i++)
+      if(found[i])
+        retval[i]= found[i]->getElementPtr();
     return retval;
   }
+
+//! @brief Returns the k elements closest to the position being passed
+//! as parameter (sorted by distance).
+std::vector<const XC::Element *> XC::KDTreeElements::getKNearest(const Pos3d &pos,const size_t &k) const
+  { return get_elements(find_k_nearest(ElemPos(pos),k)); }
+
+//! @brief Returns the k elements closest to each one of the positions
+//! being passed as parameter (sorted by distance).
+//! @param positions: positions to search for.
+//! @param k: number of elements to search for each position.
+//! @param nThreads: number of threads used to run the queries.
+std::vector<std::vector<const XC::Element *> > XC::KDTreeElements::getKNearest(const std::vector<Pos3d> &positions,const size_t &k,const size_t &nThreads) const
+  {
+    const std::vector<tree_type::result_type> found= find_k_nearest(get_targets(positions),k,nThreads);
+    std::vector<std::vector<const Element *> > retval;
+    retval.reserve(found.size());
+    for(std::vector<tree_type::result_type>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(get_elements(*i));
+    return retval;
+  }
+
+//! @brief Returns the elements whose distance to the position being passed
+//! as parameter is not greater than r (sorted by distance).
+std::vector<const XC::Element *> XC::KDTreeElements::getInRadius(const Pos3d &pos,const double &r) const
+  { return get_elements(find_within_range(ElemPos(pos),r)); }
+
+//! @brief Returns the elements whose distance to each one of the positions
+//! being passed as parameter is not greater than r (sorted by distance).
+//! @param positions: positions to search for.
+//! @param r: search radius.
+//! @param nThreads: number of threads used to run the queries.
+std::vector<std::vector<const XC::Element *> > XC::KDTreeElements::getInRadius(const std::vector<Pos3d> &positions,const double &r,const size_t &nThreads) const
+  {
+    const std::vector<tree_type::result_type> found= find_within_range(get_targets(positions),r,nThreads);
+    std::vector<std::vector<const Element *> > retval;
+    retval.reserve(found.size());
+    for(std::vector<tree_type::result_type>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(get_elements(*i));
+    return retval;
+  }
+
+//! @brief Returns the elements whose centroid lies inside the box
+//! defined by its lower (pMin) and upper (pMax) corners.
+std::vector<const XC::Element *> XC::KDTreeElements::getInBox(const Pos3d &pMin,const Pos3d &pMax) const
+  { return get_elements(find_within_box(ElemPos(pMin),ElemPos(pMax))); }
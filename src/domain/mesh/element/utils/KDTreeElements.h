@@ -29,7 +29,8 @@
 #define KDTreeElements_h
 
 #include "xc_utils/src/geom/pos_vec/KDTreePos.h"
-#include "xc_utils/src/kdtree++/kdtree.hpp"
+#include "utility/kdtree/FlatKDTree.h"
+#include <vector>
 
 class Pos3d;
 
@@ -48,29 +49,47 @@ class ElemPos: public KDTreePos
     explicit ElemPos(const Pos3d &p);
     inline const Element *getElementPtr(void) const
       { return elemPtr; }
-
-    static inline double tac( ElemPos p, size_t k ) { return p[k]; }
   };
 
 inline bool operator==(const ElemPos &A,const ElemPos &B)
   { return ((A.getElementPtr()== B.getElementPtr()) && (A[0] == B[0]) && (A[1] == B[1]) && (A[2] == B[2])); }
 
 
-class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_binary_function<ElemPos,size_t,double> >
+class KDTreeElements: protected FlatKDTree<ElemPos>
   {
-    size_t pend_optimizar;
   public:
-    typedef kd_tree::KDTree<3, ElemPos, std::pointer_to_binary_function<ElemPos,size_t,double> > tree_type;
+    typedef FlatKDTree<ElemPos> tree_type;
     KDTreeElements(void);
 
     void insert(const Element &);
+    template <class InputIterator>
+    void insert(InputIterator, InputIterator);
     void erase(const Element &);
     void clear(void);
+    inline size_t size(void) const
+      { return tree_type::size(); }
 
     const Element *getNearest(const Pos3d &pos) const;
     const Element *getNearest(const Pos3d &pos, const double &r) const;
+    std::vector<const Element *> getNearest(const std::vector<Pos3d> &,const size_t &nThreads= 1) const;
+    std::vector<const Element *> getKNearest(const Pos3d &,const size_t &) const;
+    std::vector<std::vector<const Element *> > getKNearest(const std::vector<Pos3d> &,const size_t &,const size_t &nThreads= 1) const;
+    std::vector<const Element *> getInRadius(const Pos3d &,const double &) const;
+    std::vector<std::vector<const Element *> > getInRadius(const std::vector<Pos3d> &,const double &,const size_t &nThreads= 1) const;
+    std::vector<const Element *> getInBox(const Pos3d &,const Pos3d &) const;
   };
 
+//! @brief Inserts the objects pointed by the iterators in the range
+//! [first,last) and rebuilds the tree (balanced) only once.
+template <class InputIterator>
+void KDTreeElements::insert(InputIterator first, InputIterator last)
+  {
+    std::vector<ElemPos> tmp;
+    for(InputIterator i= first;i!=last;i++)
+      tmp.push_back(ElemPos(**i));
+    tree_type::insert(tmp.begin(),tmp.end());
+  }
+
 } // end of XC namespace 
 
 
@@ -139,7 +139,7 @@ double XC::CrdTransf::getLength(bool initialGeometry) const
 
 const XC::Matrix &XC::CrdTransf::getPointsGlobalCoordFromLocal(const Matrix &localCoords) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of points to transform.
     const size_t dim= localCoords.noCols(); //Space dimension.
     retval.resize(numPts,dim);
@@ -168,7 +168,7 @@ const XC::Vector &XC::CrdTransf::getBasicDisplSensitivity(int gradNumber)
 	      << "; WARNING - this method "
               << " should not be called." << std::endl;
 
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -179,7 +179,7 @@ const XC::Vector &XC::CrdTransf::getGlobalResistingForceShapeSensitivity(const V
               << " implemented yet for the chosen transformation."
 	      << std::endl;
 
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -190,7 +190,7 @@ const XC::Vector &XC::CrdTransf::getGlobalResistingForceShapeSensitivity(const X
               << " implemented yet for the chosen transformation."
 	      << std::endl;
 
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -201,7 +201,7 @@ const XC::Vector &XC::CrdTransf::getBasicTrialDispShapeSensitivity(void)
               << " implemented yet for the chosen transformation."
 	      << std::endl;
 
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
   }
 
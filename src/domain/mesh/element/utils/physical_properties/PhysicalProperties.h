@@ -74,6 +74,8 @@ class PhysicalProperties: public CommandEntity, public MovableObject
       { return theMaterial.getNames(); }
     inline boost::python::list getMaterialNamesPy(void) const
       { return theMaterial.getNamesPy(); }
+    inline bool isThreadSafe(void) const
+      { return theMaterial.isThreadSafe(); }
 
     inline MAT *operator[](const size_t &i)
       { return theMaterial[i]; }
@@ -85,10 +85,10 @@
 
 
 namespace XC{
- XC::Matrix XC::TwentyNodeBrick::K(60, 60);
- XC::Matrix XC::TwentyNodeBrick::C(60, 60);
- XC::Matrix XC::TwentyNodeBrick::M(60, 60);
- XC::Vector XC::TwentyNodeBrick::P(60);
+ thread_local XC::Matrix XC::TwentyNodeBrick::K(60, 60);
+ thread_local XC::Matrix XC::TwentyNodeBrick::C(60, 60);
+ thread_local XC::Matrix XC::TwentyNodeBrick::M(60, 60);
+ thread_local XC::Vector XC::TwentyNodeBrick::P(60);
  XC::Vector Info(109+3);  //For computing moment
  XC::Vector InfoPt(FixedOrder*FixedOrder*FixedOrder*4+1); //Plastic info
  XC::Vector InfoSt(FixedOrder*FixedOrder*FixedOrder*6+1); //Stress info
@@ -2957,7 +2957,7 @@ std::cerr << "XC::TwentyNodeBrick::addInertiaLoadToUnbalance " <<
   return -1;
     }
 
- static XC::Vector ra(60);  // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
+ static thread_local XC::Vector ra(60);  // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
 
  ra( 0) = Raccel1(0);
  ra( 1) = Raccel1(1);
@@ -3230,7 +3230,7 @@ const XC::Vector &XC::TwentyNodeBrick::getResistingForceIncInertia(void) const
         const Vector &accel19 = theNodes[18]->getTrialAccel();
         const Vector &accel20 = theNodes[19]->getTrialAccel();
 
-        static Vector a(60);  // originally 8
+        static thread_local Vector a(60);  // originally 8
 
         a( 0) = accel1(0);
         a( 1) = accel1(1);
@@ -4379,7 +4379,7 @@ double XC::TwentyNodeBrick::get_Gauss_p_c(short order, short point_numb)
   {
 //  Abscissae coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_coordinates[7][7];
+    static thread_local double Gauss_coordinates[7][7];
 
     Gauss_coordinates[1][1] = 0.0 ;
     Gauss_coordinates[2][1] = -0.577350269189626;
@@ -4410,7 +4410,7 @@ double XC::TwentyNodeBrick::get_Gauss_p_w(short order, short point_numb)
   {
 //  Weight coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_weights[7][7]; // static data ??
+    static thread_local double Gauss_weights[7][7]; // static data ??
 
     Gauss_weights[1][1] = 2.0;
     Gauss_weights[2][1] = 1.0;
@@ -90,10 +90,10 @@ class TwentySevenNodeBrick: public ElementBase<27>
 
     mutable Matrix *Ki;
 
-    static Matrix K; //!< Element stiffness Matrix
-    static Matrix C; //!< Element damping matrix
-    static Matrix M; //!< Element mass matrix
-    static Vector P; //!< Element resisting force vector
+    static thread_local Matrix K; //!< Element stiffness Matrix
+    static thread_local Matrix C; //!< Element damping matrix
+    static thread_local Matrix M; //!< Element mass matrix
+    static thread_local Vector P; //!< Element resisting force vector
     BodyForces3D bf; //!< Body forces
 
     // double thickness;  // Element thickness
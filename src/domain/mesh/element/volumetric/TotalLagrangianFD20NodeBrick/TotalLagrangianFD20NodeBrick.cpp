@@ -76,9 +76,9 @@ const int XC::TotalLagrangianFD20NodeBrick::NumNodes = 20;
 const int XC::TotalLagrangianFD20NodeBrick::NumDof = 3;
 const int XC::TotalLagrangianFD20NodeBrick::NumElemDof = NumNodes*NumDof;
 
- XC::Matrix XC::TotalLagrangianFD20NodeBrick::K(NumElemDof, NumElemDof);
- XC::Matrix XC::TotalLagrangianFD20NodeBrick::M(NumElemDof, NumElemDof);
- XC::Vector XC::TotalLagrangianFD20NodeBrick::P(NumElemDof);
+ thread_local XC::Matrix XC::TotalLagrangianFD20NodeBrick::K(NumElemDof, NumElemDof);
+ thread_local XC::Matrix XC::TotalLagrangianFD20NodeBrick::M(NumElemDof, NumElemDof);
+ thread_local XC::Vector XC::TotalLagrangianFD20NodeBrick::P(NumElemDof);
 const double XC::TotalLagrangianFD20NodeBrick::pts[3] = {-0.774596669241483, 0.0, +0.774596669241483};
 const double XC::TotalLagrangianFD20NodeBrick::wts[3] = {+0.55555555555555556, +0.88888888888888889, +0.55555555555555556};
 
@@ -518,7 +518,7 @@ int XC::TotalLagrangianFD20NodeBrick::addInertiaLoadToUnbalance(const XC::Vector
     // Check for a quick return
     if(rho == 0.0) return 0;
 
-    static XC::Vector ra(NumElemDof);
+    static thread_local XC::Vector ra(NumElemDof);
     int i, j;
 
     for(i=0; i<NumNodes; i++) {
@@ -669,7 +669,7 @@ void XC::TotalLagrangianFD20NodeBrick::Print(std::ostream &s, int flag)
 int XC::TotalLagrangianFD20NodeBrick::getResponse (int responseID, Information &eleInfo)
 {
     int i;
-        static XC::Vector P0(NumTotalGaussPts*6);
+        static thread_local XC::Vector P0(NumTotalGaussPts*6);
 
      switch (responseID) {
 
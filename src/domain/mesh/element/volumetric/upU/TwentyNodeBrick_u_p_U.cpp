@@ -87,10 +87,10 @@ const int XC::TwentyNodeBrick_u_p_U::Num_Dof = 7;
 const int XC::TwentyNodeBrick_u_p_U::Num_ElemDof = 140;
 const double XC::TwentyNodeBrick_u_p_U::pts[3] = {-0.774596669241483, 0.0, +0.774596669241483};
 const double XC::TwentyNodeBrick_u_p_U::wts[3] = {5.0/9.0, 8.0/9.0, 5.0/9.0};
- XC::Matrix XC::TwentyNodeBrick_u_p_U::K(Num_ElemDof, Num_ElemDof);
- XC::Matrix XC::TwentyNodeBrick_u_p_U::C(Num_ElemDof, Num_ElemDof);
- XC::Matrix XC::TwentyNodeBrick_u_p_U::M(Num_ElemDof, Num_ElemDof);
- XC::Vector XC::TwentyNodeBrick_u_p_U::P(Num_ElemDof);
+ thread_local XC::Matrix XC::TwentyNodeBrick_u_p_U::K(Num_ElemDof, Num_ElemDof);
+ thread_local XC::Matrix XC::TwentyNodeBrick_u_p_U::C(Num_ElemDof, Num_ElemDof);
+ thread_local XC::Matrix XC::TwentyNodeBrick_u_p_U::M(Num_ElemDof, Num_ElemDof);
+ thread_local XC::Vector XC::TwentyNodeBrick_u_p_U::P(Num_ElemDof);
  XC::BJtensor XC::TwentyNodeBrick_u_p_U::perm(2,def_dim_2,0.0);
 } //namespace XC
 
@@ -172,7 +172,7 @@ void XC::TwentyNodeBrick_u_p_U::setDomain(Domain *theDomain)
 //======================================================================
 const XC::Matrix &XC::TwentyNodeBrick_u_p_U::getTangentStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= getStiff(1);
     if(isDead())
       K*=dead_srf;
@@ -182,7 +182,7 @@ const XC::Matrix &XC::TwentyNodeBrick_u_p_U::getTangentStiff(void) const
 //======================================================================
 const XC::Matrix &XC::TwentyNodeBrick_u_p_U::getInitialStiff(void) const
   {
-    static Matrix K;
+    static thread_local Matrix K;
     K= getStiff(0);
     if(isDead())
       K*=dead_srf;
@@ -290,7 +290,7 @@ int XC::TwentyNodeBrick_u_p_U::addLoad(ElementalLoad *theLoad, double loadFactor
 //======================================================================
 int XC::TwentyNodeBrick_u_p_U::addInertiaLoadToUnbalance(const XC::Vector &accel)
 {
-  static XC::Vector ra(Num_ElemDof);
+  static thread_local XC::Vector ra(Num_ElemDof);
 
   int i, ik;
 
@@ -452,7 +452,7 @@ int XC::TwentyNodeBrick_u_p_U::getResponse(int responseID, Information &eleInfo)
     return eleInfo.setMatrix(getDamp());
 
   else if(responseID == 5) {
-    static XC::Vector stresses(Num_TotalGaussPts*6);
+    static thread_local XC::Vector stresses(Num_TotalGaussPts*6);
     stresstensor sigma;
     int cnt = 0;
     int i;
@@ -470,7 +470,7 @@ int XC::TwentyNodeBrick_u_p_U::getResponse(int responseID, Information &eleInfo)
   }
 
   else if(responseID == 6) {
-    static XC::Vector Gpts(Num_TotalGaussPts*Num_Dim);
+    static thread_local XC::Vector Gpts(Num_TotalGaussPts*Num_Dim);
     BJtensor GCoord;
     int cnt = 0;
     int i,j;
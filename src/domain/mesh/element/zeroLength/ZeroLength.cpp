@@ -78,14 +78,14 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
 // initialise the class wide variables
-XC::Matrix XC::ZeroLength::ZeroLengthM2(2,2);
-XC::Matrix XC::ZeroLength::ZeroLengthM4(4,4);
-XC::Matrix XC::ZeroLength::ZeroLengthM6(6,6);
-XC::Matrix XC::ZeroLength::ZeroLengthM12(12,12);
-XC::Vector XC::ZeroLength::ZeroLengthV2(2);
-XC::Vector XC::ZeroLength::ZeroLengthV4(4);
-XC::Vector XC::ZeroLength::ZeroLengthV6(6);
-XC::Vector XC::ZeroLength::ZeroLengthV12(12);
+thread_local XC::Matrix XC::ZeroLength::ZeroLengthM2(2,2);
+thread_local XC::Matrix XC::ZeroLength::ZeroLengthM4(4,4);
+thread_local XC::Matrix XC::ZeroLength::ZeroLengthM6(6,6);
+thread_local XC::Matrix XC::ZeroLength::ZeroLengthM12(12,12);
+thread_local XC::Vector XC::ZeroLength::ZeroLengthV2(2);
+thread_local XC::Vector XC::ZeroLength::ZeroLengthV4(4);
+thread_local XC::Vector XC::ZeroLength::ZeroLengthV6(6);
+thread_local XC::Vector XC::ZeroLength::ZeroLengthV12(12);
 
 //!  @brief Constructor.
 //!
@@ -106,7 +106,7 @@ XC::Vector XC::ZeroLength::ZeroLengthV12(12);
 //! @param direction: local direction on which the material works.
 XC::ZeroLength::ZeroLength(int tag,int dim,int Nd1, int Nd2,const Vector &x, const Vector &yp,UniaxialMaterial &theMat, int direction)
   : Element0D(tag,ELE_TAG_ZeroLength,Nd1,Nd2,dim,x,yp),
-    theMatrix(nullptr), theVector(nullptr), theMaterial1d(this,theMat,direction)
+    theMaterial1d(this,theMat,direction)
     {}
 
 
@@ -125,7 +125,6 @@ XC::ZeroLength::ZeroLength(int tag,int dim,int Nd1, int Nd2,const Vector &x, con
 //! @param direction: local direction on which the material works.
 XC::ZeroLength::ZeroLength(int tag,int dim,const Material *ptr_mat,int direction)
   :Element0D(tag,ELE_TAG_ZeroLength,0,0,dim),
-   theMatrix(nullptr), theVector(nullptr),
    theMaterial1d(this,cast_material<UniaxialMaterial>(ptr_mat),direction) {}
 
 //! @brief Construct element with multiple unidirectional materials
@@ -147,12 +146,12 @@ XC::ZeroLength::ZeroLength(int tag,int dim,const Material *ptr_mat,int direction
 //! @param theMat: material container.
 //! @param direction: direction container.
 XC::ZeroLength::ZeroLength(int tag,int dim,int Nd1, int Nd2,const Vector& x, const Vector& yp,const DqUniaxialMaterial &theMat,const ID& direction )
-  :Element0D(tag,ELE_TAG_ZeroLength,Nd1,Nd2,dim,x,yp), theMatrix(nullptr), theVector(nullptr), theMaterial1d(this,theMat,direction) {}
+  :Element0D(tag,ELE_TAG_ZeroLength,Nd1,Nd2,dim,x,yp), theMaterial1d(this,theMat,direction) {}
 
 
 //! @brief Default constructor:
 XC::ZeroLength::ZeroLength(void)
-  :Element0D(0,ELE_TAG_ZeroLength,0,0,0),theMatrix(nullptr), theVector(nullptr),
+  :Element0D(0,ELE_TAG_ZeroLength,0,0,0),
    theMaterial1d(this) {}
 
 void XC::ZeroLength::setMaterial(const int &dir,const std::string &nmbMat)
@@ -242,6 +241,40 @@ XC::ZeroLength::~ZeroLength(void)
     theMaterial1d.clear();
   }
 
+//! @brief Return the class wide matrix (one copy per thread) that
+//! corresponds to the number of DOFs of the element.
+XC::Matrix &XC::ZeroLength::get_class_wide_matrix(void) const
+  {
+    switch(numDOF)
+      {
+      case 4:
+        return ZeroLengthM4;
+      case 6:
+        return ZeroLengthM6;
+      case 12:
+        return ZeroLengthM12;
+      default:
+        return ZeroLengthM2;
+      }
+  }
+
+//! @brief Return the class wide vector (one copy per thread) that
+//! corresponds to the number of DOFs of the element.
+XC::Vector &XC::ZeroLength::get_class_wide_vector(void) const
+  {
+    switch(numDOF)
+      {
+      case 4:
+        return ZeroLengthV4;
+      case 6:
+        return ZeroLengthV6;
+      case 12:
+        return ZeroLengthV12;
+      default:
+        return ZeroLengthV2;
+      }
+  }
+
 //! @brief Sets the element type and matrix dimensions from
 //! element dimension and the number of DOF of the connected nodes.
 void XC::ZeroLength::setUpType(const size_t &numDOFsNodes)
@@ -249,36 +282,26 @@ void XC::ZeroLength::setUpType(const size_t &numDOFsNodes)
     if(dimension == 1 && numDOFsNodes == 1)
       {
         numDOF = 2;
-        theMatrix = &ZeroLengthM2;
-        theVector = &ZeroLengthV2;
         elemType  = D1N2;
       }
     else if(dimension == 2 && numDOFsNodes == 2)
       {
         numDOF = 4;
-        theMatrix = &ZeroLengthM4;
-        theVector = &ZeroLengthV4;
         elemType  = D2N4;
       }
     else if(dimension == 2 && numDOFsNodes == 3)
       {
         numDOF = 6;
-        theMatrix = &ZeroLengthM6;
-        theVector = &ZeroLengthV6;
         elemType  = D2N6;
       }
     else if(dimension == 3 && numDOFsNodes == 3)
       {
         numDOF = 6;
-        theMatrix = &ZeroLengthM6;
-        theVector = &ZeroLengthV6;
         elemType  = D3N6;
       }
     else if(dimension == 3 && numDOFsNodes == 6)
       {
         numDOF = 12;
-        theMatrix = &ZeroLengthM12;
-        theVector = &ZeroLengthV12;
         elemType  = D3N12;
       }
     else
@@ -304,8 +327,6 @@ void XC::ZeroLength::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &ZeroLengthM2;
-    theVector = &ZeroLengthV2;
 
     // now determine the number of dof and the dimension
     const int dofNd1 = theNodes[0]->getNumberDOF();
@@ -429,7 +450,7 @@ const XC::Matrix &XC::ZeroLength::getTangentStiff(void) const
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = get_class_wide_matrix();
 
     // zero stiffness matrix
     stiff.Zero();
@@ -467,7 +488,7 @@ const XC::Matrix &XC::ZeroLength::getInitialStiff(void) const
     double E= 0.0;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = get_class_wide_matrix();
 
     // zero stiffness matrix
     stiff.Zero();
@@ -505,7 +526,7 @@ const XC::Matrix &XC::ZeroLength::getDamp(void) const
     double eta;
 
     // damp is a reference to the matrix holding the damping matrix
-    Matrix& damp = *theMatrix;
+    Matrix& damp = get_class_wide_matrix();
 
     // zero stiffness matrix
     damp.Zero();
@@ -537,8 +558,8 @@ const XC::Matrix &XC::ZeroLength::getDamp(void) const
 const XC::Matrix &XC::ZeroLength::getMass(void) const
   {
     // no mass
-    theMatrix->Zero();
-    return *theMatrix;
+    get_class_wide_matrix().Zero();
+    return get_class_wide_matrix();
   }
 
 
@@ -566,7 +587,7 @@ const XC::Vector &XC::ZeroLength::getResistingForce(void) const
     double force;
 
     // zero the residual
-    theVector->Zero();
+    get_class_wide_vector().Zero();
 
     // loop over 1d materials
     for(size_t mat=0; mat<theMaterial1d.size(); mat++)
@@ -576,11 +597,11 @@ const XC::Vector &XC::ZeroLength::getResistingForce(void) const
 
         // compute residual due to resisting force
         for(int i=0; i<numDOF; i++)
-            (*theVector)(i)  += t1d(mat,i) * force;
+            get_class_wide_vector()(i)  += t1d(mat,i) * force;
       } // end loop over 1d materials
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_class_wide_vector()*=dead_srf;
+    return get_class_wide_vector();
   }
 
 //! @brief Return resisting force vector with inertia included.
@@ -595,8 +616,8 @@ int XC::ZeroLength::sendData(CommParameters &cp)
   {
     int res= Element0D::sendData(cp);
     res+= cp.sendInt(elemType,getDbTagData(),CommMetaData(9));
-    res+= cp.sendMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(10,11,12,13));
-    res+= cp.sendVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(14,15,16));
+    res+= cp.sendMatrixPtr(&get_class_wide_matrix(),getDbTagData(),MatrixCommMetaData(10,11,12,13));
+    res+= cp.sendVectorPtr(&get_class_wide_vector(),getDbTagData(),ArrayCommMetaData(14,15,16));
     res+= cp.sendMovable(theMaterial1d,getDbTagData(),CommMetaData(17));
     res+= cp.sendMatrix(t1d,getDbTagData(),CommMetaData(18));
     return res;
@@ -609,8 +630,10 @@ int XC::ZeroLength::recvData(const CommParameters &cp)
     int et= elemType;
     res+= cp.receiveInt(et,getDbTagData(),CommMetaData(9));
     elemType= Etype(et);
-    theMatrix= cp.receiveMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(10,11,12,13));
-    theVector= cp.receiveVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(14,15,16));
+    Matrix *ptrMatrix= &get_class_wide_matrix();
+    cp.receiveMatrixPtr(ptrMatrix,getDbTagData(),MatrixCommMetaData(10,11,12,13));
+    Vector *ptrVector= &get_class_wide_vector();
+    cp.receiveVectorPtr(ptrVector,getDbTagData(),ArrayCommMetaData(14,15,16));
     res+= cp.receiveMovable(theMaterial1d,getDbTagData(),CommMetaData(17));
     res+= cp.receiveMatrix(t1d,getDbTagData(),CommMetaData(18));
     return res;
@@ -654,7 +677,7 @@ void XC::ZeroLength::Print(std::ostream &s, int flag)
     double force =0.0;
 
     for(int i=0; i<numDOF; i++)
-      (*theVector)(i) = t1d(0,i)*force;
+      get_class_wide_vector()(i) = t1d(0,i)*force;
 
     if(flag == 0)
       { // print everything
@@ -100,8 +100,6 @@ class ZeroLength: public Element0D
   {
   private:
     Etype elemType;
-    Matrix *theMatrix; //!< pointer to objects matrix
-    Vector *theVector; //!< pointer to objects vector
     // Storage for uniaxial material models
     ZeroLengthMaterials theMaterial1d; //!< array of pointers to 1d materials y related directionss.
 
@@ -113,18 +111,20 @@ class ZeroLength: public Element0D
     void setUp(int Nd1, int Nd2,const Vector &x,const Vector &y);
     void setTran1d ( Etype e, int n );
     double computeCurrentStrain1d(int mat, const Vector& diff ) const;    
+    Matrix &get_class_wide_matrix(void) const;
+    Vector &get_class_wide_vector(void) const;
 
 
 
-    // static data - single copy for all objects of the class    
-    static Matrix ZeroLengthM2;   // class wide matrix for 2*2
-    static Matrix ZeroLengthM4;   // class wide matrix for 4*4
-    static Matrix ZeroLengthM6;   // class wide matrix for 6*6
-    static Matrix ZeroLengthM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthV2;   // class wide Vector for size 2
-    static Vector ZeroLengthV4;   // class wide Vector for size 4
-    static Vector ZeroLengthV6;   // class wide Vector for size 6
-    static Vector ZeroLengthV12;  // class wide Vector for size 12
+    // static data - single copy (per thread) for all objects of the class    
+    static thread_local Matrix ZeroLengthM2;   // class wide matrix for 2*2
+    static thread_local Matrix ZeroLengthM4;   // class wide matrix for 4*4
+    static thread_local Matrix ZeroLengthM6;   // class wide matrix for 6*6
+    static thread_local Matrix ZeroLengthM12;  // class wide matrix for 12*12
+    static thread_local Vector ZeroLengthV2;   // class wide Vector for size 2
+    static thread_local Vector ZeroLengthV4;   // class wide Vector for size 4
+    static thread_local Vector ZeroLengthV6;   // class wide Vector for size 6
+    static thread_local Vector ZeroLengthV12;  // class wide Vector for size 12
 
   protected:
     void setUpType(const size_t &);
@@ -64,9 +64,9 @@
 #include "domain/mesh/node/Node.h"
 
 // static data for 2D
-XC::Matrix  XC::ZeroLengthContact2D::stiff(2*XC::ZeroLengthContact2D::numNodes(),2*XC::ZeroLengthContact2D::numNodes()) ;
-XC::Vector  XC::ZeroLengthContact2D::resid(2*XC::ZeroLengthContact2D::numNodes()) ;
-XC::Matrix  XC::ZeroLengthContact2D::zeroMatrix(2*XC::ZeroLengthContact2D::numNodes(),2*XC::ZeroLengthContact2D::numNodes()) ;
+thread_local XC::Matrix  XC::ZeroLengthContact2D::stiff(2*XC::ZeroLengthContact2D::numNodes(),2*XC::ZeroLengthContact2D::numNodes()) ;
+thread_local XC::Vector  XC::ZeroLengthContact2D::resid(2*XC::ZeroLengthContact2D::numNodes()) ;
+thread_local XC::Matrix  XC::ZeroLengthContact2D::zeroMatrix(2*XC::ZeroLengthContact2D::numNodes(),2*XC::ZeroLengthContact2D::numNodes()) ;
 
 //! @brief Constructor.
 XC::ZeroLengthContact2D::ZeroLengthContact2D(int tag,int Nd1, int Nd2,double Knormal, double Ktangent, double frictionRatio,  const Vector& normal )
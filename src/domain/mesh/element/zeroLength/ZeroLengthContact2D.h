@@ -140,9 +140,9 @@ class ZeroLengthContact2D: public ZeroLengthContact
     mutable double xi; //!< trial stick point in local coord
 
     //static variables for 2D contact
-    static Matrix stiff; //!< for stiff matrix
-    static Vector resid; //!< for force residual vector
-    static Matrix zeroMatrix;
+    static thread_local Matrix stiff; //!< for stiff matrix
+    static thread_local Vector resid; //!< for force residual vector
+    static thread_local Matrix zeroMatrix;
         
   public:
     ZeroLengthContact2D(int tag= 0);
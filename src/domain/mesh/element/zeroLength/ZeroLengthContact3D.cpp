@@ -64,9 +64,9 @@
 
  
 // static data for 3D
-XC::Matrix  XC::ZeroLengthContact3D::stiff(3*XC::ZeroLengthContact3D::numNodes(),3*XC::ZeroLengthContact3D::numNodes()) ;
-XC::Vector  XC::ZeroLengthContact3D::resid(3*XC::ZeroLengthContact3D::numNodes()) ;
-XC::Matrix  XC::ZeroLengthContact3D::zeroMatrix(3*XC::ZeroLengthContact3D::numNodes(),3*XC::ZeroLengthContact3D::numNodes()) ;
+thread_local XC::Matrix  XC::ZeroLengthContact3D::stiff(3*XC::ZeroLengthContact3D::numNodes(),3*XC::ZeroLengthContact3D::numNodes()) ;
+thread_local XC::Vector  XC::ZeroLengthContact3D::resid(3*XC::ZeroLengthContact3D::numNodes()) ;
+thread_local XC::Matrix  XC::ZeroLengthContact3D::zeroMatrix(3*XC::ZeroLengthContact3D::numNodes(),3*XC::ZeroLengthContact3D::numNodes()) ;
 
 //*********************************************************************
 //  Full Constructor:
@@ -72,11 +72,11 @@
 #include "utility/matrix/Matrix.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
-XC::Matrix XC::ZeroLengthSection::K6(6,6);
-XC::Matrix XC::ZeroLengthSection::K12(12,12);
+thread_local XC::Matrix XC::ZeroLengthSection::K6(6,6);
+thread_local XC::Matrix XC::ZeroLengthSection::K12(12,12);
 
-XC::Vector XC::ZeroLengthSection::P6(6);
-XC::Vector XC::ZeroLengthSection::P12(12);
+thread_local XC::Vector XC::ZeroLengthSection::P6(6);
+thread_local XC::Vector XC::ZeroLengthSection::P12(12);
 
 void XC::ZeroLengthSection::setup_section(const Material *sec)
   {
@@ -136,7 +136,7 @@ XC::ZeroLengthSection::ZeroLengthSection(int tag, int dim, int Nd1, int Nd2,
                                          const Vector &x, const Vector &yprime,
                                          SectionForceDeformation& sec)
   : Element0D(tag, ELE_TAG_ZeroLengthSection,Nd1,Nd2,dim,x,yprime),
-    K(nullptr), P(nullptr), theSection(nullptr), order(0)
+    theSection(nullptr), order(0)
   { setup_section(&sec); }
 
 //! @brief Constructor:
@@ -146,7 +146,7 @@ XC::ZeroLengthSection::ZeroLengthSection(int tag, int dim, int Nd1, int Nd2,
 //! @param sec: SectionForceDeformation material for the element.
 XC::ZeroLengthSection::ZeroLengthSection(int tag, int dim,const Material *sec)
   : Element0D(tag, ELE_TAG_ZeroLengthSection,0,0,dim),
-    K(nullptr), P(nullptr), theSection(nullptr), order(0)
+    theSection(nullptr), order(0)
   {
     if(sec)
       setup_section(sec);
@@ -154,7 +154,7 @@ XC::ZeroLengthSection::ZeroLengthSection(int tag, int dim,const Material *sec)
 
 //! @brief Copy constructor.
 XC::ZeroLengthSection::ZeroLengthSection(const ZeroLengthSection &other)
-  : Element0D(other), A(other.A), v(other.v), K(nullptr), P(nullptr), theSection(nullptr), order(0)
+  : Element0D(other), A(other.A), v(other.v), theSection(nullptr), order(0)
   {
     if(other.theSection)
       setup_section(other.theSection);
@@ -174,7 +174,27 @@ XC::ZeroLengthSection &XC::ZeroLengthSection::operator=(const ZeroLengthSection
 //! @brief Default constructor.
 XC::ZeroLengthSection::ZeroLengthSection(void)
   : XC::Element0D(0, ELE_TAG_ZeroLengthSection,0,0,0),
-    K(nullptr), P(nullptr), theSection(nullptr), order(0) {}
+    theSection(nullptr), order(0) {}
+
+//! @brief Return the class wide stiffness matrix (one copy per thread)
+//! that corresponds to the number of DOFs of the element.
+XC::Matrix &XC::ZeroLengthSection::get_class_wide_matrix(void) const
+  {
+    if(numDOF == 6)
+      return K6;
+    else
+      return K12;
+  }
+
+//! @brief Return the class wide force vector (one copy per thread)
+//! that corresponds to the number of DOFs of the element.
+XC::Vector &XC::ZeroLengthSection::get_class_wide_vector(void) const
+  {
+    if(numDOF == 6)
+      return P6;
+    else
+      return P12;
+  }
 
 //! @brief Virtual constructor.
 XC::Element *XC::ZeroLengthSection::getCopy(void) const
@@ -237,18 +257,6 @@ void XC::ZeroLengthSection::setDomain(Domain *theDomain)
 	        << "; material supports only with 3 (2D) or 6 (3D)"
 	        << " degrees of freedom by node.\n";
 
-    // Set pointers to class wide objects
-    if(numDOF == 6)
-      {
-        P= &P6;
-        K= &K6;
-      }
-    else
-      {
-        P= &P12;
-        K= &K12;
-      }
-
     // Check that length is zero within tolerance
     const Vector &end1Crd = theNodes[0]->getCrds();
     const Vector &end2Crd = theNodes[1]->getCrds();
@@ -316,11 +324,11 @@ const XC::Matrix &XC::ZeroLengthSection::getTangentStiff(void) const
     const Matrix &kb = theSection->getSectionTangent();
 
     // Compute element stiffness ... K = A^*kb*A
-    K->addMatrixTripleProduct(0.0,A, kb, 1.0);
+    get_class_wide_matrix().addMatrixTripleProduct(0.0,A, kb, 1.0);
 
     if(isDead())
-      (*K)*=dead_srf;
-    return *K;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 //! @brief Return tangent stiffness matrix for element.  The element tangent
@@ -331,10 +339,10 @@ const XC::Matrix &XC::ZeroLengthSection::getInitialStiff(void) const
     // Get section tangent stiffness, the element basic stiffness
     const Matrix &kb = theSection->getInitialTangent();
     // Compute element stiffness ... K = A^*kb*A
-    K->addMatrixTripleProduct(0.0,A, kb, 1.0);
+    get_class_wide_matrix().addMatrixTripleProduct(0.0,A, kb, 1.0);
     if(isDead())
-      (*K)*=dead_srf;
-    return *K;
+      get_class_wide_matrix()*=dead_srf;
+    return get_class_wide_matrix();
   }
 
 //! @brief The element has no loads, so this operation has no effect and returns 0.
@@ -369,11 +377,11 @@ const XC::Vector &XC::ZeroLengthSection::getResistingForce(void) const
     const Vector &q = theSection->getStressResultant();
 
     // Compute element resisting force ... P = A^*q
-    P->addMatrixTransposeVector(0.0,A, q, 1.0);
+    get_class_wide_vector().addMatrixTransposeVector(0.0,A, q, 1.0);
 
     if(isDead())
-      (*P)*=dead_srf;
-    return *P;
+      get_class_wide_vector()*=dead_srf;
+    return get_class_wide_vector();
   }
 
 //! @brief Returns the result of getResistingForce() as there is no element mass.
@@ -383,10 +391,10 @@ const XC::Vector &XC::ZeroLengthSection::getResistingForceIncInertia(void) const
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullKValues())
-      *P += this->getRayleighDampingForces();
+      get_class_wide_vector() += this->getRayleighDampingForces();
     if(isDead())
-      (*P)*=dead_srf;
-    return *P;
+      get_class_wide_vector()*=dead_srf;
+    return get_class_wide_vector();
   }
 
 //! @brief Returns the direction vector of element strong axis
@@ -447,7 +455,7 @@ const XC::Vector &XC::ZeroLengthSection::getVDirStrongAxisGlobalCoord(bool initi
     const Rect3d3dCooSys coo_sys= getCooSys(initialGeometry);
     const Vector eF= getVDirStrongAxisLocalCoord();
     const Vector3d v= coo_sys.GetCooGlobales(Vector3d(eF[0],eF[1],eF[2]));
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval[0]= v.x(); retval[1]= v.y(); retval[2]= v.z();
     return retval;
   }
@@ -459,7 +467,7 @@ const XC::Vector &XC::ZeroLengthSection::getVDirWeakAxisGlobalCoord(bool initial
     const Rect3d3dCooSys coo_sys= getCooSys(initialGeometry);
     const Vector eD= getVDirWeakAxisLocalCoord();
     const Vector3d v= coo_sys.GetCooGlobales(Vector3d(eD[0],eD[1],eD[2]));
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval[0]= v.x(); retval[1]= v.y(); retval[2]= v.z();
     return retval;
   }
@@ -472,8 +480,8 @@ int XC::ZeroLengthSection::sendData(CommParameters &cp)
     res+= cp.sendInt(order,getDbTagData(),CommMetaData(9));
     res+= cp.sendMatrix(A,getDbTagData(),CommMetaData(10));
     res+= cp.sendVector(v,getDbTagData(),CommMetaData(11));
-    res+= cp.sendMatrixPtr(K,getDbTagData(),MatrixCommMetaData(17,18,19,20));
-    res+= cp.sendVectorPtr(P,getDbTagData(),ArrayCommMetaData(21,22,23));
+    res+= cp.sendMatrixPtr(&get_class_wide_matrix(),getDbTagData(),MatrixCommMetaData(17,18,19,20));
+    res+= cp.sendVectorPtr(&get_class_wide_vector(),getDbTagData(),ArrayCommMetaData(21,22,23));
     res+= cp.sendBrokedPtr(theSection,getDbTagData(),BrokedPtrCommMetaData(24,25,26));
     return res;
   }
@@ -485,8 +493,10 @@ int XC::ZeroLengthSection::recvData(const CommParameters &cp)
     res+= cp.receiveInt(order,getDbTagData(),CommMetaData(9));
     res+= cp.receiveMatrix(A,getDbTagData(),CommMetaData(10));
     res+= cp.receiveVector(v,getDbTagData(),CommMetaData(14));
-    K= cp.receiveMatrixPtr(K,getDbTagData(),MatrixCommMetaData(17,18,19,20));
-    P= cp.receiveVectorPtr(P,getDbTagData(),ArrayCommMetaData(21,22,23));
+    Matrix *ptrMatrix= &get_class_wide_matrix();
+    cp.receiveMatrixPtr(ptrMatrix,getDbTagData(),MatrixCommMetaData(17,18,19,20));
+    Vector *ptrVector= &get_class_wide_vector();
+    cp.receiveVectorPtr(ptrVector,getDbTagData(),ArrayCommMetaData(21,22,23));
     theSection= cp.getBrokedMaterial(theSection,getDbTagData(),BrokedPtrCommMetaData(24,25,26));
     return res;
   }
@@ -539,10 +549,10 @@ XC::Response* XC::ZeroLengthSection::setResponse(const std::vector<std::string>
   {
     // element forces
     if(argv[0] == "force" || argv[0] == "forces")
-      return new ElementResponse(this, 1, *P);
+      return new ElementResponse(this, 1, get_class_wide_vector());
     // element stiffness matrix
     else if(argv[0] == "stiff" || argv[0] == "stiffness")
-      return new ElementResponse(this, 2, *K);
+      return new ElementResponse(this, 2, get_class_wide_matrix());
     else if(argv[0] == "defo" || argv[0] == "deformations" ||
                 argv[0] == "deformation")
       { return new ElementResponse(this, 3, Vector(order)); }
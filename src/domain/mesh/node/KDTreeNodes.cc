@@ -40,46 +40,116 @@ XC::NodePos::NodePos(const Pos3d &p)
   
 //! @brief Constructor.
 XC::KDTreeNodes::KDTreeNodes(void)
-  : tree_type(std::ptr_fun(NodePos::tac)), pend_optimizar(0) {}
-
+  : tree_type() {}
 
+//! @brief Inserts the node in the tree.
 void XC::KDTreeNodes::insert(const Node &n)
+  { tree_type::insert(NodePos(n)); }
+
+//! @brief Removes the node from the tree.
+void XC::KDTreeNodes::erase(const Node &n)
+  { tree_type::erase(NodePos(n)); }
+
+//! @brief Removes all the items of the tree.
+void XC::KDTreeNodes::clear(void)
+  { tree_type::clear(); }
+
+//! @brief Return the nodes of the positions being passed as parameter.
+static std::vector<const XC::Node *> get_nodes(const XC::KDTreeNodes::tree_type::result_type &found)
   {
-    tree_type::insert(n);
+    std::vector<const XC::Node *> retval;
+    retval.reserve(found.size());
+    for(XC::KDTreeNodes::tree_type::result_type::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back((*i)->getNodePtr());
+    return retval;
   }
 
-void XC::KDTreeNodes::erase(const Node &n)
+//! @brief Return the positions to search for.
+static std::vector<XC::NodePos> get_targets(const std::vector<Pos3d> &positions)
   {
-    tree_type::erase(n);
-    pend_optimizar++;
-    if(pend_optimizar>=10)
-      {
-	tree_type::optimise();
-        pend_optimizar= 0;
-      }
+    std::vector<XC::NodePos> retval;
+    retval.reserve(positions.size());
+    for(std::vector<Pos3d>::const_iterator i= positions.begin();i!=positions.end();i++)
+      retval.push_back(XC::NodePos(*i));
+    return retval;
   }
 
-void XC::KDTreeNodes::clear(void)
-  { tree_type::clear(); }
-  
 //! @brief Returns the node closest to the position being passed as parameter.
 const XC::Node *XC::KDTreeNodes::getNearest(const Pos3d &pos) const
   {
     const Node *retval= nullptr;
-    NodePos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target);
-    if(found.first != end())
-      retval= found.first->getNodePtr();
+    const NodePos *found= find_nearest(NodePos(pos));
+    if(found)
+      retval= found->getNodePtr();
     return retval;
   }
 
-//! @brief Returns the node closest to the position being passed as parameter.
+//! @brief Returns the node closest to the position being passed as parameter
+//! whose distance is not greater than r.
 const XC::Node *XC::KDTreeNodes::getNearest(const Pos3d &pos, const double &r) const
   {
     const Node *retval= nullptr;
-    NodePos target(pos);
-    std::pair<tree_type::const_iterator,double> found = find_nearest(target,r);
-    if(found.first != end())
-      retval= found.first->getNodePtr();
+    const NodePos *found= find_nearest(NodePos(pos),r);
+    if(found)
+      retval= found->getNodePtr();
     return retval;
   }
+
+//! @brief Returns the nodes closest to each one of the positions
+//! being passed as parameter.
+//! @param positions: positions to search for.
+//! @param nThreads: number of threads used to run the queries.
+std::vector<const XC::Node *> XC::KDTreeNodes::getNearest(const std::vector<Pos3d> &positions,const size_t &nThreads) const
+  {
+    const tree_type::result_type found= find_nearest(get_targets(positions),nThreads);
+    std::vector<const Node *> retval(found.size(),nullptr);
+    for(size_t i= 0;i<found.size();i++)
+      if(found[i])
+        retval[i]= found[i]->getNodePtr();
+    return retval;
+  }
+
+//! @brief Returns the k nodes closest to the position being passed
+//! as parameter (sorted by distance).
+std::vector<const XC::Node *> XC::KDTreeNodes::getKNearest(const Pos3d &pos,const size_t &k) const
+  { return get_nodes(find_k_nearest(NodePos(pos),k)); }
+
+//! @brief Returns the k nodes closest to each one of the positions
+//! being passed as parameter (sorted by distance).
+//! @param positions: positions to search for.
+//! @param k: number of nodes to search for each position.
+//! @param nThreads: number of threads used to run the queries.
+std::vector<std::vector<const XC::Node *> > XC::KDTreeNodes::getKNearest(const std::vector<Pos3d> &positions,const size_t &k,const size_t &nThreads) const
+  {
+    const std::vector<tree_type::result_type> found= find_k_nearest(get_targets(positions),k,nThreads);
+    std::vector<std::vector<const Node *> > retval;
+    retval.reserve(found.size());
+    for(std::vector<tree_type::result_type>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(get_nodes(*i));
+    return retval;
+  }
+
+//! @brief Returns the nodes whose distance to the position being passed
+//! as parameter is not greater than r (sorted by distance).
+std::vector<const XC::Node *> XC::KDTreeNodes::getInRadius(const Pos3d &pos,const double &r) const
+  { return get_nodes(find_within_range(NodePos(pos),r)); }
+
+//! @brief Returns the nodes whose distance to each one of the positions
+//! being passed as parameter is not greater than r (sorted by distance).
+//! @param positions: positions to search for.
+//! @param r: search radius.
+//! @param nThreads: number of threads used to run the queries.
+std::vector<std::vector<const XC::Node *> > XC::KDTreeNodes::getInRadius(const std::vector<Pos3d> &positions,const double &r,const size_t &nThreads) const
+  {
+    const std::vector<tree_type::result_type> found= find_within_range(get_targets(positions),r,nThreads);
+    std::vector<std::vector<const Node *> > retval;
+    retval.reserve(found.size());
+    for(std::vector<tree_type::result_type>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(get_nodes(*i));
+    return retval;
+  }
+
+//! @brief Returns the nodes whose position lies inside the box
+//! defined by its lower (pMin) and upper (pMax) corners.
+std::vector<const XC::Node *> XC::KDTreeNodes::getInBox(const Pos3d &pMin,const Pos3d &pMax) const
+  { return get_nodes(find_within_box(NodePos(pMin),NodePos(pMax))); }
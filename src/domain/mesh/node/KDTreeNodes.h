@@ -29,7 +29,8 @@
 #define KDTreeNodes_h
 
 #include "xc_utils/src/geom/pos_vec/KDTreePos.h"
-#include "xc_utils/src/kdtree++/kdtree.hpp"
+#include "utility/kdtree/FlatKDTree.h"
+#include <vector>
 
 class Pos3d;
 
@@ -48,28 +49,47 @@ class NodePos: public KDTreePos
     explicit NodePos(const Pos3d &p);
     inline const Node *getNodePtr(void) const
       { return nodPtr; }
-    static inline double tac( NodePos p, size_t k ) { return p[k]; }
   };
 
 inline bool operator==(const NodePos &A,const NodePos &B)
   { return ((A.getNodePtr()== B.getNodePtr()) && (A[0] == B[0]) && (A[1] == B[1]) && (A[2] == B[2])); }
 
 
-class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_function<NodePos,size_t,double> >
+class KDTreeNodes: protected FlatKDTree<NodePos>
   {
-    size_t pend_optimizar;
   public:
-    typedef kd_tree::KDTree<3, NodePos, std::pointer_to_binary_function<NodePos,size_t,double> > tree_type;
+    typedef FlatKDTree<NodePos> tree_type;
     KDTreeNodes(void);
 
     void insert(const Node &);
+    template <class InputIterator>
+    void insert(InputIterator, InputIterator);
     void erase(const Node &);
     void clear(void);
+    inline size_t size(void) const
+      { return tree_type::size(); }
 
     const Node *getNearest(const Pos3d &pos) const;
     const Node *getNearest(const Pos3d &pos, const double &r) const;
+    std::vector<const Node *> getNearest(const std::vector<Pos3d> &,const size_t &nThreads= 1) const;
+    std::vector<const Node *> getKNearest(const Pos3d &,const size_t &) const;
+    std::vector<std::vector<const Node *> > getKNearest(const std::vector<Pos3d> &,const size_t &,const size_t &nThreads= 1) const;
+    std::vector<const Node *> getInRadius(const Pos3d &,const double &) const;
+    std::vector<std::vector<const Node *> > getInRadius(const std::vector<Pos3d> &,const double &,const size_t &nThreads= 1) const;
+    std::vector<const Node *> getInBox(const Pos3d &,const Pos3d &) const;
   };
 
+//! @brief Inserts the objects pointed by the iterators in the range
+//! [first,last) and rebuilds the tree (balanced) only once.
+template <class InputIterator>
+void KDTreeNodes::insert(InputIterator first, InputIterator last)
+  {
+    std::vector<NodePos> tmp;
+    for(InputIterator i= first;i!=last;i++)
+      tmp.push_back(NodePos(**i));
+    tree_type::insert(tmp.begin(),tmp.end());
+  }
+
 } // end of XC namespace 
 
 
@@ -546,8 +546,9 @@ Pos3d XC::Node::getInitialPosition3d(void) const
     return retval;
   }
 
-//! @brief Return the 2D position obtained as: initPos+ factor * v.
-Pos2d XC::Node::getPosition2d(const Vector &v) const
+//! @brief Return the 2D position obtained as: initPos+ v (only the
+//! translational components of v are used).
+Pos2d XC::Node::get_position2d(const FixedVector3 &v) const
   {
     Pos2d retval;
     const size_t sz= getDim();
@@ -568,8 +569,9 @@ Pos2d XC::Node::getPosition2d(const Vector &v) const
     return retval;
   }
   
-//! @brief Return the 3D position obtained as: initPos+ factor * v.
-Pos3d XC::Node::getPosition3d(const Vector &v) const
+//! @brief Return the 3D position obtained as: initPos+ v (only the
+//! translational components of v are used).
+Pos3d XC::Node::get_position3d(const FixedVector3 &v) const
   {
     Pos3d retval;
     const size_t sz= getDim();
@@ -601,20 +603,30 @@ Pos3d XC::Node::getPosition3d(const Vector &v) const
     return retval;
   }
 
+//! @brief Return the 2D position obtained as: initPos+ v.
+Pos2d XC::Node::getPosition2d(const Vector &v) const
+  { return get_position2d(FixedVector3(v)); }
+
+//! @brief Return the 3D position obtained as: initPos+ v.
+Pos3d XC::Node::getPosition3d(const Vector &v) const
+  { return get_position3d(FixedVector3(v)); }
+
 //! @brief Return the current position of the node scaled by
 //! factor: return initPos+ factor * nodDisplacement.
 Pos2d XC::Node::getCurrentPosition2d(const double &factor) const
   {
-    const Vector fd= factor*getDisp();
-    return getPosition2d(fd);
+    FixedVector3 fd(getDisp());
+    fd*= factor;
+    return get_position2d(fd);
   }
 
 //! @brief Return the current position of the node scaled by
 //! factor: return initPos+ factor * nodDisplacement.
 Pos3d XC::Node::getCurrentPosition3d(const double &factor) const
   {
-    const Vector fd= factor*getDisp();
-    return getPosition3d(fd);
+    FixedVector3 fd(getDisp());
+    fd*= factor;
+    return get_position3d(fd);
   }
 
 //! @brief Returns true if the current position of the node scaled by
@@ -655,9 +667,9 @@ bool XC::Node::Out(const GeomObj2d &geomObj,const double &factor, const double &
 
 //! @brief Extracts translational components from d vector.
 //! @param d: displacement (or velocity or acceleration) vector
-XC::Vector extract_translation(const XC::Vector &d,const size_t &dim,const size_t numDOF)
+XC::FixedVector3 extract_translation(const XC::Vector &d,const size_t &dim,const size_t numDOF)
   {
-    XC::Vector retval(3,0.0);
+    XC::FixedVector3 retval;
     if(dim==1)
       {
         if(numDOF==1) //Elast 1D.
@@ -688,11 +700,11 @@ XC::Vector extract_translation(const XC::Vector &d,const size_t &dim,const size_
 
 //! @brief Extracts rotational components from d vector.
 //! @param d: displacement (or velocity or acceleration) vector
-XC::Vector extract_rotation(const XC::Vector &d,const size_t &dim,const size_t numDOF)
+XC::FixedVector3 extract_rotation(const XC::Vector &d,const size_t &dim,const size_t numDOF)
   {
-    XC::Vector retval(3,0.0);
+    XC::FixedVector3 retval;
     if((dim==2) && (numDOF==3)) //RM 2D.
-      {retval[3]= d[2];}
+      {retval[2]= d[2];}
     else if ((dim==3) && (numDOF==6)) //RM 3D.
       {retval[0]= d[3]; retval[1]=d[4]; retval[2]=d[5];}
     return retval;
@@ -700,27 +712,27 @@ XC::Vector extract_rotation(const XC::Vector &d,const size_t &dim,const size_t n
 
 //! @brief Returns the XYZ components of node displacement.
 XC::Vector XC::Node::getDispXYZ(void) const
-  { return extract_translation(getDisp(),getDim(),numberDOF); }
+  { return extract_translation(getDisp(),getDim(),numberDOF).getVector(); }
 
 //! @brief Returns the XYZ components of node rotation.
 XC::Vector XC::Node::getRotXYZ(void) const
-  { return extract_rotation(getDisp(),getDim(),numberDOF); }
+  { return extract_rotation(getDisp(),getDim(),numberDOF).getVector(); }
 
 //! @brief Returns the XYZ components of the translational velocity of the node.
 XC::Vector XC::Node::getVelXYZ(void) const
-  { return extract_translation(getVel(),getDim(),numberDOF); }
+  { return extract_translation(getVel(),getDim(),numberDOF).getVector(); }
 
 //! @brief Returns the XYZ components of the angular velocity of the node.
 XC::Vector XC::Node::getOmegaXYZ(void) const
-  { return extract_rotation(getVel(),getDim(),numberDOF); }
+  { return extract_rotation(getVel(),getDim(),numberDOF).getVector(); }
 
 //! @brief Returns the XYZ components of the translational acceleration of the node.
 XC::Vector XC::Node::getAccelXYZ(void) const
-  { return extract_translation(getAccel(),getDim(),numberDOF); }
+  { return extract_translation(getAccel(),getDim(),numberDOF).getVector(); }
 
 //! @brief Returns the XYZ components of the angular acceleration of the node.
 XC::Vector XC::Node::getAlphaXYZ(void) const
-  { return extract_rotation(getAccel(),getDim(),numberDOF); }
+  { return extract_rotation(getAccel(),getDim(),numberDOF).getVector(); }
 
 //! @brief Returns the square of the distance from the node to the point
 //! being passed as parameter.
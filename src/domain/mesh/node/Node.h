@@ -69,6 +69,7 @@
 #include "NodeVelVectors.h"
 #include "NodeAccelVectors.h"
 #include "utility/matrix/Matrix.h"
+#include "utility/matrix/FixedVector.h"
 #include <boost/python/list.hpp>
 
 class Pos2d;
@@ -143,6 +144,8 @@ class Node: public MeshComponent
     std::set<int> freeze_constraints;//!< Tags of the constraints created by freeze() method.
     const ID &get_id_constraints(void) const;
     void set_id_constraints(const ID &);
+    Pos2d get_position2d(const FixedVector3 &) const;
+    Pos3d get_position3d(const FixedVector3 &) const;
 
     static DefaultTag defaultTag; //<! tag for next new node.
   protected:
@@ -39,6 +39,10 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumNodes", &XC::Mesh::getNumNodes,"Returns the number of nodes.")
   .def("getNode", make_function(getNodePtr, return_internal_reference<>() ),"Returns a node from its identifier.")
   .def("getNearestNode",make_function(getNearestNodePtrMesh, return_internal_reference<>() ),"Returns nearest node.")
+  .def("getKNearestNodeTags",&XC::Mesh::getKNearestNodeTags,"getKNearestNodeTags(pos,k): returns the tags of the k nodes nearest to the position (sorted by distance).")
+  .def("getKNearestNodeTags",&XC::Mesh::getKNearestNodeTagsPy,"getKNearestNodeTags([pos1,pos2,...],k): returns a list with the tags of the k nodes nearest to each position.")
+  .def("getNodeTagsInRadius",&XC::Mesh::getNodeTagsInRadius,"getNodeTagsInRadius(pos,r): returns the tags of the nodes whose distance to the position is not greater than r (sorted by distance).")
+  .def("getNodeTagsInRadius",&XC::Mesh::getNodeTagsInRadiusPy,"getNodeTagsInRadius([pos1,pos2,...],r): returns a list with the tags of the nodes whose distance to each position is not greater than r.")
   .def("getNumLiveNodes", &XC::Mesh::getNumLiveNodes,"Returns the number of live nodes.")
   .def("getNumDeadNodes", &XC::Mesh::getNumDeadNodes,"Returns the number of dead nodes.")
   .def("getNumFrozenNodes", &XC::Mesh::getNumFrozenNodes,"Returns the number of frozen nodes.")
@@ -53,6 +57,12 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumLiveElements", &XC::Mesh::getNumLiveElements,"Returns the number of live elements.")
   .def("getNumDeadElements", &XC::Mesh::getNumDeadElements,"Returns the number of dead elements.")
   .def("getNearestElement",make_function(getNearestElementPtrMesh, return_internal_reference<>() ),"Returns nearest node.")
+  .def("getKNearestElementTags",&XC::Mesh::getKNearestElementTags,"getKNearestElementTags(pos,k): returns the tags of the k elements nearest to the position (sorted by distance).")
+  .def("getKNearestElementTags",&XC::Mesh::getKNearestElementTagsPy,"getKNearestElementTags([pos1,pos2,...],k): returns a list with the tags of the k elements nearest to each position.")
+  .def("getElementTagsInRadius",&XC::Mesh::getElementTagsInRadius,"getElementTagsInRadius(pos,r): returns the tags of the elements whose distance to the position is not greater than r (sorted by distance).")
+  .def("getElementTagsInRadius",&XC::Mesh::getElementTagsInRadiusPy,"getElementTagsInRadius([pos1,pos2,...],r): returns a list with the tags of the elements whose distance to each position is not greater than r.")
+  .def("update",&XC::Mesh::update,"Updates the state of the elements.")
+  .add_property("numThreads", &XC::Mesh::getNumThreads, &XC::Mesh::setNumThreads,"Number of threads used to update, commit and revert the state of nodes and elements (0: as many as the hardware supports).")
   .def("setDeadSRF",XC::Mesh::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation. Syntax: setDeadSRF(factor)")
   .staticmethod("setDeadSRF")
   ;
@@ -124,6 +124,13 @@ int XC::Material::getResponse(int responseID, Information &info)
 void XC::Material::update(void)
    {return;}
 
+//! @brief Returns true if the state determination of different
+//! materials can run concurrently (see Element::isThreadSafe).
+//! Materials that share mutable data between instances (class-wide
+//! work buffers,...) must redefine this method.
+bool XC::Material::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Increments generalized strain
 //! @param incS: strain increment.
 void XC::Material::addInitialGeneralizedStrain(const Vector &incS)
@@ -71,6 +71,7 @@ class MaterialVector: public std::vector<MAT *>, public CommandEntity, public Mo
     void setMaterial(size_t i,MAT *);
     void setMaterial(const MAT *,const std::string &);
     bool empty(void) const;
+    bool isThreadSafe(void) const;
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
@@ -209,6 +210,17 @@ bool MaterialVector<MAT>::empty(void) const
       return ((*this)[0]==nullptr);
   }
 
+//! @brief Returns true if all the materials can be
+//! used concurrently (see Material::isThreadSafe).
+template <class MAT>
+bool MaterialVector<MAT>::isThreadSafe(void) const
+  {
+    for(const_iterator i= mat_vector::begin();i!=mat_vector::end();i++)
+      if((*i) && !(*i)->isThreadSafe())
+        return false;
+    return true;
+  }
+
 template <class MAT>
 void MaterialVector<MAT>::clearAll(void)
   {
@@ -297,7 +309,7 @@ m_double MaterialVector<MAT>::getGeneralizedStrains(void) const
 template <class MAT>
 const Vector &MaterialVector<MAT>::getMeanGeneralizedStress(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*this)[0]->getGeneralizedStress();
     const size_t nMat= this->size();
     for(size_t i= 1;i<nMat;i++)
@@ -310,7 +322,7 @@ const Vector &MaterialVector<MAT>::getMeanGeneralizedStress(void) const
 template <class MAT>
 const Vector &MaterialVector<MAT>::getMeanGeneralizedStrain(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*this)[0]->getGeneralizedStrain();
     const size_t nMat= this->size();
     for(size_t i= 0;i<nMat;i++)
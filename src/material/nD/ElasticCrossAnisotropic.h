@@ -67,7 +67,7 @@ namespace XC {
 class ElasticCrossAnisotropic : public NDMaterial
   {
   private:
-    static Vector sigma; //!< Stress vector ... class-wide for returns
+    static thread_local Vector sigma; //!< Stress vector ... class-wide for returns
     static Matrix D; //!< Elastic constants
     Vector Tepsilon; //!< Trial strain vector
     Vector Cepsilon; //!< Committed strains
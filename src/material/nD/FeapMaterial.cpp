@@ -271,6 +271,12 @@ const XC::Matrix &XC::FeapMaterial::getTangent(void) const
 double XC::FeapMaterial::getRho(void) const
   { return rho; }
 
+//! @brief The FEAP parameter, stress and tangent arrays (d, sig, dd,...)
+//! are shared by all the materials of the class so they can't be
+//! used concurrently.
+bool XC::FeapMaterial::isThreadSafe(void) const
+  { return false; }
+
 int
 XC::FeapMaterial::commitState(void)
 {
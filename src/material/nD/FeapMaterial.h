@@ -79,6 +79,7 @@ class FeapMaterial : public NDMaterial
   virtual const Vector &getStress(void) const;
   virtual const Matrix &getTangent(void) const;
   virtual double getRho(void) const;
+  virtual bool isThreadSafe(void) const;
   
   virtual int commitState(void);
   virtual int revertToLastCommit(void);    
@@ -119,7 +119,7 @@ const XC::straintensor &XC::FiniteDeformationElastic3D::getF(void) const
   {
      std::cerr << "FiniteDeformationElastic3D-- subclass responsibility\n";
      exit(-1);
-     static straintensor retval;
+     static thread_local straintensor retval;
      return retval;
   }
 
@@ -128,7 +128,7 @@ const XC::straintensor &XC::FiniteDeformationElastic3D::getC(void) const
   {
      std::cerr << "FiniteDeformationElastic3D-- subclass responsibility\n";
      exit(-1);
-     static straintensor retval;
+     static thread_local straintensor retval;
      return retval;
   }
 
@@ -157,7 +157,7 @@ const XC::straintensor &XC::FiniteDeformationElastic3D::getStrainTensor(void) co
     std::cerr << "FiniteDeformationElastic3D-- subclass responsibility\n";
     exit(-1);
     // Just to make it compile
-    static XC::straintensor ret;
+    static thread_local XC::straintensor ret;
     return ret;
   }
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -165,7 +165,7 @@ const XC::stresstensor &XC::FiniteDeformationElastic3D::getStressTensor(void) co
   {
     std::cerr << "FiniteDeformationElastic3D-- subclass responsibility\n";
     exit(-1);
-    static XC::stresstensor ret; 
+    static thread_local XC::stresstensor ret; 
     return ret;
   }
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------
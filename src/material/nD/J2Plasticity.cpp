@@ -91,7 +91,7 @@ const double XC::J2Plasticity::two3   = 2.0 / 3.0 ;
 const double XC::J2Plasticity::four3  = 4.0 / 3.0 ;
 const double XC::J2Plasticity::root23 = sqrt( 2.0 / 3.0 ) ;
 
-double XC::J2Plasticity::initialTangent[3][3][3][3] ;   //material tangent
+thread_local double XC::J2Plasticity::initialTangent[3][3][3][3] ;   //material tangent
 double XC::J2Plasticity::IIdev[3][3][3][3] ; //rank 4 deviatoric 
 double XC::J2Plasticity::IbunI[3][3][3][3] ; //rank 4 I bun I 
 
@@ -459,9 +459,9 @@ void XC::J2Plasticity::plastic_integrator( )
     const double tolerance = (1.0e-8)*sigma_0 ;
     const double dt= FEProblem::theActiveDomain->getTimeTracker().getDt(); //time step
 
-    static XC::Matrix dev_strain(3,3) ; //deviatoric strain
-    static XC::Matrix dev_stress(3,3) ; //deviatoric stress
-    static XC::Matrix normal(3,3) ;     //normal to yield surface
+    static thread_local XC::Matrix dev_strain(3,3) ; //deviatoric strain
+    static thread_local XC::Matrix dev_stress(3,3) ; //deviatoric stress
+    static thread_local XC::Matrix normal(3,3) ;     //normal to yield surface
 
     double NbunN ; //normal bun normal 
 
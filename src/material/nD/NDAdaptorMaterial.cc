@@ -80,6 +80,10 @@ int XC::NDAdaptorMaterial::revertToStart()
 double XC::NDAdaptorMaterial::getRho(void) const
   { return theMaterial->getRho(); }
 
+//! @brief Thread safe if the wrapped material is.
+bool XC::NDAdaptorMaterial::isThreadSafe(void) const
+  { return (theMaterial && theMaterial->isThreadSafe()); }
+
 const XC::Vector& XC::NDAdaptorMaterial::getStrain(void)
   { return strain; }
 
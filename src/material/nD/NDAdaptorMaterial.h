@@ -55,6 +55,7 @@ class NDAdaptorMaterial: public NDMaterial
 
     const Vector& getStrain(void);
     double getRho(void) const;
+    bool isThreadSafe(void) const;
 
     int commitState(void);
     int revertToLastCommit(void);
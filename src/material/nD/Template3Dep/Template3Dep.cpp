@@ -834,7 +834,7 @@ int XC::Template3Dep::setTrialStrainIncr(const XC::Vector &v, const XC::Vector &
 //================================================================================
 const XC::Matrix& XC::Template3Dep::getTangent(void) const
   {
-    static Matrix M;
+    static thread_local Matrix M;
     return M;
   }
 
@@ -847,7 +847,7 @@ const XC::Matrix& XC::Template3Dep::getInitialTangent(void) const
 const XC::Vector& XC::Template3Dep::getStress(void) const
   {
     // Not yet implemented
-    static Vector V;
+    static thread_local Vector V;
     return V;
   }
 
@@ -855,7 +855,7 @@ const XC::Vector& XC::Template3Dep::getStress(void) const
 const XC::Vector& XC::Template3Dep::getStrain(void) const
   {
     // Not yet implemented
-    static Vector V;
+    static thread_local Vector V;
     return V;
   }
 
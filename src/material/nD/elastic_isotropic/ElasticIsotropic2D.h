@@ -37,7 +37,7 @@ namespace XC {
 class ElasticIsotropic2D : public ElasticIsotropicMaterial
   {
   protected:
-    static Matrix D;	        // Elastic constants
+    static thread_local Matrix D;	        // Elastic constants
   public:
     ElasticIsotropic2D(int tag, int classTag, double E, double nu, double rho);
     ElasticIsotropic2D(int tag, int classTag);
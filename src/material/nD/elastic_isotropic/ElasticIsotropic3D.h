@@ -69,11 +69,11 @@ namespace XC {
 class ElasticIsotropic3D : public ElasticIsotropicMaterial
   {
   private:
-    static Vector sigma; //!< Stress vector
-    static Matrix D;     //!< Elastic constantsVector sigma;
+    static thread_local Vector sigma; //!< Stress vector
+    static thread_local Matrix D;     //!< Elastic constantsVector sigma;
 
     mutable Tensor Dt;	 //!< Elastic constants tensor
-    static stresstensor Stress;	//!< Stress tensor    
+    static thread_local stresstensor Stress;	//!< Stress tensor    
     straintensor Strain;	//!< Strain tensor    
   public:
     ElasticIsotropic3D(int tag, double E, double nu, double rho);
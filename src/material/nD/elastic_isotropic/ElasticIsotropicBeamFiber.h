@@ -67,8 +67,8 @@ namespace XC {
 class ElasticIsotropicBeamFiber : public ElasticIsotropicMaterial
   {
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
   public:
     ElasticIsotropicBeamFiber(int tag, double E, double nu, double rho);
     ElasticIsotropicBeamFiber(int tag);
@@ -71,8 +71,8 @@ namespace XC {
 class ElasticIsotropicPlateFiber : public ElasticIsotropicMaterial
   {
   private:
-    static Vector sigma; //!< Stress vector ... class-wide for returns
-    static Matrix D; //!< Elastic constants
+    static thread_local Vector sigma; //!< Stress vector ... class-wide for returns
+    static thread_local Matrix D; //!< Elastic constants
   public:
     ElasticIsotropicPlateFiber(int tag, double E, double nu, double rho);
     ElasticIsotropicPlateFiber(int tag);
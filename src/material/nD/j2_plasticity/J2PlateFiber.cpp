@@ -85,9 +85,9 @@
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
 
-XC::Vector XC::J2PlateFiber::strain_vec(5) ;
-XC::Vector XC::J2PlateFiber::stress_vec(5) ;
-XC::Matrix XC::J2PlateFiber::tangent_matrix(5,5) ;
+thread_local XC::Vector XC::J2PlateFiber::strain_vec(5) ;
+thread_local XC::Vector XC::J2PlateFiber::stress_vec(5) ;
+thread_local XC::Matrix XC::J2PlateFiber::tangent_matrix(5,5) ;
 
 XC::J2PlateFiber::J2PlateFiber(int tag)
   : XC::J2Plasticity(tag,ND_TAG_J2PlateFiber) 
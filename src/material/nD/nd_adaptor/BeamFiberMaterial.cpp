@@ -62,8 +62,8 @@
 #include "material/nD/NDMaterialType.h"
 
 
-XC::Vector XC::BeamFiberMaterial::stress(3);
-XC::Matrix XC::BeamFiberMaterial::tangent(3,3);
+thread_local XC::Vector XC::BeamFiberMaterial::stress(3);
+thread_local XC::Matrix XC::BeamFiberMaterial::tangent(3,3);
 
 XC::BeamFiberMaterial::BeamFiberMaterial(void)
   : XC::NDAdaptorMaterial(ND_TAG_BeamFiberMaterial,3),
@@ -131,14 +131,14 @@ int XC::BeamFiberMaterial::setTrialStrain(const XC::Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static XC::Vector condensedStress(3);
-  static XC::Vector strainIncrement(3);
-  static XC::Vector threeDstress(6);
-  static XC::Vector threeDstrain(6);
-  static XC::Matrix threeDtangent(6,6);
-  static XC::Vector threeDstressCopy(6); 
-  static XC::Matrix threeDtangentCopy(6,6);
-  static XC::Matrix dd22(3,3);
+  static thread_local XC::Vector condensedStress(3);
+  static thread_local XC::Vector strainIncrement(3);
+  static thread_local XC::Vector threeDstress(6);
+  static thread_local XC::Vector threeDstrain(6);
+  static thread_local XC::Matrix threeDtangent(6,6);
+  static thread_local XC::Vector threeDstressCopy(6); 
+  static thread_local XC::Matrix threeDtangentCopy(6,6);
+  static thread_local XC::Matrix dd22(3,3);
 
   int i, j;
   int ii, jj;
@@ -213,7 +213,7 @@ int XC::BeamFiberMaterial::setTrialStrain(const XC::Vector &strainFromElement)
 const XC::Vector &XC::BeamFiberMaterial::getStress(void) const
 {
   const XC::Vector &threeDstress = theMaterial->getStress();
-  static XC::Vector threeDstressCopy(6);
+  static thread_local XC::Vector threeDstressCopy(6);
 
   int i, ii;
   //swap matrix indices to sort out-of-plane components 
@@ -232,12 +232,12 @@ const XC::Vector &XC::BeamFiberMaterial::getStress(void) const
 
 const XC::Matrix &XC::BeamFiberMaterial::getTangent(void) const
 {
-  static XC::Matrix dd11(3,3);
-  static XC::Matrix dd12(3,3);
-  static XC::Matrix dd21(3,3);
-  static XC::Matrix dd22(3,3);
-  static XC::Matrix dd22invdd21(3,3);
-  static XC::Matrix threeDtangentCopy(6,6);
+  static thread_local XC::Matrix dd11(3,3);
+  static thread_local XC::Matrix dd12(3,3);
+  static thread_local XC::Matrix dd21(3,3);
+  static thread_local XC::Matrix dd22(3,3);
+  static thread_local XC::Matrix dd22invdd21(3,3);
+  static thread_local XC::Matrix threeDtangentCopy(6,6);
 
   const XC::Matrix &threeDtangent = theMaterial->getTangent();
 
@@ -280,12 +280,12 @@ const XC::Matrix &XC::BeamFiberMaterial::getTangent(void) const
 
 const XC::Matrix &XC::BeamFiberMaterial::getInitialTangent(void) const
 {
-  static XC::Matrix dd11(3,3);
-  static XC::Matrix dd12(3,3);
-  static XC::Matrix dd21(3,3);
-  static XC::Matrix dd22(3,3);
-  static XC::Matrix dd22invdd21(3,3);
-  static XC::Matrix threeDtangentCopy(6,6);
+  static thread_local XC::Matrix dd11(3,3);
+  static thread_local XC::Matrix dd12(3,3);
+  static thread_local XC::Matrix dd21(3,3);
+  static thread_local XC::Matrix dd22(3,3);
+  static thread_local XC::Matrix dd22invdd21(3,3);
+  static thread_local XC::Matrix threeDtangentCopy(6,6);
 
   const XC::Matrix &threeDtangent = theMaterial->getInitialTangent();
 
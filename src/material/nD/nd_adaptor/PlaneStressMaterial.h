@@ -71,8 +71,8 @@ class PlaneStressMaterial: public NDAdaptorMaterial
     double Cgamma02;
     double Cgamma12; 
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 
     int indexMap(int i) const;
   protected:
@@ -262,6 +262,12 @@ const XC::Matrix &XC::FluidSolidPorousMaterial::getInitialTangent(void) const
 double XC::FluidSolidPorousMaterial::getRho(void) const
   { return theSoilMaterial->getRho(); }
 
+//! @brief The stress and tangent returned by this class are stored
+//! in class-wide work arrays (workV3, workV6, workM3, workM6) so the
+//! materials can't be used concurrently.
+bool XC::FluidSolidPorousMaterial::isThreadSafe(void) const
+  { return false; }
+
 const XC::Vector & XC::FluidSolidPorousMaterial::getStress(void) const
 {
     int ndm = ndmx[matN];
@@ -321,7 +327,7 @@ const XC::Vector & XC::FluidSolidPorousMaterial::getCommittedStrain(void)
 const XC::Vector & XC::FluidSolidPorousMaterial::getCommittedPressure(void)
   {
     //int ndm = ndmx[matN];
-    static XC::Vector temp(2);
+    static thread_local XC::Vector temp(2);
     temp[0] = currentExcessPressure;
     temp[1] = temp[0]/initMaxPress;
     return temp;
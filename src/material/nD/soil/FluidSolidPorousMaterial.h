@@ -102,6 +102,7 @@ class FluidSolidPorousMaterial: public NDMaterial
      const Matrix &getInitialTangent(void) const;
 
      double getRho(void) const;
+     bool isThreadSafe(void) const;
 
      // Calculates the corresponding stress increment(rate), for a given strain increment. 
      const Vector &getStress(void) const;
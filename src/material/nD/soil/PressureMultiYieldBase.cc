@@ -199,4 +199,8 @@ int XC::PressureMultiYieldBase::recvData(const CommParameters &cp)
     return res;
   }
 
-
+//! @brief The tangent and the work tensors (theTangent, subStrainRate
+//! and the work vectors of the derived classes) are shared by all
+//! the materials of the class so they can't be used concurrently.
+bool XC::PressureMultiYieldBase::isThreadSafe(void) const
+  { return false; }
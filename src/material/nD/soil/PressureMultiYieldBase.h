@@ -83,6 +83,7 @@ class PressureMultiYieldBase: public NDMaterial
      PressureMultiYieldBase(int tag, int classTag);
      PressureMultiYieldBase(const PressureMultiYieldBase &);
      PressureMultiYieldBase &operator=(const PressureMultiYieldBase &);
+     bool isThreadSafe(void) const;
   };
 } // end of XC namespace
 
@@ -518,8 +518,8 @@ void XC::MultiaxialCyclicPlasticity::Print( std::ostream &s, int flag )
 
 void XC::MultiaxialCyclicPlasticity::elastic_integrator(void)
   {
-    static Matrix dev_strain(3,3); //deviatoric strain  
-    static Matrix dev_stress(3,3); //deviatoric stress
+    static thread_local Matrix dev_strain(3,3); //deviatoric strain  
+    static thread_local Matrix dev_stress(3,3); //deviatoric stress
 
     // add
     double pressure= 0.0;  // 1/3 trace(stress) 
@@ -545,9 +545,9 @@ void XC::MultiaxialCyclicPlasticity::elastic_integrator(void)
         pressure  *= bulk_K0;                                                 
       }
 
-    static Matrix IncrStrain(3,3);
-    static Matrix DevStress_n(3,3);
-    static double pressure_n;
+    static thread_local Matrix IncrStrain(3,3);
+    static thread_local Matrix DevStress_n(3,3);
+    static thread_local double pressure_n;
 
     if(IncrFormulationFlag==1)
       {
@@ -835,6 +835,12 @@ int XC::MultiaxialCyclicPlasticity::recvSelf(const CommParameters &cp)
 double XC::MultiaxialCyclicPlasticity::getRho(void) const
   { return density; }
 
+//! @brief The strain, stress and tangent of the derived classes are
+//! returned in class-wide vectors and matrices (strain_vec, stress_vec,
+//! tangent_matrix) so the materials can't be used concurrently.
+bool XC::MultiaxialCyclicPlasticity::isThreadSafe(void) const
+  { return false; }
+
 
 
 int XC::MultiaxialCyclicPlasticity::updateParameter(int responseID, Information &info)
@@ -854,33 +860,33 @@ void XC::MultiaxialCyclicPlasticity::plastic_integrator()
 
   // toleraces
 
-  static double ZERO      = 1.0e-16; 
+  static thread_local double ZERO      = 1.0e-16; 
 
-  static double zerotol   = 1.0e-10;    // tol for zeroloading...||de||<zerotol
-  static double tolforload= 1.0e-10;     // tol to determine loading/unloading
-  static double tolforX   = 1.0e-6;       // tol for compute norm g1g2 in iteration X[1], X[2]
+  static thread_local double zerotol   = 1.0e-10;    // tol for zeroloading...||de||<zerotol
+  static thread_local double tolforload= 1.0e-10;     // tol to determine loading/unloading
+  static thread_local double tolforX   = 1.0e-6;       // tol for compute norm g1g2 in iteration X[1], X[2]
   
   double twomu; 
   int ii,jj;              // for loop iterators
   int i,j,k,l;
 
-  static XC::Matrix de(3,3);   //incremental deviatoric strain  
-  static XC::Matrix  s(3,3);   //deviatoric stress
+  static thread_local XC::Matrix de(3,3);   //incremental deviatoric strain  
+  static thread_local XC::Matrix  s(3,3);   //deviatoric stress
  // add
-  static double p;          // pressure, 1/3 trace(stress) 
-  static double e;          // incr. vol.strain, trace(incremental strains)
+  static thread_local double p;          // pressure, 1/3 trace(stress) 
+  static thread_local double e;          // incr. vol.strain, trace(incremental strains)
 
-  static XC::Matrix IncrStrain(3,3); // Frank let all XC::Matrix be static
-  static XC::Matrix s_n(3,3);        // dev. stress at t_n 
-  static double p_n;             // pressure at t_n
+  static thread_local XC::Matrix IncrStrain(3,3); // Frank let all XC::Matrix be static
+  static thread_local XC::Matrix s_n(3,3);        // dev. stress at t_n 
+  static thread_local double p_n;             // pressure at t_n
   //static XC::Matrix soinit(3,3);   // save s0_n here
   double normchi=0;
-  static XC::Matrix strial(3,3);
-  static XC::Matrix chitri(3,3);
-  static XC::Matrix alpha_n(3,3); // backstress of loading surface at t_n
-  static double  Psi_split; // Psi for strain split step
-  static XC::Matrix temp6(3,3);
-  static double dottemp6;
+  static thread_local XC::Matrix strial(3,3);
+  static thread_local XC::Matrix chitri(3,3);
+  static thread_local XC::Matrix alpha_n(3,3); // backstress of loading surface at t_n
+  static thread_local double  Psi_split; // Psi for strain split step
+  static thread_local XC::Matrix temp6(3,3);
+  static thread_local double dottemp6;
   double norm = 0;
     
   double Hn =0;
@@ -244,6 +244,7 @@ class MultiaxialCyclicPlasticity: public NDMaterial
   virtual int getOrder (void) const ;
     
   double getRho(void) const;
+  bool isThreadSafe(void) const;
   int updateParameter(int responseID, Information &eleInformation);	
   Vector& getMCPparameter(void);   // used for debug only
   }; //end of MultiaxialCyclicPlasticity declarations
@@ -153,7 +153,7 @@ int XC::MultiaxialCyclicPlasticityAxiSymm::setTrialStrain( const XC::Vector &v,
 int XC::MultiaxialCyclicPlasticityAxiSymm::setTrialStrainIncr( const XC::Vector &v ) 
 {
     // implemented Dec. 5, 2003, Gang Wang
-    static XC::Vector newStrain(4);
+    static thread_local XC::Vector newStrain(4);
     newStrain(0) = strain(0,0) + v(0);
     newStrain(1) = strain(1,1) + v(1);
     newStrain(2) = strain(2,2) + v(2);
@@ -170,7 +170,7 @@ int XC::MultiaxialCyclicPlasticityAxiSymm::setTrialStrainIncr( const XC::Vector
     //return this->setTrialStrainIncr(v);
 
    // implemented April. 4, 2004, Gang Wang
-    static XC::Vector newStrain(4);
+    static thread_local XC::Vector newStrain(4);
     newStrain(0) = strain(0,0) + v(0);
     newStrain(1) = strain(1,1) + v(1);
     newStrain(2) = strain(2,2) + v(2);
@@ -146,7 +146,7 @@ int XC::MultiaxialCyclicPlasticityPlaneStrain::setTrialStrain( const XC::Vector
 
 int XC::MultiaxialCyclicPlasticityPlaneStrain::setTrialStrainIncr( const XC::Vector &v ) 
 {
-  static XC::Vector newStrain(3);
+  static thread_local XC::Vector newStrain(3);
   newStrain(0) = strain(0,0) + v(0);
   newStrain(1) = strain(1,1) + v(1);
   newStrain(2) = 2.0 * strain(0,1) + v(2);
@@ -160,7 +160,7 @@ int XC::MultiaxialCyclicPlasticityPlaneStrain::setTrialStrainIncr( const XC::Vec
 {
  
    // implemented April. 4, 2004, Gang Wang
-    static XC::Vector newStrain(3);
+    static thread_local XC::Vector newStrain(3);
     newStrain(0) = strain(0,0) + v(0);
     newStrain(1) = strain(1,1) + v(1);
          newStrain(2) = 2.0*strain(0,1) + v(2);
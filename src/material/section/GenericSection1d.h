@@ -84,8 +84,8 @@ class GenericSection1d : public PrismaticBarCrossSection
     UniaxialMaterial *theModel;//!< Material model.
     int code;
 
-    static Vector s;
-    static Matrix ks;
+    static thread_local Vector s;
+    static thread_local Matrix ks;
     static ResponseId c;
 
     int sendData(CommParameters &);
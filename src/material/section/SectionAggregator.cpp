@@ -77,7 +77,7 @@ const size_t maxOrder= 10;
 
 // Assumes section order is less than or equal to maxOrder.
 // Can increase if needed!!!
-double XC::SectionAggregator::workArea[2*maxOrder*(maxOrder+1)];
+thread_local double XC::SectionAggregator::workArea[2*maxOrder*(maxOrder+1)];
 //int    XC::SectionAggregator::codeArea[maxOrder]; Not sharing area anymore
 //                                                  LCPT 19/09/2016
 
@@ -402,7 +402,7 @@ const XC::Vector &XC::SectionAggregator::getSectionDeformation(void) const
           (*def)(i)= eSec(i);
       }
     theAdditions.getStrain(*def,theSectionOrder);
-    static Vector retval;
+    static thread_local Vector retval;
     retval= (*def)-(*defzero);
     return retval;
   }
@@ -87,7 +87,7 @@ class SectionAggregator : public PrismaticBarCrossSection
     Matrix *fs;//!< Storage for section flexibility
     ResponseId *theCode; //!< identifiers for stiffness contribution.
 
-    static double workArea[];
+    static thread_local double workArea[];
     //static int codeArea[];
 
     void copy_section(const SectionForceDeformation *);
@@ -429,19 +429,19 @@ int XC::SectionForceDeformation::activateParameter(int parameterID)
 
 const XC::Vector &XC::SectionForceDeformation::getStressResultantSensitivity(int gradNumber, bool conditional)
   {
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
   }
 
 const XC::Vector &XC::SectionForceDeformation::getSectionDeformationSensitivity(int gradNumber)
   {
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
   }
 
 const XC::Matrix &XC::SectionForceDeformation::getSectionTangentSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
@@ -98,7 +98,7 @@ int XC::BaseElasticSection::setTrialSectionDeformation(const Vector &def)
 //! @brief Returns the current value of the (generalized) deformation.
 const XC::Vector &XC::BaseElasticSection::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -58,7 +58,7 @@
 
 #include <cstdlib>
 
-XC::Vector XC::ElasticShearSection2d::s(3);
+thread_local XC::Vector XC::ElasticShearSection2d::s(3);
 
 XC::ElasticShearSection2d::ElasticShearSection2d(int tag, MaterialHandler *mat_ldr)
   : BaseElasticSection2d(tag,SEC_TAG_ElasticShear2d,3,mat_ldr) {}
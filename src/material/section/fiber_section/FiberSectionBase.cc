@@ -43,6 +43,7 @@
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
 #include "material/section/interaction_diagram/NMPointCloud.h"
 #include "material/section/interaction_diagram/NMyMzPointCloud.h"
+#include "utility/parallel/ThreadPool.h"
 #include "xc_utils/src/geom/pos_vec/Vector3d.h"
 #include "xc_utils/src/geom/d2/Triang3dMesh.h"
 #include "xc_utils/src/geom/d3/ConvexHull3d.h"
@@ -200,7 +201,7 @@ int XC::FiberSectionBase::setTrialSectionDeformation(const Vector &deforms)
 //! @brief Returns material's trial generalized strain.
 const XC::Vector &XC::FiberSectionBase::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -358,6 +359,7 @@ double XC::FiberSectionBase::getNeutralAxisDist(const double &y,const double &)
 Line2d XC::FiberSectionBase::getEffectiveConcreteAreaLimitLine(const double &hEfMax) const
   {
     Line2d retval;
+    fibers.updateSkippedFibers();
     Line2d fn= getNeutralAxis(); //Neutral axis computed from deformation plane.
     if(!fn.exists()) //It this doesn't work.
       fn= fibers.getNeutralAxis(); //Neutral axis computed from fiber model. 
@@ -391,6 +393,7 @@ std::list<Polygon2d> XC::FiberSectionBase::getGrossEffectiveConcreteAreaContour(
     std::list<Polygon2d> retval;
     Polygon2d contour= getRegionsContour(); //Computes cross-section contour.
 
+    fibers.updateSkippedFibers();
     const double epsMin= fibers.getStrainMin(); //Minimal strain.
     const double epsMax= fibers.getStrainMax(); //Maximal strain.
     if(epsMin>0) //Full section is in tension.
@@ -609,9 +612,10 @@ Pos3d XC::FiberSectionBase::getNMyMz(const DeformationPlane &def)
 //    | / theta
 //    +------->y
 //
-//! @brief Returns the points that define the interaction diagram
-//! of the section for an angle \f$\theta\f$ with respect to the z axis.
-void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &diag_data,const FiberPtrDeque &fsC,const FiberPtrDeque &fsS,const double &theta)
+//! @brief Appends to the container the generalized strains of the
+//! deformation planes that define the interaction diagram of the
+//! section for an angle \f$\theta\f$ with respect to the z axis.
+void XC::FiberSectionBase::getInteractionDiagramStrainsForTheta(std::vector<Vector> &strains,const InteractionDiagramData &diag_data,const FiberPtrDeque &fsC,const FiberPtrDeque &fsS,const double &theta) const
   {
     ComputePivots cp(diag_data.getPivotsUltimateStrains(),fibers,fsC,fsS,theta);
     Pivots pivots(cp);
@@ -628,7 +632,7 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
         for(double e= eps_agot_A;e>=eps_agot_B;e-=inc_eps_B)
           {
             P3= pivots.getBPoint(e);
-            lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+            strains.push_back(getGeneralizedStrainVector(DeformationPlane(P1,P2,P3)));
           }
         //Domains 3 and 4
         P1= pivots.getBPivot(); //Pivot
@@ -637,7 +641,7 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
         for(double e= eps_agot_A;e>=0.0;e-=inc_eps_A)
           {
             P3= pivots.getAPoint(e);
-            lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+            strains.push_back(getGeneralizedStrainVector(DeformationPlane(P1,P2,P3)));
           }
         //Domain 4a
         //Compute strain in D when the pivot point is B
@@ -653,7 +657,7 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
             for(double e= eps_D4a;e>=0.0;e-=inc_eps_D4a)
               {
                 P3= pivots.getDPoint(e);
-                lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+                strains.push_back(getGeneralizedStrainVector(DeformationPlane(P1,P2,P3)));
               }
           }
         //Domain 5
@@ -664,40 +668,112 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
         for(double e= 0.0;e>=eps_agot_C;e-=inc_eps_D)
           {
             P3= pivots.getDPoint(e);
-            lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+            strains.push_back(getGeneralizedStrainVector(DeformationPlane(P1,P2,P3)));
           }
       }
   }
 
-//! @brief Returns the points that define the interaction diagram
-//! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
-const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
-  {
-    static NMPointCloud retval;
-    retval.clear();
-    retval.setUmbral(diag_data.getUmbral());
-    const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
-    if(fsC.empty())
+//! @brief Computes the points that define the interaction diagram of
+//! the section for each of the angles being passed as parameter.
+//!
+//! The section itself is not modified (so the method can be called
+//! concurrently): the work is done on copies of the section. The
+//! deformation planes of all the angles are computed first by the
+//! calling thread, since that code relies on the geometry library, whose
+//! thread safety is not guaranteed. Then the stresses of those planes are
+//! integrated, in parallel when diag_data.getNumThreads() is greater than
+//! one, each thread working on its own copy of the section (this part
+//! only uses the section and its materials). The points are appended
+//! to the cloud in the order of the planes, so the result is the same
+//! whatever the number of threads.
+//! @param cloud: point cloud to append the points to.
+//! @param diag_data: interaction diagram parameters.
+//! @param thetas: angles of the bending planes.
+//! @return false if the fibers of the concrete or the reinforcement
+//! can't be found.
+bool XC::FiberSectionBase::getInteractionDiagramPoints(NMyMzPointCloud &cloud,const InteractionDiagramData &diag_data,const std::vector<double> &thetas) const
+  {
+    bool retval= false;
+    // Working copy of the section used to compute the deformation planes.
+    FiberSectionBase *section= dynamic_cast<FiberSectionBase *>(getCopy());
+    if(!section)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't get a copy of the section." << std::endl;
+        return retval;
+      }
+    const FiberPtrDeque &concreteFibers= section->sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
+    const FiberPtrDeque &rebarFibers= section->sel_mat_tag(diag_data.getRebarSetName(),diag_data.getReinforcementTag())->second;
+    if(concreteFibers.empty())
       std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; fibers for concrete material, identified by tag: "
-		<< diag_data.getConcreteTag()
+                << "; fibers for concrete material, identified by tag: "
+                << diag_data.getConcreteTag()
                 << ", not found." << std::endl;
-    const FiberPtrDeque &fsS= sel_mat_tag(diag_data.getRebarSetName(),diag_data.getReinforcementTag())->second;
-    if(fsS.empty())
+    if(rebarFibers.empty())
       std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; fibers for steel material, identified by tag: "
-		<< diag_data.getReinforcementTag()
+                << "; fibers for steel material, identified by tag: "
+                << diag_data.getReinforcementTag()
                 << ", not found." << std::endl;
-    if(!fsC.empty() && !fsS.empty())
+    if(!concreteFibers.empty() && !rebarFibers.empty())
       {
-        static NMyMzPointCloud tmp;
-        tmp.clear();
-        tmp.setUmbral(diag_data.getUmbral());
-        getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta);
-        getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta+M_PI); //theta+M_PI
-        retval= tmp.getNM(theta);
-        revertToStart();
+        // Deformation planes (serial).
+        std::vector<Vector> strains;
+        for(std::vector<double>::const_iterator i= thetas.begin();i!=thetas.end();i++)
+          section->getInteractionDiagramStrainsForTheta(strains,diag_data,concreteFibers,rebarFibers,*i);
+        const size_t numPlanes= strains.size();
+        // Working copies of the section (one for each thread).
+        const size_t nThreads= std::max<size_t>(1,std::min(diag_data.getNumThreads(),numPlanes));
+        std::vector<FiberSectionBase *> sections(nThreads,nullptr);
+        sections[0]= section;
+        bool ok= true;
+        for(size_t t= 1;(t<nThreads) && ok;t++)
+          {
+            sections[t]= dynamic_cast<FiberSectionBase *>(getCopy());
+            ok= (sections[t]!=nullptr);
+          }
+        if(!ok)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; can't get a copy of the section." << std::endl;
+        else
+          {
+            // Stress resultants (N,My,Mz) of each plane.
+            std::vector<double> resultants(3*numPlanes);
+            ThreadPool::for_each_index(nThreads,nThreads,[&](const size_t &t)
+              {
+                FiberSectionBase *s= sections[t];
+                size_t b= 0, e= 0;
+                ThreadPool::getBlock(0,numPlanes,nThreads,t,b,e);
+                for(size_t i= b;i<e;i++)
+                  {
+                    s->setTrialSectionDeformation(strains[i]);
+                    resultants[3*i]= s->getStressResultant(SECTION_RESPONSE_P);
+                    resultants[3*i+1]= s->getStressResultant(SECTION_RESPONSE_MY);
+                    resultants[3*i+2]= s->getStressResultant(SECTION_RESPONSE_MZ);
+                  }
+              });
+            for(size_t i= 0;i<numPlanes;i++)
+              cloud.append(Pos3d(resultants[3*i],resultants[3*i+1],resultants[3*i+2]));
+            retval= true;
+          }
+        for(size_t t= 1;t<nThreads;t++)
+          if(sections[t])
+            delete sections[t];
       }
+    delete section;
+    return retval;
+  }
+
+//! @brief Returns the points that define the interaction diagram
+//! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
+XC::NMPointCloud XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta) const
+  {
+    NMPointCloud retval(diag_data.getUmbral());
+    NMyMzPointCloud tmp(diag_data.getUmbral());
+    std::vector<double> thetas(2);
+    thetas[0]= theta;
+    thetas[1]= theta+M_PI;
+    if(getInteractionDiagramPoints(tmp,diag_data,thetas))
+      retval= tmp.getNM(theta);
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; can't compute interaction diagram." << std::endl;
@@ -705,37 +781,20 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
   }
 
 //! @brief Returns the points that define the interaction diagram of the section.
-const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
+XC::NMyMzPointCloud XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data) const
   {
-    static NMyMzPointCloud lista_esfuerzos;
-    lista_esfuerzos.clear();
-    lista_esfuerzos.setUmbral(diag_data.getUmbral());
-    const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
-    if(fsC.empty())
-      std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; fibers for concrete material, identified by tag: "
-		<< diag_data.getConcreteTag()
-                << ", not found." << std::endl;
-    const FiberPtrDeque &fsS= sel_mat_tag(diag_data.getRebarSetName(),diag_data.getReinforcementTag())->second;
-    if(fsS.empty())
-      std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; fibers for steel material, identified by tag: "
-		<< diag_data.getReinforcementTag()
-                << ", not found." << std::endl;
-    if(!fsC.empty() && !fsS.empty())
-      {
-        for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
-          getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,theta);
-        revertToStart();
-      }
-    else
+    NMyMzPointCloud lista_esfuerzos(diag_data.getUmbral());
+    std::vector<double> thetas;
+    for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
+      thetas.push_back(theta);
+    if(!getInteractionDiagramPoints(lista_esfuerzos,diag_data,thetas))
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; can't compute interaction diagram." << std::endl;
     return lista_esfuerzos;
   }
 
 //! @brief Returns the interaction diagram.
-XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const InteractionDiagramData &diag_data)
+XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const InteractionDiagramData &diag_data) const
   {
     const NMyMzPointCloud lp= getInteractionDiagramPoints(diag_data);
     InteractionDiagram retval;
@@ -752,7 +811,7 @@ XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const Interac
   }
 
 //! @brief Returns the interaction diagram.
-XC::InteractionDiagram2d XC::FiberSectionBase::GetInteractionDiagramForPlane(const InteractionDiagramData &diag_data, const double &theta)
+XC::InteractionDiagram2d XC::FiberSectionBase::GetInteractionDiagramForPlane(const InteractionDiagramData &diag_data, const double &theta) const
   {
     const NMPointCloud lp= getInteractionDiagramPointsForPlane(diag_data, theta);
     InteractionDiagram2d retval;
@@ -769,16 +828,19 @@ XC::InteractionDiagram2d XC::FiberSectionBase::GetInteractionDiagramForPlane(con
   }
 
 //! @brief Returns the interaction diagram on plane N-My.
-XC::InteractionDiagram2d XC::FiberSectionBase::GetNMyInteractionDiagram(const InteractionDiagramData &diag_data)
+XC::InteractionDiagram2d XC::FiberSectionBase::GetNMyInteractionDiagram(const InteractionDiagramData &diag_data) const
   { return GetInteractionDiagramForPlane(diag_data,M_PI/2.0); }
 
 //! @brief Returns the interaction diagram on plane N-Mz.
-XC::InteractionDiagram2d XC::FiberSectionBase::GetNMzInteractionDiagram(const InteractionDiagramData &diag_data)
+XC::InteractionDiagram2d XC::FiberSectionBase::GetNMzInteractionDiagram(const InteractionDiagramData &diag_data) const
   { return GetInteractionDiagramForPlane(diag_data,0.0); }
 
 //! @brief Returns a vector from the centroid of tensions to the centroid of compressions.
 XC::Vector XC::FiberSectionBase::getLeverArmVector(void) const
-  { return fibers.getLeverArmVector(); }
+  {
+    fibers.updateSkippedFibers();
+    return fibers.getLeverArmVector();
+  }
 
 //! @brief Returns a vector oriented from the centroid of the area in tension
 //! to the most compressed fiber.
@@ -797,6 +859,7 @@ XC::Vector XC::FiberSectionBase::getVectorCantoUtil(void) const
 //! to the centroid of the compressed area.
 Segment2d XC::FiberSectionBase::getLeverArmSegment(void) const
   {
+    fibers.updateSkippedFibers();
     Segment2d retval= fibers.getLeverArmSegment();
     if(!retval.exists())
       {
@@ -830,6 +893,7 @@ Segment2d XC::FiberSectionBase::getEffectiveDepthSegment(void) const
 //! plane that contains the cross section.
 Line2d XC::FiberSectionBase::getBendingPlaneTrace(void) const
   {
+    fibers.updateSkippedFibers();
     Line2d retval= fibers.getBendingPlaneTrace();
     if(!retval.exists())
       {
@@ -845,6 +909,7 @@ Line2d XC::FiberSectionBase::getBendingPlaneTrace(void) const
 //! plane that contains the cross section.
 Line2d XC::FiberSectionBase::getTensionedPlaneTrace(void) const
   {
+    fibers.updateSkippedFibers();
     Line2d retval= fibers.getTensionedPlaneTrace();
     if(!retval.exists())
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -857,6 +922,7 @@ Line2d XC::FiberSectionBase::getTensionedPlaneTrace(void) const
 //! plane that contains the cross section.
 Line2d XC::FiberSectionBase::getCompressedPlaneTrace(void) const
   {
+    fibers.updateSkippedFibers();
     Line2d retval= fibers.getCompressedPlaneTrace();
     if(!retval.exists())
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -899,7 +965,10 @@ double XC::FiberSectionBase::getCover(const Pos2d &p) const
 
 //! @brief Returns the lever arm of the section.
 double XC::FiberSectionBase::getMechanicLeverArm(void) const
-  { return fibers.getMechanicLeverArm(); }
+  {
+    fibers.updateSkippedFibers();
+    return fibers.getMechanicLeverArm();
+  }
 
 //! @brief Returns the effective depth of the section.
 double XC::FiberSectionBase::getEffectiveDepth(void) const
@@ -928,5 +997,8 @@ double XC::FiberSectionBase::getSPosHomogeneizada(const double &E0) const
   }
 
 std::string XC::FiberSectionBase::getStrClaseEsfuerzo(const double &tol) const
-  { return fibers.getStrClaseEsfuerzo(); }
+  {
+    fibers.updateSkippedFibers();
+    return fibers.getStrClaseEsfuerzo();
+  }
 
@@ -83,9 +83,10 @@ class FiberSectionBase: public PrismaticBarCrossSection
     virtual double get_dist_to_neutral_axis(const double &,const double &) const;
     Pos3d Esf2Pos3d(void) const;
     Pos3d getNMyMz(const DeformationPlane &);
-    void getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &,const FiberPtrDeque &,const FiberPtrDeque &,const double &);
-    const NMyMzPointCloud &getInteractionDiagramPoints(const InteractionDiagramData &);
-    const NMPointCloud &getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
+    void getInteractionDiagramStrainsForTheta(std::vector<Vector> &,const InteractionDiagramData &,const FiberPtrDeque &,const FiberPtrDeque &,const double &) const;
+    bool getInteractionDiagramPoints(NMyMzPointCloud &,const InteractionDiagramData &,const std::vector<double> &) const;
+    NMyMzPointCloud getInteractionDiagramPoints(const InteractionDiagramData &) const;
+    NMPointCloud getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &) const;
   public:
     FiberSectionBase(int classTag,int dim,MaterialHandler *mat_ldr= nullptr); 
     FiberSectionBase(int tag, int classTag,int dim,MaterialHandler *mat_ldr= nullptr);
@@ -97,8 +98,36 @@ class FiberSectionBase: public PrismaticBarCrossSection
     virtual void setupFibers(void) = 0;
     inline size_t getNumFibers(void) const
       { return fibers.getNumFibers(); }
+    //! @brief Return the fiber container (the trial state of
+    //! the skipped fibers is updated first, see setLazyElasticFibers).
     inline FiberContainer &getFibers(void)
-      { return fibers; }
+      {
+        fibers.updateSkippedFibers();
+        return fibers;
+      }
+    inline const FiberContainer &getFibers(void) const
+      {
+        fibers.updateSkippedFibers();
+        return fibers;
+      }
+    //! @brief Return true if the state determination uses the packed fiber arrays (see PackedFibers).
+    inline bool hasPackedFiberLayout(void) const
+      { return fibers.hasPackedLayout(); }
+    //! @brief Use (or not) the packed fiber arrays in the state determination (see PackedFibers).
+    inline void setPackedFiberLayout(const bool &b)
+      { fibers.setPackedLayout(b); }
+    //! @brief Return true if the materials of the fibers that remain in their elastic range are skipped in the state determination (see PackedFibers::setTrial).
+    inline bool hasLazyElasticFibers(void) const
+      { return fibers.hasLazyElasticFibers(); }
+    //! @brief Skip (or not) the materials of the fibers that remain in their elastic range (only with the packed fiber layout).
+    inline void setLazyElasticFibers(const bool &b)
+      { fibers.setLazyElasticFibers(b); }
+    //! @brief Return true if the fibers of the section (and of its copies) are allocated in a memory arena (see MemoryArena).
+    inline bool hasArenaFiberStorage(void) const
+      { return fibers.hasArenaStorage(); }
+    //! @brief Allocate (or not) the fibers created from now on (setupFibers, addFiber and section copies) in a memory arena.
+    inline void setArenaFiberStorage(const bool &b)
+      { fibers.setArenaStorage(b); }
     virtual Fiber *addFiber(Fiber &)= 0;
     virtual Fiber *addFiber(int tag,const MaterialHandler &,const std::string &nmbMat,const double &, const Vector &position)= 0;
     Fiber *addFiber(const std::string &nmbMat,const double &area,const Vector &coo);
@@ -155,7 +184,10 @@ class FiberSectionBase: public PrismaticBarCrossSection
     std::string getStrClaseEsfuerzo(const double &tol= 1e-4) const;
     
     inline FiberSets &getFiberSets(void)
-      { return fiber_sets; }
+      {
+        fibers.updateSkippedFibers();
+        return fiber_sets;
+      }
     //fiber_set_iterator sel(const std::string &nmb_set,const std::string &cond);
     fiber_set_iterator sel_mat_tag(const std::string &nmb_set,const int &matTag);
     //fiber_set_iterator resel(const std::string &nmb_set,const std::string &nmb_set_org,const std::string &cond);
@@ -164,10 +196,10 @@ class FiberSectionBase: public PrismaticBarCrossSection
       { return fibers.getCenterOfMassY(); }
     double getArea(void) const;
 
-    InteractionDiagram GetInteractionDiagram(const InteractionDiagramData &);
-    InteractionDiagram2d GetInteractionDiagramForPlane(const InteractionDiagramData &,const double &);
-    InteractionDiagram2d GetNMyInteractionDiagram(const InteractionDiagramData &);
-    InteractionDiagram2d GetNMzInteractionDiagram(const InteractionDiagramData &);
+    InteractionDiagram GetInteractionDiagram(const InteractionDiagramData &) const;
+    InteractionDiagram2d GetInteractionDiagramForPlane(const InteractionDiagramData &,const double &) const;
+    InteractionDiagram2d GetNMyInteractionDiagram(const InteractionDiagramData &) const;
+    InteractionDiagram2d GetNMzInteractionDiagram(const InteractionDiagramData &) const;
   };
 } // end of XC namespace
 
@@ -44,11 +44,11 @@ class FiberSectionShear3d : public FiberSection3d
     UniaxialMaterial *respVz;
     UniaxialMaterial *respT;
     
-    static Vector def; //!< Storage for section deformations
-    static Vector defzero; //!< Storage for initial section deformations
-    static Vector s; //!< Storage for stress resultants
-    static Matrix ks;//!< Storage for section stiffness
-    static Matrix fs;//!< Storage for section flexibility
+    static thread_local Vector def; //!< Storage for section deformations
+    static thread_local Vector defzero; //!< Storage for initial section deformations
+    static thread_local Vector s; //!< Storage for stress resultants
+    static thread_local Matrix ks;//!< Storage for section stiffness
+    static thread_local Matrix fs;//!< Storage for section flexibility
 
     void setRespVy(const UniaxialMaterial *);
     void setRespVz(const UniaxialMaterial *);
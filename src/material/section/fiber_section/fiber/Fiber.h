@@ -68,6 +68,7 @@
 
 #include "utility/tagged/TaggedObject.h"
 #include "utility/actor/actor/MovableObject.h"
+#include "utility/memory/MemoryArena.h"
 
 class Pos2d;
 
@@ -96,6 +97,12 @@ class Fiber: public TaggedObject, public MovableObject
   public:
     Fiber(int tag, int classTag);
 
+    //! @brief Allocates the fiber in the current arena (if any, see MemoryArena).
+    static void *operator new(size_t sz)
+      { return MemoryArena::allocate_object(sz); }
+    static void operator delete(void *ptr)
+      { MemoryArena::deallocate_object(ptr); }
+
     virtual int setTrialFiberStrain(const Vector &vs)=0;
     virtual Vector &getFiberStressResultants(void) =0;
     virtual Matrix &getFiberTangentStiffContr(void) =0;
@@ -31,6 +31,24 @@
 #include "material/section/fiber_section/FiberSection2d.h"
 #include "material/section/fiber_section/FiberSection3d.h"
 #include "xc_utils/src/geom/d2/2d_polygons/Polygon2d.h"
+#include "utility/memory/MemoryArena.h"
+
+//! @brief Return the arena where the new fibers must be allocated
+//! (nullptr if the arena storage is not enabled).
+//!
+//! @param sizeHint: expected number of bytes to allocate.
+XC::MemoryArena *XC::FiberContainer::get_arena(const size_t &sizeHint)
+  {
+    MemoryArena *retval= nullptr;
+    if(arenaStorage)
+      {
+        if(!arena)
+          arena= new MemoryArena();
+        arena->reserve(sizeHint);
+        retval= arena;
+      }
+    return retval;
+  }
 
 //! @brief Allocates memory for each fiber material and for its data;
 //! two (yLoc,Area) for 2D sections (getOrder()= 2) and three (yLoc,zLoc,Area) for 3D sections (getOrder()= 3).
@@ -41,19 +59,25 @@ void XC::FiberContainer::allocFibers(int numOfFibers,const Fiber *muestra)
       {
         resize(numOfFibers);
         if(muestra)
-          for(int i= 0;i<numOfFibers;i++)
-            (*this)[i]= muestra->getCopy();
+          {
+            MemoryArena::Scope scope(get_arena(0));
+            for(int i= 0;i<numOfFibers;i++)
+              (*this)[i]= muestra->getCopy();
+          }
       }
   }
 
 //! @brief Copy the fibers from te container into this object.
 void XC::FiberContainer::copy_fibers(const FiberContainer &other)
   {
+    other.updateSkippedFibers(); //Copy the trial state of all the fibers.
     free_mem();
     const size_t numFibers= other.getNumFibers();
     if(numFibers)
       {
         allocFibers(numFibers);
+        const size_t sizeHint= (other.arena ? other.arena->getNumBytes() : 0);
+        MemoryArena::Scope scope(get_arena(sizeHint));
         for(register size_t i= 0;i<numFibers;i++)
           (*this)[i]= other[i]->getCopy();
       }
@@ -62,6 +86,7 @@ void XC::FiberContainer::copy_fibers(const FiberContainer &other)
 //! @brief frees memory
 void XC::FiberContainer::free_mem(void)
   {
+    packedFibers.clear(); //Fibers deleted below.
     const size_t numFibers= getNumFibers();
     for(register size_t i= 0;i<numFibers;i++)
       if((*this)[i])
@@ -70,21 +95,29 @@ void XC::FiberContainer::free_mem(void)
           (*this)[i]= nullptr;
         }
     clear();
+    if(arena) //Fibers already destroyed.
+      arena->release();
   }
 
 //! @brief Default constructor.
 XC::FiberContainer::FiberContainer(const size_t &num)
-  : FiberPtrDeque(num) {}
+  : FiberPtrDeque(num), arenaStorage(false), arena(nullptr) {}
 
 //! @brief Copy constructor.
 XC::FiberContainer::FiberContainer(const FiberContainer &other)
-  : FiberPtrDeque() //Don't copy pointers
-  { copy_fibers(other); }
+  : FiberPtrDeque(), //Don't copy pointers
+    arenaStorage(other.arenaStorage), arena(nullptr)
+  {
+    setPackedLayout(other.hasPackedLayout());
+    copy_fibers(other);
+  }
 
 //! @brief Assignment operator.
 XC::FiberContainer &XC::FiberContainer::operator=(const FiberContainer &other)
   {
     CommandEntity::operator=(other); //Don't copy pointers
+    setPackedLayout(other.hasPackedLayout());
+    arenaStorage= other.arenaStorage;
     copy_fibers(other); //They are copied here.
     return *this;
   }
@@ -94,6 +127,7 @@ void XC::FiberContainer::copy_fibers(const fiber_list &fibers)
   {
     const size_t numFibers= fibers.size();
     allocFibers(numFibers);
+    MemoryArena::Scope scope(get_arena(0));
     int i= 0;
     for(fiber_list::const_iterator ifib=fibers.begin();ifib!=fibers.end(); ifib++,i++)
       {
@@ -137,6 +171,7 @@ void XC::FiberContainer::setup(FiberSectionGJ &SectionGJ,const fiber_list &fiber
 //! @brief Adds the fiber to the container.
 XC::Fiber *XC::FiberContainer::insert(const Fiber &f)
   {
+    MemoryArena::Scope scope(get_arena(0));
     Fiber *retval= f.getCopy();
     push_back(retval);
     return retval;
@@ -167,6 +202,21 @@ XC::Fiber *XC::FiberContainer::addFiber(FiberSectionGJ &SectionGJ,Fiber &newFibe
     return retval;
   }
 
+//! @brief Enables (or disables) the arena storage. The fibers
+//! already in the container stay where they are; the setting affects
+//! the fibers added from now on and the copies of the container
+//! (i.e. the copies of the section).
+void XC::FiberContainer::setArenaStorage(const bool &b)
+  { arenaStorage= b; }
+
+//! @brief Return the number of bytes allocated in the arena.
+size_t XC::FiberContainer::getArenaNumBytes(void) const
+  { return (arena ? arena->getNumBytes() : 0); }
+
 //! @brief Destructor.
 XC::FiberContainer::~FiberContainer(void)
-  { free_mem(); }
+  {
+    free_mem();
+    if(arena)
+      delete arena;
+  }
@@ -33,12 +33,22 @@
 #include <material/section/repres/section/fiber_list.h>
 
 namespace XC {
+class MemoryArena;
 
 //! @ingroup MATSCCFibers
 //
 //! @brief Fiber container.
+//!
+//! When the arena storage is enabled the fibers created by the
+//! container (and the copies of their materials) are allocated
+//! consecutively in a few large memory blocks (see MemoryArena)
+//! instead of one by one in the heap.
 class FiberContainer : public FiberPtrDeque
   {
+    bool arenaStorage; //!< if true allocate the fibers in the arena.
+    MemoryArena *arena; //!< memory for the fibers (and their materials).
+
+    MemoryArena *get_arena(const size_t &);
     void free_mem(void);
     void copy_fibers(const FiberContainer &);
     void copy_fibers(const fiber_list &);
@@ -49,6 +59,12 @@ class FiberContainer : public FiberPtrDeque
     FiberContainer(const size_t &num= 0); 
     FiberContainer(const FiberContainer &);
     FiberContainer &operator=(const FiberContainer &);
+
+    //! @brief Return true if the fibers are allocated in the arena.
+    inline bool hasArenaStorage(void) const
+      { return arenaStorage; }
+    void setArenaStorage(const bool &);
+    size_t getArenaNumBytes(void) const;
     
     Fiber *addFiber(FiberSection2d &,Fiber &,CrossSectionKR &);
     Fiber *addFiber(FiberSection3d &,Fiber &,CrossSectionKR &);
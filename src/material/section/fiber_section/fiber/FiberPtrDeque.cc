@@ -55,12 +55,12 @@
 
 //! @brief Constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const size_t &num)
-  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), MovableObject(0), yCenterOfMass(0.0), zCenterOfMass(0.0)
+  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), MovableObject(0), yCenterOfMass(0.0), zCenterOfMass(0.0), packedLayout(false), lazyElasticFibers(false)
   {}
 
 //! @brief Copy constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const FiberPtrDeque &other)
-  : CommandEntity(other), fiber_ptrs_dq(other), MovableObject(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass)
+  : CommandEntity(other), fiber_ptrs_dq(other), MovableObject(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass), packedLayout(other.packedLayout), lazyElasticFibers(other.lazyElasticFibers)
   {}
 
 //! @brief Assignment operator.
@@ -71,12 +71,59 @@ XC::FiberPtrDeque &XC::FiberPtrDeque::operator=(const FiberPtrDeque &other)
     MovableObject::operator=(other);
     yCenterOfMass= other.yCenterOfMass;
     zCenterOfMass= other.zCenterOfMass;
+    packedLayout= other.packedLayout;
+    lazyElasticFibers= other.lazyElasticFibers;
+    packedFibers.clear();
     return *this;
   }
 
 //! @brief Adds the fiber to the container.
 void XC::FiberPtrDeque::push_back(Fiber *f)
-   { fiber_ptrs_dq::push_back(f); }
+   {
+     updateSkippedFibers();
+     fiber_ptrs_dq::push_back(f);
+     packedFibers.clear();
+   }
+
+//! @brief Activates or deactivates the use of the packed fiber arrays
+//! (see PackedFibers) in the computation of the section stiffness
+//! and stress resultant.
+void XC::FiberPtrDeque::setPackedLayout(const bool &b)
+  {
+    updateSkippedFibers();
+    packedLayout= b;
+    packedFibers.clear();
+  }
+
+//! @brief Activates or deactivates the skipping of the materials of
+//! the fibers that remain in their elastic range (see
+//! PackedFibers::setTrial). Only used with the packed layout.
+void XC::FiberPtrDeque::setLazyElasticFibers(const bool &b)
+  {
+    if(!b)
+      updateSkippedFibers();
+    lazyElasticFibers= b;
+  }
+
+//! @brief Set the trial strain of the materials skipped in the last
+//! state determination (see setLazyElasticFibers), so the state
+//! of each fiber corresponds to the section trial deformation.
+int XC::FiberPtrDeque::updateSkippedFibers(void) const
+  {
+    int retval= 0;
+    if(packedFibers.getNumSkipped()>0)
+      retval= packedFibers.updateSkippedMaterials();
+    return retval;
+  }
+
+//! @brief Return the packed fiber arrays, updating them
+//! if the fibers have changed.
+XC::PackedFibers &XC::FiberPtrDeque::getPackedFibers(void) const
+  {
+    if(!packedFibers.isPacked(size()))
+      packedFibers.pack(*this);
+    return packedFibers;
+  }
 
 
 //! @brief Search for the fiber identified by the parameter.
@@ -339,7 +386,7 @@ const XC::Vector &XC::FiberPtrDeque::getCenterOfMassHomogenizedSection(const dou
           std::cerr << getClassName() << "::" << __FUNCTION__
 		    << "; null pointer to material." << std::endl;
       }
-    static Vector retval(2);
+    static thread_local Vector retval(2);
     retval[0]= -Qz/Atot; //center of mass y coordinate  XXX ¿Signo menos?
     retval[1]= Qy/Atot; //center of mass z coordinate 
     return retval;
@@ -448,7 +495,7 @@ double XC::FiberPtrDeque::getIHomogenizedSection(const double &E0,const unsigned
 //! @brief Return the tensor of inertia computed with respect to the object centroid.
 XC::Matrix &XC::FiberPtrDeque::getIHomogenizedSection(const double &E0) const
   {
-    static Matrix i(2,2);
+    static thread_local Matrix i(2,2);
     i(0,0)= getIyHomogenizedSection(E0); i(0,1)= -getPyzHomogenizedSection(E0);
     i(1,0)= i(0,1);   i(1,1)= getIzHomogenizedSection(E0);
     return i;
@@ -457,7 +504,7 @@ XC::Matrix &XC::FiberPtrDeque::getIHomogenizedSection(const double &E0) const
 //! @brief Return the tensor of inertia with respect to the point o.
 XC::Matrix &XC::FiberPtrDeque::getIHomogenizedSection(const double &E0,const Pos2d &o) const
   {
-    static Matrix retval(2,2);
+    static thread_local Matrix retval(2,2);
     const Matrix Ig= getIHomogenizedSection(E0);
     Vector O(2); O[0]= o.x(); O[1]= o.y();
     const Vector og= getCenterOfMassHomogenizedSection(E0) - O;
@@ -808,8 +855,8 @@ double XC::FiberPtrDeque::getCompressedFibersMz(const double &y0) const
 //! not such stresses it returns (0,0).
 const XC::Vector &XC::FiberPtrDeque::getCompressedFibersCentroid(void) const
   {
-    static Vector retval(2);
-    static double f,r;
+    static thread_local Vector retval(2);
+    static thread_local double f,r;
     retval[0]= 0.0; retval[1]= 0.0; f= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -833,8 +880,8 @@ const XC::Vector &XC::FiberPtrDeque::getCompressedFibersCentroid(void) const
 //! the value passed as parameter.
 const XC::Vector &XC::FiberPtrDeque::getCentroidFibersWithStrainSmallerThan(const double &defRef) const
   {
-    static Vector retval(2);
-    static double def,r;
+    static thread_local Vector retval(2);
+    static thread_local double def,r;
     retval[0]= 0.0; retval[1]= 0.0; def= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -909,8 +956,8 @@ double XC::FiberPtrDeque::getTensionedFibersMy(const double &z0) const
 //! there is no tensioned fibers returns (0,0).
 const XC::Vector &XC::FiberPtrDeque::getTensionedFibersCentroid(void) const
   {
-    static Vector retval(2);
-    static double f,r;
+    static thread_local Vector retval(2);
+    static thread_local double f,r;
     retval[0]= 0.0; retval[1]= 0.0; f= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -934,8 +981,8 @@ const XC::Vector &XC::FiberPtrDeque::getTensionedFibersCentroid(void) const
 //! the value being passed as parameter.
 const XC::Vector &XC::FiberPtrDeque::getCentroidFibersWithStrainGreaterThan(const double &defRef) const
   {
-    static Vector retval(2);
-    static double def,r;
+    static thread_local Vector retval(2);
+    static thread_local double def,r;
     retval[0]= 0.0; retval[1]= 0.0; def= 0.0; r= 0.0;
     register std::deque<Fiber *>::const_iterator i= begin();
     for(;i!= end();i++)
@@ -1528,35 +1575,46 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection2d &Section2d,CrossSecti
     double yLoc= 0.0, zLoc= 0.0;
 
     double tangent,stress,fs0;
-    // Recompute centroid
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        (*i)->getFiberLocation(yLoc, zLoc);
-        fiberArea= (*i)->getArea();
-        if(fiberArea!= 0.0)
+        PackedFibers &pf= getPackedFibers();
+        pf.getMaterialState();
+        pf.updateK2d(kr2.kData,kr2.rData);
+        yCenterOfMass= pf.getCenterOfMassY();
+      }
+    else
+      {
+        // Recompute centroid
+        std::deque<Fiber *>::iterator i= begin();
+        for(;i!= end();i++)
           {
-            Atot+= fiberArea;
-            Qz+= -yLoc*fiberArea; //Coordenada y cambiada de signo.
+            (*i)->getFiberLocation(yLoc, zLoc);
+            fiberArea= (*i)->getArea();
+            if(fiberArea!= 0.0)
+              {
+                Atot+= fiberArea;
+                Qz+= -yLoc*fiberArea; //Coordenada y cambiada de signo.
 
-            //Updating stiffness matrix.
-            tangent= (*i)->getMaterial()->getTangent();
-            kr2.updateK2d(fiberArea,yLoc,tangent);
+                //Updating stiffness matrix.
+                tangent= (*i)->getMaterial()->getTangent();
+                kr2.updateK2d(fiberArea,yLoc,tangent);
 
-            //Updating stress resultant.
-            stress= (*i)->getMaterial()->getStress();
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,yLoc);
+                //Updating stress resultant.
+                stress= (*i)->getMaterial()->getStress();
+                fs0= stress * fiberArea;
+                kr2.updateNMz(fs0,yLoc);
+              }
           }
+        yCenterOfMass= -Qz/Atot; //center or mass z coordinate 
       }
-    yCenterOfMass= -Qz/Atot; //center or mass z coordinate 
     kr2.kData[2]= kr2.kData[1]; //Simetría.
     return 0;
   }
 
 int XC::FiberPtrDeque::commitState(void)
   {
-    int err= 0;
+    int err= updateSkippedFibers();
+    packedFibers.clearElasticRanges();
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->commitState();
@@ -1567,6 +1625,7 @@ int XC::FiberPtrDeque::commitState(void)
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection2d &Section2d)
   {
     int retval= 0;
+    packedFibers.clearElasticRanges();
     UniaxialMaterial *theMat;
     double y; 
     std::deque<Fiber *>::iterator i= begin();
@@ -1585,26 +1644,37 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(const FiberSection2d &Section2
   {
     int retval= 0;
     kr2.zero();
-    UniaxialMaterial *theMat;
-    double y,fiberArea,strain,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
+        const Vector &def= Section2d.getSectionDeformation();
+        PackedFibers &pf= getPackedFibers();
+        pf.computeStrains(def(0),def(1));
+        retval+= pf.setTrial(lazyElasticFibers);
+        pf.updateK2d(kr2.kData,kr2.rData);
+      }
+    else
+      {
+        UniaxialMaterial *theMat;
+        double y,fiberArea,strain,tangent,stress, fs0; 
+        std::deque<Fiber *>::iterator i= begin();
+        for(;i!= end();i++)
           {
-            // determine material strain and set it
-            strain= Section2d.get_strain(y);
-            retval+= theMat->setTrial(strain, stress, tangent);
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            fiberArea= (*i)->getArea();
+            if(fiberArea!=0.0)
+              {
+                // determine material strain and set it
+                strain= Section2d.get_strain(y);
+                retval+= theMat->setTrial(strain, stress, tangent);
 
-            //Updating stiffness matrix.
-            kr2.updateK2d(fiberArea,y,tangent);
+                //Updating stiffness matrix.
+                kr2.updateK2d(fiberArea,y,tangent);
 
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,y);
+                //Updating stress resultant.
+                fs0= stress * fiberArea;
+                kr2.updateNMz(fs0,y);
+              }
           }
       }
     kr2.kData[2]= kr2.kData[1]; //Simetría.
@@ -1616,6 +1686,7 @@ int XC::FiberPtrDeque::revertToLastCommit(FiberSection2d &Section2d,CrossSection
   {
     int err= 0;
     kr2.zero();
+    packedFibers.discardSkippedMaterials(); //Reverted below.
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->getMaterial()->revertToLastCommit();
@@ -1628,6 +1699,7 @@ int XC::FiberPtrDeque::revertToStart(FiberSection2d &Section2d,CrossSectionKR &k
   {
     int err= 0;
     kr2.zero();
+    packedFibers.discardSkippedMaterials(); //Reverted below.
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->getMaterial()->revertToStart();
@@ -1638,24 +1710,34 @@ int XC::FiberPtrDeque::revertToStart(FiberSection2d &Section2d,CrossSectionKR &k
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection2d &Section2d) const
   {
-    static double kInitial[4];
+    static thread_local double kInitial[4];
     kInitial[0]= 0.0; kInitial[1]= 0.0;
     kInitial[2]= 0.0; kInitial[3]= 0.0;
-    static Matrix kInitialMatrix(kInitial, 2, 2);
+    static thread_local Matrix kInitialMatrix(kInitial, 2, 2);
 
-    std::deque<Fiber *>::const_iterator i= begin();
-    UniaxialMaterial *theMat= nullptr;
-    double y,fiberArea,tangent; 
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        fiberArea= (*i)->getArea();
-
-        if(fiberArea!=0.0)
+        PackedFibers &pf= getPackedFibers();
+        pf.getInitialTangent();
+        double r[2]= {0.0,0.0}; //Stress resultant (not used).
+        pf.updateK2d(kInitial,r);
+      }
+    else
+      {
+        std::deque<Fiber *>::const_iterator i= begin();
+        UniaxialMaterial *theMat= nullptr;
+        double y,fiberArea,tangent; 
+        for(;i!= end();i++)
           {
-            tangent= theMat->getInitialTangent();
-            CrossSectionKR::updateK2d(kInitial,fiberArea,y,tangent);
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            fiberArea= (*i)->getArea();
+
+            if(fiberArea!=0.0)
+              {
+                tangent= theMat->getInitialTangent();
+                CrossSectionKR::updateK2d(kInitial,fiberArea,y,tangent);
+              }
           }
       }
 
@@ -1665,7 +1747,7 @@ const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection2d &Sec
 
 const XC::Vector &XC::FiberPtrDeque::getStressResultantSensitivity(int gradNumber, bool conditional)
   {
-    static XC::Vector ds(2);
+    static thread_local XC::Vector ds(2);
     ds.Zero();
     double y, fiberArea, stressGradient;
     std::deque<Fiber *>::const_iterator i= begin();
@@ -1707,33 +1789,44 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection3d &Section3d,CrossSecti
     double fiberArea= 0.0;
     double yLoc= 0.0, zLoc= 0.0;
 
-    // Recompute centroid
-    double stress,tangent,fs0;
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        yLoc= (*i)->getLocY();
-        zLoc= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
+        PackedFibers &pf= getPackedFibers();
+        pf.getMaterialState();
+        pf.updateK3d(kr3.kData,kr3.rData);
+        yCenterOfMass= pf.getCenterOfMassY();
+        zCenterOfMass= pf.getCenterOfMassZ();
+      }
+    else
+      {
+        // Recompute centroid
+        double stress,tangent,fs0;
+        std::deque<Fiber *>::iterator i= begin();
+        for(;i!= end();i++)
           {
-            Atot+= fiberArea;
-            Qz+= -yLoc*fiberArea; //Coordenada y cambiada de signo.
-            Qy+= zLoc*fiberArea;
+            yLoc= (*i)->getLocY();
+            zLoc= (*i)->getLocZ();
+            fiberArea= (*i)->getArea();
+            if(fiberArea!=0.0)
+              {
+                Atot+= fiberArea;
+                Qz+= -yLoc*fiberArea; //Coordenada y cambiada de signo.
+                Qy+= zLoc*fiberArea;
 
-            //Updating stiffness matrix.
-            tangent= (*i)->getMaterial()->getTangent();
+                //Updating stiffness matrix.
+                tangent= (*i)->getMaterial()->getTangent();
 
-            kr3.updateK3d(fiberArea,yLoc,zLoc,tangent);
+                kr3.updateK3d(fiberArea,yLoc,zLoc,tangent);
 
-            //Updating stress resultant.
-            stress= (*i)->getMaterial()->getStress();
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,yLoc,zLoc);
-	  }
+                //Updating stress resultant.
+                stress= (*i)->getMaterial()->getStress();
+                fs0= stress * fiberArea;
+                kr3.updateNMzMy(fs0,yLoc,zLoc);
+              }
+          }
+        yCenterOfMass= -Qz/Atot; //center of mass y coordinate  XXX ¿Signo menos?
+        zCenterOfMass= Qy/Atot; //center of mass z coordinate 
       }
-    yCenterOfMass= -Qz/Atot; //center of mass y coordinate  XXX ¿Signo menos?
-    zCenterOfMass= Qy/Atot; //center of mass z coordinate 
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
     kr3.kData[6]= kr3.kData[2];
     kr3.kData[7]= kr3.kData[5];
@@ -1744,6 +1837,7 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection3d &Section3d,CrossSecti
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection3d &Section3d)
   {
     int retval= 0;
+    packedFibers.clearElasticRanges();
     UniaxialMaterial *theMat;
     double y,z; 
     std::deque<Fiber *>::iterator i= begin();
@@ -1763,27 +1857,47 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSection3d &Section3d,Cros
   {
     int retval= 0;
     kr3.zero();
-    std::deque<Fiber *>::iterator i= begin();
     UniaxialMaterial *theMat;
     double y,z,fiberArea,tangent,stress, fs0; 
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
+        const Vector &def= Section3d.getSectionDeformation();
+        PackedFibers &pf= getPackedFibers();
+        pf.computeStrains(def(0),def(1),def(2));
+        retval+= pf.setTrial(lazyElasticFibers);
+        pf.updateK3d(kr3.kData,kr3.rData);
+        // the fibers without area are updated too.
+        const std::vector<Fiber *> &zeroAreaFibers= pf.getZeroAreaFibers();
+        for(std::vector<Fiber *>::const_iterator i= zeroAreaFibers.begin();i!=zeroAreaFibers.end();i++)
+          {
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            z= (*i)->getLocZ();
+            retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
+          }
+      }
+    else
+      {
+        std::deque<Fiber *>::iterator i= begin();
+        for(;i!= end();i++)
+          {
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            z= (*i)->getLocZ();
 
-        // determine material strain and set it
-        retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
+            // determine material strain and set it
+            retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
 
-        //Updating stiffness matrix.
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            kr3.updateK3d(fiberArea,y,z,tangent);
+            //Updating stiffness matrix.
+            fiberArea= (*i)->getArea();
+            if(fiberArea!=0.0)
+              {
+                kr3.updateK3d(fiberArea,y,z,tangent);
 
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,y,z);
+                //Updating stress resultant.
+                fs0= stress * fiberArea;
+                kr3.updateNMzMy(fs0,y,z);
+              }
           }
       }
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
@@ -1797,6 +1911,7 @@ int XC::FiberPtrDeque::revertToLastCommit(FiberSection3d &Section3d,CrossSection
   {
     int err= 0;
     kr3.zero();
+    packedFibers.discardSkippedMaterials(); //Reverted below.
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->getMaterial()->revertToLastCommit(); // invoke revertToLastCommit on the material
@@ -1810,6 +1925,7 @@ int XC::FiberPtrDeque::revertToStart(FiberSection3d &Section3d,CrossSectionKR &k
     // revert the fibers to start
     int err= 0;
     kr3.zero();
+    packedFibers.discardSkippedMaterials(); //Reverted below.
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->getMaterial()->revertToStart(); // invoke revertToStart on the material
@@ -1820,27 +1936,37 @@ int XC::FiberPtrDeque::revertToStart(FiberSection3d &Section3d,CrossSectionKR &k
 //! @brief Return the tangent stiffness matrix inicial.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection3d &Section3d) const
   {
-    static double kInitialData[9];
-    static XC::Matrix kInitial(kInitialData, 3, 3);
+    static thread_local double kInitialData[9];
+    static thread_local XC::Matrix kInitial(kInitialData, 3, 3);
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0;
     kInitialData[3]= 0.0; kInitialData[4]= 0.0; kInitialData[5]= 0.0;
     kInitialData[6]= 0.0; kInitialData[7]= 0.0; kInitialData[8]= 0.0;
 
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent; 
-    std::deque<Fiber *>::const_iterator i= begin();
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
+        PackedFibers &pf= getPackedFibers();
+        pf.getInitialTangent();
+        double r[3]= {0.0,0.0,0.0}; //Stress resultant (not used).
+        pf.updateK3d(kInitialData,r);
+      }
+    else
+      {
+        UniaxialMaterial *theMat;
+        double y,z,fiberArea,tangent; 
+        std::deque<Fiber *>::const_iterator i= begin();
+        for(;i!= end();i++)
+          {
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            z= (*i)->getLocZ();
+            fiberArea= (*i)->getArea();
 
-        if(fiberArea!=0.0)
-	  {
-            tangent= theMat->getInitialTangent();
-            CrossSectionKR::updateK3d(kInitialData,fiberArea,y,z,tangent);
+            if(fiberArea!=0.0)
+              {
+                tangent= theMat->getInitialTangent();
+                CrossSectionKR::updateK3d(kInitialData,fiberArea,y,z,tangent);
+              }
           }
       }
     kInitialData[3]= kInitialData[1]; //Stiffness matrix symmetry.
@@ -1859,33 +1985,44 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSectionGJ &SectionGJ,CrossSecti
     double fiberArea= 0.0;
     double yLoc= 0.0, zLoc=0.0;
 
-    // Recompute centroid
-    double stress,tangent,fs0;
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        yLoc= (*i)->getLocY();
-        zLoc= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
+        PackedFibers &pf= getPackedFibers();
+        pf.getMaterialState();
+        pf.updateKGJ(krGJ.kData,krGJ.rData);
+        yCenterOfMass= pf.getCenterOfMassY();
+        zCenterOfMass= pf.getCenterOfMassZ();
+      }
+    else
+      {
+        // Recompute centroid
+        double stress,tangent,fs0;
+        std::deque<Fiber *>::iterator i= begin();
+        for(;i!= end();i++)
           {
-            Atot+= fiberArea;
-            Qz+= -yLoc*fiberArea; //Coordenada y cambiada de signo.
-            Qy+= zLoc*fiberArea;
+            yLoc= (*i)->getLocY();
+            zLoc= (*i)->getLocZ();
+            fiberArea= (*i)->getArea();
+            if(fiberArea!=0.0)
+              {
+                Atot+= fiberArea;
+                Qz+= -yLoc*fiberArea; //Coordenada y cambiada de signo.
+                Qy+= zLoc*fiberArea;
 
-            tangent= (*i)->getMaterial()->getTangent();
+                tangent= (*i)->getMaterial()->getTangent();
 
-            //Updating stiffness matrix.
-            krGJ.updateKGJ(fiberArea,yLoc,zLoc,tangent);
+                //Updating stiffness matrix.
+                krGJ.updateKGJ(fiberArea,yLoc,zLoc,tangent);
 
-            //Updating stress resultant.
-            stress= (*i)->getMaterial()->getStress();
-            fs0= stress * fiberArea;
-            krGJ.updateNMzMy(fs0,yLoc,zLoc);
+                //Updating stress resultant.
+                stress= (*i)->getMaterial()->getStress();
+                fs0= stress * fiberArea;
+                krGJ.updateNMzMy(fs0,yLoc,zLoc);
+              }
           }
+        yCenterOfMass= -Qz/Atot; //center of mass y coordinate  XXX ¿Signo menos?
+        zCenterOfMass= Qy/Atot; //center of mass z coordinate 
       }
-    yCenterOfMass= -Qz/Atot; //center of mass y coordinate  XXX ¿Signo menos?
-    zCenterOfMass= Qy/Atot; //center of mass z coordinate 
     krGJ.kData[4]= krGJ.kData[1]; //Stiffness matrix symmetry.
     krGJ.kData[8]= krGJ.kData[2];
     krGJ.kData[9]= krGJ.kData[6];
@@ -1899,6 +2036,7 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSectionGJ &SectionGJ,CrossSecti
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSectionGJ &SectionGJ)
   {
     int retval= 0;
+    packedFibers.clearElasticRanges();
     UniaxialMaterial *theMat;
     double y,z; 
     std::deque<Fiber *>::iterator i= begin();
@@ -1918,28 +2056,39 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSectionGJ &SectionGJ,Cros
   {
     int retval= 0;
     krGJ.zero();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    if(packedLayout)
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-
-        if(fiberArea!=0.0)
+        const Vector &def= SectionGJ.getSectionDeformation();
+        PackedFibers &pf= getPackedFibers();
+        pf.computeStrains(def(0),def(1),def(2));
+        retval= pf.setTrial(lazyElasticFibers);
+        pf.updateKGJ(krGJ.kData,krGJ.rData);
+      }
+    else
+      {
+        UniaxialMaterial *theMat;
+        double y,z,fiberArea,tangent,stress, fs0; 
+        std::deque<Fiber *>::iterator i= begin();
+        for(;i!= end();i++)
           {
-            // determine material strain and set it
-            retval= theMat->setTrial(SectionGJ.get_strain(y,z), stress, tangent);
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            z= (*i)->getLocZ();
+            fiberArea= (*i)->getArea();
 
-            //Updating stiffness matrix.
-            krGJ.updateKGJ(fiberArea,y,z,tangent);
+            if(fiberArea!=0.0)
+              {
+                // determine material strain and set it
+                retval= theMat->setTrial(SectionGJ.get_strain(y,z), stress, tangent);
 
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            krGJ.updateNMzMy(fs0,y,z);
-	  }
+                //Updating stiffness matrix.
+                krGJ.updateKGJ(fiberArea,y,z,tangent);
+
+                //Updating stress resultant.
+                fs0= stress * fiberArea;
+                krGJ.updateNMzMy(fs0,y,z);
+              }
+          }
       }
     krGJ.kData[4]= krGJ.kData[1]; //Stiffness matrix symmetry.
     krGJ.kData[8]= krGJ.kData[2];
@@ -1955,6 +2104,7 @@ int XC::FiberPtrDeque::revertToLastCommit(FiberSectionGJ &SectionGJ,CrossSection
   {
     int err= 0;
     krGJ.zero();
+    packedFibers.discardSkippedMaterials(); //Reverted below.
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->getMaterial()->revertToLastCommit(); // invoke revertToLastCommit on the material
@@ -1968,6 +2118,7 @@ int XC::FiberPtrDeque::revertToStart(FiberSectionGJ &SectionGJ,CrossSectionKR &k
     // revert the fibers to start
     int err= 0;
     krGJ.zero();
+    packedFibers.discardSkippedMaterials(); //Reverted below.
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->getMaterial()->revertToStart(); // invoke revertToStart on the material
@@ -1978,29 +2129,39 @@ int XC::FiberPtrDeque::revertToStart(FiberSectionGJ &SectionGJ,CrossSectionKR &k
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSectionGJ &SectionGJ) const
   {
-    static double kInitialData[16];
+    static thread_local double kInitialData[16];
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0; kInitialData[3]= 0.0;
     kInitialData[4]= 0.0; kInitialData[5]= 0.0; kInitialData[6]= 0.0; kInitialData[7]= 0.0;
     kInitialData[8]= 0.0; kInitialData[9]= 0.0; kInitialData[10]= 0.0; kInitialData[11]= 0.0;
     kInitialData[12]= 0.0; kInitialData[13]= 0.0; kInitialData[14]= 0.0; kInitialData[15]= 0.0;
 
-    static XC::Matrix kInitial(kInitialData, 4, 4);
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent; 
-    std::deque<Fiber *>::const_iterator i= begin();
-    for(;i!= end();i++)
+    static thread_local XC::Matrix kInitial(kInitialData, 4, 4);
+    if(packedLayout)
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-
-        if(fiberArea!= 0.0)
+        PackedFibers &pf= getPackedFibers();
+        pf.getInitialTangent();
+        double r[3]= {0.0,0.0,0.0}; //Stress resultant (not used).
+        pf.updateKGJ(kInitialData,r);
+      }
+    else
+      {
+        UniaxialMaterial *theMat;
+        double y,z,fiberArea,tangent; 
+        std::deque<Fiber *>::const_iterator i= begin();
+        for(;i!= end();i++)
           {
-            tangent= theMat->getInitialTangent();
-            //Updating stiffness matrix.
-            CrossSectionKR::updateKGJ(kInitialData,fiberArea,y,z,tangent);
+            theMat= (*i)->getMaterial();
+            y= (*i)->getLocY();
+            z= (*i)->getLocZ();
+            fiberArea= (*i)->getArea();
+
+            if(fiberArea!= 0.0)
+              {
+                tangent= theMat->getInitialTangent();
+                //Updating stiffness matrix.
+                CrossSectionKR::updateKGJ(kInitialData,fiberArea,y,z,tangent);
+              }
           }
       }
     kInitialData[4]= kInitialData[1]; //Simetría.
@@ -2278,6 +2439,7 @@ int XC::FiberPtrDeque::setParameter(const int &paramMatTag,const std::vector<std
 int XC::FiberPtrDeque::updateParameter(const int &paramMatTag,int parameterID, Information &info)
   {
     int ok= -1;
+    packedFibers.clearElasticRanges();
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       if(paramMatTag == (*i)->getMaterial()->getTag())
@@ -2333,6 +2495,7 @@ void XC::FiberPtrDeque::Print(std::ostream &s,const int &flag)
 //! @brief Send object members through the channel being passed as parameter.
 int XC::FiberPtrDeque::sendData(CommParameters &cp)
   {
+    updateSkippedFibers();
     int res= cp.sendDoubles(yCenterOfMass,zCenterOfMass,getDbTagData(),CommMetaData(0));
     res+= sendDeque(*this,cp,getDbTagData(),CommMetaData(1));
     std::clog << getClassName() << "::" << __FUNCTION__
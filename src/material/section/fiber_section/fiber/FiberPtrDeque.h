@@ -32,6 +32,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "xc_utils/src/geom/GeomObj.h"
 #include "utility/actor/actor/MovableObject.h"
+#include "PackedFibers.h"
 #include <deque>
 
 class Ref3d3d;
@@ -73,6 +74,11 @@ enum ClaseEsfuerzo {SIMPLE_TENSION,COMPOSED_TENSION,FLEXION_SIMPLE,FLEXION_COMPU
 
     double yCenterOfMass; //!< Y coordinate of the centroid.
     double zCenterOfMass; //!< Z coordinate of the centroid.
+    bool packedLayout; //!< if true use the packed fiber arrays in the state determination.
+    bool lazyElasticFibers; //!< if true skip the materials of the fibers in their elastic range (packed layout only).
+    mutable PackedFibers packedFibers; //!< packed copy of the fiber data.
+
+    PackedFibers &getPackedFibers(void) const;
 
     int sendData(CommParameters &);  
     int recvData(const CommParameters &);
@@ -82,7 +88,10 @@ enum ClaseEsfuerzo {SIMPLE_TENSION,COMPOSED_TENSION,FLEXION_SIMPLE,FLEXION_COMPU
     mutable std::deque<double> seps; //! Spacing for each fiber.
 
     inline void resize(const size_t &nf)
-      { fiber_ptrs_dq::resize(nf,nullptr); }
+      {
+        fiber_ptrs_dq::resize(nf,nullptr);
+        packedFibers.clear();
+      }
 
     inline reference operator[](const size_t &i)
       { return fiber_ptrs_dq::operator[](i); }
@@ -99,6 +108,15 @@ enum ClaseEsfuerzo {SIMPLE_TENSION,COMPOSED_TENSION,FLEXION_SIMPLE,FLEXION_COMPU
     void push_back(Fiber *f);
     inline size_t getNumFibers(void) const
       { return size(); }
+    //! @brief Return true if the state determination uses the packed fiber arrays.
+    inline bool hasPackedLayout(void) const
+      { return packedLayout; }
+    void setPackedLayout(const bool &);
+    //! @brief Return true if the materials of the fibers that remain in their elastic range are skipped in the state determination.
+    inline bool hasLazyElasticFibers(void) const
+      { return lazyElasticFibers; }
+    void setLazyElasticFibers(const bool &);
+    int updateSkippedFibers(void) const;
 
     const Fiber *findFiber(const int &tag) const;
     Fiber *findFiber(const int &tag);
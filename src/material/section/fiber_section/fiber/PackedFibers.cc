@@ -0,0 +1,398 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PackedFibers.cc
+
+#include "PackedFibers.h"
+#include "Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <algorithm>
+#include <typeinfo>
+#include <typeindex>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+
+//! @brief Constructor.
+XC::PackedFibers::PackedFibers(void)
+  : numSkipped(0), elasticRanges(false), numFibers(0), packed(false), Atot(0.0), Qy(0.0), Qz(0.0) {}
+
+//! @brief Release the packed arrays.
+void XC::PackedFibers::clear(void)
+  {
+    y.clear(); z.clear(); area.clear();
+    strain.clear(); stress.clear(); tangent.clear();
+    materials.clear(); groups.clear(); zeroAreaFibers.clear();
+    strainMin.clear(); strainMax.clear(); elasticE.clear();
+    strain0.clear(); stress0.clear(); skipped.clear();
+    numSkipped= 0; elasticRanges= false;
+    numFibers= 0; packed= false;
+    Atot= 0.0; Qy= 0.0; Qz= 0.0;
+  }
+
+//! @brief Copy the data of the fibers in the container into
+//! the arrays, grouping them by the class of its material.
+void XC::PackedFibers::pack(const std::deque<Fiber *> &fibers)
+  {
+    clear();
+    std::vector<Fiber *> tmp;
+    tmp.reserve(fibers.size());
+    for(std::deque<Fiber *>::const_iterator i= fibers.begin();i!=fibers.end();i++)
+      {
+        if((*i)->getArea()!=0.0)
+          tmp.push_back(*i);
+        else
+          zeroAreaFibers.push_back(*i);
+      }
+    //Keep the original order inside each group.
+    std::stable_sort(tmp.begin(),tmp.end(),[](Fiber *a,Fiber *b)
+      {
+        const UniaxialMaterial *ma= a->getMaterial();
+        const UniaxialMaterial *mb= b->getMaterial();
+        if(ma->getClassTag()!=mb->getClassTag())
+          return ma->getClassTag() < mb->getClassTag();
+        return std::type_index(typeid(*ma)) < std::type_index(typeid(*mb));
+      });
+
+    const size_t n= tmp.size();
+    y.resize(n); z.resize(n); area.resize(n);
+    strain.resize(n,0.0); stress.resize(n,0.0); tangent.resize(n,0.0);
+    materials.resize(n);
+    skipped.resize(n,0);
+    for(size_t i= 0;i<n;i++)
+      {
+        Fiber *f= tmp[i];
+        y[i]= f->getLocY();
+        z[i]= f->getLocZ();
+        area[i]= f->getArea();
+        materials[i]= f->getMaterial();
+        Atot+= area[i];
+        Qy+= area[i]*y[i];
+        Qz+= area[i]*z[i];
+        const int classTag= materials[i]->getClassTag();
+        if(groups.empty() || (groups.back().classTag!=classTag) || (typeid(*materials[groups.back().begin])!=typeid(*materials[i])))
+          groups.push_back(MaterialGroup(classTag,i,i+1));
+        else
+          groups.back().end= i+1;
+      }
+    numFibers= fibers.size();
+    packed= true;
+  }
+
+//! @brief Compute the strain of the fibers from the
+//! generalized strains of the section (eps= e0+ky*y+kz*z).
+void XC::PackedFibers::computeStrains(const double &e0,const double &ky,const double &kz)
+  {
+    const size_t n= size();
+    const double *py= y.data();
+    const double *pz= z.data();
+    double *eps= strain.data();
+    if(kz!=0.0)
+      for(size_t i= 0;i<n;i++)
+        eps[i]= e0 + py[i]*ky + pz[i]*kz;
+    else
+      for(size_t i= 0;i<n;i++)
+        eps[i]= e0 + py[i]*ky;
+  }
+
+//! @brief Ask the materials for their elastic ranges (see
+//! UniaxialMaterial::getElasticRange). The fibers whose material
+//! doesn't provide one get an empty range.
+void XC::PackedFibers::update_elastic_ranges(void)
+  {
+    const size_t n= size();
+    strainMin.resize(n); strainMax.resize(n);
+    elasticE.resize(n); strain0.resize(n); stress0.resize(n);
+    for(size_t i= 0;i<n;i++)
+      if(!materials[i]->getElasticRange(strainMin[i],strainMax[i],elasticE[i],strain0[i],stress0[i]))
+        {
+          strainMin[i]= 1.0; strainMax[i]= -1.0; //Empty range.
+        }
+    elasticRanges= true;
+  }
+
+//! @brief Set the trial strains of a group of fibers skipping the
+//! materials of the fibers that remain in their elastic range.
+//!
+//! The stress and the tangent of the skipped fibers are computed in
+//! closed form (the same values the material would return); the other
+//! fibers of the group are updated with a single call to
+//! UniaxialMaterial::setTrialBatch.
+int XC::PackedFibers::set_trial_group(const MaterialGroup &g)
+  {
+    nonElastic.clear();
+    for(size_t i= g.begin;i<g.end;i++)
+      {
+        const double eps= strain[i];
+        if((eps>=strainMin[i]) && (eps<=strainMax[i]))
+          {
+            const double dStrain= eps-strain0[i];
+            stress[i]= (fabs(dStrain)>DBL_EPSILON) ? stress0[i]+elasticE[i]*dStrain : stress0[i];
+            tangent[i]= elasticE[i];
+            if(!skipped[i])
+              { skipped[i]= 1; numSkipped++; }
+          }
+        else
+          {
+            nonElastic.push_back(i);
+            if(skipped[i])
+              { skipped[i]= 0; numSkipped--; }
+          }
+      }
+    int retval= 0;
+    const size_t m= nonElastic.size();
+    if(m==(g.end-g.begin)) //No fiber skipped.
+      retval= materials[g.begin]->setTrialBatch(m,&materials[g.begin],&strain[g.begin],&stress[g.begin],&tangent[g.begin]);
+    else if(m>0)
+      {
+        batchMaterials.resize(m); batchStrain.resize(m);
+        batchStress.resize(m); batchTangent.resize(m);
+        for(size_t j= 0;j<m;j++)
+          {
+            batchMaterials[j]= materials[nonElastic[j]];
+            batchStrain[j]= strain[nonElastic[j]];
+          }
+        retval= batchMaterials[0]->setTrialBatch(m,batchMaterials.data(),batchStrain.data(),batchStress.data(),batchTangent.data());
+        for(size_t j= 0;j<m;j++)
+          {
+            stress[nonElastic[j]]= batchStress[j];
+            tangent[nonElastic[j]]= batchTangent[j];
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set the trial strains of the materials and
+//! store their stress and tangent.
+//!
+//! Each group of materials is updated with a single call
+//! to UniaxialMaterial::setTrialBatch.
+//! @param skipElastic: if true, don't call the materials of the fibers
+//! whose strain lies in their elastic range (see set_trial_group).
+int XC::PackedFibers::setTrial(const bool &skipElastic)
+  {
+    int retval= 0;
+    if(skipElastic)
+      {
+        if(!elasticRanges)
+          update_elastic_ranges();
+        for(material_groups::const_iterator g= groups.begin();g!=groups.end();g++)
+          retval+= set_trial_group(*g);
+      }
+    else
+      {
+        if(numSkipped>0) //Their trial strain is set below.
+          discardSkippedMaterials();
+        for(material_groups::const_iterator g= groups.begin();g!=groups.end();g++)
+          {
+            const size_t i= g->begin;
+            retval+= materials[i]->setTrialBatch(g->end-i,&materials[i],&strain[i],&stress[i],&tangent[i]);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set the trial strain of the materials skipped by
+//! the last call to setTrial.
+int XC::PackedFibers::updateSkippedMaterials(void)
+  {
+    int retval= 0;
+    if(numSkipped>0)
+      {
+        const size_t n= size();
+        for(size_t i= 0;i<n;i++)
+          if(skipped[i])
+            {
+              retval+= materials[i]->setTrialStrain(strain[i]);
+              skipped[i]= 0;
+            }
+        numSkipped= 0;
+      }
+    return retval;
+  }
+
+//! @brief Forget the materials skipped by the last call to setTrial
+//! (their state has been reverted). The elastic ranges are marked as
+//! out of date too.
+void XC::PackedFibers::discardSkippedMaterials(void)
+  {
+    if(numSkipped>0)
+      {
+        std::fill(skipped.begin(),skipped.end(),0);
+        numSkipped= 0;
+      }
+    elasticRanges= false;
+  }
+
+//! @brief Read the stress and tangent from the materials
+//! (the skipped materials are updated first).
+void XC::PackedFibers::getMaterialState(void)
+  {
+    updateSkippedMaterials();
+    const size_t n= size();
+    for(size_t i= 0;i<n;i++)
+      {
+        tangent[i]= materials[i]->getTangent();
+        stress[i]= materials[i]->getStress();
+      }
+  }
+
+//! @brief Read the initial tangent from the materials (the
+//! stresses are set to zero).
+void XC::PackedFibers::getInitialTangent(void)
+  {
+    const size_t n= size();
+    for(size_t i= 0;i<n;i++)
+      {
+        tangent[i]= materials[i]->getInitialTangent();
+        stress[i]= 0.0;
+      }
+  }
+
+#if defined(__GNUC__)
+//! @brief Four doubles vector (GCC vector extension).
+typedef double v4d __attribute__((vector_size(4*sizeof(double))));
+#endif
+
+//! @brief Compute the sums of the stiffness terms (EA, EAy, EAz, EAy²,
+//! EAyz, EAz²) and the stress resultant (N, N*y, N*z).
+//!
+//! When compiling with GCC (or compatible) the fibers are processed
+//! four at a time using vector extensions (the compiler doesn't
+//! vectorize floating point reductions by itself because that changes
+//! the order of the operations).
+void XC::PackedFibers::reduce(double k[6],double r[3]) const
+  {
+    for(size_t l= 0;l<6;l++)
+      k[l]= 0.0;
+    r[0]= 0.0; r[1]= 0.0; r[2]= 0.0;
+    const size_t n= size();
+    const double *py= y.data();
+    const double *pz= z.data();
+    const double *pa= area.data();
+    const double *ps= stress.data();
+    const double *pt= tangent.data();
+    size_t i= 0;
+#if defined(__GNUC__)
+    const v4d zero= {0.0,0.0,0.0,0.0};
+    v4d k0= zero, k1= zero, k2= zero, k3= zero, k4= zero, k5= zero;
+    v4d r0= zero, r1= zero, r2= zero;
+    for(;i+4<=n;i+=4)
+      {
+        v4d yi, zi, ai, ti, si; //No alignment required.
+        memcpy(&yi,py+i,sizeof(v4d));
+        memcpy(&zi,pz+i,sizeof(v4d));
+        memcpy(&ai,pa+i,sizeof(v4d));
+        memcpy(&ti,pt+i,sizeof(v4d));
+        memcpy(&si,ps+i,sizeof(v4d));
+        const v4d ea= ti*ai;
+        const v4d eay= ea*yi;
+        const v4d eaz= ea*zi;
+        const v4d f= si*ai;
+        k0+= ea;
+        k1+= eay;
+        k2+= eaz;
+        k3+= eay*yi;
+        k4+= eay*zi;
+        k5+= eaz*zi;
+        r0+= f;
+        r1+= f*yi;
+        r2+= f*zi;
+      }
+    for(size_t j= 0;j<4;j++)
+      {
+        k[0]+= k0[j]; k[1]+= k1[j]; k[2]+= k2[j];
+        k[3]+= k3[j]; k[4]+= k4[j]; k[5]+= k5[j];
+        r[0]+= r0[j]; r[1]+= r1[j]; r[2]+= r2[j];
+      }
+#endif
+    for(;i<n;i++)
+      {
+        const double ea= pt[i]*pa[i];
+        const double eay= ea*py[i];
+        const double eaz= ea*pz[i];
+        const double f= ps[i]*pa[i];
+        k[0]+= ea;
+        k[1]+= eay;
+        k[2]+= eaz;
+        k[3]+= eay*py[i];
+        k[4]+= eay*pz[i];
+        k[5]+= eaz*pz[i];
+        r[0]+= f;
+        r[1]+= f*py[i];
+        r[2]+= f*pz[i];
+      }
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness matrix
+//! and the stress resultant of a 2D section (same storage as
+//! CrossSectionKR::updateK2d and CrossSectionKR::updateNMz).
+void XC::PackedFibers::updateK2d(double k[],double r[]) const
+  {
+    double ks[6], rs[3];
+    reduce(ks,rs);
+    k[0]+= ks[0];
+    k[1]+= ks[1];
+    k[2]+= ks[3];
+    r[0]+= rs[0];
+    r[1]+= rs[1];
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness matrix
+//! and the stress resultant of a 3D section (same storage as
+//! CrossSectionKR::updateK3d and CrossSectionKR::updateNMzMy).
+void XC::PackedFibers::updateK3d(double k[],double r[]) const
+  {
+    double ks[6], rs[3];
+    reduce(ks,rs);
+    k[0]+= ks[0];
+    k[1]+= ks[1];
+    k[2]+= ks[2];
+    k[4]+= ks[3];
+    k[5]+= ks[4];
+    k[8]+= ks[5];
+    r[0]+= rs[0];
+    r[1]+= rs[1];
+    r[2]+= rs[2];
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness matrix
+//! and the stress resultant of a 3D section with torsion (same storage as
+//! CrossSectionKR::updateKGJ and CrossSectionKR::updateNMzMy).
+void XC::PackedFibers::updateKGJ(double k[],double r[]) const
+  {
+    double ks[6], rs[3];
+    reduce(ks,rs);
+    k[0]+= ks[0];
+    k[1]+= ks[1];
+    k[2]+= ks[2];
+    k[5]+= ks[3];
+    k[6]+= ks[4];
+    k[10]+= ks[5];
+    r[0]+= rs[0];
+    r[1]+= rs[1];
+    r[2]+= rs[2];
+  }
@@ -0,0 +1,157 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PackedFibers.h
+
+#ifndef PackedFibers_h
+#define PackedFibers_h
+
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+namespace XC {
+class Fiber;
+class UniaxialMaterial;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Structure of arrays copy of the fiber data used in the
+//! section state determination.
+//!
+//! The positions and areas of the fibers are stored in contiguous
+//! arrays, together with the strain, stress and tangent of each fiber,
+//! so the strain computation and the reduction of the stiffness matrix
+//! and the stress resultant run over plain arrays (see reduce) instead
+//! of calling the virtual methods of each fiber. The fibers are grouped
+//! by the class of their material, so the materials of each group are
+//! updated with a single call (see UniaxialMaterial::setTrialBatch).
+//!
+//! Only the fibers with non-zero area are packed; the remaining
+//! ones don't contribute to the section response.
+//!
+//! Optionally, the fibers whose trial strain falls in the elastic
+//! range of their material (see UniaxialMaterial::getElasticRange) get
+//! their stress and tangent in closed form, without calling the
+//! material. The trial strain of those materials is set later, when
+//! needed (see updateSkippedMaterials).
+class PackedFibers
+  {
+  public:
+    //! @brief Range of packed fibers whose materials share the same class
+    //! (same class tag and same dynamic type).
+    struct MaterialGroup
+      {
+        int classTag; //!< class tag of the materials.
+        size_t begin; //!< index of the first fiber of the group.
+        size_t end; //!< index of the fiber past the last one in the group.
+        MaterialGroup(const int &tag,const size_t &b,const size_t &e)
+          : classTag(tag), begin(b), end(e) {}
+      };
+    typedef std::vector<MaterialGroup> material_groups;
+  private:
+    std::vector<double> y; //!< y coordinate of the fibers.
+    std::vector<double> z; //!< z coordinate of the fibers.
+    std::vector<double> area; //!< area of the fibers.
+    std::vector<double> strain; //!< trial strain of the fibers.
+    std::vector<double> stress; //!< stress of the fibers.
+    std::vector<double> tangent; //!< tangent of the fibers.
+    std::vector<UniaxialMaterial *> materials; //!< fiber materials.
+    material_groups groups; //!< groups of fibers by material class.
+    std::vector<Fiber *> zeroAreaFibers; //!< fibers left out of the packed arrays.
+    std::vector<double> strainMin; //!< lower limit of the elastic range of each fiber.
+    std::vector<double> strainMax; //!< upper limit of the elastic range of each fiber.
+    std::vector<double> elasticE; //!< tangent in the elastic range.
+    std::vector<double> strain0; //!< reference strain of the elastic range.
+    std::vector<double> stress0; //!< reference stress of the elastic range.
+    std::vector<char> skipped; //!< true if the trial strain of the material has not been set.
+    size_t numSkipped; //!< number of skipped materials.
+    bool elasticRanges; //!< true if the elastic ranges are up to date.
+    std::vector<size_t> nonElastic; //!< scratch: fibers out of the elastic range.
+    std::vector<UniaxialMaterial *> batchMaterials; //!< scratch: materials of those fibers.
+    std::vector<double> batchStrain; //!< scratch: strains of those fibers.
+    std::vector<double> batchStress; //!< scratch: stresses of those fibers.
+    std::vector<double> batchTangent; //!< scratch: tangents of those fibers.
+    size_t numFibers; //!< number of fibers in the container when packed.
+    bool packed; //!< true if the arrays are up to date.
+    double Atot; //!< total area of the packed fibers.
+    double Qy; //!< sum of the products area*y.
+    double Qz; //!< sum of the products area*z.
+
+    void reduce(double k[6],double r[3]) const;
+    void update_elastic_ranges(void);
+    int set_trial_group(const MaterialGroup &);
+  public:
+    PackedFibers(void);
+
+    void pack(const std::deque<Fiber *> &);
+    void clear(void);
+    //! @brief Return true if the arrays are up to date with
+    //! a container of n fibers.
+    inline bool isPacked(const size_t &n) const
+      { return (packed && (n==numFibers)); }
+    //! @brief Return the number of packed fibers.
+    inline size_t size(void) const
+      { return area.size(); }
+    //! @brief Return the groups of fibers by material class.
+    inline const material_groups &getMaterialGroups(void) const
+      { return groups; }
+    //! @brief Return the fibers left out of the packed arrays.
+    inline const std::vector<Fiber *> &getZeroAreaFibers(void) const
+      { return zeroAreaFibers; }
+    //! @brief Return the total area of the packed fibers.
+    inline const double &getArea(void) const
+      { return Atot; }
+    //! @brief Return the y coordinate of the centroid.
+    inline double getCenterOfMassY(void) const
+      { return Qy/Atot; }
+    //! @brief Return the z coordinate of the centroid.
+    inline double getCenterOfMassZ(void) const
+      { return Qz/Atot; }
+
+    void computeStrains(const double &,const double &,const double &kz= 0.0);
+    int setTrial(const bool &skipElastic= false);
+    int updateSkippedMaterials(void);
+    void discardSkippedMaterials(void);
+    //! @brief Mark the elastic ranges as out of date (the committed
+    //! state of the materials has changed).
+    inline void clearElasticRanges(void)
+      { elasticRanges= false; }
+    //! @brief Return the number of materials whose trial strain
+    //! has not been set yet.
+    inline size_t getNumSkipped(void) const
+      { return numSkipped; }
+    void getMaterialState(void);
+    void getInitialTangent(void);
+
+    void updateK2d(double k[],double r[]) const;
+    void updateK3d(double k[],double r[]) const;
+    void updateKGJ(double k[],double r[]) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -80,8 +80,8 @@ class UniaxialFiber2d: public UniaxialFiber
     double y; //!< Position of the fiber
               //(its sign is changed -see comments along the file-). 
 
-    static Matrix ks; //!< static class wide matrix object for returns
-    static Vector fs; //!< static class wide vector object for returns
+    static thread_local Matrix ks; //!< static class wide matrix object for returns
+    static thread_local Vector fs; //!< static class wide vector object for returns
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -74,8 +74,8 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::UniaxialFiber3d::ks(3,3); 
-XC::Vector XC::UniaxialFiber3d::fs(3); 
+thread_local XC::Matrix XC::UniaxialFiber3d::ks(3,3); 
+thread_local XC::Vector XC::UniaxialFiber3d::fs(3); 
 
 void XC::UniaxialFiber3d::set_position(const Vector &position)
   {
@@ -73,6 +73,8 @@ class_<XC::FiberPtrDeque, bases<CommandEntity,fiber_ptrs_dq>, boost::noncopyable
   .def("empty",&XC::FiberPtrDeque::empty,"Return true if there are no fibers.")
   .def("clear",&XC::FiberPtrDeque::clear,"Removes all the fibers.")
   .def("getNumFibers",&XC::FiberPtrDeque::getNumFibers)
+  .add_property("packedLayout",&XC::FiberPtrDeque::hasPackedLayout,&XC::FiberPtrDeque::setPackedLayout,"If true, use the packed fiber arrays in the state determination.")
+  .add_property("lazyElasticFibers",&XC::FiberPtrDeque::hasLazyElasticFibers,&XC::FiberPtrDeque::setLazyElasticFibers,"If true, skip the materials of the fibers that remain in their elastic range (packed layout only).")
   .def("getCenterOfMassY",&XC::FiberPtrDeque::getCenterOfMassY,return_value_policy<copy_const_reference>())
   .def("getCenterOfMassZ",&XC::FiberPtrDeque::getCenterOfMassZ,return_value_policy<copy_const_reference>())
   .def("getCenterOfMass",&XC::FiberPtrDeque::getCenterOfMass)
@@ -183,6 +185,8 @@ class_<XC::FiberSet, bases<XC::FiberPtrDeque>, boost::noncopyable >("FiberSet",
   ;
 
 class_<XC::FiberContainer , bases<XC::FiberPtrDeque>, boost::noncopyable >("FiberContainer", no_init)
+  .add_property("arenaStorage",&XC::FiberContainer::hasArenaStorage,&XC::FiberContainer::setArenaStorage,"If true, the fibers created by the container are allocated in a memory arena.")
+  .def("getArenaNumBytes",&XC::FiberContainer::getArenaNumBytes,"Return the number of bytes allocated in the memory arena.")
 //.def("insert",&XC::FiberContainer::insert,"insert fiber.")
   ;
 
@@ -24,10 +24,14 @@
 #include "fiber/python_interface.tcc"
 
 XC::Fiber *(XC::FiberSectionBase::*addFiberAdHoc)(const std::string &,const double &,const XC::Vector &)= &XC::FiberSectionBase::addFiber; 
+XC::FiberContainer &(XC::FiberSectionBase::*getFiberSectionFibers)(void)= &XC::FiberSectionBase::getFibers;
 class_<XC::FiberSectionBase, bases<XC::PrismaticBarCrossSection>, boost::noncopyable >("FiberSectionBase", no_init)
   .def("addFiber",make_function(addFiberAdHoc,return_internal_reference<>()),"Adds a fiber to the section.")
-.def("getFibers",make_function(&XC::FiberSectionBase::getFibers,return_internal_reference<>()),"Return a fiber container with the fibers in the section.")
+.def("getFibers",make_function(getFiberSectionFibers,return_internal_reference<>()),"Return a fiber container with the fibers in the section.")
 .def("getFiberSets",make_function(&XC::FiberSectionBase::getFiberSets,return_internal_reference<>()),"Return the fiber sets in the fiber section.")
+  .add_property("packedFiberLayout",&XC::FiberSectionBase::hasPackedFiberLayout,&XC::FiberSectionBase::setPackedFiberLayout,"If true, the stiffness and the stress resultant of the section are computed from a packed copy of the fiber data (positions and areas in contiguous arrays, fibers grouped by material type).")
+  .add_property("lazyElasticFibers",&XC::FiberSectionBase::hasLazyElasticFibers,&XC::FiberSectionBase::setLazyElasticFibers,"If true (and packedFiberLayout is true), the fibers whose strain stays in the elastic range of their material get their stress and tangent in closed form, without calling the material; the trial state of those materials is updated when the section state is committed or when the fibers are accessed.")
+  .add_property("arenaFiberStorage",&XC::FiberSectionBase::hasArenaFiberStorage,&XC::FiberSectionBase::setArenaFiberStorage,"If true, the fibers of the section and the copies of their materials are allocated together in a few large memory blocks; the setting affects the fibers created afterwards (setupFibers, addFiber and the copies of the section used by the elements).")
 .def("setInitialSectionDeformation",&XC::FiberSectionBase::setInitialSectionDeformation,"Set generalized initial strains values in the section from the components of the vector passed as parameter")
   .def("setTrialSectionDeformation",&XC::FiberSectionBase::setTrialSectionDeformation,"Set generalized trial strains values in the section from the components of the vector passed as parameter")
 .def("getArea",&XC::FiberSectionBase::getArea,"Return the area of the fiber section")
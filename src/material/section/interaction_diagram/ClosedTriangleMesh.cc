@@ -36,6 +36,8 @@
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 #include "xc_utils/src/gnu_gts/TriangleMap.h"
+#include <cstring>
+#include <cstdint>
 
 XC::ClosedTriangleMesh::iterator XC::ClosedTriangleMesh::begin(void) { return trihedrons.begin(); }
 XC::ClosedTriangleMesh::iterator XC::ClosedTriangleMesh::end(void) { return trihedrons.end(); }
@@ -325,7 +327,7 @@ void XC::ClosedTriangleMesh::Print(std::ostream &os) const
 
 //! @brief Return a matrix with the coordinates of the points
 //! that define each one of the trihedrons.
-void XC::ClosedTriangleMesh::getPositionsMatrix(Matrix &m)
+void XC::ClosedTriangleMesh::getPositionsMatrix(Matrix &m) const
   {
     const int sz= size();
     size_t row= 0;
@@ -384,6 +386,60 @@ void XC::ClosedTriangleMesh::read(std::ifstream &is)
     setPositionsMatrix(m);
   }
 
+//! @brief Write the mesh in the compact binary format read by readBinary.
+//!
+//! The format is: tol, rMax and rMin (doubles), the number of
+//! trihedrons (64 bit unsigned integer) and the twelve coordinates
+//! of each trihedron (see getPositionsMatrix) as doubles. All the
+//! fields are eight bytes long so, if the block starts at an eight
+//! byte boundary, it can be read directly from a mapped file.
+void XC::ClosedTriangleMesh::writeBinary(std::ostream &os) const
+  {
+    os.write((const char *) &tol,sizeof tol);
+    os.write((const char *) &rMax,sizeof rMax);
+    os.write((const char *) &rMin,sizeof rMin);
+    const uint64_t numberOfRows= size();
+    os.write((const char *) &numberOfRows,sizeof numberOfRows);
+    Matrix m;
+    getPositionsMatrix(m);
+    for(uint64_t i= 0;i<numberOfRows;i++)
+      for(int j= 0;j<12;j++)
+        {
+          const double x= m(i,j);
+          os.write((const char *) &x,sizeof x);
+        }
+  }
+
+//! @brief Read the mesh from a memory block written by writeBinary.
+//! @param buffer: start of the block.
+//! @param sz: size of the memory available from buffer.
+//! @return number of bytes read (zero if the block is not valid).
+size_t XC::ClosedTriangleMesh::readBinary(const char *buffer,const size_t &sz)
+  {
+    const size_t headerSize= 3*sizeof(double)+sizeof(uint64_t);
+    if(sz<headerSize)
+      return 0;
+    double hdr[3];
+    uint64_t numberOfRows= 0;
+    memcpy(hdr,buffer,3*sizeof(double));
+    memcpy(&numberOfRows,buffer+3*sizeof(double),sizeof(uint64_t));
+    const size_t dataSize= numberOfRows*12*sizeof(double);
+    if((numberOfRows>(sz/(12*sizeof(double)))) || (sz-headerSize<dataSize))
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; truncated data block." << std::endl;
+        return 0;
+      }
+    tol= hdr[0]; rMax= hdr[1]; rMin= hdr[2];
+    Matrix m(numberOfRows,12);
+    const char *p= buffer+headerSize;
+    for(uint64_t i= 0;i<numberOfRows;i++)
+      for(int j= 0;j<12;j++,p+= sizeof(double))
+        memcpy(&m(i,j),p,sizeof(double));
+    setPositionsMatrix(m);
+    return headerSize+dataSize;
+  }
+
 //! @brief Sends object members through the channel being passed as parameter.
 int XC::ClosedTriangleMesh::sendData(CommParameters &cp)
   {
@@ -59,7 +59,7 @@ class ClosedTriangleMesh: public GeomObj3d, public MovableObject
 
     GeomObj::list_Pos3d get_intersection(const Pos3d &p) const;
   protected:
-    void getPositionsMatrix(Matrix &);
+    void getPositionsMatrix(Matrix &) const;
     virtual void setPositionsMatrix(const Matrix &);
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -101,6 +101,8 @@ class ClosedTriangleMesh: public GeomObj3d, public MovableObject
     void read(std::ifstream &);
     void writeTo(const std::string &);
     void readFrom(const std::string &);
+    void writeBinary(std::ostream &) const;
+    size_t readBinary(const char *,const size_t &);
     void Print(std::ostream &os) const;
   };
 
@@ -131,7 +131,7 @@ double XC::DeformationPlane::Strain(const Pos2d &p) const
 //! @brief Returns the generalized strains vector.
 const XC::Vector &XC::DeformationPlane::getDeformation(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval(0)= Strain(Pos2d(0,0));
     retval(1)= Strain(Pos2d(1,0))-retval(0);
     retval(2)= Strain(Pos2d(0,1))-retval(0);
@@ -141,7 +141,7 @@ const XC::Vector &XC::DeformationPlane::getDeformation(void) const
 //! @brief Returns the generalized strains vector.
 const XC::Vector &XC::DeformationPlane::getDeformation(const size_t &order,const ResponseId &code) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval.resize(order);
     retval.Zero();
     const Vector &tmp= getDeformation();
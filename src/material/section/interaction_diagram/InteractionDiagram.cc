@@ -34,24 +34,20 @@
 #include "xc_utils/src/geom/d3/BND3d.h"
 #include "xc_utils/src/geom/d1/Segment3d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
+#include "material/section/interaction_diagram/InteractionDiagramCache.h"
 
 
-//! @brier We classify the trihedron by its quadrant.
-void XC::InteractionDiagram::classify_trihedron(const Trihedron &tdro)
-  {
-    for(int i= 0;i<8;i++)
-      if(tdro.TocaCuadrante(i+1)) quadrant_trihedrons[i].insert(&tdro);
-  }
-
-//! @brier We classify the trihedrons by its quadrants.
+//! @brief Build the angular index of the trihedrons used to find the
+//! one that contains a point (see findTrihedronPtr).
 void XC::InteractionDiagram::classify_trihedrons(void)
   {
-    //Clasificamos los trihedrons por cuadrantes.
-    for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
-      classify_trihedron(*i);
+    Matrix m;
+    getPositionsMatrix(m);
+    direction_index.build(m);
   }
 
 //! @brief Default constructor.
@@ -94,12 +90,14 @@ const Trihedron *XC::InteractionDiagram::findTrihedronPtr(const Pos3d &p) const
                   << std::endl;
         return retval;
       }
-    const int cuadrante= p.Cuadrante();
-    const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
-    for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
-      if((*i)->In(p,tol))
+    //Candidates from the cell that contains the direction of p.
+    const size_t *first= nullptr;
+    const size_t *last= nullptr;
+    direction_index.getCandidates(p.x(),p.y(),p.z(),first,last);
+    for(const size_t *i= first;i!=last;i++)
+      if(trihedrons[*i].In(p,tol))
         {
-          retval= *i;
+          retval= &trihedrons[*i];
           break;
         }
     if(!retval) //Not found, so brute-force search.
@@ -289,6 +287,8 @@ double XC::InteractionDiagram::getCapacityFactor(const Pos3d &esf_d) const
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets
+//! being passed as parameters.
 XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &lp) const
   {
     Vector retval(lp.size());
@@ -298,6 +298,24 @@ XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets
+//! (N,My,Mz) stored in the rows of the matrix being passed as parameter.
+XC::Vector XC::InteractionDiagram::getCapacityFactor(const Matrix &m) const
+  {
+    const int numberOfRows= m.noRows();
+    Vector retval(numberOfRows);
+    if(m.noCols()!=3)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; wrong number of columns: " << m.noCols()
+                  << " (3 expected: N, My, Mz)." << std::endl;
+        return retval;
+      }
+    for(int i= 0;i<numberOfRows;i++)
+      retval[i]= getCapacityFactor(Pos3d(m(i,0),m(i,1),m(i,2)));
+    return retval;
+  }
+
 
 void XC::InteractionDiagram::Print(std::ostream &os) const
   {
@@ -311,19 +329,31 @@ void XC::InteractionDiagram::setPositionsMatrix(const Matrix &m)
     classify_trihedrons();   
   }
 
+//! @brief Compute the interaction diagram of the section.
+//!
+//! If the parameters define a cache directory, the diagram is read
+//! from the cache when possible; otherwise it's computed and stored
+//! in the cache (see InteractionDiagramCache). The cache is not used
+//! if the key of the section can't be computed.
 XC::InteractionDiagram XC::calc_interaction_diagram(const FiberSectionBase &scc,const InteractionDiagramData &data= InteractionDiagramData())
   {
     InteractionDiagram retval;
-    FiberSectionBase *tmp= dynamic_cast<FiberSectionBase *>(scc.getCopy());
-    if(tmp)
+    const std::string &cacheDir= data.getCacheDirectory();
+    if(cacheDir.empty())
+      retval= scc.GetInteractionDiagram(data);
+    else
       {
-        retval= tmp->GetInteractionDiagram(data);
-        delete tmp;
+        const InteractionDiagramCache cache(cacheDir);
+        InteractionDiagramCache::Key key;
+        if(!cache.getKey(scc,data,key))
+          retval= scc.GetInteractionDiagram(data);
+        else if(!cache.read(key,retval))
+          {
+            retval= scc.GetInteractionDiagram(data);
+            if(retval.size()>0)
+              cache.write(key,retval);
+          }
       }
-    else
-      std::cerr << __FUNCTION__
-		<< "; can't get a copy of the section."
-                << std::endl;
     return retval;
   }
 
@@ -33,12 +33,14 @@
 #include <set>
 #include <deque>
 #include "ClosedTriangleMesh.h"
+#include "TrihedronDirectionIndex.h"
 
 class Triang3dMesh;
 
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -48,12 +50,8 @@ class InteractionDiagramData;
 class InteractionDiagram: public ClosedTriangleMesh
   {
   protected:
-    typedef std::set<const Trihedron *> set_ptr_trihedrons;
+    TrihedronDirectionIndex direction_index; //!< angular index of the trihedrons.
 
-    
-    set_ptr_trihedrons quadrant_trihedrons[8];
-
-    void classify_trihedron(const Trihedron &tdro);
     void classify_trihedrons(void);
     void setPositionsMatrix(const Matrix &);
     GeomObj::list_Pos3d get_intersection(const Pos3d &p) const;
@@ -68,6 +66,7 @@ class InteractionDiagram: public ClosedTriangleMesh
     Pos3d getIntersection(const Pos3d &) const;
     double getCapacityFactor(const Pos3d &) const;
     Vector getCapacityFactor(const GeomObj::list_Pos3d &) const;
+    Vector getCapacityFactor(const Matrix &) const;
 
     void Print(std::ostream &os) const;
   };
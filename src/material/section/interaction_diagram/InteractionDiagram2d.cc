@@ -137,50 +137,11 @@ void XC::InteractionDiagram2d::Print(std::ostream &os) const
   }
 
 XC::InteractionDiagram2d XC::calcPlaneInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &data, const double &theta)
-  {
-    InteractionDiagram2d retval;
-    FiberSectionBase *tmp= dynamic_cast<FiberSectionBase *>(scc.getCopy());
-    if(tmp)
-      {
-        retval= tmp->GetInteractionDiagramForPlane(data,theta);
-        delete tmp;
-      }
-    else
-      std::cerr << __FUNCTION__
-		<< "; can't get a copy of the section."
-                << std::endl;
-    return retval;
-  }
+  { return scc.GetInteractionDiagramForPlane(data,theta); }
 
 XC::InteractionDiagram2d XC::calcNMyInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &data= InteractionDiagramData())
-  {
-    InteractionDiagram2d retval;
-    FiberSectionBase *tmp= dynamic_cast<FiberSectionBase *>(scc.getCopy());
-    if(tmp)
-      {
-        retval= tmp->GetNMyInteractionDiagram(data);
-        delete tmp;
-      }
-    else
-      std::cerr << __FUNCTION__
-		<< "; can't get a copy of the section."
-                << std::endl;
-    return retval;
-  }
+  { return scc.GetNMyInteractionDiagram(data); }
 
 XC::InteractionDiagram2d XC::calcNMzInteractionDiagram(const FiberSectionBase &scc,const InteractionDiagramData &data= InteractionDiagramData())
-  {
-    InteractionDiagram2d retval;
-    FiberSectionBase *tmp= dynamic_cast<FiberSectionBase *>(scc.getCopy());
-    if(tmp)
-      {
-        retval= tmp->GetNMzInteractionDiagram(data);
-        delete tmp;
-      }
-    else
-      std::cerr << __FUNCTION__
-		<< "; can't get a copy of the section."
-                << std::endl;
-    return retval;
-  }
+  { return scc.GetNMzInteractionDiagram(data); }
 
@@ -0,0 +1,351 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InteractionDiagramCache.cc
+
+#include "InteractionDiagramCache.h"
+#include "InteractionDiagram.h"
+#include "InteractionDiagramData.h"
+#include "material/section/fiber_section/FiberSectionBase.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include "utility/actor/channel/Channel.h"
+#include "utility/actor/actor/CommParameters.h"
+#include "utility/actor/message/Message.h"
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//! @brief File format version (change it when the file layout
+//! or the contents of the key change).
+static const uint64_t cache_format_version= 3;
+//! @brief Byte order mark.
+static const uint64_t cache_byte_order_mark= 0x0102030405060708ULL;
+//! @brief Magic string at the beginning of the files.
+static const char cache_magic[8]= {'X','C','I','D','I','A','G','\0'};
+//! @brief Size of the file header (magic, version, byte order mark and key).
+static const size_t cache_header_size= sizeof(cache_magic)+4*sizeof(uint64_t);
+//! @brief Database tag assigned to the copy of the material being
+//! hashed, so its header (sent with this data tag) can be recognized.
+static const int material_header_db_tag= -1;
+
+//! @brief Incremental 128 bit hash (FNV-1a and a multiplicative hash
+//! with a splitmix64 finalizer) of the data used as key.
+class ContentHash
+  {
+    uint64_t h1;
+    uint64_t h2;
+    static uint64_t mix(uint64_t z)
+      {
+        z= (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z= (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+      }
+  public:
+    ContentHash(void)
+      : h1(0xcbf29ce484222325ULL), h2(0x9e3779b97f4a7c15ULL) {}
+    void add(const uint64_t &w)
+      {
+        for(size_t i= 0;i<sizeof(w);i++)
+          {
+            h1^= (w >> (8*i)) & 0xff;
+            h1*= 0x100000001b3ULL;
+          }
+        h2= mix(h2+w)+0x9e3779b97f4a7c15ULL;
+      }
+    void add(const double &d)
+      {
+        double x= d;
+        if(x==0.0) x= 0.0; //Same key for -0.0 and 0.0.
+        if(std::isnan(x)) x= NAN;
+        uint64_t w= 0;
+        memcpy(&w,&x,sizeof(w));
+        add(w);
+      }
+    void add(const int &i)
+      { add(static_cast<uint64_t>(static_cast<int64_t>(i))); }
+    void add(const std::string &s)
+      {
+        add(static_cast<uint64_t>(s.size()));
+        for(std::string::const_iterator i= s.begin();i!=s.end();i++)
+          add(static_cast<uint64_t>(static_cast<unsigned char>(*i)));
+      }
+    XC::InteractionDiagramCache::Key getKey(void) const
+      {
+        XC::InteractionDiagramCache::Key retval;
+        retval.h1= h1;
+        retval.h2= h2;
+        return retval;
+      }
+  };
+
+//! @brief Channel that adds the data sent through it to a
+//! ContentHash (it can't receive data).
+//!
+//! Used to hash the data of the materials as written by their sendSelf
+//! methods (parameters and committed state). The database tags and
+//! commit tags are not hashed, so the result doesn't depend on them.
+//! The material tag (first word of the header of the material, see
+//! UniaxialMaterial::sendData) is not hashed either.
+class ContentHashChannel: public XC::Channel
+  {
+    ContentHash &hash;
+  public:
+    ContentHashChannel(ContentHash &h)
+      : XC::Channel(), hash(h) {}
+    char *addToProgram(void)
+      { return nullptr; }
+    int setUpConnection(void)
+      { return 0; }
+    int setNextAddress(const XC::ChannelAddress &)
+      { return 0; }
+    XC::ChannelAddress *getLastSendersAddress(void)
+      { return nullptr; }
+    //! @brief Database tag for the objects nested in the material
+    //! (always zero so the headers that store them don't depend on
+    //! the order of the computation).
+    int getDbTag(void) const
+      { return 0; }
+    int sendObj(int commitTag, XC::MovableObject &theObj, XC::ChannelAddress *theAddress= nullptr)
+      { return sendMovable(commitTag,theObj); }
+    int recvObj(int, XC::MovableObject &, XC::FEM_ObjectBroker &, XC::ChannelAddress *theAddress= nullptr)
+      { return -1; }
+    int sendMsg(int, int, const XC::Message &theMsg, XC::ChannelAddress *theAddress= nullptr)
+      {
+        XC::Message &msg= const_cast<XC::Message &>(theMsg);
+        const int sz= msg.getSize();
+        const char *data= msg.getData();
+        hash.add(static_cast<uint64_t>(1)); //Type of data.
+        hash.add(sz);
+        for(int i= 0;i<sz;i++)
+          hash.add(static_cast<uint64_t>(static_cast<unsigned char>(data[i])));
+        return 0;
+      }
+    int recvMsg(int, int, XC::Message &, XC::ChannelAddress *theAddress= nullptr)
+      { return -1; }
+    int sendMatrix(int, int, const XC::Matrix &m, XC::ChannelAddress *theAddress= nullptr)
+      {
+        hash.add(static_cast<uint64_t>(2)); //Type of data.
+        hash.add(m.noRows());
+        hash.add(m.noCols());
+        for(int i= 0;i<m.noRows();i++)
+          for(int j= 0;j<m.noCols();j++)
+            hash.add(m(i,j));
+        return 0;
+      }
+    int recvMatrix(int, int, XC::Matrix &, XC::ChannelAddress *theAddress= nullptr)
+      { return -1; }
+    int sendVector(int, int, const XC::Vector &v, XC::ChannelAddress *theAddress= nullptr)
+      {
+        hash.add(static_cast<uint64_t>(3)); //Type of data.
+        hash.add(v.Size());
+        for(int i= 0;i<v.Size();i++)
+          hash.add(v(i));
+        return 0;
+      }
+    int recvVector(int, int, XC::Vector &, XC::ChannelAddress *theAddress= nullptr)
+      { return -1; }
+    int sendID(int dataTag, int, const XC::ID &id, XC::ChannelAddress *theAddress= nullptr)
+      {
+        hash.add(static_cast<uint64_t>(4)); //Type of data.
+        hash.add(id.Size());
+        //Skip the material tag.
+        const int first= ((dataTag==material_header_db_tag) ? 1 : 0);
+        for(int i= first;i<id.Size();i++)
+          hash.add(id(i));
+        return 0;
+      }
+    int recvID(int, int, XC::ID &, XC::ChannelAddress *theAddress= nullptr)
+      { return -1; }
+  };
+
+//! @brief Return the hexadecimal representation of the key.
+std::string XC::InteractionDiagramCache::Key::getString(void) const
+  {
+    std::ostringstream os;
+    os << std::hex << std::setfill('0') << std::setw(16) << h1 << std::setw(16) << h2;
+    return os.str();
+  }
+
+//! @brief Constructor.
+//! @param dir: cache directory.
+XC::InteractionDiagramCache::InteractionDiagramCache(const std::string &dir)
+  : directory(dir) {}
+
+//! @brief Compute the key of the interaction diagram of the section
+//! computed with the parameters being passed as parameter.
+//!
+//! The materials are identified by their class and by the data written
+//! by their sendSelf method (parameters and committed state), so
+//! materials that differ in any of their parameters have different keys.
+//! The material tags are not part of the key (sections whose materials
+//! have the same data under different tags share the diagram); the
+//! concrete and reinforcement tags of the parameters are replaced by
+//! the role (concrete, reinforcement) of each fiber. Materials that
+//! wrap other materials still include the tag of the wrapped one.
+//! @return false if the data of some material can't be obtained (the
+//! cache must not be used in that case).
+bool XC::InteractionDiagramCache::getKey(const FiberSectionBase &scc,const InteractionDiagramData &data,Key &key)
+  {
+    bool retval= true;
+    ContentHash hash;
+    hash.add(cache_format_version);
+    // Parameters (the number of threads and the cache directory
+    // don't change the diagram).
+    hash.add(data.getUmbral());
+    hash.add(data.getIncEps());
+    hash.add(data.getIncTheta());
+    const PivotsUltimateStrains &pivots= data.getPivotsUltimateStrains();
+    hash.add(pivots.getUltimateStrainAPivot());
+    hash.add(pivots.getUltimateStrainBPivot());
+    hash.add(pivots.getUltimateStrainCPivot());
+    hash.add(data.getConcreteSetName());
+    hash.add(data.getRebarSetName());
+    // Section.
+    hash.add(scc.getClassName());
+    const Vector &e0= scc.getInitialSectionDeformation();
+    hash.add(static_cast<uint64_t>(e0.Size()));
+    for(int i= 0;i<e0.Size();i++)
+      hash.add(e0(i));
+    // Fibers.
+    ContentHashChannel channel(hash);
+    CommParameters cp(0,channel);
+    const FiberContainer &fibers= scc.getFibers();
+    hash.add(static_cast<uint64_t>(fibers.size()));
+    for(FiberContainer::const_iterator i= fibers.begin();retval && (i!=fibers.end());i++)
+      {
+        const Fiber *f= *i;
+        hash.add(f->getLocY());
+        hash.add(f->getLocZ());
+        hash.add(f->getArea());
+        const UniaxialMaterial *mat= f->getMaterial();
+        if(mat)
+          {
+            hash.add(mat->getClassName());
+            //Role of the fiber (the tags are not part of the key).
+            const int matTag= mat->getTag();
+            uint64_t role= 0;
+            if(matTag==data.getConcreteTag()) role|= 1;
+            if(matTag==data.getReinforcementTag()) role|= 2;
+            hash.add(role);
+            UniaxialMaterial *tmp= mat->getCopy();
+            tmp->setDbTag(material_header_db_tag); //See ContentHashChannel.
+            retval= (tmp->sendSelf(cp)>=0);
+            delete tmp;
+            if(!retval)
+              std::cerr << "InteractionDiagramCache::" << __FUNCTION__
+                        << "; can't get the data of the material: '"
+                        << mat->getClassName() << "' with tag: "
+                        << mat->getTag() << "." << std::endl;
+          }
+        else
+          hash.add(static_cast<uint64_t>(0));
+      }
+    key= hash.getKey();
+    return retval;
+  }
+
+//! @brief Return the name of the file corresponding to the key.
+std::string XC::InteractionDiagramCache::getFileName(const Key &key) const
+  { return directory+"/"+key.getString()+".xcid"; }
+
+//! @brief Read the diagram corresponding to the key being passed
+//! as parameter (the file is mapped in memory).
+//! @return false if the diagram is not in the cache.
+bool XC::InteractionDiagramCache::read(const Key &key,InteractionDiagram &diagram) const
+  {
+    bool retval= false;
+    const std::string fileName= getFileName(key);
+    const int fd= open(fileName.c_str(),O_RDONLY);
+    if(fd<0)
+      return retval; //Not in cache.
+    struct stat st;
+    const size_t sz= ((fstat(fd,&st)==0) ? static_cast<size_t>(st.st_size) : 0);
+    void *ptr= MAP_FAILED;
+    if(sz>cache_header_size)
+      ptr= mmap(nullptr,sz,PROT_READ,MAP_PRIVATE,fd,0);
+    close(fd);
+    if(ptr!=MAP_FAILED)
+      {
+        const char *buffer= static_cast<const char *>(ptr);
+        uint64_t hdr[4];
+        memcpy(hdr,buffer+sizeof(cache_magic),sizeof(hdr));
+        const bool valid= (memcmp(buffer,cache_magic,sizeof(cache_magic))==0) && (hdr[0]==cache_format_version) && (hdr[1]==cache_byte_order_mark) && (hdr[2]==key.h1) && (hdr[3]==key.h2);
+        if(valid)
+          {
+            const size_t dataSize= sz-cache_header_size;
+            retval= (diagram.readBinary(buffer+cache_header_size,dataSize)==dataSize);
+          }
+        munmap(ptr,sz);
+      }
+    if(!retval)
+      std::cerr << "InteractionDiagramCache::" << __FUNCTION__
+                << "; file: '" << fileName
+                << "' is not a valid cache entry; ignored." << std::endl;
+    return retval;
+  }
+
+//! @brief Store the diagram with the key being passed as parameter.
+//! @return false if the diagram can't be written.
+bool XC::InteractionDiagramCache::write(const Key &key,const InteractionDiagram &diagram) const
+  {
+    mkdir(directory.c_str(),0755); //Fails if it already exists.
+    const std::string fileName= getFileName(key);
+    std::ostringstream tmpName;
+    tmpName << fileName << ".tmp." << getpid() << "."
+            << std::hash<std::thread::id>()(std::this_thread::get_id());
+    std::ofstream os(tmpName.str().c_str(),std::ios::out|std::ios::binary);
+    bool retval= os.good();
+    if(retval)
+      {
+        const uint64_t hdr[4]= {cache_format_version,cache_byte_order_mark,key.h1,key.h2};
+        os.write(cache_magic,sizeof(cache_magic));
+        os.write((const char *) hdr,sizeof(hdr));
+        diagram.writeBinary(os);
+        os.close();
+        retval= !os.fail() && (std::rename(tmpName.str().c_str(),fileName.c_str())==0);
+        if(!retval)
+          std::remove(tmpName.str().c_str());
+      }
+    if(!retval)
+      std::cerr << "InteractionDiagramCache::" << __FUNCTION__
+                << "; can't write file: '" << fileName
+                << "'." << std::endl;
+    return retval;
+  }
@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InteractionDiagramCache.h
+
+#ifndef INTERACTIONDIAGRAMCACHE_H
+#define INTERACTIONDIAGRAMCACHE_H
+
+#include <string>
+#include <cstdint>
+
+namespace XC {
+
+class FiberSectionBase;
+class InteractionDiagram;
+class InteractionDiagramData;
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Content-addressed disk cache of interaction diagrams.
+//!
+//! Each diagram is stored in its own file, whose name is the
+//! hexadecimal representation of a 128 bit hash (the key) of
+//! the data the diagram depends on:
+//! - the position, area and material of each fiber (the materials
+//!   are identified by their class and by the data written by their
+//!   sendSelf method: parameters and committed state; the material
+//!   tags are not part of the key),
+//! - the initial strains of the section,
+//! - the parameters of the computation (see InteractionDiagramData)
+//!   except the number of threads and the cache directory.
+//!
+//! The files have a fixed size header (magic string, version,
+//! byte order mark and key) followed by the mesh in the format of
+//! ClosedTriangleMesh::writeBinary, so they are read by mapping them
+//! in memory. The files are written in a temporary file and then
+//! renamed, so concurrent processes can share the same directory.
+class InteractionDiagramCache
+  {
+  public:
+    //! @brief Cache key.
+    struct Key
+      {
+        uint64_t h1; //!< first half of the hash.
+        uint64_t h2; //!< second half of the hash.
+        std::string getString(void) const;
+      };
+  private:
+    std::string directory; //!< cache directory.
+  public:
+    InteractionDiagramCache(const std::string &);
+    //! @brief Return the cache directory.
+    inline const std::string &getDirectory(void) const
+      { return directory; }
+
+    static bool getKey(const FiberSectionBase &,const InteractionDiagramData &,Key &);
+    std::string getFileName(const Key &) const;
+    bool read(const Key &,InteractionDiagram &) const;
+    bool write(const Key &,const InteractionDiagram &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -48,6 +48,8 @@ class InteractionDiagramData: public CommandEntity
     int concrete_tag; //!< Concrete material tag.
     std::string reinforcement_set_name; //!< Steel fibers set name. 
     int reinforcement_tag; //!< Steel material tag.
+    size_t numThreads; //!< Number of threads used to compute the diagram.
+    std::string cache_directory; //!< Directory of the diagram cache (see InteractionDiagramCache); empty: no cache.
   public:
     InteractionDiagramData(void);
     InteractionDiagramData(const double &u,const double &inc_e,const double &inc_t= M_PI/4,const PivotsUltimateStrains &agot= PivotsUltimateStrains());
@@ -84,6 +86,14 @@ class InteractionDiagramData: public CommandEntity
       { return reinforcement_tag; }
     inline void setReinforcementTag(const int &v)
       { reinforcement_tag= v; }
+    //! @brief Return the number of threads used to compute the diagram.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+    inline const std::string &getCacheDirectory(void) const
+      { return cache_directory; }
+    inline void setCacheDirectory(const std::string &v)
+      { cache_directory= v; }
   };
 
 } // end of XC namespace
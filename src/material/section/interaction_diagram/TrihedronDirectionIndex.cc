@@ -0,0 +1,250 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronDirectionIndex.cc
+
+#include "TrihedronDirectionIndex.h"
+#include "utility/matrix/Matrix.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+//! @brief Normalize the vector, return false if its length is zero.
+static bool normalize_direction(double v[3])
+  {
+    const double l= sqrt(v[0]*v[0]+v[1]*v[1]+v[2]*v[2]);
+    if(l<=0.0)
+      return false;
+    v[0]/= l; v[1]/= l; v[2]/= l;
+    return true;
+  }
+
+//! @brief Return the angle between the unit vectors being passed as parameters.
+static double unit_vector_angle(const double a[3],const double b[3])
+  {
+    const double c= a[0]*b[0]+a[1]*b[1]+a[2]*b[2];
+    return acos(std::max(-1.0,std::min(1.0,c)));
+  }
+
+//! @brief Spherical cap (axis and angular radius).
+struct SphericalCap
+  {
+    double axis[3];
+    double radius;
+    double cosRadius;
+    double sinRadius;
+    void setRadius(const double &r)
+      {
+        radius= r;
+        cosRadius= cos(r);
+        sinRadius= sin(r);
+      }
+    //! @brief Return true if both caps overlap.
+    bool overlaps(const SphericalCap &other) const
+      {
+        bool retval= true;
+        if((radius+other.radius)<M_PI)
+          {
+            const double c= axis[0]*other.axis[0]+axis[1]*other.axis[1]+axis[2]*other.axis[2];
+            // cos(radius+other.radius)
+            retval= (c>=(cosRadius*other.cosRadius-sinRadius*other.sinRadius));
+          }
+        return retval;
+      }
+  };
+
+//! @brief Default constructor.
+XC::TrihedronDirectionIndex::TrihedronDirectionIndex(void)
+  : n(0)
+  { center[0]= center[1]= center[2]= 0.0; }
+
+//! @brief Remove the index contents.
+void XC::TrihedronDirectionIndex::clear(void)
+  {
+    n= 0;
+    center[0]= center[1]= center[2]= 0.0;
+    cellBegin.clear();
+    cellTrihedrons.clear();
+  }
+
+//! @brief Return the direction d that corresponds to the face coordinates
+//! (u,v) in [-1,1] of the cube face being passed as parameter.
+void XC::TrihedronDirectionIndex::getCellDirection(const size_t &face,const double &u,const double &v,double d[3]) const
+  {
+    const size_t k= face/2;
+    d[k]= (face%2) ? -1.0 : 1.0;
+    d[(k+1)%3]= u;
+    d[(k+2)%3]= v;
+  }
+
+//! @brief Return the index of the cell that contains the direction d.
+size_t XC::TrihedronDirectionIndex::getCell(const double d[3]) const
+  {
+    size_t k= 0;
+    if(fabs(d[1])>fabs(d[k])) k= 1;
+    if(fabs(d[2])>fabs(d[k])) k= 2;
+    const double dk= fabs(d[k]);
+    const size_t face= 2*k+((d[k]<0.0) ? 1 : 0);
+    const double u= d[(k+1)%3]/dk;
+    const double v= d[(k+2)%3]/dk;
+    const double fn= static_cast<double>(n);
+    const size_t i= std::min(n-1,static_cast<size_t>(std::max(0.0,floor((u+1.0)*0.5*fn))));
+    const size_t j= std::min(n-1,static_cast<size_t>(std::max(0.0,floor((v+1.0)*0.5*fn))));
+    return (face*n+j)*n+i;
+  }
+
+//! @brief Build the index from the matrix that contains the cusp and
+//! the vertices of each trihedron in its rows (see
+//! ClosedTriangleMesh::getPositionsMatrix).
+//!
+//! The index is only built if all the trihedrons share the same cusp;
+//! otherwise the index is left empty and the function returns false.
+bool XC::TrihedronDirectionIndex::build(const Matrix &m)
+  {
+    clear();
+    const size_t numTrihedrons= m.noRows();
+    if(numTrihedrons==0)
+      return false;
+    if(m.noCols()!=12)
+      {
+        std::cerr << "TrihedronDirectionIndex::" << __FUNCTION__
+                  << "; wrong number of columns: " << m.noCols()
+                  << " (12 expected)." << std::endl;
+        return false;
+      }
+    center[0]= m(0,0); center[1]= m(0,1); center[2]= m(0,2);
+    // Bounding cap (axis and angular radius) of each trihedron.
+    std::vector<SphericalCap> caps(numTrihedrons);
+    double scale= 0.0;
+    for(size_t t= 0;t<numTrihedrons;t++)
+      for(size_t k= 3;k<12;k++)
+        scale= std::max(scale,fabs(m(t,k)-center[k%3]));
+    const double cuspTol= 1e-9*std::max(1.0,scale);
+    for(size_t t= 0;t<numTrihedrons;t++)
+      {
+        for(size_t k= 0;k<3;k++)
+          if(fabs(m(t,k)-center[k])>cuspTol)
+            {
+              clear(); //Not a common cusp.
+              return false;
+            }
+        double u[3][3];
+        bool ok= true;
+        for(size_t v= 0;v<3;v++)
+          {
+            for(size_t k= 0;k<3;k++)
+              u[v][k]= m(t,3*(v+1)+k)-center[k];
+            ok= ok && normalize_direction(u[v]);
+          }
+        SphericalCap &cap= caps[t];
+        cap.setRadius(M_PI); //Overlaps everything.
+        double *a= cap.axis;
+        for(size_t k= 0;k<3;k++)
+          a[k]= u[0][k]+u[1][k]+u[2][k];
+        if(ok && normalize_direction(a))
+          {
+            double r= 0.0;
+            for(size_t v= 0;v<3;v++)
+              r= std::max(r,unit_vector_angle(a,u[v]));
+            if(r<M_PI/2.0) //Otherwise the cap is not convex.
+              cap.setRadius(r+1e-6); //Small margin for round-off.
+          }
+      }
+    // About two cells per trihedron.
+    n= std::max<size_t>(1,std::min<size_t>(24,static_cast<size_t>(ceil(sqrt(numTrihedrons/3.0)))));
+    const size_t numCells= getNumCells();
+    // Bounding cap of each cell.
+    std::vector<SphericalCap> cellCaps(numCells);
+    const double h= 2.0/n;
+    for(size_t c= 0;c<numCells;c++)
+      {
+        const size_t i= c%n;
+        const size_t j= (c/n)%n;
+        const size_t face= c/(n*n);
+        double *a= cellCaps[c].axis;
+        getCellDirection(face,-1.0+(i+0.5)*h,-1.0+(j+0.5)*h,a);
+        normalize_direction(a);
+        double r= 0.0;
+        for(size_t q= 0;q<4;q++)
+          {
+            double d[3];
+            getCellDirection(face,-1.0+(i+q%2)*h,-1.0+(j+q/2)*h,d);
+            normalize_direction(d);
+            r= std::max(r,unit_vector_angle(a,d));
+          }
+        cellCaps[c].setRadius(r);
+      }
+    // Compressed storage: count the candidates of each cell and fill.
+    // Only the trihedrons that overlap the cube face are checked.
+    const size_t cellsPerFace= n*n;
+    std::vector<std::vector<size_t> > faceTrihedrons(6);
+    for(size_t face= 0;face<6;face++)
+      {
+        SphericalCap faceCap;
+        getCellDirection(face,0.0,0.0,faceCap.axis);
+        faceCap.setRadius(acos(1.0/sqrt(3.0))+1e-6);
+        for(size_t t= 0;t<numTrihedrons;t++)
+          if(faceCap.overlaps(caps[t]))
+            faceTrihedrons[face].push_back(t);
+      }
+    cellBegin.assign(numCells+1,0);
+    for(size_t c= 0;c<numCells;c++)
+      {
+        const std::vector<size_t> &candidates= faceTrihedrons[c/cellsPerFace];
+        for(std::vector<size_t>::const_iterator t= candidates.begin();t!=candidates.end();t++)
+          if(cellCaps[c].overlaps(caps[*t]))
+            cellBegin[c+1]++;
+      }
+    for(size_t c= 0;c<numCells;c++)
+      cellBegin[c+1]+= cellBegin[c];
+    cellTrihedrons.resize(cellBegin[numCells]);
+    for(size_t c= 0;c<numCells;c++)
+      {
+        const std::vector<size_t> &candidates= faceTrihedrons[c/cellsPerFace];
+        size_t pos= cellBegin[c];
+        for(std::vector<size_t>::const_iterator t= candidates.begin();t!=candidates.end();t++)
+          if(cellCaps[c].overlaps(caps[*t]))
+            cellTrihedrons[pos++]= *t;
+      }
+    return true;
+  }
+
+//! @brief Return in [first,last) the indexes of the trihedrons that
+//! can contain the point (x,y,z).
+void XC::TrihedronDirectionIndex::getCandidates(const double &x,const double &y,const double &z,const size_t *&first,const size_t *&last) const
+  {
+    first= last= nullptr;
+    if(isBuilt())
+      {
+        const double d[3]= {x-center[0],y-center[1],z-center[2]};
+        if((d[0]!=0.0) || (d[1]!=0.0) || (d[2]!=0.0))
+          {
+            const size_t c= getCell(d);
+            first= cellTrihedrons.data()+cellBegin[c];
+            last= cellTrihedrons.data()+cellBegin[c+1];
+          }
+      }
+  }
@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronDirectionIndex.h
+
+#ifndef TRIHEDRON_DIRECTION_INDEX_H
+#define TRIHEDRON_DIRECTION_INDEX_H
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+class Matrix;
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Angular index of the trihedrons of a closed triangle mesh.
+//!
+//! The directions from the common cusp of the trihedrons are mapped
+//! on the faces of a cube (cube map); each face is divided in n x n
+//! cells and each cell stores the trihedrons whose solid angle
+//! can overlap the cell (every trihedron is bounded by the spherical
+//! cap that contains its three edges). Locating the trihedron that
+//! contains a point reduces to check the (few) candidates of the cell
+//! that contains the direction of the point.
+class TrihedronDirectionIndex
+  {
+  private:
+    size_t n; //!< number of cells along each side of a cube face.
+    double center[3]; //!< common cusp of the trihedrons.
+    std::vector<size_t> cellBegin; //!< position of the first candidate of each cell in cellTrihedrons.
+    std::vector<size_t> cellTrihedrons; //!< candidate trihedrons of each cell.
+
+    size_t getCell(const double d[3]) const;
+    void getCellDirection(const size_t &,const double &,const double &,double d[3]) const;
+  public:
+    TrihedronDirectionIndex(void);
+
+    void clear(void);
+    bool build(const Matrix &);
+    //! @brief Return true if the index is ready to be used.
+    inline bool isBuilt(void) const
+      { return !cellBegin.empty(); }
+    //! @brief Return the number of cells along each side of a cube face.
+    inline size_t getNumDivisions(void) const
+      { return n; }
+    //! @brief Return the number of cells of the index.
+    inline size_t getNumCells(void) const
+      { return 6*n*n; }
+    void getCandidates(const double &,const double &,const double &,const size_t *&,const size_t *&) const;
+  };
+
+} // end of XC namespace
+
+#endif
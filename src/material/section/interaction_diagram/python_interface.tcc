@@ -49,6 +49,8 @@ class_<XC::InteractionDiagramData, bases<CommandEntity>>("InteractionDiagramPara
   .add_property("concreteTag",make_function(&XC::InteractionDiagramData::getConcreteTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setConcreteTag)
   .add_property("rebarSetName",make_function(&XC::InteractionDiagramData::getRebarSetName,return_internal_reference<>()),&XC::InteractionDiagramData::setRebarSetName)
   .add_property("reinforcementTag",make_function(&XC::InteractionDiagramData::getReinforcementTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setReinforcementTag)
+  .add_property("numThreads",&XC::InteractionDiagramData::getNumThreads,&XC::InteractionDiagramData::setNumThreads,"Number of threads used to compute the diagram (0: as many as the hardware supports).")
+  .add_property("cacheDirectory",make_function(&XC::InteractionDiagramData::getCacheDirectory,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setCacheDirectory,"Directory where the computed diagrams are stored to be reused (empty: no cache).")
   ;
 
 class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTriangleMesh", no_init)
@@ -65,11 +67,13 @@ class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTri
   ;
 
 double (XC::InteractionDiagram::*getCF)(const Pos3d &esf_d) const= &XC::InteractionDiagram::getCapacityFactor;
+XC::Vector (XC::InteractionDiagram::*getCFMatrix)(const XC::Matrix &) const= &XC::InteractionDiagram::getCapacityFactor;
 class_<XC::InteractionDiagram, bases<XC::ClosedTriangleMesh>, boost::noncopyable >("InteractionDiagram", no_init)
   .def("centroid",&XC::InteractionDiagram::getCenterOfMass)
   .def("getLength",&XC::InteractionDiagram::getLength)
   .def("getIntersection",&XC::InteractionDiagram::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getCF)
+  .def("getCapacityFactor",getCFMatrix,"Returns the capacity factors for the internal forces triplets (N,My,Mz) in the rows of the matrix.")
   .def("writeTo",&XC::InteractionDiagram::writeTo)
   .def("readFrom",&XC::InteractionDiagram::readFrom)
   ;
@@ -39,8 +39,8 @@
 #include "domain/component/Parameter.h"
 #include "material/section/SectionForceDeformation.h"
 
-XC::Matrix XC::CrossSectionProperties2d::ks2(2,2);
-XC::Matrix XC::CrossSectionProperties2d::ks3(3,3);
+thread_local XC::Matrix XC::CrossSectionProperties2d::ks2(2,2);
+thread_local XC::Matrix XC::CrossSectionProperties2d::ks3(3,3);
 
 bool XC::CrossSectionProperties2d::check_values(void)
   {
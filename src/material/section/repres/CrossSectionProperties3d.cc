@@ -38,8 +38,8 @@
 #include "material/section/SectionForceDeformation.h"
 #include "material/section/ResponseId.h"
 
-XC::Matrix XC::CrossSectionProperties3d::ks4(4,4);
-XC::Matrix XC::CrossSectionProperties3d::ks6(6,6);
+thread_local XC::Matrix XC::CrossSectionProperties3d::ks4(4,4);
+thread_local XC::Matrix XC::CrossSectionProperties3d::ks6(6,6);
 
 //! @brief Check values of inertia values.
 bool XC::CrossSectionProperties3d::check_values(void)
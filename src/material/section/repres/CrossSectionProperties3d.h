@@ -41,8 +41,8 @@ class CrossSectionProperties3d: public CrossSectionProperties2d
   {
   private:
     double iy, iyz, j;
-    static Matrix ks4;
-    static Matrix ks6;
+    static thread_local Matrix ks4;
+    static thread_local Matrix ks6;
   protected:
     DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
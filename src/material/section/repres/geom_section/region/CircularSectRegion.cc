@@ -93,7 +93,7 @@ void XC::CircularSectRegion::getAngles(double &initialAngle, double &finalAngle)
 
 const XC::Matrix &XC::CircularSectRegion::getVertCoords(void) const
   {
-    static Matrix vertCoord(4,2);
+    static thread_local Matrix vertCoord(4,2);
     const double cosI= cos(initAng);
     const double cosF= cos(finalAng);
     const double sinI= sin(initAng);
@@ -37,10 +37,10 @@
 
 #define SEC_TAG_YS2d -1
 
-XC::Vector  XC::YieldSurfaceSection2d::dele(2);
-XC::Vector  XC::YieldSurfaceSection2d::surfaceForce(2);
-XC::Matrix  XC::YieldSurfaceSection2d::G(2,1);
-XC::Matrix  XC::YieldSurfaceSection2d::Ktp(2,2);
+thread_local XC::Vector  XC::YieldSurfaceSection2d::dele(2);
+thread_local XC::Vector  XC::YieldSurfaceSection2d::surfaceForce(2);
+thread_local XC::Matrix  XC::YieldSurfaceSection2d::G(2,1);
+thread_local XC::Matrix  XC::YieldSurfaceSection2d::Ktp(2,2);
 
 XC::YieldSurfaceSection2d::YieldSurfaceSection2d(void)
   :PrismaticBarCrossSection(0, SEC_TAG_YS2d),
@@ -210,7 +210,7 @@ const XC::Vector &XC::YieldSurfaceSection2d::getInitialSectionDeformation(void)
 //! @brief Returns generalized trial deformation.
 const XC::Vector &XC::YieldSurfaceSection2d::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -223,7 +223,7 @@ const XC::Matrix &XC::YieldSurfaceSection2d::getSectionTangent(void) const
 
 const XC::Matrix &XC::YieldSurfaceSection2d::getSectionFlexibility(void) const
   {
-    static XC::Matrix fs(2,2);
+    static thread_local XC::Matrix fs(2,2);
     invert2by2Matrix(ks, fs);
     return fs;
   }
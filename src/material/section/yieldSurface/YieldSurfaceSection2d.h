@@ -64,10 +64,10 @@ class YieldSurfaceSection2d: public PrismaticBarCrossSection
   private:
     //    int algo;
     bool use_Kr, split_step;
-    static Vector dele;
-    static Vector surfaceForce;
-    static Matrix G;
-    static Matrix Ktp;
+    static thread_local Vector dele;
+    static thread_local Vector surfaceForce;
+    static thread_local Matrix G;
+    static thread_local Matrix Ktp;
   public:
     YieldSurfaceSection2d( int tag, int classtag,YieldSurface_BC *ptrys, bool use_kr=true);
     YieldSurfaceSection2d(void);    
@@ -105,6 +105,23 @@ int XC::ElasticMaterial::setTrial(double strain, double &stress, double &tangent
     return 0;
   }
 
+//! @brief Sets the trial strains of a batch of elastic materials
+//! (strain rate is zero) and returns their stresses and tangents.
+//!
+//! The loop has neither branches nor virtual calls.
+int XC::ElasticMaterial::setTrialBatch(const size_t &n,UniaxialMaterial *const *materials,const double *strains,double *stresses,double *tangents) const
+  {
+    for(size_t i= 0;i<n;i++)
+      {
+        ElasticMaterial *m= static_cast<ElasticMaterial *>(materials[i]);
+        m->trialStrain= strains[i];
+        m->trialStrainRate= 0.0;
+        stresses[i]= m->E*(strains[i]-m->ezero);
+        tangents[i]= m->E;
+      }
+    return 0;
+  }
+
 //! @brief Returns the product of \f$E * \epsilon\f$, where \f$\epsilon\f$ is
 //! the current trial strain.
 double XC::ElasticMaterial::getStress(void) const
@@ -94,6 +94,7 @@ class ElasticMaterial : public ElasticBaseMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
+    int setTrialBatch(const size_t &,UniaxialMaterial *const *,const double *,double *,double *) const;
     double getStrainRate(void) const {return trialStrainRate;};
     double getStress(void) const;
     double getTangent(void) const {return E;}
@@ -60,7 +60,7 @@ const int PYmaxIterations = 20;
 const double PYtolerance = 1.0e-12;
 
 int XC::PyLiq1::loadStage = 0;
-XC::Vector XC::PyLiq1::stressV3(3);
+thread_local XC::Vector XC::PyLiq1::stressV3(3);
 
 /////////////////////////////////////////////////////////////////////
 //! @brief Constructor with data
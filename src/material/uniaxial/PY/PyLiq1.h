@@ -91,7 +91,7 @@ class PyLiq1 : public PySimple1
      
     // Function for obtaining effective stresses from adjoining solid soil elements
     double getEffectiveStress(void);
-    static Vector stressV3;
+    static thread_local Vector stressV3;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
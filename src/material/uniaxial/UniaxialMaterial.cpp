@@ -92,6 +92,45 @@ int XC::UniaxialMaterial::setTrial(double strain, double &stress, double &tangen
     return res;
   }
 
+//! @brief Sets the trial strains of a batch of materials of the same
+//! class as this one (strain rate is zero) and returns their stresses
+//! and tangents.
+//!
+//! The derived classes can redefine this method to update the whole
+//! batch without a virtual call for each material; this default
+//! implementation calls setTrial for each one.
+//! @param n: number of materials in the batch.
+//! @param materials: pointers to the materials.
+//! @param strains: trial strains (n values).
+//! @param stresses: stresses (n values, output).
+//! @param tangents: tangents (n values, output).
+int XC::UniaxialMaterial::setTrialBatch(const size_t &n,UniaxialMaterial *const *materials,const double *strains,double *stresses,double *tangents) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      retval+= materials[i]->setTrial(strains[i],stresses[i],tangents[i]);
+    return retval;
+  }
+
+//! @brief Return true if, from the last committed state, the response
+//! of the material is linear for the trial strains in the range
+//! [strainMin,strainMax]. In that range setTrialStrain gives a stress
+//! stress0+E*(strain-strain0) (or stress0 if the strain increment
+//! is not greater than DBL_EPSILON) and a tangent E.
+//!
+//! The fiber sections use it to skip the materials whose trial strain
+//! falls in that range (see PackedFibers::setTrial). This default
+//! implementation returns false (the range is not known); it's kept
+//! by the materials whose response has no exactly linear branch
+//! (i.e. Steel02).
+//! @param strainMin: lower limit of the range (output).
+//! @param strainMax: upper limit of the range (output).
+//! @param E: tangent in the range (output).
+//! @param strain0: strain of the reference point (output).
+//! @param stress0: stress of the reference point (output).
+bool XC::UniaxialMaterial::getElasticRange(double &strainMin,double &strainMax,double &E,double &strain0,double &stress0) const
+  { return false; }
+
 //! @brief Return the initial strain.
 double XC::UniaxialMaterial::getInitialStrain(void) const
   { return 0.0; }
@@ -104,7 +143,7 @@ double XC::UniaxialMaterial::getStrainRate(void) const
 //! @brief Return the generalized stress.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getStress();
     return retval;
   }
@@ -112,14 +151,14 @@ const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
 //! @brief Return the generalized strain.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getStrain();
     return retval;
   }
 
 const XC::Vector &XC::UniaxialMaterial::getInitialGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getInitialStrain();
     return retval;
   }
@@ -222,7 +261,7 @@ XC::Response *XC::UniaxialMaterial::setResponse(const std::vector<std::string> &
 
 int XC::UniaxialMaterial::getResponse(int responseID, Information &matInfo)
   {
-    static XC::Vector stressStrain(2);
+    static thread_local XC::Vector stressStrain(2);
     // each subclass must implement its own stuff    
     switch(responseID)
       {
@@ -69,6 +69,7 @@
 #define NEG_INF_STRAIN       -1.0e16
 
 #include <material/Material.h>
+#include "utility/memory/MemoryArena.h"
 namespace XC {
 class ID;
 class Vector;
@@ -98,6 +99,12 @@ class UniaxialMaterial : public Material
     int recvData(const CommParameters &);
   public:
     UniaxialMaterial(int tag, int classTag);
+
+    //! @brief Allocates the material in the current arena (if any, see MemoryArena).
+    static void *operator new(size_t sz)
+      { return MemoryArena::allocate_object(sz); }
+    static void operator delete(void *ptr)
+      { MemoryArena::deallocate_object(ptr); }
         
     virtual int setInitialStrain(double strain);
     //! @brief Sets the value of the trial strain.
@@ -106,6 +113,8 @@ class UniaxialMaterial : public Material
     //!return 0 if successful, a negative number if not.
     virtual int setTrialStrain(double strain, double strainRate = 0.0)= 0;
     virtual int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
+    virtual int setTrialBatch(const size_t &,UniaxialMaterial *const *,const double *,double *,double *) const;
+    virtual bool getElasticRange(double &,double &,double &,double &,double &) const;
 
     virtual double getInitialStrain(void) const;
     virtual double getStrain(void) const= 0;
@@ -68,6 +68,7 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <cmath>
 #include <cfloat>
+#include <algorithm>
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
 //int count= 0;
@@ -237,6 +238,41 @@ int XC::Concrete01::setTrial(double strain, double &stress, double &tangent, dou
     return 0;
   }
 
+//! @brief Sets the trial strains of a batch of Concrete01 materials
+//! and returns their stresses and tangents (the methods of this
+//! class are called directly, without a virtual call for each material).
+int XC::Concrete01::setTrialBatch(const size_t &n,UniaxialMaterial *const *materials,const double *strains,double *stresses,double *tangents) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Concrete01 *m= static_cast<Concrete01 *>(materials[i]);
+        retval+= m->Concrete01::setTrial(strains[i],stresses[i],tangents[i]);
+      }
+    return retval;
+  }
+
+//! @brief Return the range of trial strains for which the response
+//! from the committed state is linear (see UniaxialMaterial::getElasticRange).
+//!
+//! The material doesn't resist tension: for positive strains the
+//! stress and the tangent are zero. The strains too close to the
+//! committed one are left out when the committed state is not
+//! in tension (setTrialStrain returns the committed state for them).
+bool XC::Concrete01::getElasticRange(double &strainMin,double &strainMax,double &E,double &strain0,double &stress0) const
+  {
+    const double cStrain= convergedState.getStrain();
+    if(cStrain>0.0 && convergedState.getStress()==0.0 && convergedState.getTangent()==0.0)
+      strainMin= DBL_MIN;
+    else
+      strainMin= std::max(DBL_MIN,cStrain+2.0*DBL_EPSILON);
+    strainMax= DBL_MAX;
+    E= 0.0;
+    strain0= cStrain;
+    stress0= 0.0;
+    return true;
+  }
+
 //! @brief ??
 void XC::Concrete01::determineTrialState(double dStrain)
   {
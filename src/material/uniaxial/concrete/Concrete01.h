@@ -109,6 +109,8 @@ class Concrete01: public ConcreteBase
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
+    int setTrialBatch(const size_t &,UniaxialMaterial *const *,const double *,double *,double *) const;
+    bool getElasticRange(double &,double &,double &,double &,double &) const;
 
     //! @brief Returns initial tangent stiffness.
     inline double getInitialTangent(void) const
@@ -64,6 +64,7 @@
 
 #include <material/uniaxial/concrete/Concrete02.h>
 #include <cfloat>
+#include <algorithm>
 
 void XC::Concrete02::setup_parameters(void)
   {
@@ -148,6 +149,54 @@ double XC::Concrete02::getLambda(void) const
   { return rat; }
 
 
+//! @brief Sets the trial strains of a batch of Concrete02 materials
+//! and returns their stresses and tangents (the methods of this
+//! class are called directly, without a virtual call for each material).
+int XC::Concrete02::setTrialBatch(const size_t &n,UniaxialMaterial *const *materials,const double *strains,double *stresses,double *tangents) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Concrete02 *m= static_cast<Concrete02 *>(materials[i]);
+        retval+= m->Concrete02::setTrialStrain(strains[i]);
+        stresses[i]= m->Concrete02::getStress();
+        tangents[i]= m->Concrete02::getTangent();
+      }
+    return retval;
+  }
+
+//! @brief Compute the reloading branch from the minimum previous
+//! strain ecmin.
+//! @param sigmm: stress of the compression envelope at ecmin (output).
+//! @param er: reloading slope (output).
+//! @param ept: strain that corresponds to zero stress in the reloading
+//! branch (output).
+void XC::Concrete02::get_reloading_branch(const double &ecmin,double &sigmm,double &er,double &ept) const
+  {
+    const double ec0= getInitialTangent();
+
+    // calculate strain-stress coordinates of point R that determines 
+    // the reloading slope according to Fig.2.11 in EERC Report 
+    // (corresponding equations are 2.31 and 2.32 
+    // the strain of point R is epsR and the stress is sigmR 
+    
+    const double epsr= (fpcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
+    const double sigmr= ec0 * epsr;
+    
+    // calculate the previous minimum stress sigmm from the minimum 
+    // previous strain ecmin and the monotonic envelope in compression 
+    
+    double dumy;
+    this->Compr_Envlp(ecmin, sigmm, dumy);
+    
+    // calculate current reloading slope Er (Eq. 2.35 in EERC Report) 
+    // calculate the intersection of the current reloading slope Er 
+    // with the zero stress axis (variable ept) (Eq. 2.36 in EERC Report) 
+    
+    er= (sigmm - sigmr) / (ecmin - epsr);
+    ept= ecmin - sigmm / er;
+  }
+
 int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
   {
     const double ec0= getInitialTangent();
@@ -173,27 +222,10 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
         // (which corresponds to zero stress) the material is in the unloading- 
         // reloading branch and the stress remains between sigmin and sigmax 
     
-        // calculate strain-stress coordinates of point R that determines 
-        // the reloading slope according to Fig.2.11 in EERC Report 
-        // (corresponding equations are 2.31 and 2.32 
-        // the strain of point R is epsR and the stress is sigmR 
-    
-        const double epsr= (fpcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
-        const double sigmr= ec0 * epsr;
-    
-        // calculate the previous minimum stress sigmm from the minimum 
-        // previous strain hstv.ecmin and the monotonic envelope in compression 
-    
-        double sigmm;
-        double dumy;
-        this->Compr_Envlp(hstv.ecmin, sigmm, dumy);
-    
-        // calculate current reloading slope Er (Eq. 2.35 in EERC Report) 
-        // calculate the intersection of the current reloading slope Er 
-        // with the zero stress axis (variable ept) (Eq. 2.36 in EERC Report) 
-    
-        const double er= (sigmm - sigmr) / (hstv.ecmin - epsr);
-        const double ept= hstv.ecmin - sigmm / er;
+        // calculate the reloading slope Er and its intersection ept
+        // with the zero stress axis (see get_reloading_branch)
+        double sigmm, er, ept;
+        get_reloading_branch(hstv.ecmin,sigmm,er,ept);
     
         if(hstv.eps <= ept)
           {
@@ -239,6 +271,42 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
   }
 
 
+//! @brief Return the range of trial strains for which the response
+//! from the committed state is linear (see UniaxialMaterial::getElasticRange).
+//!
+//! The range is the reloading branch in tension, between ept (zero
+//! stress) and epn (maximum remaining tensile strength). While the
+//! concrete is not cracked (dept is zero) the branch is replaced by the
+//! linear part of the tension envelope. In both cases the stress is
+//! e*(strain-ept), so ept is the reference point. The strains too
+//! close to ept are left out. The unloading branch is not used: its
+//! stress is computed from the committed one and it's cut by bounds
+//! that change with the strain.
+bool XC::Concrete02::getElasticRange(double &strainMin,double &strainMax,double &E,double &strain0,double &stress0) const
+  {
+    double sigmm, er, ept;
+    get_reloading_branch(hstvP.ecmin,sigmm,er,ept);
+    const double dept= hstvP.dept;
+    double epn= ept + dept;
+    if(dept != 0.0)
+      {
+        double sicn;
+        Tens_Envlp(dept, sicn, E);
+        E= sicn / dept;
+      }
+    else
+      {
+        E= getInitialTangent();
+        epn= ept + ft/E; // end of the linear part of the envelope.
+      }
+    const double margin= 1e-6*(epn-ept);
+    strainMin= ept+std::max(2.0*DBL_EPSILON,margin);
+    strainMax= epn-margin;
+    strain0= ept;
+    stress0= 0.0;
+    return ((strainMin<strainMax) && (strainMin>=hstvP.ecmin));
+  }
+
 
 int XC::Concrete02::commitState(void)
   {
@@ -317,7 +385,7 @@ void XC::Concrete02::Print(std::ostream &s, int flag)
   }
 
 
-void XC::Concrete02::Tens_Envlp(double epsc, double &sigc, double &Ect)
+void XC::Concrete02::Tens_Envlp(double epsc, double &sigc, double &Ect) const
   {
     /*-----------------------------------------------------------------------
     ! monotonic envelope of concrete in tension (positive envelope)
@@ -359,7 +427,7 @@ void XC::Concrete02::Tens_Envlp(double epsc, double &sigc, double &Ect)
   }
 
   
-void XC::Concrete02::Compr_Envlp(double epsc, double &sigc, double &Ect) 
+void XC::Concrete02::Compr_Envlp(double epsc, double &sigc, double &Ect) const
   {
     /*-----------------------------------------------------------------------
     ! monotonic envelope of concrete in compression (negative envelope)
@@ -140,8 +140,9 @@ class Concrete02: public RawConcrete
     // hstv : Concrete HISTORY VARIABLES  current step
     Conc02HistoryVars hstv; //!< = values at current step (trial values)
 
-    void Tens_Envlp(double epsc, double &sigc, double &Ect);
-    void Compr_Envlp(double epsc, double &sigc, double &Ect);
+    void Tens_Envlp(double epsc, double &sigc, double &Ect) const;
+    void Compr_Envlp(double epsc, double &sigc, double &Ect) const;
+    void get_reloading_branch(const double &,double &,double &,double &) const;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -165,6 +166,8 @@ class Concrete02: public RawConcrete
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(const size_t &,UniaxialMaterial *const *,const double *,double *,double *) const;
+    bool getElasticRange(double &,double &,double &,double &,double &) const;
     inline double getStrain(void) const
       { return hstv.getStrain(); }
     inline double getStress(void) const
@@ -65,6 +65,7 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <cmath>
 #include <cfloat>
+#include <algorithm>
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/actor/actor/MovableMatrix.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
@@ -229,6 +230,114 @@ void XC::Steel01::detectLoadReversal(double dStrain)
      }
   }
 
+//! @brief Sets the trial strains of a batch of Steel01 materials
+//! and returns their stresses and tangents.
+//!
+//! The materials are processed in blocks: the committed state of each
+//! block is copied into local arrays, the trial stresses and tangents
+//! are computed by a loop without branches (the same expressions used
+//! in determineTrialState) and then the trial state is written back
+//! to each material, checking for load reversals. The file is compiled
+//! with -ffp-contract=off (see src/CMakeLists.txt), so the results are
+//! the same that those of determineTrialState.
+int XC::Steel01::setTrialBatch(const size_t &n,UniaxialMaterial *const *materials,const double *strains,double *stresses,double *tangents) const
+  {
+    static const size_t blockSize= 64;
+    double dStrain[blockSize], cStress[blockSize], cTangent[blockSize];
+    double e0[blockSize], esh[blockSize], fyOneMinusB[blockSize];
+    double shiftP[blockSize], shiftN[blockSize];
+    for(size_t i0= 0;i0<n;i0+= blockSize)
+      {
+        const size_t nb= std::min(blockSize,n-i0);
+        UniaxialMaterial *const *m= materials+i0;
+        const double *eps= strains+i0;
+        double *sig= stresses+i0;
+        double *tg= tangents+i0;
+        // Gather the committed state.
+        for(size_t j= 0;j<nb;j++)
+          {
+            const Steel01 &s= *static_cast<const Steel01 *>(m[j]);
+            dStrain[j]= eps[j]-s.Cstrain;
+            cStress[j]= s.Cstress;
+            cTangent[j]= s.Ctangent;
+            e0[j]= s.E0;
+            esh[j]= s.getEsh();
+            fyOneMinusB[j]= s.fy*(1.0-s.b);
+            shiftP[j]= s.CshiftP;
+            shiftN[j]= s.CshiftN;
+          }
+        // Trial stress and tangent.
+        for(size_t j= 0;j<nb;j++)
+          {
+            const double c1= esh[j]*eps[j];
+            const double c2= shiftN[j]*fyOneMinusB[j];
+            const double c3= shiftP[j]*fyOneMinusB[j];
+            const double c= cStress[j]+e0[j]*dStrain[j];
+            const double stress= std::max((c1-c2), std::min((c1+c3),c));
+            const double tangent= (fabs(stress-c)<DBL_EPSILON) ? e0[j] : esh[j];
+            const bool changed= (fabs(dStrain[j]) > DBL_EPSILON);
+            sig[j]= changed ? stress : cStress[j];
+            tg[j]= changed ? tangent : cTangent[j];
+          }
+        // Scatter the trial state.
+        for(size_t j= 0;j<nb;j++)
+          {
+            Steel01 &s= *static_cast<Steel01 *>(m[j]);
+            if(fabs(eps[j])>fabs(10.0*s.getEpsy()))
+              std::clog << "Warning: the strain in material SteelBase0103 is very big: "
+                        << eps[j] << std::endl;
+            s.TminStrain= s.CminStrain;
+            s.TmaxStrain= s.CmaxStrain;
+            s.TshiftP= s.CshiftP;
+            s.TshiftN= s.CshiftN;
+            s.Tloading= s.Cloading;
+            s.Tstrain= (fabs(dStrain[j]) > DBL_EPSILON) ? eps[j] : s.Cstrain;
+            s.Tstress= sig[j];
+            s.Ttangent= tg[j];
+            if(fabs(dStrain[j]) > DBL_EPSILON)
+              s.detectLoadReversal(dStrain[j]);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Return the range of trial strains for which the response
+//! from the committed state follows the elastic branch (see
+//! UniaxialMaterial::getElasticRange).
+//!
+//! The range is the one where the stress Cstress+E0*(strain-Cstrain)
+//! lies between the bounds computed in determineTrialState, shrunk by
+//! a small margin so the tangent is E0 in all of it. The strains that
+//! trigger the "very big strain" warning are left out too. If the
+//! committed tangent is not E0 (the material yielded in the last
+//! step) the range is not used, because a null strain increment
+//! returns the committed tangent.
+bool XC::Steel01::getElasticRange(double &strainMin,double &strainMax,double &E,double &strain0,double &stress0) const
+  {
+    const double Esh= getEsh();
+    bool retval= ((Ctangent==E0) && (E0>Esh));
+    if(retval)
+      {
+        const double fyOneMinusB= fy*(1.0-b);
+        const double c2= CshiftN*fyOneMinusB;
+        const double c3= CshiftP*fyOneMinusB;
+        const double c= E0*Cstrain-Cstress;
+        const double dE= E0-Esh;
+        // Esh*strain-c2 <= Cstress+E0*(strain-Cstrain) <= Esh*strain+c3
+        strainMin= (c-c2)/dE;
+        strainMax= (c+c3)/dE;
+        const double margin= 1e-6*(strainMax-strainMin);
+        const double epsLim= fabs(10.0*getEpsy());
+        strainMin= std::max(strainMin+margin,-epsLim);
+        strainMax= std::min(strainMax-margin,epsLim);
+        E= E0;
+        strain0= Cstrain;
+        stress0= Cstress;
+        retval= (strainMin<strainMax);
+      }
+    return retval;
+  }
+
 int XC::Steel01::revertToStart(void)
   {
     SteelBase0103::revertToStart();
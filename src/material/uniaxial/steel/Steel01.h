@@ -108,6 +108,8 @@ class Steel01 : public SteelBase0103
 
     UniaxialMaterial *getCopy(void) const;
 
+    int setTrialBatch(const size_t &,UniaxialMaterial *const *,const double *,double *,double *) const;
+    bool getElasticRange(double &,double &,double &,double &,double &) const;
     int revertToStart(void);
 
     int sendSelf(CommParameters &);
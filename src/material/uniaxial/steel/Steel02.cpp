@@ -129,6 +129,22 @@ void XC::Steel02::setInitialStress(const double &d)
 XC::UniaxialMaterial *XC::Steel02::getCopy(void) const
   { return new Steel02(*this); }
 
+//! @brief Sets the trial strains of a batch of Steel02 materials
+//! and returns their stresses and tangents (the methods of this
+//! class are called directly, without a virtual call for each material).
+int XC::Steel02::setTrialBatch(const size_t &n,UniaxialMaterial *const *materials,const double *strains,double *stresses,double *tangents) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Steel02 *m= static_cast<Steel02 *>(materials[i]);
+        retval+= m->Steel02::setTrialStrain(strains[i]);
+        stresses[i]= m->Steel02::getStress();
+        tangents[i]= m->Steel02::getTangent();
+      }
+    return retval;
+  }
+
 int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
   {
     double Esh= b * E0;
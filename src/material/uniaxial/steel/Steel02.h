@@ -72,6 +72,10 @@ namespace XC {
 //
 //! @brief Uniaxial material for steel. Menegotto-Pinto steel
 //! model with Filippou isotropic hardening.
+//!
+//! The Menegotto-Pinto curve has no linear branch, so this class keeps
+//! the default UniaxialMaterial::getElasticRange (its fibers are never
+//! skipped by the lazy state determination of the fiber sections).
 class Steel02 : public SteelBase
   {
   private:
@@ -125,6 +129,7 @@ class Steel02 : public SteelBase
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0);
+    int setTrialBatch(const size_t &,UniaxialMaterial *const *,const double *,double *,double *) const;
     double getStrain(void) const;
     double getStress(void) const;
     double getTangent(void) const;
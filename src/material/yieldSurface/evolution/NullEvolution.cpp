@@ -39,9 +39,9 @@
 #include "material/yieldSurface/evolution/NullEvolution.h"
 #define nullptr_EVOL_CLASS_TAG -1
 
-XC::Vector XC::NullEvolution::vec_dim_1(1);
-XC::Vector XC::NullEvolution::vec_dim_2(2);
-XC::Vector XC::NullEvolution::vec_dim_3(3);
+thread_local XC::Vector XC::NullEvolution::vec_dim_1(1);
+thread_local XC::Vector XC::NullEvolution::vec_dim_2(2);
+thread_local XC::Vector XC::NullEvolution::vec_dim_3(3);
 
 XC::NullEvolution::NullEvolution(int tag, double isox)
 :YS_Evolution(tag, nullptr_EVOL_CLASS_TAG, 0.0, 0.0, 1, 0.0, 0.0)
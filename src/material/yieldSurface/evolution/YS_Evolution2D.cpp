@@ -37,7 +37,7 @@
 #define modifDebug 0
 #define transDebug 0
 
-XC::Vector XC::YS_Evolution2D::v2(2);
+thread_local XC::Vector XC::YS_Evolution2D::v2(2);
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -72,7 +72,7 @@ protected:
 //  double sumPlasticDeformX, sumPlasticDeformX_hist;
 //  double sumPlasticDeformY, sumPlasticDeformY_hist;
     bool   softening;
-    static Vector v2;
+    static thread_local Vector v2;
     double minIsoFactor;
     YieldSurface_BC *tmpYSPtr;
   };
@@ -39,12 +39,12 @@
 #include <utility/recorder/response/MaterialResponse.h>
 
 double XC::YieldSurface_BC2D::error(1.0e-6);
-XC::Vector XC::YieldSurface_BC2D::v6(6);
-XC::Vector XC::YieldSurface_BC2D::T2(2);
-XC::Vector XC::YieldSurface_BC2D::F2(2);
-XC::Vector XC::YieldSurface_BC2D::g2(2);
-XC::Vector XC::YieldSurface_BC2D::v2(2);
-XC::Vector XC::YieldSurface_BC2D::v4(4);
+thread_local XC::Vector XC::YieldSurface_BC2D::v6(6);
+thread_local XC::Vector XC::YieldSurface_BC2D::T2(2);
+thread_local XC::Vector XC::YieldSurface_BC2D::F2(2);
+thread_local XC::Vector XC::YieldSurface_BC2D::g2(2);
+thread_local XC::Vector XC::YieldSurface_BC2D::v2(2);
+thread_local XC::Vector XC::YieldSurface_BC2D::v4(4);
 
 
 //////////////////////////////////////////////////////////////////////
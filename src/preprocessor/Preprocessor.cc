@@ -76,6 +76,20 @@ void XC::Preprocessor::UpdateSets(Node *new_node)
       }
   }
 
+//! @brief Insert the pointers to the nodes in the "total" set and in the 
+//! sets that are currently opened (each set is updated only once).
+void XC::Preprocessor::UpdateSets(const std::vector<Node *> &new_nodes)
+  {
+    sets.get_set_total()->addNodes(new_nodes);
+    MapSet::map_sets &open_sets= sets.get_open_sets();
+    for(MapSet::map_sets::iterator i= open_sets.begin();i!= open_sets.end();i++)
+      {
+        Set *ptr_set= dynamic_cast<Set *>((*i).second);
+        assert(ptr_set);
+        ptr_set->addNodes(new_nodes);
+      }
+  }
+
 //! @brief Insert the pointer to the element in the "total" set and in the 
 //! sets that are currently opened.
 void XC::Preprocessor::UpdateSets(Element *new_elem)
@@ -90,6 +104,20 @@ void XC::Preprocessor::UpdateSets(Element *new_elem)
       }
   }
 
+//! @brief Insert the pointers to the elements in the "total" set and in the 
+//! sets that are currently opened (each set is updated only once).
+void XC::Preprocessor::UpdateSets(const std::vector<Element *> &new_elems)
+  {
+    sets.get_set_total()->addElements(new_elems);
+    MapSet::map_sets &open_sets= sets.get_open_sets();
+    for(MapSet::map_sets::iterator i= open_sets.begin();i!= open_sets.end();i++)
+      {
+        Set *ptr_set= dynamic_cast<Set *>((*i).second);
+        assert(ptr_set);
+        ptr_set->addElements(new_elems);
+      }
+  }
+
 //! @brief Insert the pointer to the constraint in the "total" set and in the 
 //! sets that are currently opened.
 void XC::Preprocessor::UpdateSets(Constraint *new_constraint)
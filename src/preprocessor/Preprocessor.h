@@ -93,6 +93,7 @@ class Preprocessor: public CommandEntity, public MovableObject
     friend class BoundaryCondHandler;
     friend class FEProblem;
     void UpdateSets(Element *);
+    void UpdateSets(const std::vector<Element *> &);
     void UpdateSets(Constraint *);
 
     SetEstruct *busca_set_estruct(const std::string &nmb);
@@ -105,6 +106,7 @@ class Preprocessor: public CommandEntity, public MovableObject
     FE_Datastore *getDataBase(void);
 
     void UpdateSets(Node *);
+    void UpdateSets(const std::vector<Node *> &);
 
     MapSet &get_sets(void)
       { return sets; }
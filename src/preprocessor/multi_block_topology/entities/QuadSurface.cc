@@ -36,6 +36,11 @@
 #include "domain/mesh/element/Element.h"
 #include "xc_utils/src/matrices/TMatrix.h"
 #include "preprocessor/Preprocessor.h"
+#include "preprocessor/prep_handlers/NodeHandler.h"
+#include "preprocessor/prep_handlers/ElementHandler.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/Mesh.h"
+#include "utility/parallel/ThreadPool.h"
 
 //! @brief Constructor.
 XC::QuadSurface::QuadSurface(Preprocessor *m,const size_t &ndivI, const size_t &ndivJ)
@@ -466,6 +471,44 @@ Polygon3d XC::QuadSurface::getPolygon(void) const
     return retval;
   }
 
+//! @brief Allocates the node array and sets the pointers to the
+//! nodes of the contour lines (that must be already created).
+void XC::QuadSurface::set_contour_nodes(void)
+  {
+    const size_t n_rows= NDivJ()+1;
+    const size_t n_cols= NDivI()+1;
+    ttzNodes= NodePtrArray3d(1,n_rows,n_cols);
+
+    //Set the pointers of the contour nodes.
+    //j=1
+    for(size_t k=1;k<=n_cols;k++)
+      {
+        Side &ll= lines[0];
+        Node *nn= ll.getNode(k);
+        ttzNodes(1,1,k)= nn;
+      }
+    //j=n_rows.
+    for(size_t k=1;k<=n_cols;k++) // Reverse.
+      ttzNodes(1,n_rows,k)= lines[2].getNodeReverse(k);
+    //k=1
+    for(size_t j=2;j<n_rows;j++) // Reverse.
+      ttzNodes(1,j,1)= lines[3].getNodeReverse(j);
+    //k=n_cols.
+    for(size_t j=2;j<n_rows;j++)
+      ttzNodes(1,j,n_cols)= lines[1].getNode(j);
+  }
+
+//! @brief Returns the number of nodes in the interior of the surface.
+size_t XC::QuadSurface::get_num_interior_nodes(void) const
+  {
+    const size_t n_rows= ttzNodes.getNumberOfRows();
+    const size_t n_cols= ttzNodes.getNumberOfColumns();
+    size_t retval= 0;
+    if((n_rows>2) && (n_cols>2))
+      retval= (n_rows-2)*(n_cols-2);
+    return retval;
+  }
+
 //! @brief Creates surface nodes.
 void XC::QuadSurface::create_nodes(void)
   {
@@ -474,31 +517,11 @@ void XC::QuadSurface::create_nodes(void)
     if(ttzNodes.Null())
       {
         create_line_nodes();
-
-        const size_t n_rows= NDivJ()+1;
-        const size_t n_cols= NDivI()+1;
-        ttzNodes= NodePtrArray3d(1,n_rows,n_cols);
-
-
-        //Set the pointers of the contour nodes.
-        //j=1
-        for(size_t k=1;k<=n_cols;k++)
-          {
-            Side &ll= lines[0];
-            Node *nn= ll.getNode(k);
-            ttzNodes(1,1,k)= nn;
-          }
-        //j=n_rows.
-        for(size_t k=1;k<=n_cols;k++) // Reverse.
-          ttzNodes(1,n_rows,k)= lines[2].getNodeReverse(k);
-        //k=1
-        for(size_t j=2;j<n_rows;j++) // Reverse.
-          ttzNodes(1,j,1)= lines[3].getNodeReverse(j);
-        //k=n_cols.
-        for(size_t j=2;j<n_rows;j++)
-          ttzNodes(1,j,n_cols)= lines[1].getNode(j);
+        set_contour_nodes();
 
         //Populate the interior nodes.
+        const size_t n_rows= ttzNodes.getNumberOfRows();
+        const size_t n_cols= ttzNodes.getNumberOfColumns();
         Pos3dArray node_pos= get_positions(); //Node positions.
         for(size_t j= 2;j<n_rows;j++) //interior rows.
           for(size_t k= 2;k<n_cols;k++) //interior columns.
@@ -528,3 +551,163 @@ void XC::QuadSurface::genMesh(meshing_dir dm)
     if(verbosity>3)
       std::clog << "done." << std::endl;
   }
+
+//! @brief Meshes the surfaces being passed as parameter in two phases.
+//!
+//! First the positions of the interior nodes of all the surfaces are
+//! computed in parallel (using the number of threads of the mesh, see
+//! Mesh::setNumThreads) and the nodes are added to the domain in one
+//! ordered batch; then the elements are created by copying the seed
+//! element (serially, since copying the elements and their materials
+//! may touch Python objects) and added to the domain and to the sets
+//! in one ordered batch. The nodes of the contour lines are created
+//! (serially) before, so the lines and points shared by the surfaces
+//! keep being meshed only once. The tags of the interior nodes are
+//! reserved in surface order, so the tags of the resulting nodes and
+//! elements are the same ones obtained by meshing the surfaces one by one.
+void XC::QuadSurface::genMesh(const std::vector<QuadSurface *> &surfaces,meshing_dir dm)
+  {
+    const size_t numSurfaces= surfaces.size();
+    if(numSurfaces<1)
+      return;
+    Preprocessor *prep= surfaces.front()->getPreprocessor();
+    if(!prep)
+      {
+        std::cerr << "QuadSurface::" << __FUNCTION__
+	          << "; preprocessor undefined." << std::endl;
+        return;
+      }
+    NodeHandler &nodeHandler= prep->getNodeHandler();
+    ElementHandler &elementHandler= prep->getElementHandler();
+    const size_t nThreads= prep->getDomain()->getMesh().getNumThreads();
+
+    // Contour nodes and tags of the interior nodes (in surface order).
+    std::vector<int> firstTags(numSurfaces,-1);
+    for(size_t i= 0;i<numSurfaces;i++)
+      {
+        QuadSurface &s= *surfaces[i];
+        s.checkNDivs();
+        if(s.ttzNodes.Null())
+          {
+            s.create_line_nodes();
+            s.set_contour_nodes();
+            firstTags[i]= nodeHandler.getDefaultTag();
+            nodeHandler.setDefaultTag(firstTags[i]+s.get_num_interior_nodes());
+          }
+        else if(s.verbosity>2)
+          std::clog << s.getClassName() << "::" << __FUNCTION__
+	            << "; nodes of entity: '" << s.getName()
+		    << "' already exist." << std::endl;
+      }
+
+    // Positions of the interior nodes (in parallel).
+    std::vector<Pos3dArray> positions(numSurfaces);
+    ThreadPool::for_each_index(numSurfaces,nThreads,[&](const size_t &i)
+      {
+        if(firstTags[i]>=0)
+          positions[i]= surfaces[i]->get_positions();
+      });
+
+    // Creation of the interior nodes (one batch).
+    std::vector<int> tags;
+    std::vector<Pos3d> pos;
+    for(size_t i= 0;i<numSurfaces;i++)
+      if(firstTags[i]>=0)
+        {
+          const QuadSurface &s= *surfaces[i];
+          const size_t n_rows= s.ttzNodes.getNumberOfRows();
+          const size_t n_cols= s.ttzNodes.getNumberOfColumns();
+          if((positions[i].getNumberOfRows()!=n_rows) || (positions[i].getNumberOfColumns()!=n_cols))
+            {
+              std::cerr << s.getClassName() << "::" << __FUNCTION__
+	                << "; can't compute the positions of the nodes"
+		        << " of the surface: '" << s.getName()
+			<< "'." << std::endl;
+              firstTags[i]= -1;
+              continue;
+            }
+          int tg= firstTags[i];
+          for(size_t j= 2;j<n_rows;j++) //interior rows.
+            for(size_t k= 2;k<n_cols;k++,tg++) //interior columns.
+              {
+                tags.push_back(tg);
+                pos.push_back(positions[i](j,k));
+              }
+        }
+    const std::vector<Node *> nodes= nodeHandler.newNodes(tags,pos);
+    std::vector<Node *>::const_iterator iNode= nodes.begin();
+    for(size_t i= 0;i<numSurfaces;i++)
+      if(firstTags[i]>=0)
+        {
+          QuadSurface &s= *surfaces[i];
+          const size_t n_rows= s.ttzNodes.getNumberOfRows();
+          const size_t n_cols= s.ttzNodes.getNumberOfColumns();
+          for(size_t j= 2;j<n_rows;j++)
+            for(size_t k= 2;k<n_cols;k++,iNode++)
+              s.ttzNodes(1,j,k)= *iNode;
+        }
+
+    // Elements of the surfaces.
+    const Element *seed= elementHandler.get_seed_element();
+    std::vector<bool> newElements(numSurfaces,false);
+    for(size_t i= 0;i<numSurfaces;i++)
+      {
+        const QuadSurface &s= *surfaces[i];
+        if(!s.ttzElements.Null())
+          {
+            if(s.verbosity>2)
+              std::clog << s.getClassName() << "::" << __FUNCTION__
+	                << "; elements for surface: '" << s.getName()
+		        << "' already exist." << std::endl;
+          }
+        else if(s.ttzNodes.empty() || s.ttzNodes.HasNull())
+          std::cerr << s.getClassName() << "::" << __FUNCTION__
+	            << "; there are null pointers in the nodes of surface: '"
+		    << s.getName() << "'. Elements were not created."
+		    << std::endl;
+        else if(!seed)
+          {
+            if(s.verbosity>0)
+              std::clog << s.getClassName() << "::" << __FUNCTION__
+		        << "; seed element not set." << std::endl;
+          }
+        else
+          newElements[i]= true;
+      }
+    for(size_t i= 0;i<numSurfaces;i++)
+      if(newElements[i])
+        surfaces[i]->ttzElements= seed->put_on_mesh(surfaces[i]->ttzNodes,dm);
+
+    // Creation of the elements (one batch).
+    std::vector<Element *> elements;
+    for(size_t i= 0;i<numSurfaces;i++)
+      if(newElements[i])
+        {
+          const ElemPtrArray3d &elems= surfaces[i]->ttzElements;
+          const size_t n_layers= elems.getNumberOfLayers();
+          if(n_layers<1) continue;
+          const size_t n_rows= elems(1).getNumberOfRows();
+          const size_t n_cols= elems(1).getNumberOfColumns();
+          for(size_t l= 1;l<=n_layers;l++)
+            for(size_t j= 1;j<=n_rows;j++)
+              for(size_t k= 1;k<=n_cols;k++)
+                if(elems(l,j,k))
+                  elements.push_back(elems(l,j,k));
+        }
+    elementHandler.Add(elements);
+    std::vector<Element *>::const_iterator iElem= elements.begin();
+    for(size_t i= 0;i<numSurfaces;i++)
+      if(newElements[i])
+        {
+          ElemPtrArray3d &elems= surfaces[i]->ttzElements;
+          const size_t n_layers= elems.getNumberOfLayers();
+          if(n_layers<1) continue;
+          const size_t n_rows= elems(1).getNumberOfRows();
+          const size_t n_cols= elems(1).getNumberOfColumns();
+          for(size_t l= 1;l<=n_layers;l++)
+            for(size_t j= 1;j<=n_rows;j++)
+              for(size_t k= 1;k<=n_cols;k++)
+                if(elems(l,j,k))
+                  elems(l,j,k)= *iElem++; //Null if rejected.
+        }
+  }
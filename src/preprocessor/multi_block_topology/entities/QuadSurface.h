@@ -31,6 +31,7 @@
 
 #include "Face.h"
 #include "preprocessor/multi_block_topology/matrices/PntPtrArray.h"
+#include <vector>
 
 class Polygon3d;
 namespace XC {
@@ -43,6 +44,8 @@ class QuadSurface: public Face
   protected:
     Pos3dArray get_positions(void) const;
     const Edge *get_lado_homologo(const Edge *l) const;
+    void set_contour_nodes(void);
+    size_t get_num_interior_nodes(void) const;
   public:
     QuadSurface(Preprocessor *m,const size_t &ndivI= 4, const size_t &ndivJ= 4);
     virtual SetEstruct *getCopy(void) const;
@@ -74,6 +77,7 @@ class QuadSurface: public Face
     bool checkNDivs(void) const;
     void create_nodes(void);
     void genMesh(meshing_dir dm);
+    static void genMesh(const std::vector<QuadSurface *> &,meshing_dir dm);
   };
 
 } //end of XC namespace
@@ -35,6 +35,9 @@
 
 #include "domain/mesh/node/Node.h"
 #include "utility/tagged/DefaultTag.h"
+#include "utility/matrix/ID.h"
+#include "utility/xc_python_utils.h"
+#include <boost/python/extract.hpp>
 
 void XC::ElementHandler::SeedElemHandler::free_mem(void)
   {
@@ -131,6 +134,20 @@ void XC::ElementHandler::Add(Element *e)
       }
   }
 
+//! @brief Adds the elements and set their identifiers (tags) in one
+//! batch, use in EntMdlr class.
+//!
+//! The elements receive consecutive tags starting at the default tag,
+//! as if they were added one by one with Add(Element *); the rejected
+//! ones are deleted and replaced by null pointers in the vector.
+XC::ID XC::ElementHandler::Add(std::vector<Element *> &elements)
+  {
+    int tg= getDefaultTag();
+    for(std::vector<Element *>::iterator i= elements.begin();i!=elements.end();i++)
+      (*i)->setTag(tg++);
+    setDefaultTag(tg);
+    return add_elements(elements);
+  }
 
 //! @brief Adds a new element to the model.
 void XC::ElementHandler::new_element(Element *e)
@@ -139,3 +156,141 @@ void XC::ElementHandler::new_element(Element *e)
     getPreprocessor()->UpdateSets(e);
   }
 
+//! @brief Adds the elements to the domain and to the sets in one
+//! batch and returns their tags (-1 for the elements that were rejected
+//! by the domain, which are deleted and replaced by null pointers
+//! in the vector).
+XC::ID XC::ElementHandler::add_elements(std::vector<Element *> &elements)
+  {
+    const size_t sz= elements.size();
+    ID retval(sz);
+    Domain *dom= getDomain();
+    const size_t numAdded= dom->addElements(elements);
+    if(numAdded==sz)
+      {
+        for(size_t i= 0;i<sz;i++)
+          retval[i]= elements[i]->getTag();
+        getPreprocessor()->UpdateSets(elements);
+      }
+    else
+      {
+        std::vector<Element *> added;
+        added.reserve(numAdded);
+        for(size_t i= 0;i<sz;i++)
+          {
+            Element *e= elements[i];
+            if(dom->getElement(e->getTag())==e)
+              {
+                retval[i]= e->getTag();
+                added.push_back(e);
+              }
+            else
+              {
+                retval[i]= -1;
+                delete e;
+                elements[i]= nullptr;
+              }
+          }
+        getPreprocessor()->UpdateSets(added);
+      }
+    return retval;
+  }
+
+//! @brief Creates copies of the seed element connected to the nodes
+//! stored in the array being passed as parameter and returns their tags.
+//!
+//! The elements are created with consecutive tags starting at the default
+//! tag and the domain, the sets and the KD-trees are updated once for
+//! the whole batch.
+//! @param conn: node tags of the elements (e0n0,e0n1,...,e1n0,e1n1,...).
+//! @param numElements: number of elements.
+//! @param numNodesElem: number of nodes of each element in the array.
+XC::ID XC::ElementHandler::newElements(const int *conn,const size_t &numElements,const size_t &numNodesElem)
+  {
+    ID retval;
+    const Element *seed= get_seed_element();
+    if(!seed)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; seed element not set." << std::endl;
+    else if(size_t(seed->getNumExternalNodes())!=numNodesElem)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; the seed element has " << seed->getNumExternalNodes()
+		<< " nodes, " << numNodesElem << " were given."
+		<< std::endl;
+    else
+      {
+        std::vector<Element *> elements;
+        elements.reserve(numElements);
+        std::vector<int> iNodes(numNodesElem);
+        int tg= getDefaultTag();
+        const int *p= conn;
+        for(size_t i= 0;i<numElements;i++,p+= numNodesElem,tg++)
+          {
+            Element *e= seed->getCopy();
+            e->setTag(tg);
+            iNodes.assign(p,p+numNodesElem);
+            e->setIdNodes(iNodes);
+            elements.push_back(e);
+          }
+        setDefaultTag(tg);
+        retval= add_elements(elements);
+      }
+    return retval;
+  }
+
+//! @brief Creates copies of the seed element connected to the nodes
+//! stored in the Python object being passed as parameter (an ID or any
+//! object that exports a buffer of integers, like a numpy array with
+//! one row for each element).
+//!
+//! The buffer of C-contiguous arrays of int is used directly (no copy).
+XC::ID XC::ElementHandler::newElementsPy(const boost::python::object &o)
+  {
+    ID retval;
+    const Element *seed= get_seed_element();
+    if(!seed)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; seed element not set." << std::endl;
+    else
+      {
+        const size_t numNodesElem= seed->getNumExternalNodes();
+        boost::python::extract<ID> id(o);
+        if(id.check())
+          {
+            const ID &conn= id();
+            if(conn.Size()%numNodesElem!=0)
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; the size of the ID: " << conn.Size()
+                        << " is not a multiple of the number of nodes"
+                        << " of the seed element." << std::endl;
+            else
+              retval= newElements(conn.getDataPtr(),conn.Size()/numNodesElem,numNodesElem);
+          }
+        else
+          {
+            const PyBufferView buffer(o,numNodesElem);
+            if(buffer.isValid())
+              {
+                const size_t numElements= buffer.getNumberOfRows();
+                const size_t numCols= buffer.getNumberOfColumns();
+                const int *ptr= buffer.getIntPtr();
+                if(ptr) //Zero copy.
+                  retval= newElements(ptr,numElements,numCols);
+                else
+                  {
+                    std::vector<int> tmp(numElements*numCols);
+                    for(size_t i= 0;i<numElements;i++)
+                      for(size_t j= 0;j<numCols;j++)
+                        tmp[i*numCols+j]= buffer.getInt(i,j);
+                    retval= newElements(tmp.data(),numElements,numCols);
+                  }
+              }
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; the argument must be an ID or an array."
+                        << std::endl;
+          }
+      }
+    return retval;
+  }
+
@@ -30,8 +30,10 @@
 #define ELEMENTHANDLER_H
 
 #include "preprocessor/prep_handlers/ProtoElementHandler.h"
+#include <vector>
 
 namespace XC {
+class ID;
 
 //!  @ingroup Ldrs
 //! 
@@ -60,6 +62,7 @@ class ElementHandler: public ProtoElementHandler
       };
   private:
     SeedElemHandler seed_elem_handler; //!< Seed element for meshing.
+    ID add_elements(std::vector<Element *> &);
   protected:
     virtual void add(Element *);
   public:
@@ -73,6 +76,9 @@ class ElementHandler: public ProtoElementHandler
       { return seed_elem_handler.GetSeedElement(); }
 
     virtual void Add(Element *);
+    ID Add(std::vector<Element *> &);
+    ID newElements(const int *,const size_t &,const size_t &);
+    ID newElementsPy(const boost::python::object &);
 
     int getDefaultTag(void) const;
     void setDefaultTag(const int &tag);
@@ -38,6 +38,11 @@
 
 #include "domain/mesh/element/Element.h"
 #include "utility/tagged/DefaultTag.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/xc_python_utils.h"
+#include <boost/python/extract.hpp>
+#include <algorithm>
 
 void XC::NodeHandler::free_mem(void)
   {
@@ -184,6 +189,185 @@ XC::Node *XC::NodeHandler::newNode(const Vector &coo)
     return retval;
   }
 
+//! @brief Return the seed node (creates it if needed).
+XC::Node *XC::NodeHandler::alloc_seed_node(void)
+  {
+    if(!seed_node)
+      {
+        const int tg= getDefaultTag(); //Before seed node creation.
+        seed_node= new_node(0,ncoo_def_node,ndof_def_node,0.0,0.0,0.0);
+        setDefaultTag(tg);
+      }
+    return seed_node;
+  }
+
+//! @brief Adds the nodes to the domain and to the sets in one
+//! batch and returns their tags (-1 for the nodes that were rejected
+//! by the domain, which are deleted and replaced by null pointers
+//! in the vector).
+XC::ID XC::NodeHandler::add_nodes(std::vector<Node *> &nodes)
+  {
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    Domain *dom= getDomain();
+    const size_t numAdded= dom->addNodes(nodes);
+    if(numAdded==sz)
+      {
+        for(size_t i= 0;i<sz;i++)
+          retval[i]= nodes[i]->getTag();
+        getPreprocessor()->UpdateSets(nodes);
+      }
+    else
+      {
+        std::vector<Node *> added;
+        added.reserve(numAdded);
+        for(size_t i= 0;i<sz;i++)
+          {
+            Node *n= nodes[i];
+            if(dom->getNode(n->getTag())==n)
+              {
+                retval[i]= n->getTag();
+                added.push_back(n);
+              }
+            else
+              {
+                retval[i]= -1;
+                delete n;
+                nodes[i]= nullptr;
+              }
+          }
+        getPreprocessor()->UpdateSets(added);
+      }
+    return retval;
+  }
+
+//! @brief Creates the nodes whose coordinates are stored in the array
+//! being passed as parameter and returns their tags.
+//!
+//! The nodes are created with consecutive tags starting at the default
+//! tag and the domain, the sets and the KD-trees are updated once for
+//! the whole batch.
+//! @param coo: coordinates of the nodes (x0,y0,z0,x1,y1,z1,...).
+//! @param numNodes: number of nodes.
+//! @param numCoo: number of coordinates of each node in the array.
+XC::ID XC::NodeHandler::newNodes(const double *coo,const size_t &numNodes,const size_t &numCoo)
+  {
+    if(numCoo==0)
+      {
+        if(numNodes>0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+	            << "; no coordinates given for the "
+		    << numNodes << " nodes." << std::endl;
+        return ID();
+      }
+    const Node *seed= alloc_seed_node();
+    const size_t dim= seed->getDim();
+    const int ndof= seed->getNumberDOF();
+    if(numCoo<dim)
+      std::clog << getClassName() << "::" << __FUNCTION__
+	        << "; " << numCoo << " coordinates given for "
+		<< dim << "-dimensional nodes, the remaining ones"
+		<< " are set to zero." << std::endl;
+    std::vector<Node *> nodes;
+    nodes.reserve(numNodes);
+    int tg= getDefaultTag();
+    const double *p= coo;
+    for(size_t i= 0;i<numNodes;i++,p+= numCoo,tg++)
+      {
+        const double x= p[0];
+        const double y= (numCoo>1 ? p[1] : 0.0);
+        const double z= (numCoo>2 ? p[2] : 0.0);
+        nodes.push_back(new_node(tg,dim,ndof,x,y,z));
+      }
+    return add_nodes(nodes);
+  }
+
+//! @brief Creates the nodes whose coordinates are the rows of the
+//! matrix being passed as parameter and returns their tags.
+XC::ID XC::NodeHandler::newNodes(const Matrix &coo)
+  {
+    const size_t numNodes= coo.noRows();
+    const size_t numCoo= coo.noCols();
+    std::vector<double> tmp(numNodes*numCoo);
+    for(size_t i= 0;i<numNodes;i++)
+      for(size_t j= 0;j<numCoo;j++)
+        tmp[i*numCoo+j]= coo(i,j);
+    return newNodes(tmp.data(),numNodes,numCoo);
+  }
+
+//! @brief Creates the nodes whose coordinates are stored in the Python
+//! object being passed as parameter (a Matrix or any object that exports
+//! a buffer of numbers, like a numpy array with one row for each node).
+//!
+//! The buffer of C-contiguous arrays of doubles is used directly
+//! (no copy).
+XC::ID XC::NodeHandler::newNodesPy(const boost::python::object &o)
+  {
+    ID retval;
+    boost::python::extract<Matrix> m(o);
+    if(m.check())
+      retval= newNodes(m());
+    else
+      {
+        const PyBufferView buffer(o,alloc_seed_node()->getDim());
+        if(buffer.isValid())
+          {
+            const size_t numNodes= buffer.getNumberOfRows();
+            const size_t numCoo= buffer.getNumberOfColumns();
+            const double *ptr= buffer.getDoublePtr();
+            if(ptr) //Zero copy.
+              retval= newNodes(ptr,numNodes,numCoo);
+            else
+              {
+                std::vector<double> tmp(numNodes*numCoo);
+                for(size_t i= 0;i<numNodes;i++)
+                  for(size_t j= 0;j<numCoo;j++)
+                    tmp[i*numCoo+j]= buffer.getDouble(i,j);
+                retval= newNodes(tmp.data(),numNodes,numCoo);
+              }
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+	            << "; the argument must be a matrix or an array."
+		    << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Creates the nodes with the tags and at the positions being
+//! passed as parameters and returns pointers to them (null pointers
+//! for the nodes rejected by the domain).
+//!
+//! The domain, the sets and the KD-trees are updated once for the whole
+//! batch and the default tag is not modified (used by the structured
+//! meshing of the entities to create nodes whose tags were reserved
+//! in advance).
+//! @param tags: tags of the new nodes.
+//! @param positions: positions of the new nodes.
+std::vector<XC::Node *> XC::NodeHandler::newNodes(const std::vector<int> &tags,const std::vector<Pos3d> &positions)
+  {
+    std::vector<Node *> retval;
+    const size_t numNodes= std::min(tags.size(),positions.size());
+    if(tags.size()!=positions.size())
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; the number of tags: " << tags.size()
+		<< " doesn't match the number of positions: "
+		<< positions.size() << std::endl;
+    const int tg= getDefaultTag(); //Node constructor modifies it.
+    const Node *seed= alloc_seed_node();
+    const size_t dim= seed->getDim();
+    const int ndof= seed->getNumberDOF();
+    retval.reserve(numNodes);
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const Pos3d &p= positions[i];
+        retval.push_back(new_node(tags[i],dim,ndof,p.x(),p.y(),p.z()));
+      }
+    add_nodes(retval);
+    setDefaultTag(tg);
+    return retval;
+  }
+
 //! @brief Defines the seed node.
 XC::Node *XC::NodeHandler::newSeedNode(void)
   {
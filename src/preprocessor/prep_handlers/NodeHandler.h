@@ -31,10 +31,13 @@
 
 #include "PrepHandler.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <vector>
 
 namespace XC {
 
 class Node;
+class ID;
+class Matrix;
 
 //!  @ingroup Lodrs
 //! 
@@ -47,6 +50,8 @@ class NodeHandler: public PrepHandler
     Node *seed_node; //!< Seed node for semi-automatic meshing.
     void free_mem(void);
     Node *new_node(const int &tag,const size_t &dim,const int &ndof,const double &x,const double &y=0.0,const double &z=0.0);
+    Node *alloc_seed_node(void);
+    ID add_nodes(std::vector<Node *> &);
   public:
     NodeHandler(Preprocessor *);
     virtual ~NodeHandler(void);
@@ -62,6 +67,10 @@ class NodeHandler: public PrepHandler
     Node *newNodeIDXYZ(const int &,const double &,const double &,const double &);
     Node *newNodeIDXY(const int &,const double &,const double &);
     Node *newNodeIDV(const int &,const Vector &);
+    ID newNodes(const double *,const size_t &,const size_t &);
+    ID newNodes(const Matrix &);
+    ID newNodesPy(const boost::python::object &);
+    std::vector<Node *> newNodes(const std::vector<int> &,const std::vector<Pos3d> &);
     Node *duplicateNode(const int &);
 
     size_t getDimEspacio(void) const
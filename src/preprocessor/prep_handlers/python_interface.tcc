@@ -38,6 +38,7 @@ class_<XC::NodeHandler, bases<XC::PrepHandler>, boost::noncopyable >("NodeHandle
   .def("newNodeXY", newNodeFromXY,return_internal_reference<>(),"\n""newNodeXY(x,y)\n""Create a node from global coordinates (x,y).")
   .def("newNodeIDXY", &XC::NodeHandler::newNodeIDXY,return_internal_reference<>(),"\n""newNodeIDXY(tag,x,y)""Create a node whose ID=tag from global coordinates (x,y).")
   .def("newNodeIDV", &XC::NodeHandler::newNodeIDV,return_internal_reference<>(),"\n""newNodeIDV(tag,vector)""Create a node whose ID=tag from the vector passed as parameter.")
+  .def("newNodes", &XC::NodeHandler::newNodesPy,"\n""newNodes(coords)\n""Create the nodes whose coordinates are the rows of coords (a Matrix or an array, e.g. numpy, with one row for each node) and return their tags. The domain and the sets are updated once for the whole batch.")
   .def("newSeedNode", &XC::NodeHandler::newSeedNode,return_internal_reference<>(),"\n""newSeedNode()\n""Defines the seed node.")
   .def("duplicateNode", &XC::NodeHandler::duplicateNode,return_internal_reference<>(),"\n""duplicateNode(orgNodeTag) \n" "Create a duplicate copy of node with ID=orgNodeTag")
   ;
@@ -85,6 +86,7 @@ class_<XC::ElementHandler, bases<XC::ProtoElementHandler>, boost::noncopyable >(
   .add_property("seedElemHandler", make_function( &XC::ElementHandler::getSeedElemHandler, return_internal_reference<>() ))
   .def("getElement", &XC::ElementHandler::getElement,return_internal_reference<>(),"Returns the element identified by the parameter.")
   .add_property("defaultTag", &XC::ElementHandler::getDefaultTag, &XC::ElementHandler::setDefaultTag)
+  .def("newElements", &XC::ElementHandler::newElementsPy,"\n""newElements(connectivity)\n""Create copies of the seed element connected to the nodes of each row of connectivity (an ID or an array, e.g. numpy, with one row for each element) and return their tags. The domain and the sets are updated once for the whole batch.")
    ;
 
 class_<XC::BoundaryCondHandler, bases<XC::PrepHandler>, boost::noncopyable >("BoundaryCondHandler", no_init)
@@ -34,7 +34,11 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include <deque>
 #include <set>
+#include <unordered_set>
+#include <cmath>
 #include "utility/actor/actor/MovableID.h"
+#include "xc_utils/src/geom/d3/GeomObj3d.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
 #include <boost/iterator/indirect_iterator.hpp>
 
 
@@ -52,6 +56,10 @@ namespace XC {
 //!  - Line.
 //!  - Suprface.
 //!  - Body.
+//!
+//!  The pointers are stored in insertion order. A hash index of the
+//!  stored pointers is kept to check membership in constant time, so
+//!  inserting n objects (with duplicate check) is O(n) instead of O(n^2).
 template <class T>
 class DqPtrs: public CommandEntity, protected std::deque<T *>
   {
@@ -63,6 +71,14 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     typedef typename lst_ptr::const_reference const_reference;
     typedef typename lst_ptr::size_type size_type;
     typedef boost::indirect_iterator<iterator> indIterator;
+  private:
+    typedef std::unordered_set<const T *> index_type;
+    index_type index; //!< Pointers in the container (membership index).
+    void rebuild_index(void);
+  protected:
+    template <class Predicate>
+    void remove_if(Predicate);
+    static bool get_search_box(const GeomObj3d &,const double &,Pos3d &,Pos3d &);
   public:
     DqPtrs(CommandEntity *owr= nullptr);
     DqPtrs(const DqPtrs &);
@@ -74,6 +90,7 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     //void extend_cond(const DqPtrs &,const std::string &cond);
     bool push_back(T *);
     bool push_front(T *);
+    void reserve(const size_t &);
     inline bool empty(void) const
       { return lst_ptr::empty(); }
     inline iterator begin(void)
@@ -99,16 +116,19 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     const ID &getTags(void) const;
     template <class InputIterator>
     void insert(iterator pos, InputIterator f, InputIterator l)
-      { lst_ptr::insert(pos,f,l); }
+      {
+        lst_ptr::insert(pos,f,l);
+	index.insert(f,l);
+      }
     template <class InputIterator>
     void insert_unique(iterator pos, InputIterator f, InputIterator l)
       {
-	DqPtrs<T> tmp;
+	lst_ptr tmp;
 	//Filter those already in the container.
 	for(InputIterator i= f;i!=l;i++)
 	  {
 	    T *ptr= *i;
-	    if(!this->in(ptr))
+	    if(ptr && index.insert(ptr).second) //New one.
 	      { tmp.push_back(ptr); }
 	  }
 	lst_ptr::insert(pos,tmp.begin(),tmp.end()); //Add only new ones.
@@ -128,14 +148,14 @@ DqPtrs<T>::DqPtrs(CommandEntity *owr)
 //! @brief Copy constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(const DqPtrs<T> &other)
-  : CommandEntity(other), lst_ptr(other)
+  : CommandEntity(other), lst_ptr(other), index(other.index)
   {}
 
 //! @brief Copy from deque container.
 template <class T>
 DqPtrs<T>::DqPtrs(const std::deque<T *> &ts)
   : CommandEntity(), lst_ptr(ts)
-  {}
+  { rebuild_index(); }
 
 //! @brief Copy from set container.
 template <class T>
@@ -146,6 +166,7 @@ DqPtrs<T>::DqPtrs(const std::set<const T *> &st)
     k= st.begin();
     for(;k!=st.end();k++)
       lst_ptr::push_back(const_cast<T *>(*k));
+    rebuild_index();
   }
 
 //! @brief Assignment operator.
@@ -154,6 +175,7 @@ DqPtrs<T> &DqPtrs<T>::operator=(const DqPtrs &other)
   {
     CommandEntity::operator=(other);
     lst_ptr::operator=(other);
+    index= other.index;
     return *this;
   }
 
@@ -175,10 +197,74 @@ void DqPtrs<T>::extend(const DqPtrs &other)
       push_back(*i);
   }
 
+//! @brief Rebuilds the membership index from the stored pointers.
+template<class T>
+void DqPtrs<T>::rebuild_index(void)
+  {
+    index.clear();
+    index.reserve(size());
+    for(const_iterator i= begin();i!=end();i++)
+      index.insert(*i);
+  }
+
+//! @brief Removes the pointers for which the predicate returns
+//! true, preserving the order of the remaining ones.
+template<class T>
+template <class Predicate>
+void DqPtrs<T>::remove_if(Predicate pred)
+  {
+    lst_ptr tmp;
+    for(const_iterator i= begin();i!=end();i++)
+      {
+        T *ptr= *i;
+        if(pred(ptr))
+          index.erase(ptr);
+        else
+          tmp.push_back(ptr);
+      }
+    lst_ptr::swap(tmp);
+  }
+
+//! @brief Computes the box that contains the geometric object enlarged
+//! by the tolerance; the objects that don't touch this box can't be
+//! inside the geometric object.
+//!
+//! @param geomObj: geometric object.
+//! @param tol: tolerance for "In" function.
+//! @param pMin: lower corner of the box.
+//! @param pMax: upper corner of the box.
+//! @return false if the object is not bounded (planes, half spaces,...).
+template<class T>
+bool DqPtrs<T>::get_search_box(const GeomObj3d &geomObj,const double &tol,Pos3d &pMin,Pos3d &pMax)
+  {
+    const double t= std::fabs(tol);
+    const double xMin= geomObj.GetXMin()-t, xMax= geomObj.GetXMax()+t;
+    const double yMin= geomObj.GetYMin()-t, yMax= geomObj.GetYMax()+t;
+    const double zMin= geomObj.GetZMin()-t, zMax= geomObj.GetZMax()+t;
+    const bool retval= (std::isfinite(xMin) && std::isfinite(xMax) &&
+                        std::isfinite(yMin) && std::isfinite(yMax) &&
+                        std::isfinite(zMin) && std::isfinite(zMax) &&
+                        (xMin<=xMax) && (yMin<=yMax) && (zMin<=zMax));
+    if(retval)
+      {
+        pMin= Pos3d(xMin,yMin,zMin);
+        pMax= Pos3d(xMax,yMax,zMax);
+      }
+    return retval;
+  }
+
+//! @brief Prepares the membership index to receive n more pointers.
+template<class T>
+void DqPtrs<T>::reserve(const size_t &n)
+  { index.reserve(size()+n); }
+
 //! @brief Clears out the list of pointers.
 template<class T>
 void DqPtrs<T>::clear(void)
-  { lst_ptr::clear(); }
+  {
+    lst_ptr::clear();
+    index.clear();
+  }
 
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template<class T>
@@ -199,25 +285,18 @@ const T &DqPtrs<T>::get(const size_t &i) const
 //! @brief Returns true if the pointer is in the container.
 template<class T>
 bool DqPtrs<T>::in(const T *ptr) const
-  {
-    bool retval= false;
-    for(const_iterator i= begin();i!= end();i++)
-      if(*i==ptr)
-        {
-          retval= true;
-          break;
-        }
-    return retval;
-  }
+  { return (index.find(ptr)!=index.end()); }
 
 
+//! @brief Inserts the pointer at the end of the container (if it's
+//! not already there).
 template <class T>
 bool DqPtrs<T>::push_back(T *t)
   {
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //It's a new element.
+        if(index.insert(t).second) //It's a new element.
           {
             lst_ptr::push_back(t);
             retval= true;
@@ -229,13 +308,15 @@ bool DqPtrs<T>::push_back(T *t)
     return retval;
   }
 
+//! @brief Inserts the pointer at the begining of the container (if it's
+//! not already there).
 template <class T>
 bool DqPtrs<T>::push_front(T *t)
   {
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //New element.
+        if(index.insert(t).second) //New element.
           {
             lst_ptr::push_front(t);
             retval= true;
@@ -235,16 +235,27 @@ std::deque<Polyline3d> XC::DqPtrsElem::getContours(const double &factor) const
 //!
 //! @param geomObj: geometric object that must contain the elements.
 //! @param tol: tolerance for "In" function.
+//!
+//! An element is inside the object if all its nodes are, so its
+//! centroid (the position indexed in the KD tree) is inside the
+//! bounding box of the object. If the KD tree picking is active (see
+//! setKDTreePicking) and tol (the factor that scales the displacement
+//! in Element::In) is zero, only the elements whose centroid is inside
+//! that box are tested; otherwise all the elements are tested.
 XC::DqPtrsElem XC::DqPtrsElem::pickElemsInside(const GeomObj3d &geomObj, const double &tol)
   {
     DqPtrsElem retval;
-    for(iterator i= begin();i!=end();i++)
-      {
-        Element *e= (*i);
-        assert(e);
-	if(e->In(geomObj,tol))
-	  retval.push_back(e);
-      }
+    Pos3d pMin, pMax;
+    if(getKDTreePicking() && (tol==0.0) && get_search_box(geomObj,0.0,pMin,pMax))
+      retval.extend(pick_in_box(pMin,pMax,[&geomObj,&tol](const Element *e){ return e->In(geomObj,tol); }));
+    else
+      for(iterator i= begin();i!=end();i++)
+        {
+          Element *e= (*i);
+          assert(e);
+          if(e->In(geomObj,tol))
+            retval.push_back(e);
+        }
     return retval;    
   }
 
@@ -134,14 +134,28 @@ const T *DqPtrsEntities<T>::getNearest(const Pos3d &p) const
 //!
 //! @param geomObj: geometric object that must contain the nodes.
 //! @param tol: tolerance for "In" function.
+//!
+//! The entities whose bounding box doesn't touch the one of the
+//! geometric object (enlarged by the tolerance) are discarded
+//! without calling "In".
 template <class T>
 DqPtrsEntities<T> DqPtrsEntities<T>::pickEntitiesInside(const GeomObj3d &geomObj, const double &tol) const
   {
     DqPtrsEntities<T> retval;
+    Pos3d pMin, pMax;
+    const bool bounded= dq_ptr::get_search_box(geomObj,tol,pMin,pMax);
     for(const_iterator i= this->begin();i!= this->end();i++)
       {
         T *t= (*i);
         assert(t);
+        if(bounded)
+          {
+            const BND3d bnd= t->Bnd();
+            if((bnd.GetXMin()>pMax.x()) || (bnd.GetXMax()<pMin.x()) ||
+               (bnd.GetYMin()>pMax.y()) || (bnd.GetYMax()<pMin.y()) ||
+               (bnd.GetZMin()>pMax.z()) || (bnd.GetZMax()<pMin.z()))
+              continue;
+          }
 	if(t->In(geomObj,tol))
 	  retval.push_back(t);
       }
@@ -174,28 +188,12 @@ BND3d DqPtrsEntities<T>::Bnd(void) const
 //! @brief Removes the objects that belongs also to the parameter.
 template <class T>
 void DqPtrsEntities<T>::remove(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j!=this->end()) //Found.
-	  this->erase(j);
-      }
-  }
+  { this->remove_if([&other](const T *t){ return other.in(t); }); }
 
-//! @brief Removes the objects that belongs also to the parameter.
+//! @brief Removes the objects that doesn't belong also to the parameter.
 template <class T>
 void DqPtrsEntities<T>::intersect(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j==this->end()) //Not found
-	  this->erase(j);
-      }
-  }
+  { this->remove_if([&other](const T *t){ return !other.in(t); }); }
 
 //! @brief -= (difference) operator.
 template <class T>
@@ -230,9 +228,8 @@ DqPtrsEntities<T> operator-(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j==b.end()) //Not found in b.
+        T *t= (*i);
+	if(!b.in(t)) //Not found in b.
 	  retval.push_back(t);
       }
     return retval;
@@ -245,9 +242,8 @@ DqPtrsEntities<T> operator*(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j!=b.end()) //Found also in b.
+        T *t= (*i);
+	if(b.in(t)) //Found also in b.
 	  retval.push_back(t);
       }
     return retval;
@@ -32,6 +32,8 @@
 
 #include "DqPtrs.h"
 #include <set>
+#include <vector>
+#include <unordered_set>
 
 class Pos3d;
 class Vector3d;
@@ -47,8 +49,11 @@ template <class T,class KDTree>
 class DqPtrsKDTree: public DqPtrs<T>
   {
     KDTree kdtree; //!< space-partitioning data structure for organizing objects.
+    bool kdtreePicking; //!< if true the pick methods use the KD tree (see setKDTreePicking).
   protected:
     void create_tree(void);
+    template <class Predicate>
+    std::vector<T *> pick_in_box(const Pos3d &,const Pos3d &,const Predicate &) const;
   public:
     typedef typename DqPtrs<T>::const_iterator const_iterator;
     typedef typename DqPtrs<T>::iterator iterator;
@@ -63,13 +68,21 @@ class DqPtrsKDTree: public DqPtrs<T>
     DqPtrsKDTree &operator=(const DqPtrsKDTree &);
     DqPtrsKDTree &operator+=(const DqPtrsKDTree &);
     void extend(const DqPtrsKDTree &);
+    size_t extend(const std::vector<T *> &);
     //void extend_cond(const DqPtrsKDTree &,const std::string &cond);
     bool push_back(T *);
     bool push_front(T *);
+    void clear(void);
     void clearAll(void);
 
     T *getNearest(const Pos3d &p);
     const T *getNearest(const Pos3d &p) const;
+
+    void updateKDTree(void);
+    //! @brief Return true if the pick methods use the KD tree.
+    inline bool getKDTreePicking(void) const
+      { return kdtreePicking; }
+    void setKDTreePicking(const bool &);
   };
 
 //! @brief Creates the KD tree.
@@ -88,24 +101,24 @@ void DqPtrsKDTree<T,KDTree>::create_tree(void)
 //! @brief Constructor.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(CommandEntity *owr)
-  : DqPtrs<T>(owr) {}
+  : DqPtrs<T>(owr), kdtreePicking(false) {}
 
 //! @brief Copy constructor.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const DqPtrsKDTree &other)
-  : DqPtrs<T>(other)
+  : DqPtrs<T>(other), kdtreePicking(false)
   { create_tree(); }
 
 //! @brief Copy constructor.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const std::deque<T *> &ts)
-  : DqPtrs<T>(ts)
+  : DqPtrs<T>(ts), kdtreePicking(false)
   { create_tree(); }
 
 //! @brief Copy constructor.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const std::set<const T *> &st)
-  : DqPtrs<T>()
+  : DqPtrs<T>(), kdtreePicking(false)
   {
     typename std::set<const T *>::const_iterator k;
     k= st.begin();
@@ -130,6 +143,23 @@ void DqPtrsKDTree<T,KDTree>::extend(const DqPtrsKDTree &other)
     for(register DqPtrsKDTree<T,KDTree>::const_iterator i= other.begin();i!=other.end();i++)
       push_back(*i);
   }
+//! @brief Appends the objects of the vector (skipping those already
+//! in the container) and updates the KD tree only once.
+//! Returns the number of objects added.
+template <class T,class KDTree>
+size_t DqPtrsKDTree<T,KDTree>::extend(const std::vector<T *> &ts)
+  {
+    std::vector<T *> added;
+    added.reserve(ts.size());
+    DqPtrs<T>::reserve(ts.size());
+    for(typename std::vector<T *>::const_iterator i= ts.begin();i!=ts.end();i++)
+      if(DqPtrs<T>::push_back(*i))
+        added.push_back(*i);
+    if(!added.empty())
+      kdtree.insert(added.begin(),added.end());
+    return added.size();
+  }
+
 //! @brief += operator.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree> &DqPtrsKDTree<T,KDTree>::operator+=(const DqPtrsKDTree &other)
@@ -158,6 +188,14 @@ bool XC::DqPtrsKDTree<T,KDTree>::push_front(T *t)
     return retval;
 }
 
+//! @brief Clears out the list of pointers.
+template <class T,class KDTree>
+void DqPtrsKDTree<T,KDTree>::clear(void)
+  {
+    DqPtrs<T>::clear();
+    kdtree.clear();
+  }
+
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template <class T,class KDTree>
 void DqPtrsKDTree<T,KDTree>::clearAll(void)
@@ -165,6 +203,62 @@ void DqPtrsKDTree<T,KDTree>::clearAll(void)
     DqPtrs<T>::clear();
     kdtree.clear();
   }
+
+//! @brief Rebuilds the KD tree from the current positions of the
+//! objects of the container.
+//!
+//! The tree is updated when the objects are moved through the methods of
+//! this container, but not when they are moved by other means (i.e. from
+//! other set or modifying the node coordinates directly).
+template <class T,class KDTree>
+void DqPtrsKDTree<T,KDTree>::updateKDTree(void)
+  { create_tree(); }
+
+//! @brief Sets if the pick methods (pickNodesInside, pickElemsInside)
+//! use the KD tree to discard the objects far from the geometric object.
+//!
+//! The tree is rebuilt when the option is activated. Since the tree is
+//! not aware of the objects being moved by other means than the methods
+//! of this container, the caller must call updateKDTree after such
+//! changes; otherwise the picks can miss objects. By default the picks
+//! test every object of the container.
+template <class T,class KDTree>
+void DqPtrsKDTree<T,KDTree>::setKDTreePicking(const bool &b)
+  {
+    if(b && !kdtreePicking)
+      create_tree();
+    kdtreePicking= b;
+  }
+
+//! @brief Return the objects of the container indexed inside the box
+//! [pMin,pMax] that satisfy the predicate, in container order.
+//!
+//! The KD tree gives the candidates so the predicate (the exact and
+//! expensive test) is evaluated only for the objects near the box.
+//! @param pMin: lower corner of the box.
+//! @param pMax: upper corner of the box.
+//! @param pred: predicate to test for each candidate.
+template <class T,class KDTree> template <class Predicate>
+std::vector<T *> DqPtrsKDTree<T,KDTree>::pick_in_box(const Pos3d &pMin,const Pos3d &pMax,const Predicate &pred) const
+  {
+    std::vector<T *> retval;
+    const std::vector<const T *> candidates= kdtree.getInBox(pMin,pMax);
+    std::unordered_set<const T *> picked;
+    for(typename std::vector<const T *>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      if(this->in(*i) && pred(*i))
+        picked.insert(*i);
+    // Restore the order of the container.
+    size_t remaining= picked.size();
+    retval.reserve(remaining);
+    for(const_iterator i= this->begin();(remaining>0) && (i!=this->end());i++)
+      if(picked.find(*i)!=picked.end())
+        {
+          retval.push_back(*i);
+          remaining--;
+        }
+    return retval;
+  }
+
 //! @brief Returns the object closest to the point being passed as parameter.
 template <class T,class KDTree>
 T *DqPtrsKDTree<T,KDTree>::getNearest(const Pos3d &p)
@@ -197,16 +197,27 @@ std::set<int> XC::DqPtrsNode::getTags(void) const
 //!
 //! @param geomObj: geometric object that must contain the nodes.
 //! @param tol: tolerance for "In" function.
+//!
+//! The second argument of Node::In is the factor that scales the
+//! displacement, so when tol is zero the position tested is the
+//! initial one, which is the position indexed in the KD tree. If the
+//! KD tree picking is active (see setKDTreePicking) and tol is zero, the
+//! tree gives the nodes inside the bounding box of the object and only
+//! those are tested; otherwise all the nodes are tested.
 XC::DqPtrsNode XC::DqPtrsNode::pickNodesInside(const GeomObj3d &geomObj, const double &tol)
   {
     DqPtrsNode retval;
-    for(iterator i= begin();i!=end();i++)
-      {
-        Node *n= (*i);
-        assert(n);
-	if(n->In(geomObj,tol))
-	  retval.push_back(n);
-      }
+    Pos3d pMin, pMax;
+    if(getKDTreePicking() && (tol==0.0) && get_search_box(geomObj,0.0,pMin,pMax))
+      retval.extend(pick_in_box(pMin,pMax,[&geomObj,&tol](const Node *n){ return n->In(geomObj,tol); }));
+    else
+      for(iterator i= begin();i!=end();i++)
+        {
+          Node *n= (*i);
+          assert(n);
+          if(n->In(geomObj,tol))
+            retval.push_back(n);
+        }
     return retval;    
   }
 
@@ -31,7 +31,7 @@
 #include "preprocessor/Preprocessor.h"
 #include "preprocessor/multi_block_topology/entities/Pnt.h"
 #include "preprocessor/multi_block_topology/entities/Edge.h"
-#include "preprocessor/multi_block_topology/entities/Face.h"
+#include "preprocessor/multi_block_topology/entities/QuadSurface.h"
 #include "preprocessor/multi_block_topology/entities/Body.h"
 #include "preprocessor/multi_block_topology/entities/UniformGrid.h"
 #include "preprocessor/multi_block_topology/matrices/ElemPtrArray3d.h"
@@ -350,13 +350,27 @@ void XC::SetEntities::line_meshing(meshing_dir dm)
       std::clog << "done." << std::endl;
   }
 
-//! @brief Create nodes and, where appropriate, elements on surfaces.
+//! @brief Create nodes and, where appropriate, elements on surfaces
+//! (quadrilateral surfaces are meshed in one batch, see QuadSurface::genMesh).
 void XC::SetEntities::surface_meshing(meshing_dir dm)
   {
     if(verbosity>2)
       std::clog << "Meshing surfaces...";
+    std::vector<QuadSurface *> quads;
+    quads.reserve(surfaces.size());
     for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
-      (*i)->genMesh(dm);
+      {
+        QuadSurface *q= dynamic_cast<QuadSurface *>(*i);
+        if(q)
+          quads.push_back(q);
+        else
+          break;
+      }
+    if(quads.size()==surfaces.size()) //Batch meshing.
+      QuadSurface::genMesh(quads,dm);
+    else
+      for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
+        (*i)->genMesh(dm);
     if(verbosity>2)
       std::clog << "done." << std::endl;
   }
@@ -166,6 +166,16 @@ void XC::SetMeshComp::addNode(Node *nPtr)
 void XC::SetMeshComp::addElement(Element *ePtr)
   { elements.push_back(ePtr); }
 
+//! @brief Appends the nodes being passed as parameter
+//! (the KD-tree of the set is updated only once).
+size_t XC::SetMeshComp::addNodes(const std::vector<Node *> &nPtrs)
+  { return nodes.extend(nPtrs); }
+
+//! @brief Appends the elements being passed as parameter
+//! (the KD-tree of the set is updated only once).
+size_t XC::SetMeshComp::addElements(const std::vector<Element *> &ePtrs)
+  { return elements.extend(ePtrs); }
+
 //! @brief Returns true if the node belongs to the set.
 bool XC::SetMeshComp::In(const Node *n) const
   { return nodes.in(n); }
@@ -183,13 +193,20 @@ void XC::SetMeshComp::numera(void)
     numera_lista(constraints);
   }
 
-//! @brief Moves the nodes.
+//! @brief Moves the nodes (and updates the KD tree of the elements).
 void XC::SetMeshComp::mueve(const Vector3d &desplaz)
-  { nodes.mueve(desplaz); }
+  {
+    nodes.mueve(desplaz);
+    elements.updateKDTree();
+  }
 
-//! @brief Aplies the transformation to the positions of the nodes.
+//! @brief Aplies the transformation to the positions of the nodes
+//! (and updates the KD tree of the elements).
 void XC::SetMeshComp::Transform(const TrfGeom &trf)
-  { nodes.transforma(trf); }
+  {
+    nodes.transforma(trf);
+    elements.updateKDTree();
+  }
 
 //! @brief Applies to the set the transformation with
 //! the identifier being passed as parameter.
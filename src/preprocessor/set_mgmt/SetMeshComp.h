@@ -108,6 +108,7 @@ class SetMeshComp: public SetBase
       { return nodes.size(); }
     //! @brief Appends a node.
     void addNode(Node *nPtr);
+    size_t addNodes(const std::vector<Node *> &);
     //! @brief Return the node container.
     virtual const DqPtrsNode &getNodes(void) const
       { return nodes; }
@@ -130,6 +131,7 @@ class SetMeshComp: public SetBase
       { return elements.size(); }
     //! @brief Adds an element.
     void addElement(Element *ePtr);
+    size_t addElements(const std::vector<Element *> &);
     //! @brief Returns the element container.
     virtual const DqPtrsElem &getElements(void) const
       { return elements; }
@@ -40,6 +40,8 @@ class_<XC::DqPtrsNode, bases<dq_ptrs_node> >("DqPtrsNode",no_init)
   .add_property("getNumDeadNodes", &XC::DqPtrsNode::getNumDeadNodes)
   .def("getNearestNode",make_function(getNearestNodeDqPtrs, return_internal_reference<>() ),"Returns nearest node.")
   .def("pickNodesInside",&XC::DqPtrsNode::pickNodesInside,"pickNodesInside(geomObj,tol) return the nodes inside the geometric object.")
+  .add_property("useKDTreeForPicking", &XC::DqPtrsNode::getKDTreePicking, &XC::DqPtrsNode::setKDTreePicking,"If true pickNodesInside uses the KD tree of the container (call updateKDTree after moving the nodes from other sets or by modifying their coordinates).")
+  .def("updateKDTree", &XC::DqPtrsNode::updateKDTree,"Rebuild the KD tree from the current positions of the nodes.")
   .def("getBnd", &XC::DqPtrsNode::Bnd, "Returns nodes boundary.")
   .def("getCentroid", &XC::DqPtrsNode::getCentroid, "Returns nodes centroid.")
   .def(self += self)
@@ -69,6 +71,8 @@ class_<XC::DqPtrsElem, bases<dq_ptrs_element> >("DqPtrsElem",no_init)
   .def("getBnd", &XC::DqPtrsElem::Bnd, "Returns elements boundary.")
   .def("getContours",&XC::DqPtrsElem::getContours,"Returns contour(s) from the element set in the form of closed 3D polylines.")
   .def("pickElemsInside",&XC::DqPtrsElem::pickElemsInside,"pickElemsInside(geomObj,tol) return the elements inside the geometric object.") 
+  .add_property("useKDTreeForPicking", &XC::DqPtrsElem::getKDTreePicking, &XC::DqPtrsElem::setKDTreePicking,"If true pickElemsInside uses the KD tree of the container (call updateKDTree after moving the nodes from other sets or by modifying their coordinates).")
+  .def("updateKDTree", &XC::DqPtrsElem::updateKDTree,"Rebuild the KD tree from the current positions of the elements.")
   .def("pickElemsOfType",&XC::DqPtrsElem::pickElemsOfType,"pickElemsOfType(typeName) return the elements whose type containts the string.")
   .def("pickElemsOfDimension",&XC::DqPtrsElem::pickElemsOfDimension,"pickElemsOfDimension(dim) return the elements whose dimension equals the argument.")
   .def("getTypes",&XC::DqPtrsElem::getTypesPy,"getElementTypes() return a list with the element types in the container.")
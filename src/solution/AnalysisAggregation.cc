@@ -57,6 +57,7 @@
 #include "utility/matrix/ID.h"
 
 #include "boost/any.hpp"
+#include "utility/parallel/ThreadPool.h"
 
 void XC::AnalysisAggregation::free_soln_algo(void)
   {
@@ -337,6 +338,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new DistributedSparseGenRowLinSOE(this);
     else if(nmb=="sym_sparse_lin_soe")
       theSOE =new SymSparseLinSOE(this);
+    else if(nmb=="sym_sparse_col_lin_soe")
+      theSOE =new SymSparseColLinSOE(this);
 //     else if(nmb=="umfpack_gen_lin_soe")
 //       theSOE =new UmfpackGenLinSOE();
     else
@@ -441,6 +444,22 @@ XC::ConvergenceTest &XC::AnalysisAggregation::newConvergenceTest(const std::stri
     return *theTest;
   }
 
+//! @brief Set the number of threads used to assemble the system of
+//! equations (a value of zero means as many threads as the
+//! hardware supports).
+//!
+//! With more than one thread the element tangents and residuals are
+//! computed concurrently and then added to the system of equations
+//! in the same order of the serial assembly, so the results don't depend
+//! on the number of threads.
+void XC::AnalysisAggregation::setNumThreads(const size_t &n)
+  {
+    if(n>0)
+      numThreads= n;
+    else
+      numThreads= ThreadPool::getDefaultNumThreads();
+  }
+
 void XC::AnalysisAggregation::free_mem(void)
   {
     free_soln_algo();
@@ -455,12 +474,13 @@ void XC::AnalysisAggregation::copy(const AnalysisAggregation &other)
     if(other.theIntegrator) copy_integrator(other.theIntegrator);
     if(other.theSOE) copy_system_of_equations(other.theSOE);
     if(other.theTest) copy_conv_test(other.theTest);
+    numThreads= other.numThreads;
   }
 
 //! @brief Default constructor.
 XC::AnalysisAggregation::AnalysisAggregation(Analysis *owr,ModelWrapper *b)
   : CommandEntity(owr), base(b), theSolnAlgo(nullptr),theIntegrator(nullptr),
-    theSOE(nullptr), theTest(nullptr)
+    theSOE(nullptr), theTest(nullptr), numThreads(1)
   {
     if(base)
       base->set_owner(this);
@@ -470,7 +490,7 @@ XC::AnalysisAggregation::AnalysisAggregation(Analysis *owr,ModelWrapper *b)
 //! @brief Copy constructor.
 XC::AnalysisAggregation::AnalysisAggregation(const AnalysisAggregation &other)
   : CommandEntity(other), base(other.base), theSolnAlgo(nullptr),theIntegrator(nullptr),
-    theSOE(nullptr), theTest(nullptr)
+    theSOE(nullptr), theTest(nullptr), numThreads(1)
   {
     if(base)
       base->set_owner(this);
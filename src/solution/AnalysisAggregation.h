@@ -93,6 +93,7 @@ class AnalysisAggregation: public CommandEntity
     Integrator *theIntegrator; //!< Integration scheme.
     SystemOfEqn *theSOE; //!< System of equations.
     ConvergenceTest *theTest; //!< Convergence test.
+    size_t numThreads; //!< Number of threads used to assemble the system of equations.
 
     Analysis *getAnalysis(void);
     const Analysis *getAnalysis(void) const;    
@@ -163,6 +164,12 @@ class AnalysisAggregation: public CommandEntity
     const ConvergenceTest *getConvergenceTestPtr(void) const;
     ConvergenceTest &newConvergenceTest(const std::string &);
 
+    //! @brief Return the number of threads used to assemble the
+    //! system of equations.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+
     virtual const DomainSolver *getDomainSolverPtr(void) const;
     virtual DomainSolver *getDomainSolverPtr(void);
     virtual const Subdomain *getSubdomainPtr(void) const;
@@ -36,6 +36,7 @@
 #include <solution/analysis/analysis/LinearBucklingAnalysis.h>
 #include <solution/analysis/analysis/LinearBucklingEigenAnalysis.h>
 #include <solution/analysis/analysis/StaticAnalysis.h>
+#include <solution/analysis/analysis/LinearSuperpositionAnalysis.h>
 #include <solution/analysis/analysis/DirectIntegrationAnalysis.h>
 #include <solution/analysis/analysis/VariableTimeStepDirectIntegrationAnalysis.h>
 
@@ -83,6 +84,8 @@ bool XC::ProcSolu::alloc_analysis(const std::string &nmb,const std::string &anal
               theAnalysis= new LinearBucklingEigenAnalysis(analysis_aggregation);
             else if(nmb=="static_analysis")
               theAnalysis= new StaticAnalysis(analysis_aggregation);
+            else if(nmb=="linear_superposition_analysis")
+              theAnalysis= new LinearSuperpositionAnalysis(analysis_aggregation);
             else if(nmb=="variable_time_step_direct_integration_analysis")
               theAnalysis= new VariableTimeStepDirectIntegrationAnalysis(analysis_aggregation);
 	  }
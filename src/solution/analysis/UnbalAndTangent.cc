@@ -29,10 +29,15 @@
 #include "UnbalAndTangent.h"
 
 
+//! @brief Return true if the matrix and the vector are owned by this object
+//! (not taken from the class-wide storage).
+bool XC::UnbalAndTangent::owns_mem(void) const
+  { return (nDOF>=unbalAndTangentArray->size()); }
+
 bool XC::UnbalAndTangent::free_mem(void)
   {
     // delete tangent and residual if created specially
-    if(nDOF>=unbalAndTangentArray.size())
+    if(owns_mem())
       {
         if(theTangent) delete theTangent;
         theTangent= nullptr;
@@ -59,10 +64,10 @@ void XC::UnbalAndTangent::alloc(void)
             exit(-1);
           }
       }
-    else
+    else // class-wide storage (retrieved when accessed, see getTangent).
       {
-        theResidual= unbalAndTangentArray.setUnbalance(nDOF);
-        theTangent= unbalAndTangentArray.setTangent(nDOF);
+        theResidual= nullptr;
+        theTangent= nullptr;
       }             
   }
 
@@ -82,16 +87,16 @@ void XC::UnbalAndTangent::copy(const UnbalAndTangent &other)
             exit(-1);
           }
       }
-    else
+    else // class-wide storage (retrieved when accessed, see getTangent).
       {
-        theResidual= other.theResidual;
-        theTangent= other.theTangent;
+        theResidual= nullptr;
+        theTangent= nullptr;
       }             
   }
 
 //! @brief Constructor.
 XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,UnbalAndTangentStorage &a)
-  :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(a) 
+  :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(&a) 
   { alloc(); }
 
 //! @brief Copy constructor.
@@ -118,8 +123,13 @@ XC::UnbalAndTangent::~UnbalAndTangent(void)
   { free_mem(); }
 
 //! @brief Return the tangent stiffness matrix.
+//!
+//! If the matrix comes from the class-wide storage, it is
+//! the one that corresponds to the calling thread.
 const XC::Matrix &XC::UnbalAndTangent::getTangent(void) const
   {
+    if(!owns_mem())
+      return *unbalAndTangentArray->setTangent(nDOF);
     assert(theTangent);
     return *theTangent;
   }
@@ -127,13 +137,20 @@ const XC::Matrix &XC::UnbalAndTangent::getTangent(void) const
 //! @brief Return the tangent stiffness matrix.
 XC::Matrix &XC::UnbalAndTangent::getTangent(void)
   {
+    if(!owns_mem())
+      return *unbalAndTangentArray->setTangent(nDOF);
     assert(theTangent);
     return *theTangent;
   }
 
 //! @brief Returns the residual vector.
+//!
+//! If the vector comes from the class-wide storage, it is
+//! the one that corresponds to the calling thread.
 const XC::Vector &XC::UnbalAndTangent::getResidual(void) const
   {
+    if(!owns_mem())
+      return *unbalAndTangentArray->setUnbalance(nDOF);
     assert(theResidual);
     return *theResidual;
   }
@@ -141,6 +158,8 @@ const XC::Vector &XC::UnbalAndTangent::getResidual(void) const
 //! @brief Return the residual vector.
 XC::Vector &XC::UnbalAndTangent::getResidual(void)
   {
+    if(!owns_mem())
+      return *unbalAndTangentArray->setUnbalance(nDOF);
     assert(theResidual);
     return *theResidual;
   }
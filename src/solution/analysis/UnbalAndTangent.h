@@ -43,7 +43,8 @@ class UnbalAndTangent
     size_t nDOF;
     Vector *theResidual;
     Matrix *theTangent;
-    UnbalAndTangentStorage &unbalAndTangentArray; //!< Reference to array of class wide vectors and matrices
+    UnbalAndTangentStorage *unbalAndTangentArray; //!< Pointer to array of class wide vectors and matrices
+    bool owns_mem(void) const;
     bool free_mem(void);
     void alloc(void);
     void copy(const UnbalAndTangent &);
@@ -28,36 +28,57 @@
 
 
 #include "UnbalAndTangentStorage.h"
+#include <algorithm>
 
+size_t XC::UnbalAndTangentStorage::numStorages= 0;
+thread_local std::vector<XC::UnbalAndTangentStorage::Buffers> XC::UnbalAndTangentStorage::threadBuffers;
+
+//! @brief Constructor.
+//!
+//! The storage objects are class-wide (static) members so they are
+//! created during static initialization (no need of synchronization
+//! for numStorages).
 XC::UnbalAndTangentStorage::UnbalAndTangentStorage(const size_t &n)
-  : theMatrices(n), theVectors(n) {}
+  : sz(n), id(numStorages++) {}
+
+//! @brief Return the buffers of the calling thread (created on first use).
+XC::UnbalAndTangentStorage::Buffers &XC::UnbalAndTangentStorage::getBuffers(void) const
+  {
+    if(threadBuffers.size()<=id)
+      threadBuffers.resize(std::max(numStorages,id+1));
+    Buffers &retval= threadBuffers[id];
+    if(retval.theMatrices.size()<sz)
+      {
+        retval.theMatrices.resize(sz);
+        retval.theVectors.resize(sz);
+      }
+    return retval;
+  }
 
 const XC::Matrix &XC::UnbalAndTangentStorage::getTangent(const size_t &i) const
-  { return theMatrices[i]; }
+  { return getBuffers().theMatrices[i]; }
 
 XC::Matrix &XC::UnbalAndTangentStorage::getTangent(const size_t &i)
-  { return theMatrices[i]; }
+  { return getBuffers().theMatrices[i]; }
 
 const XC::Vector &XC::UnbalAndTangentStorage::getUnbalance(const size_t &i) const
-  { return theVectors[i]; }
+  { return getBuffers().theVectors[i]; }
 
 XC::Vector &XC::UnbalAndTangentStorage::getUnbalance(const size_t &i)
-  { return theVectors[i]; }
+  { return getBuffers().theVectors[i]; }
 
 XC::Vector *XC::UnbalAndTangentStorage::setUnbalance(const size_t &i)
   {
-    if(theVectors[i].isEmpty())
-      { theVectors[i]= Vector(i); }
-    return &theVectors[i];
+    Vector &retval= getBuffers().theVectors[i];
+    if(retval.isEmpty())
+      { retval= Vector(i); }
+    return &retval;
   }
 
 XC::Matrix *XC::UnbalAndTangentStorage::setTangent(const size_t &i)
   {
-    if(theMatrices[i].isEmpty())
-      { theMatrices[i]= Matrix(i,i); }
-    return &theMatrices[i];
+    Matrix &retval= getBuffers().theMatrices[i];
+    if(retval.isEmpty())
+      { retval= Matrix(i,i); }
+    return &retval;
   }
-
-
-
-
@@ -39,12 +39,25 @@ namespace XC {
 //! @ingroup Analysis
 //
 //! @brief Unbalanced force vector and tangent stiffness matrix.
+//!
+//! Each thread has its own copy of the matrices and vectors so
+//! the objects that share this storage (FE_Element, DOF_Group,...)
+//! can be evaluated concurrently.
 class UnbalAndTangentStorage
   {
   private:
-    std::vector<Matrix> theMatrices; //!< array of matrices
-    std::vector<Vector> theVectors;  //!< array of vectors
+    //! @brief Matrices and vectors of the storage for one thread.
+    struct Buffers
+      {
+        std::vector<Matrix> theMatrices; //!< array of matrices
+        std::vector<Vector> theVectors;  //!< array of vectors
+      };
+    size_t sz; //!< number of matrices and vectors.
+    size_t id; //!< index of this storage in the thread buffers.
+    static size_t numStorages; //!< number of storage objects created.
+    static thread_local std::vector<Buffers> threadBuffers; //!< buffers for the current thread.
 
+    Buffers &getBuffers(void) const;
   public:
     UnbalAndTangentStorage(const size_t &);    
 
@@ -52,7 +65,7 @@ class UnbalAndTangentStorage
     Matrix *setTangent(const size_t &);
 
     inline size_t size(void) const
-      { return theMatrices.size(); }
+      { return sz; }
 
     const Matrix &getTangent(const size_t &) const;
     Matrix &getTangent(const size_t &);
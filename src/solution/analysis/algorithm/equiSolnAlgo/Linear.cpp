@@ -73,11 +73,27 @@
 
 //! @brief Constructor
 XC::Linear::Linear(AnalysisAggregation *owr)
-  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear) {}
+  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear),
+   factorOnce(false), tangentStamp(-1) {}
 
 XC::SolutionAlgorithm *XC::Linear::getCopy(void) const
   { return new Linear(*this); }
 
+//! @brief Return true if the tangent must be formed.
+//!
+//! The tangent is formed on each step unless the factorOnce option
+//! is set. In that case it's formed only if the analysis model
+//! has been created again since the last time it was formed or if
+//! the system of equations is not factored (i.e. other object has
+//! zeroed the matrix).
+bool XC::Linear::tangent_needed(const AnalysisModel &theModel,const LinearSOE &theSOE) const
+  {
+    bool retval= true;
+    if(factorOnce)
+      retval= ((tangentStamp!=theModel.getModelStamp()) || !theSOE.isFactored());
+    return retval;
+  }
+
 //! @brief Performs the linear solution algorithm.
 int XC::Linear::resuelve(void)
   {
@@ -93,12 +109,17 @@ int XC::Linear::resuelve(void)
         return -5;
       }
 
-    if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+    if(tangent_needed(*theAnalysisModel,*theSOE))
       {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; WARNING the XC::Integrator"
-                  << " failed in formTangent().\n";
-        return -1;
+        if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING the XC::Integrator"
+                      << " failed in formTangent().\n";
+            tangentStamp= -1;
+            return -1;
+          }
+        tangentStamp= theAnalysisModel->getModelStamp();
       }
 
     if(theIncIntegrator->formUnbalance()<0) //Builds load vector.
@@ -153,6 +174,14 @@ int XC::Linear::solveCurrentStep(void)
     return resuelve();
   }
 
+//! @brief Invoked by the analysis when the domain changes. Forces
+//! the tangent to be formed on the next step.
+int XC::Linear::domainChanged(void)
+  {
+    tangentStamp= -1;
+    return EquiSolnAlgo::domainChanged();
+  }
+
 //! @brief Sets the convergence test to use in the analysis.
 int XC::Linear::setConvergenceTest(ConvergenceTest *theNewTest)
   { return 0; }
@@ -93,8 +93,16 @@ namespace XC {
 //! \f$U = U_{a} + \Delta U\f$.
 //! To start the iteration \f$U_a = U_{trial}\f$, i.e. the current trial
 //! response quantities are chosen as approximate solution quantities.
+//!
+//! If the tangent is constant (linear model) the factorOnce option
+//! avoids assembling and factoring the tangent again until the analysis
+//! model changes (see AnalysisModel::getModelStamp).
 class Linear: public EquiSolnAlgo
   {
+    bool factorOnce; //!< If true, the tangent is formed and factored again only if the model changes.
+    int tangentStamp; //!< Stamp of the analysis model when the tangent was formed (-1 if not formed).
+
+    bool tangent_needed(const AnalysisModel &,const LinearSOE &) const;
     int resuelve();
   protected:
     friend class AnalysisAggregation;
@@ -104,6 +112,19 @@ class Linear: public EquiSolnAlgo
   public:
 
     int solveCurrentStep(void);
+    int domainChanged(void);
+
+    //! @brief Return true if the tangent is formed and factored only
+    //! when the model changes.
+    inline bool getFactorOnce(void) const
+      { return factorOnce; }
+    //! @brief If true the tangent is formed and factored only when
+    //! the model changes (use it only if the tangent is constant).
+    inline void setFactorOnce(const bool &b)
+      {
+        factorOnce= b;
+        tangentStamp= -1;
+      }
     int setConvergenceTest(ConvergenceTest *theNewTest);
     
     virtual int sendSelf(CommParameters &);
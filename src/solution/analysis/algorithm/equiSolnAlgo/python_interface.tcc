@@ -33,7 +33,9 @@ class_<XC::Broyden, bases<XC::BFBRoydenBase>, boost::noncopyable >("Broyden", no
 
 class_<XC::KrylovNewton, bases<XC::EquiSolnAlgo>, boost::noncopyable >("KrylovNewton", no_init);
 
-class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init);
+class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init)
+  .add_property("factorOnce", &XC::Linear::getFactorOnce, &XC::Linear::setFactorOnce,"If true, the tangent is assembled and factored only when the model changes (use it only if the tangent is constant).")
+  ;
 
 class_<XC::NewtonBased, bases<XC::EquiSolnAlgo>, boost::noncopyable >("NewtonBased", no_init);
 
@@ -79,6 +79,11 @@ XC::Analysis::Analysis(AnalysisAggregation *s)
 int XC::Analysis::newStepDomain(AnalysisModel *theModel,const double &dT)
   { return theModel->newStepDomain(dT); }
 
+//! @brief Applies the loads of the active load patterns
+//! for the pseudo-time being passed as parameter.
+void XC::Analysis::applyLoadDomain(AnalysisModel *theModel,const double &newTime)
+  { theModel->applyLoadDomain(newTime); }
+
 XC::ProcSolu *XC::Analysis::getProcSolu(void)
   { return dynamic_cast<ProcSolu *>(Owner()); }
 
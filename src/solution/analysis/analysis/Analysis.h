@@ -120,6 +120,7 @@ class Analysis: public CommandEntity
     AnalysisAggregation *solution_method; //!< Solution method.
 
     int newStepDomain(AnalysisModel *theModel,const double &dT =0.0);
+    void applyLoadDomain(AnalysisModel *theModel,const double &newTime);
     ProcSolu *getProcSolu(void);
     const ProcSolu *getProcSolu(void) const;    
 
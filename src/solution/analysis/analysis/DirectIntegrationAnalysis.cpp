@@ -265,7 +265,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 //! - It then invokes domainChanged() on \p theIntegrator and
 //!   theAlgorithm to inform these objects that changes have occurred
 //!   in the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em setSize(theModel.getDOFCSRGraph())} on {\em
 //!   theSOE} which causes the system of equation to determine its size
 //!   based on the connectivity of the dofs in the analysis model. 
 //! - Finally it invokes domainChanged() on \p theIntegrator and theAlgorithm. 
@@ -299,7 +299,7 @@ int XC::DirectIntegrationAnalysis::domainChanged(void)
     // we invoke setGraph() on the XC::LinearSOE which
     // causes that object to determine its size
 
-    solution_method->getLinearSOEPtr()->setSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph());
+    solution_method->getLinearSOEPtr()->setSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFCSRGraph());
 
     // we invoke domainChange() on the integrator and algorithm
     solution_method->getTransientIntegratorPtr()->domainChanged();
@@ -464,7 +464,7 @@ int XC::DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
       }
     else
       {
-        Graph &theGraph = solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph();
+        const CSRGraph &theGraph = solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFCSRGraph();
         if(solution_method->getLinearSOEPtr()->setSize(theGraph) < 0)
           {
 	    std::cerr << getClassName() << "::" << __FUNCTION__
@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//LinearSuperpositionAnalysis.cc
+
+#include "LinearSuperpositionAnalysis.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include "solution/analysis/integrator/StaticIntegrator.h"
+#include "domain/domain/Domain.h"
+#include "domain/constraints/ConstrContainer.h"
+#include "domain/load/pattern/LoadPattern.h"
+#include "solution/AnalysisAggregation.h"
+
+//! @brief Constructor.
+XC::LinearSuperpositionAnalysis::LinearSuperpositionAnalysis(AnalysisAggregation *analysis_aggregation)
+  :StaticAnalysis(analysis_aggregation) {}
+
+//! @brief Discards the solutions of the load patterns (they will be
+//! computed again on the next call to analyze).
+//!
+//! Must be called if the model changes in a way that doesn't mark
+//! the domain as changed (material properties, load values,...).
+void XC::LinearSuperpositionAnalysis::clearLoadPatternSolutions(void)
+  { loadPatternSolutions.clear(); }
+
+//! @brief Returns the number of load patterns already solved.
+size_t XC::LinearSuperpositionAnalysis::getNumLoadPatternSolutions(void) const
+  { return loadPatternSolutions.size(); }
+
+//! @brief Returns true if some of the active load patterns (or node
+//! lockers) impose displacements, so the constraint handler
+//! depends on the load combination.
+bool XC::LinearSuperpositionAnalysis::imposed_displacements(void) const
+  {
+    bool retval= false;
+    const ConstrContainer &constraints= getDomainPtr()->getConstraints();
+    if(constraints.getNumNodeLockers()>0)
+      retval= true;
+    else
+      {
+        const std::map<int,LoadPattern *> &activeLPs= constraints.getLoadPatterns();
+        for(std::map<int,LoadPattern *>::const_iterator i= activeLPs.begin();i!=activeLPs.end();i++)
+          if(i->second->getNumSPs()>0)
+            {
+              retval= true;
+              break;
+            }
+      }
+    return retval;
+  }
+
+//! @brief Deals with the changes of the domain and forms the tangent
+//! matrix if it's not already factored.
+int XC::LinearSuperpositionAnalysis::check_model(int num_step)
+  {
+    // domainChanged clears the load pattern solutions.
+    int result= check_domain_change(num_step,1);
+    if(result < 0)
+      return -1;
+    if(loadPatternSolutions.empty() || !getLinearSOEPtr()->isFactored())
+      {
+        result= getStaticIntegratorPtr()->formTangent();
+        if(result < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; the Integrator failed to form the tangent"
+		      << " at step " << num_step << std::endl;
+            return -1;
+          }
+      }
+    return 0;
+  }
+
+//! @brief Solves the active load patterns that have not been solved yet.
+//!
+//! The right hand side for each load pattern is formed with that load
+//! pattern alone and a unit combination factor. All of them are solved
+//! at once so the matrix is factored only once. On exit the loads
+//! of the current combination are applied again.
+int XC::LinearSuperpositionAnalysis::solve_load_patterns(int num_step)
+  {
+    int result= 0;
+    Domain *dom= getDomainPtr();
+    const std::map<int,LoadPattern *> &activeLPs= dom->getConstraints().getLoadPatterns();
+    std::vector<LoadPattern *> active;
+    std::vector<double> gammas;
+    std::vector<LoadPattern *> pending;
+    for(std::map<int,LoadPattern *>::const_iterator i= activeLPs.begin();i!=activeLPs.end();i++)
+      {
+        LoadPattern *lp= i->second;
+        active.push_back(lp);
+        gammas.push_back(lp->GammaF());
+        if(loadPatternSolutions.find(i->first)==loadPatternSolutions.end())
+          pending.push_back(lp);
+      }
+    if(!pending.empty())
+      {
+        AnalysisModel *am= getAnalysisModelPtr();
+        LinearSOE *theSOE= getLinearSOEPtr();
+        const double currentTime= dom->getTimeTracker().getCurrentTime();
+        // Deactivate the load patterns of the combination.
+        for(std::vector<LoadPattern *>::iterator i= active.begin();i!=active.end();i++)
+          dom->removeLoadPattern(*i);
+        std::vector<Vector> rhs;
+        for(std::vector<LoadPattern *>::iterator i= pending.begin();i!=pending.end();i++)
+          {
+            LoadPattern *lp= *i;
+            lp->GammaF()= 1.0;
+            dom->addLoadPattern(lp);
+            applyLoadDomain(am,currentTime);
+            result= getStaticIntegratorPtr()->formUnbalance();
+            dom->removeLoadPattern(lp);
+            if(result < 0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; the Integrator failed to form the unbalance"
+			  << " for load pattern: " << lp->getTag()
+		          << " at step: " << num_step << std::endl;
+                break;
+              }
+            rhs.push_back(theSOE->getB());
+          }
+        // Activate the load patterns of the combination again.
+        for(size_t i= 0;i<active.size();i++)
+          {
+            active[i]->GammaF()= gammas[i];
+            dom->addLoadPattern(active[i]);
+          }
+        applyLoadDomain(am,currentTime);
+        if(result >= 0)
+          {
+            std::vector<Vector> x;
+            result= theSOE->solveMultipleRHS(rhs,x);
+            if(result < 0)
+              std::cerr << getClassName() << "::" << __FUNCTION__
+		        << "; the LinearSOE failed to solve the load patterns"
+		        << " at step: " << num_step << std::endl;
+            else
+              for(size_t i= 0;i<pending.size();i++)
+                loadPatternSolutions[pending[i]->getTag()]= x[i];
+          }
+        if(result < 0)
+          {
+            dom->revertToLastCommit();
+            return -3;
+          }
+      }
+    return result;
+  }
+
+//! @brief Updates the model with the weighted sum of the load
+//! pattern solutions (the weights being the combination factors).
+int XC::LinearSuperpositionAnalysis::superpose_solutions(int num_step)
+  {
+    Domain *dom= getDomainPtr();
+    const std::map<int,LoadPattern *> &activeLPs= dom->getConstraints().getLoadPatterns();
+    Vector U(getLinearSOEPtr()->getNumEqn());
+    for(std::map<int,LoadPattern *>::const_iterator i= activeLPs.begin();i!=activeLPs.end();i++)
+      U.addVector(1.0,loadPatternSolutions[i->first],i->second->GammaF());
+    const int result= getStaticIntegratorPtr()->update(U);
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the Integrator failed to update the model"
+                  << " at step: " << num_step << std::endl;
+        dom->revertToLastCommit();
+        return -3;
+      }
+    return result;
+  }
+
+//! @brief Performs an analysis step.
+int XC::LinearSuperpositionAnalysis::run_analysis_step(int num_step,int numSteps)
+  {
+    int result= new_domain_step(num_step);
+    if(result < 0) //new_domain_step failed.
+      return -2;
+
+    result= check_model(num_step);
+    if(result < 0) //check_model failed.
+      return -1;
+
+    result= new_integrator_step(num_step);
+    if(result < 0) //new_integrator_step failed.
+      return -2;
+
+    result= solve_load_patterns(num_step);
+    if(result < 0) //solve_load_patterns failed.
+      return -3;
+
+    result= superpose_solutions(num_step);
+    if(result < 0) //superpose_solutions failed.
+      return -3;
+
+    result= commit_step(num_step);
+    if(result < 0) //commit_step failed.
+      return -4;
+
+    return result;
+  }
+
+//! @brief Performs the analysis.
+//!
+//! The load pattern solutions are valid only for the first step from
+//! the initial state of the domain, and only if the load patterns
+//! don't impose displacements. Otherwise the analysis is performed
+//! as an ordinary static analysis.
+//!
+//! @param numSteps: number of steps in the analysis.
+int XC::LinearSuperpositionAnalysis::analyze(int numSteps)
+  {
+    int result= 0;
+    const Domain *dom= getDomainPtr();
+    const bool initialState= (dom->getTimeTracker().getCommittedTime()==0.0);
+    if((numSteps!=1) || !initialState || imposed_displacements())
+      result= StaticAnalysis::analyze(numSteps);
+    else
+      {
+        assert(solution_method);
+        CommandEntity *old= solution_method->Owner();
+        solution_method->set_owner(this);
+        result= run_analysis_step(0,numSteps);
+        solution_method->set_owner(old);
+      }
+    return result;
+  }
+
+//! @brief Method invoked during the analysis to deal with domain changes.
+//!
+//! Discards the load pattern solutions and calls
+//! StaticAnalysis::domainChanged.
+int XC::LinearSuperpositionAnalysis::domainChanged(void)
+  {
+    clearLoadPatternSolutions();
+    return StaticAnalysis::domainChanged();
+  }
@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//LinearSuperpositionAnalysis.h
+                                                                        
+#ifndef LinearSuperpositionAnalysis_h
+#define LinearSuperpositionAnalysis_h
+
+#include <solution/analysis/analysis/StaticAnalysis.h>
+#include "utility/matrix/Vector.h"
+#include <map>
+#include <vector>
+
+namespace XC {
+class LoadPattern;
+
+//! @ingroup AnalysisType
+//
+//! @brief Static analysis of linear models by superposition of
+//! the load pattern solutions.
+//!
+//! The stiffness matrix is assembled and factored only once. The
+//! active load patterns that were not solved before are solved, each
+//! one with a unit combination factor (see LoadPattern::GammaF), as
+//! a block of right hand sides (see LinearSOE::solveMultipleRHS).
+//! The displacements of the current load combination are then
+//! obtained as the weighted sum of the load pattern solutions, and the
+//! element internal forces are updated from those displacements
+//! (and the element loads of the combination), so the results can
+//! be read exactly as after a StaticAnalysis.
+//!
+//! The solutions are reused on subsequent calls to analyze (one for
+//! each combination). The domain must be at its initial state when
+//! analyze is called (see Domain::resetLoadCase) and the model must
+//! be linear. If the domain changes (see Domain::hasDomainChanged)
+//! the load pattern solutions are discarded; any other change
+//! (materials, load values,...) requires calling
+//! clearLoadPatternSolutions.
+class LinearSuperpositionAnalysis: public StaticAnalysis
+  {
+  private:
+    std::map<int,Vector> loadPatternSolutions; //!< Solution for each load pattern (key: load pattern tag).
+
+    bool imposed_displacements(void) const;
+  protected:
+    int check_model(int num_step);
+    int solve_load_patterns(int num_step);
+    int superpose_solutions(int num_step);
+    int run_analysis_step(int num_step,int numSteps);
+
+    friend class ProcSolu;
+    LinearSuperpositionAnalysis(AnalysisAggregation *analysis_aggregation);
+    Analysis *getCopy(void) const;
+  public:
+    int analyze(int numSteps);
+    int domainChanged(void);
+
+    void clearLoadPatternSolutions(void);
+    size_t getNumLoadPatternSolutions(void) const;
+  };
+
+//! @brief Virtual constructor.
+inline Analysis *LinearSuperpositionAnalysis::getCopy(void) const
+  { return new LinearSuperpositionAnalysis(*this); }
+} // end of XC namespace
+
+#endif
@@ -349,7 +349,7 @@ int XC::StaticAnalysis::initialize(void)
 //! dof's. Once the equation numbers have been set the numberer then
 //! invokes setID() on all the FE\_Elements in the model. Finally
 //! the numberer invokes setNumEqn() on the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em setSize(theModel.getDOFCSRGraph())} on {\em
 //! theSOE} which causes the system of equation to determine its size
 //! based on the connectivity of the dofs in the analysis model. 
 //! - Finally domainChanged() is invoked on both \p theIntegrator and 
@@ -400,7 +400,7 @@ int XC::StaticAnalysis::domainChanged(void)
 
     // we invoke setSize() on the LinearSOE which
     // causes that object to determine its size
-    Graph &theGraph= getAnalysisModelPtr()->getDOFGraph();
+    const CSRGraph &theGraph= getAnalysisModelPtr()->getDOFCSRGraph();
 
     result= getLinearSOEPtr()->setSize(theGraph);
     if(result < 0)
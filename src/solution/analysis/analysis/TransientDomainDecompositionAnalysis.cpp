@@ -242,7 +242,7 @@ int XC::TransientDomainDecompositionAnalysis::domainChanged(void)
   
   // we invoke setSize() on the XC::LinearSOE which
   // causes that object to determine its size
-  Graph &theGraph = getAnalysisModelPtr()->getDOFGraph();
+  const CSRGraph &theGraph = getAnalysisModelPtr()->getDOFCSRGraph();
   result = getLinearSOEPtr()->setSize(theGraph);
   if (result < 0) {
     std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
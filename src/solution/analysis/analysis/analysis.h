@@ -28,6 +28,7 @@
 
 //Headers for the analysis type.
 #include "solution/analysis/analysis/StaticAnalysis.h"
+#include "solution/analysis/analysis/LinearSuperpositionAnalysis.h"
 #include "solution/analysis/analysis/DomainDecompositionAnalysis.h"
 #include "solution/analysis/analysis/DirectIntegrationAnalysis.h"
 #include "solution/analysis/analysis/LinearBucklingAnalysis.h"
@@ -30,6 +30,11 @@ class_<XC::StaticAnalysis, bases<XC::Analysis>, boost::noncopyable >("StaticAnal
   .def("initialize", &XC::StaticAnalysis::initialize,"Initialize analysis.")
     ;
 
+class_<XC::LinearSuperpositionAnalysis, bases<XC::StaticAnalysis>, boost::noncopyable >("LinearSuperpositionAnalysis", no_init)
+  .def("clearLoadPatternSolutions", &XC::LinearSuperpositionAnalysis::clearLoadPatternSolutions,"Discard the load pattern solutions (must be called if the materials or the load values change).")
+  .add_property("numLoadPatternSolutions", &XC::LinearSuperpositionAnalysis::getNumLoadPatternSolutions,"Number of load patterns already solved.")
+  ;
+
 class_<XC::EigenAnalysis , bases<XC::Analysis>, boost::noncopyable >("EigenAnalysis", no_init)
   //Eigenvectors.
   .def("getEigenvector", make_function(&XC::EigenAnalysis::getEigenvector, return_internal_reference<>()) )
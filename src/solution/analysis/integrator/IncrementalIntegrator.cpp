@@ -65,6 +65,10 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include <utility/matrix/Matrix.h>
+#include "utility/parallel/ThreadPool.h"
+#include <vector>
+#include <algorithm>
 
 
 //! @brief Constructor.
@@ -110,20 +114,9 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 
     theSOE->zeroA(); //Zeroes the matrix elements.
     
-    // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
-
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2= mdl->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-      if(theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-        {
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-		    << "; WARNING failed in addA for ID "
-		    << elePtr->getID();	    
-	  result = -3;
-	}
+    if(addElementTangents(*theSOE,*mdl)<0)
+      result= -3;
     return result;
   }
 
@@ -337,23 +330,144 @@ int XC::IncrementalIntegrator::formNodalUnbalance(void)
 int XC::IncrementalIntegrator::formElementResidual(void)
   {
     // loop through the FE_Elements and add the residual
-    FE_Element *elePtr;
-
-    int res = 0;    
-
     LinearSOE *theSOE= getLinearSOEPtr();
     AnalysisModel *mdl= getAnalysisModelPtr();
-    FE_EleIter &theEles2 = mdl->getFEs();
-    while((elePtr= theEles2()) != nullptr)
+    return addElementResiduals(*theSOE,*mdl);
+  }
+
+//! @brief Returns the number of threads to use when assembling
+//! the element contributions (see AnalysisAggregation::setNumThreads).
+size_t XC::IncrementalIntegrator::getNumThreads(void) const
+  {
+    size_t retval= 1;
+    const AnalysisAggregation *sm= getAnalysisAggregation();
+    if(sm)
+      retval= sm->getNumThreads();
+    return retval;
+  }
+
+//! @brief Return the FE_Elements of the model in iteration order.
+static std::vector<XC::FE_Element *> get_fe_elements(XC::AnalysisModel &mdl)
+  {
+    std::vector<XC::FE_Element *> retval;
+    XC::FE_Element *elePtr= nullptr;
+    XC::FE_EleIter &theEles= mdl.getFEs();
+    while((elePtr= theEles()) != nullptr)
+      retval.push_back(elePtr);
+    return retval;
+  }
+
+//! @brief Return true if all the FE_Elements of the model can be
+//! evaluated concurrently (see Element::isThreadSafe).
+static bool thread_safe_fe_elements(XC::AnalysisModel &mdl)
+  {
+    XC::FE_Element *elePtr= nullptr;
+    XC::FE_EleIter &theEles= mdl.getFEs();
+    while((elePtr= theEles()) != nullptr)
+      if(!elePtr->isThreadSafe())
+        return false;
+    return true;
+  }
+
+//! @brief Number of element contributions computed by each thread
+//! before adding them to the system of equations.
+const size_t assemblyBatchSize= 64;
+
+//! @brief Adds the tangent matrices of the FE_Elements to the
+//! system of equations.
+//!
+//! When more than one thread is available (see getNumThreads) the elements
+//! are processed in batches: the tangents of each batch are computed
+//! concurrently and copied to a buffer that is then added to the system
+//! of equations in the order of the serial loop. This way the result
+//! is bitwise identical to the serial assembly whatever the number of
+//! threads. If any of the elements can't be evaluated concurrently
+//! (see FE_Element::isThreadSafe) the serial loop is used.
+int XC::IncrementalIntegrator::addElementTangents(LinearSOE &theSOE, AnalysisModel &mdl)
+  {
+    int result= 0;
+    const size_t nThreads= getNumThreads();
+    if((nThreads<2) || !thread_safe_fe_elements(mdl))
       {
-	if(theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0)
-          {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; WARNING failed in addB for ID: "
-		      << elePtr->getID();
-	    res = -2;
+	FE_Element *elePtr= nullptr;
+	FE_EleIter &theEles= mdl.getFEs();
+	while((elePtr= theEles()) != nullptr)
+	  if(theSOE.addA(elePtr->getTangent(this),elePtr->getID()) < 0)
+	    {
+	      std::cerr << getClassName() << "::" << __FUNCTION__
+			<< "; WARNING failed in addA for ID "
+			<< elePtr->getID();	    
+	      result= -3;
+	    }
+      }
+    else
+      {
+	const std::vector<FE_Element *> fes= get_fe_elements(mdl);
+	const size_t numFEs= fes.size();
+	ThreadPool &pool= ThreadPool::getThreadPool();
+	const size_t batchSize= assemblyBatchSize*pool.getNumThreads(nThreads);
+	std::vector<Matrix> buffer(std::min(batchSize,numFEs));
+	for(size_t first= 0;first<numFEs;first+= batchSize)
+	  {
+	    const size_t last= std::min(first+batchSize,numFEs);
+	    pool.parallel_for(first,last,[&](const size_t &i, const size_t &)
+	      { buffer[i-first]= fes[i]->getTangent(this); },nThreads);
+	    for(size_t i= first;i<last;i++)
+	      if(theSOE.addA(buffer[i-first],fes[i]->getID()) < 0)
+		{
+		  std::cerr << getClassName() << "::" << __FUNCTION__
+			    << "; WARNING failed in addA for ID "
+			    << fes[i]->getID();	    
+		  result= -3;
+		}
 	  }
       }
-    return res;	    
+    return result;
+  }
+
+//! @brief Adds the residual vectors of the FE_Elements to the
+//! system of equations.
+//!
+//! The parallel path follows the same strategy as addElementTangents.
+int XC::IncrementalIntegrator::addElementResiduals(LinearSOE &theSOE, AnalysisModel &mdl)
+  {
+    int res= 0;
+    const size_t nThreads= getNumThreads();
+    if((nThreads<2) || !thread_safe_fe_elements(mdl))
+      {
+	FE_Element *elePtr= nullptr;
+	FE_EleIter &theEles= mdl.getFEs();
+	while((elePtr= theEles()) != nullptr)
+	  if(theSOE.addB(elePtr->getResidual(this),elePtr->getID()) <0)
+	    {
+	      std::cerr << getClassName() << "::" << __FUNCTION__
+			<< "; WARNING failed in addB for ID: "
+			<< elePtr->getID();
+	      res= -2;
+	    }
+      }
+    else
+      {
+	const std::vector<FE_Element *> fes= get_fe_elements(mdl);
+	const size_t numFEs= fes.size();
+	ThreadPool &pool= ThreadPool::getThreadPool();
+	const size_t batchSize= assemblyBatchSize*pool.getNumThreads(nThreads);
+	std::vector<Vector> buffer(std::min(batchSize,numFEs));
+	for(size_t first= 0;first<numFEs;first+= batchSize)
+	  {
+	    const size_t last= std::min(first+batchSize,numFEs);
+	    pool.parallel_for(first,last,[&](const size_t &i, const size_t &)
+	      { buffer[i-first]= fes[i]->getResidual(this); },nThreads);
+	    for(size_t i= first;i<last;i++)
+	      if(theSOE.addB(buffer[i-first],fes[i]->getID()) <0)
+		{
+		  std::cerr << getClassName() << "::" << __FUNCTION__
+			    << "; WARNING failed in addB for ID: "
+			    << fes[i]->getID();
+		  res= -2;
+		}
+	  }
+      }
+    return res;
   }
 
@@ -104,6 +104,10 @@ class IncrementalIntegrator : public Integrator
     virtual int formElementResidual(void);
     int statusFlag;
 
+    size_t getNumThreads(void) const;
+    int addElementTangents(LinearSOE &, AnalysisModel &);
+    int addElementResiduals(LinearSOE &, AnalysisModel &);
+
     IncrementalIntegrator(AnalysisAggregation *,int classTag);
   public:
     // methods to set up the system of equations
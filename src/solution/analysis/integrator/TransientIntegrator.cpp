@@ -138,16 +138,11 @@ int XC::TransientIntegrator::formTangent(int statFlag)
       }    
 
     // loop through the FE_Elements getting them to add the tangent    
-    FE_EleIter &theEles2 = theModel->getFEs();    
-    FE_Element *elePtr;    
-    while((elePtr = theEles2()) != 0)
+    if(addElementTangents(*theLinSOE,*theModel) < 0)
       {
-	if(theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-          {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; failed to addA: ele\n";
-	    result = -2;
-	  }
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; failed to addA: ele\n";
+	result = -2;
       }
     return result;
   }
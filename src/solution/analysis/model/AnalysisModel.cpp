@@ -97,10 +97,11 @@
 //! automatically if the problem needs it.
 XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
   :MovableObject(AnaMODEL_TAGS_AnalysisModel), CommandEntity(owr),
-   numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+   numFE_Ele(0), numDOF_Grp(0), numEqn(0), modelStamp(0),
    theFEs(this,256,"FEs"), theDOFGroups(this,256,"DOFs"), theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false),
+   updateDOFCSRGraph(true), updateGroupCSRGraph(true) {}
 
 //! @brief Constructor.
 //!
@@ -109,18 +110,20 @@ XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
 //! subclass.
 XC::AnalysisModel::AnalysisModel(int theClassTag,CommandEntity *owr)
   :MovableObject(theClassTag), CommandEntity(owr),
-   numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+   numFE_Ele(0), numDOF_Grp(0), numEqn(0), modelStamp(0),
    theFEs(this,1024,"FEs"), theDOFGroups(this,1024,"DOFs"),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false),
+   updateDOFCSRGraph(true), updateGroupCSRGraph(true) {}
 
 //! @brief Copy constructor.
 XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
   : MovableObject(other), CommandEntity(other),
-   numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn),
+   numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn), modelStamp(other.modelStamp),
    theFEs(other.theFEs), theDOFGroups(other.theDOFGroups),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false),
+   updateDOFCSRGraph(true), updateGroupCSRGraph(true) {}
 
 //! @brief Assignment operator.
 XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
@@ -130,11 +133,14 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
     numFE_Ele= other.numFE_Ele;
     numDOF_Grp= other.numDOF_Grp;
     numEqn= other.numEqn;
+    modelStamp= other.modelStamp;
     theFEs= other.theFEs;
     theDOFGroups= other.theDOFGroups;
     myDOFGraph= DOF_Graph(*this);
     myGroupGraph= DOF_GroupGraph(*this);
     updateGraphs= false; //Update just finished
+    updateDOFCSRGraph= true;
+    updateGroupCSRGraph= true;
     return *this;
   }
 
@@ -191,7 +197,7 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
 	      {
 		theElement->setAnalysisModel(*this);
 		numFE_Ele++;
-		updateGraphs= true;
+		setGraphsChanged();
 	      }
 	  }
       }
@@ -384,7 +390,7 @@ bool XC::AnalysisModel::addDOF_Group(DOF_Group *theGroup)
     if(result == true)
       {
         numDOF_Grp++;
-        updateGraphs= true;
+        setGraphsChanged();
         return true;  // o.k.
       }
     else
@@ -508,7 +514,8 @@ XC::TransformationDOF_Group *XC::AnalysisModel::createTransformationDOF_Group(co
 //! been added to the analysis model using the above two methods. It does
 //! this by setting the components in the two arrays of pointers equal to
 //! \f$0\f$ and setting the number of components to \f$0\f$. If the Graphs have
-//! been created their destructor is invoked. Also sets \p numEqn to \f$0\f$.
+//! been created their destructor is invoked. Also sets \p numEqn to \f$0\f$
+//! and increments the model stamp (see getModelStamp).
 void XC::AnalysisModel::clearAll(void) 
   {
     //XXX LA LÍNEA SIGUIENTE FALLA CUANDO EL MODELO NO CONTIENE ELEMENTOS.
@@ -518,7 +525,8 @@ void XC::AnalysisModel::clearAll(void)
     numFE_Ele=0;
     numDOF_Grp= 0;
     numEqn= 0;    
-    updateGraphs= true;
+    modelStamp++;
+    setGraphsChanged();
   }
 
 
@@ -586,9 +594,13 @@ XC::DOF_GrpConstIter &XC::AnalysisModel::getConstDOFs() const
   }
 
 //! @brief Sets the value of the number of equations in the model.
-//! Invoked by the DOF\_Numberer when it is numbering the dofs.
+//! Invoked by the DOF\_Numberer when it is numbering the dofs (the
+//! equation numbers have changed, so the DOF CSR graph is out of date).
 void XC::AnalysisModel::setNumEqn(int theNumEqn)
-  { numEqn= theNumEqn; }
+  {
+    numEqn= theNumEqn;
+    updateDOFCSRGraph= true;
+  }
 
 //! @brief Returns the number of DOFs in the model which have been assigned
 //! an equation number.
@@ -653,6 +665,46 @@ const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
     return myGroupGraph;
   }
 
+//! @brief Marks the graphs of the model as out of date. Invoked
+//! when FE_Elements or DOF_Groups are added or removed; the accessors
+//! that return non-constant references to them only mark the legacy
+//! graphs (getDOFGraph, getDOFGroupGraph), so the compressed sparse
+//! row graphs are not built again on each access.
+void XC::AnalysisModel::setGraphsChanged(void) const
+  {
+    updateGraphs= true;
+    updateDOFCSRGraph= true;
+    updateGroupCSRGraph= true;
+  }
+
+//! @brief Returns the DOF connectivity graph in compressed sparse
+//! row format. This graph is used by the system of equation object to
+//! determine its size. It is built again only if the model has
+//! changed since the last call.
+const XC::CSRGraph &XC::AnalysisModel::getDOFCSRGraph(void) const
+  {
+    if(updateDOFCSRGraph)
+      {
+        myDOFCSRGraph.buildDOFGraph(*this);
+        updateDOFCSRGraph= false;
+      }
+    return myDOFCSRGraph;
+  }
+
+//! @brief Returns the connectivity of the DOF\_Group objects in
+//! compressed sparse row format. This graph is used by the DOF\_Numberer
+//! to assign equation numbers to the dofs. It is built again only if
+//! the model has changed since the last call.
+const XC::CSRGraph &XC::AnalysisModel::getDOFGroupCSRGraph(void) const
+  {
+    if(updateGroupCSRGraph)
+      {
+        myGroupCSRGraph.buildDOFGroupGraph(*this);
+        updateGroupCSRGraph= false;
+      }
+    return myGroupCSRGraph;
+  }
+
 //! @brief Sets the values of the displacement, velocity and acceleration of
 //! the nodes.
 //! 
@@ -69,6 +69,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "solution/graph/graph/DOF_Graph.h"
 #include "solution/graph/graph/DOF_GroupGraph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include "utility/tagged/storage/ArrayOfTaggedObjects.h"
 #include "solution/analysis/model/FE_EleIter.h"
 #include "solution/analysis/model/FE_EleConstIter.h"
@@ -136,6 +137,7 @@ class AnalysisModel: public MovableObject, public CommandEntity
     int numFE_Ele; //!< number of FE_Elements objects added
     int numDOF_Grp; //!< number of DOF_Group objects added
     int numEqn; //!< numEqn set by the ConstraintHandler typically
+    int modelStamp; //!< incremented each time the model is cleared (see clearAll).
 
     ArrayOfTaggedObjects theFEs;
     ArrayOfTaggedObjects theDOFGroups;
@@ -147,6 +149,12 @@ class AnalysisModel: public MovableObject, public CommandEntity
     mutable DOF_Graph myDOFGraph;
     mutable DOF_GroupGraph myGroupGraph;
     mutable bool updateGraphs;
+    mutable CSRGraph myDOFCSRGraph; //!< DOF graph in compressed sparse row format.
+    mutable CSRGraph myGroupCSRGraph; //!< DOF group graph in compressed sparse row format.
+    mutable bool updateDOFCSRGraph;
+    mutable bool updateGroupCSRGraph;
+
+    void setGraphsChanged(void) const;
 
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
@@ -195,6 +203,12 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual PenaltyMRMFreedom_FE *createPenaltyMRMFreedom_FE(const int &, MRMFreedom_Constraint &, const double &);
     virtual FE_Element *createTransformationFE(const int &, Element *, const std::set<int> &,std::set<FE_Element *> &);
     virtual void clearAll(void);
+    //! @brief Return an integer that changes each time the FE\_Elements
+    //! and DOF\_Groups of the model are created again, so the objects
+    //! that depend on them (i.e. an assembled tangent) can
+    //! check if they are up to date.
+    inline int getModelStamp(void) const
+      { return modelStamp; }
 
     // methods to access the FE_Elements and DOF_Groups and their numbers
     virtual int getNumDOF_Groups(void) const;
@@ -212,6 +226,8 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual Graph &getDOFGroupGraph(void);
     virtual const Graph &getDOFGraph(void) const;
     virtual const Graph &getDOFGroupGraph(void) const;
+    virtual const CSRGraph &getDOFCSRGraph(void) const;
+    virtual const CSRGraph &getDOFGroupCSRGraph(void) const;
 
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new_ nodal trial response quantities.
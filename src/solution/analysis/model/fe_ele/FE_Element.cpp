@@ -285,6 +285,17 @@ int XC::FE_Element::setID(void)
     return 0;
   }
 
+//! @brief Returns true if the FE_Element can compute its tangent and
+//! residual concurrently with other FE_Elements (see
+//! Element::isThreadSafe).
+bool XC::FE_Element::isThreadSafe(void) const
+  {
+    bool retval= true;
+    if(myEle)
+      retval= myEle->isThreadSafe();
+    return retval;
+  }
+
 //! @brief Computes and returns the tangent stiffness matrix.
 //!
 //! Causes the FE\_Element to determine it's contribution to the tangent
@@ -143,6 +143,8 @@ class FE_Element: public TaggedObject
     void setAnalysisModel(AnalysisModel &theModel);
     virtual int  setID(void);
     
+    virtual bool isThreadSafe(void) const;
+
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
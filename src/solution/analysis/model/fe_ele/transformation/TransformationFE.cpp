@@ -197,6 +197,12 @@ int XC::TransformationFE::setID(void)
     return 0;
   }
 
+//! @brief Returns false; the transformation buffers (dataBuffer,
+//! localKbuffer, theTransformations,...) are shared by all the objects
+//! of the class.
+bool XC::TransformationFE::isThreadSafe(void) const
+  { return false; }
+
 const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
   {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
@@ -65,6 +65,8 @@
 #include "solution/graph/numberer/GraphNumberer.h"
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
+#include "solution/graph/numberer/AMD.h"
+#include "solution/graph/numberer/NestedDissection.h"
 #include <utility/matrix/ID.h>
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
@@ -88,6 +90,10 @@ void XC::DOF_Numberer::alloc(const std::string &str)
       theGraphNumberer=new RCM(); //Reverse Cuthill-Macgee.
     else if(str=="simple")
       theGraphNumberer=new SimpleNumberer();
+    else if(str=="amd")
+      theGraphNumberer=new AMD(); //Approximate minimum degree.
+    else if(str=="nested_dissection")
+      theGraphNumberer=new NestedDissection();
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 	        << "; numerator type: '" << str
@@ -134,11 +140,28 @@ XC::DOF_Numberer &XC::DOF_Numberer::operator=(const DOF_Numberer &other)
     return *this;
   }
 
-//! @brief Sets the algorithm to be used for numerating the graph
-//! «Reverse Cuthill-Macgee» o simple.
+//! @brief Sets the algorithm to be used for numerating the graph:
+//! «Reverse Cuthill-Macgee» (rcm), simple, approximate minimum
+//! degree (amd) or nested dissection (nested_dissection).
 void XC::DOF_Numberer::useAlgorithm(const std::string &nmb)
   { alloc(nmb); }
 
+//! @brief Return the fill and the operation count of the factorization
+//! of the system of equations with the current numbering of the DOFs
+//! (see FillReport). Useful to choose the numbering algorithm
+//! for a given model.
+XC::FillReport XC::DOF_Numberer::getFillReport(void) const
+  {
+    FillReport retval;
+    const AnalysisModel *am= getAnalysisModelPtr();
+    if(am)
+      retval.compute(am->getDOFCSRGraph());
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; WARNING - analysis model not set.\n";
+    return retval;
+  }
+
 //! @brief Destructor
 XC::DOF_Numberer::~DOF_Numberer(void) 
   { free_mem(); }
@@ -161,7 +184,7 @@ XC::DOF_Numberer *XC::DOF_Numberer::getCopy(void) const
 //
 //! This base class performs the ordering by getting an ID containing the
 //! ordered DOF\_Group tags, obtained by invoking {\em
-//! number(theModel-\f$>\f$getDOFGroupGraph(), lastDOF\_Group)} on the
+//! number(theModel-\f$>\f$getDOFGroupCSRGraph(), lastDOF\_Group)} on the
 //! GraphNumberer, \p theGraphNumberer, passed in the constructor. The
 //! base class then makes two passes through the DOF\_Group objects in the
 //! AnalysisModel by looping through this ID; in the first pass assigning the
@@ -205,7 +228,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
       return 0;
 
     // we first number the dofs using the dof group graph
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group);
+    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupCSRGraph(), lastDOF_Group);
 
     // we now iterate through the DOFs first time setting -2 values  
     if(orderedRefs.Size() != am->getNumDOF_Groups())
@@ -344,7 +367,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
 //! This method in the base class is almost identical to the one just
 //! described. The only difference is that the ID identifying the order of
 //! the DOF\_Groups is obtained by invoking {\em
-//! number(theModel-\f$>\f$getDOFGroupGraph(), lastDOF\_Groups)} on the
+//! number(theModel-\f$>\f$getDOFGroupCSRGraph(), lastDOF\_Groups)} on the
 //! GraphNumberer.
 int XC::DOF_Numberer::numberDOF(ID &lastDOFs) 
   {
@@ -374,7 +397,7 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
 
     // we first number the dofs using the dof group graph
         
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs);     
+    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupCSRGraph(), lastDOFs);     
 
     // we now iterate through the DOFs first time setting -2 values
 
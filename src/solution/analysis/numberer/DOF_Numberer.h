@@ -66,6 +66,7 @@
 
 #include <utility/actor/actor/MovableObject.h>
 #include "xc_utils/src/kernel/CommandEntity.h"
+#include "solution/graph/graph/FillReport.h"
 
 namespace XC {
 class AnalysisModel;
@@ -123,6 +124,7 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     virtual int numberDOF(ID &lastDOF_Groups);
 
     void useAlgorithm(const std::string &);
+    FillReport getFillReport(void) const;
 
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
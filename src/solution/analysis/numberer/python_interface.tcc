@@ -21,8 +21,21 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+class_<XC::FillReport>("FillReport", "Fill and operation count of the factorization of the system of equations.")
+  .add_property("numEqn", &XC::FillReport::getNumEqn,"Return the number of equations.")
+  .add_property("nnzA", &XC::FillReport::getNnzA,"Return the number of entries of the lower triangle of the matrix (diagonal included).")
+  .add_property("nnzL", &XC::FillReport::getNnzL,"Return the number of entries of the factor (diagonal included).")
+  .add_property("fill", &XC::FillReport::getFill,"Return the number of entries of the factor that are zero in the matrix.")
+  .add_property("fillRatio", &XC::FillReport::getFillRatio,"Return the ratio nnzL/nnzA.")
+  .add_property("flops", &XC::FillReport::getFlops,"Return the operation count of the factorization.")
+  .add_property("profile", &XC::FillReport::getProfile,"Return the number of entries under the skyline (diagonal excluded).")
+  .add_property("bandwidth", &XC::FillReport::getBandwidth,"Return the half bandwidth.")
+  .def(self_ns::str(self_ns::self))
+  ;
+
 class_<XC::DOF_Numberer, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("DOFNumberer", "A DOF numberer is responsible for assigning the equation numbers to the individual DOFs in each of the DOF groups in the analysis model.",no_init)
-    .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee or 'simple' for simple algorithm.")
+    .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee, 'simple' for simple algorithm, 'amd' for approximate minimum degree or 'nested_dissection' for nested dissection.")
+    .def("getFillReport", &XC::DOF_Numberer::getFillReport,"Return the fill and the operation count of the factorization of the system of equations with the current numbering.")
     ;
 
 // class_<XC::ParallelNumberer, bases<XC::DOF_Numberer>, boost::noncopyable >("ParallelNumberer", no_init);
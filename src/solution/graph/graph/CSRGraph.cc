@@ -0,0 +1,384 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+
+#include "CSRGraph.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/Vertex.h"
+#include "solution/graph/graph/VertexIter.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/dof_grp/DOF_Group.h"
+#include "solution/analysis/model/DOF_GrpIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+//! @brief Constructor (empty graph).
+XC::CSRGraph::CSRGraph(void)
+  : rowStart(1,0) {}
+
+//! @brief Constructor from a Graph object (the vertices are
+//! sorted by tag).
+XC::CSRGraph::CSRGraph(const Graph &theGraph)
+  : rowStart(1,0)
+  {
+    Graph &g= const_cast<Graph &>(theGraph);
+    const size_t numVertex= g.getNumVertex();
+    tags.reserve(numVertex);
+    VertexIter &vertexIter= g.getVertices();
+    const Vertex *vertexPtr= nullptr;
+    while((vertexPtr= vertexIter()) != nullptr)
+      tags.push_back(vertexPtr->getTag());
+    std::sort(tags.begin(),tags.end());
+    refs.resize(tags.size());
+    colors.resize(tags.size());
+    alloc_rows();
+    const int sz= tags.size();
+    for(int i= 0;i<sz;i++)
+      {
+        vertexPtr= g.getVertexPtr(tags[i]);
+        refs[i]= vertexPtr->getRef();
+        colors[i]= vertexPtr->getColor();
+        const std::set<int> &adj= vertexPtr->getAdjacency();
+        for(std::set<int>::const_iterator j= adj.begin();j!=adj.end();j++)
+          {
+            const int k= getIndex(*j);
+            if(k>=0)
+              adjacency.push_back(k); // tags are sorted so k grows with *j.
+          }
+        rowStart[i+1]= adjacency.size();
+      }
+  }
+
+//! @brief Remove all the vertices.
+void XC::CSRGraph::clear(void)
+  {
+    tags.clear();
+    refs.clear();
+    colors.clear();
+    rowStart.assign(1,0);
+    adjacency.clear();
+  }
+
+//! @brief Reset the row pointers for the current number of vertices.
+void XC::CSRGraph::alloc_rows(void)
+  {
+    rowStart.assign(tags.size()+1,0);
+    adjacency.clear();
+  }
+
+//! @brief Count the edges of the clique (vertex indexes) being passed
+//! as parameter (first pass of the construction).
+void XC::CSRGraph::add_clique_count(const std::vector<int> &clique)
+  {
+    const int sz= clique.size();
+    for(int i= 0;i<sz;i++)
+      rowStart[clique[i]+1]+= sz-1;
+  }
+
+//! @brief Store the edges of the clique (vertex indexes) being passed
+//! as parameter (second pass of the construction).
+//! @param clique: indexes of the vertices.
+//! @param next: next free position on each row.
+void XC::CSRGraph::add_clique(const std::vector<int> &clique, std::vector<int> &next)
+  {
+    const int sz= clique.size();
+    for(int i= 0;i<sz;i++)
+      {
+        const int vi= clique[i];
+        for(int j= 0;j<sz;j++)
+          if(i!=j)
+            adjacency[next[vi]++]= clique[j];
+      }
+  }
+
+//! @brief Sort the adjacency of each vertex and remove the duplicated
+//! entries and the self loops (third pass of the construction).
+void XC::CSRGraph::compress(void)
+  {
+    const int numVertex= tags.size();
+    int last= 0;
+    int begin= 0;
+    for(int i= 0;i<numVertex;i++)
+      {
+        const int end= rowStart[i+1];
+        std::vector<int>::iterator b= adjacency.begin()+begin;
+        std::vector<int>::iterator e= adjacency.begin()+end;
+        std::sort(b,e);
+        e= std::unique(b,e);
+        rowStart[i]= last;
+        for(std::vector<int>::iterator j= b;j!=e;j++)
+          if(*j!=i)
+            adjacency[last++]= *j;
+        begin= end;
+      }
+    rowStart[numVertex]= last;
+    adjacency.resize(last);
+    adjacency.shrink_to_fit();
+  }
+
+//! @brief Build the graph of the equations of the model: one vertex
+//! for each equation and edges between the equations that are
+//! coupled by a FE_Element (see DOF_Graph).
+void XC::CSRGraph::buildDOFGraph(const AnalysisModel &theModel)
+  {
+    clear();
+    const int numEqn= theModel.getNumEqn();
+    tags.resize(numEqn);
+    for(int i= 0;i<numEqn;i++)
+      tags[i]= i;
+    refs= tags;
+    colors.assign(numEqn,0);
+    alloc_rows();
+
+    std::vector<int> clique;
+    for(int pass= 0;pass<2;pass++)
+      {
+        std::vector<int> next;
+        if(pass==1)
+          {
+            for(int i= 0;i<numEqn;i++) // accumulate the counts.
+              rowStart[i+1]+= rowStart[i];
+            adjacency.resize(rowStart[numEqn]);
+            next.assign(rowStart.begin(),rowStart.end()-1);
+          }
+        const FE_Element *elePtr= nullptr;
+        FE_EleConstIter &eleIter= theModel.getConstFEs();
+        while((elePtr= eleIter()) != nullptr)
+          {
+            const ID &id= elePtr->getID();
+            const int sz= id.Size();
+            clique.clear();
+            for(int i= 0;i<sz;i++)
+              {
+                const int eqn= id(i);
+                if((eqn>=0) && (eqn<numEqn))
+                  clique.push_back(eqn);
+              }
+            if(pass==0)
+              add_clique_count(clique);
+            else
+              add_clique(clique,next);
+          }
+      }
+    compress();
+  }
+
+//! @brief Build the graph of the DOF groups of the model: one vertex
+//! for each DOF_Group (tag: DOF group tag, ref: node tag, color: number
+//! of free DOFs) and edges between the groups that are connected by a
+//! FE_Element (see DOF_GroupGraph).
+void XC::CSRGraph::buildDOFGroupGraph(const AnalysisModel &theModel)
+  {
+    clear();
+    const int numVertex= theModel.getNumDOF_Groups();
+    tags.reserve(numVertex);
+    const DOF_Group *dofGroupPtr= nullptr;
+    DOF_GrpConstIter &dofIter= theModel.getConstDOFs();
+    while((dofGroupPtr= dofIter()) != nullptr)
+      tags.push_back(dofGroupPtr->getTag());
+    std::sort(tags.begin(),tags.end());
+    const int sz= tags.size();
+    refs.resize(sz);
+    colors.resize(sz);
+    DOF_GrpConstIter &dofIter2= theModel.getConstDOFs();
+    while((dofGroupPtr= dofIter2()) != nullptr)
+      {
+        const int i= getIndex(dofGroupPtr->getTag());
+        refs[i]= dofGroupPtr->getNodeTag();
+        colors[i]= dofGroupPtr->getNumFreeDOF();
+      }
+    alloc_rows();
+
+    std::vector<int> clique;
+    for(int pass= 0;pass<2;pass++)
+      {
+        std::vector<int> next;
+        if(pass==1)
+          {
+            for(int i= 0;i<sz;i++) // accumulate the counts.
+              rowStart[i+1]+= rowStart[i];
+            adjacency.resize(rowStart[sz]);
+            next.assign(rowStart.begin(),rowStart.end()-1);
+          }
+        const FE_Element *elePtr= nullptr;
+        FE_EleConstIter &eleIter= theModel.getConstFEs();
+        while((elePtr= eleIter()) != nullptr)
+          {
+            const ID &id= elePtr->getDOFtags();
+            const int nt= id.Size();
+            clique.clear();
+            for(int i= 0;i<nt;i++)
+              {
+                const int k= getIndex(id(i));
+                if(k>=0)
+                  clique.push_back(k);
+              }
+            if(pass==0)
+              add_clique_count(clique);
+            else
+              add_clique(clique,next);
+          }
+      }
+    compress();
+  }
+
+//! @brief Return the index of the vertex with the tag being passed
+//! as parameter (-1 if not found).
+int XC::CSRGraph::getIndex(const int &tag) const
+  {
+    const int numVertex= tags.size();
+    if((tag>=0) && (tag<numVertex) && (tags[tag]==tag)) // usual case.
+      return tag;
+    std::vector<int>::const_iterator i= std::lower_bound(tags.begin(),tags.end(),tag);
+    if((i!=tags.end()) && (*i==tag))
+      return i-tags.begin();
+    return -1;
+  }
+
+//! @brief Compute the sparsity pattern of the matrix of a system of
+//! equations whose graph is this one.
+//!
+//! Vertices must be numbered from 0 to numVertex-1 (see
+//! hasConsecutiveTags). On return, the indexes of the non-zero entries
+//! of the i-th row (or column) are stored in ascending order in the
+//! positions starts(i) through starts(i+1)-1 of \p indexes. Both
+//! arrays are enlarged if needed. Returns the number of non-zeros or
+//! -1 if the vertices are not numbered consecutively.
+//!
+//! @param starts: start of each row (or column) in indexes.
+//! @param indexes: indexes of the non-zero entries.
+//! @param withDiagonal: if true add the diagonal entries to the pattern.
+int XC::CSRGraph::getPattern(ID &starts, ID &indexes, bool withDiagonal) const
+  {
+    if(!hasConsecutiveTags())
+      return -1;
+    const int numVertex= tags.size();
+    const int retval= adjacency.size()+(withDiagonal ? numVertex : 0);
+    if(starts.Size() < numVertex+1)
+      starts.resize(numVertex+1);
+    if(indexes.Size() < retval)
+      indexes.resize(retval);
+    int k= 0;
+    starts(0)= 0;
+    for(int a= 0;a<numVertex;a++)
+      {
+        bool diagPlaced= !withDiagonal;
+        for(const int *j= adjBegin(a);j!=adjEnd(a);j++)
+          {
+            if(!diagPlaced && (*j > a))
+              {
+                indexes(k++)= a;
+                diagPlaced= true;
+              }
+            indexes(k++)= *j;
+          }
+        if(!diagPlaced)
+          indexes(k++)= a;
+        starts(a+1)= k;
+      }
+    return retval;
+  }
+
+//! @brief Compute the number of subdiagonals and superdiagonals
+//! of the matrix whose sparsity pattern is given by the graph
+//! (see Graph::getBand).
+void XC::CSRGraph::getBand(int &numSubD,int &numSuperD) const
+  {
+    numSubD= 0;
+    numSuperD= 0;
+    const int numVertex= tags.size();
+    for(int i= 0;i<numVertex;i++)
+      {
+        const int vertexNum= tags[i];
+        for(const int *j= adjBegin(i);j!=adjEnd(i);j++)
+          {
+            const int diff= vertexNum-tags[*j];
+            if(diff>numSuperD)
+              numSuperD= diff;
+            else if(-diff>numSubD)
+              numSubD= -diff;
+          }
+      }
+  }
+
+//! @brief Return the maximum (positive) of the difference between
+//! the tags of adjacent vertices (see Graph::getVertexDiffMaxima).
+int XC::CSRGraph::getVertexDiffMaxima(void) const
+  {
+    int retval= 0;
+    const int numVertex= tags.size();
+    for(int i= 0;i<numVertex;i++)
+      if(getDegree(i)>0)
+        {
+          // adjacency is sorted, so the lowest tag comes first.
+          const int diff= tags[i]-tags[*adjBegin(i)];
+          if(retval<diff)
+            retval= diff;
+        }
+    return retval;
+  }
+
+//! @brief Populate the (empty) Graph object being passed as parameter
+//! with the vertices and edges of this one (compatibility adapter for
+//! the classes that use the Graph interface).
+void XC::CSRGraph::fill(Graph &theGraph) const
+  {
+    const int numVertex= tags.size();
+    for(int i= 0;i<numVertex;i++)
+      {
+        Vertex vrt(tags[i],refs[i],0,colors[i]);
+        if(!theGraph.addVertex(vrt,false))
+          std::cerr << "CSRGraph::" << __FUNCTION__
+                    << "; error adding vertex: " << tags[i] << std::endl;
+      }
+    for(int i= 0;i<numVertex;i++)
+      for(const int *j= adjBegin(i);j!=adjEnd(i);j++)
+        if(*j>i)
+          theGraph.addEdge(tags[i],tags[*j]);
+  }
+
+//! @brief Print the graph.
+void XC::CSRGraph::Print(std::ostream &os) const
+  {
+    const int numVertex= tags.size();
+    for(int i= 0;i<numVertex;i++)
+      {
+        os << "Vertex: " << tags[i] << " Ref: " << refs[i]
+           << " Color: " << colors[i] << " ADJACENCY:";
+        for(const int *j= adjBegin(i);j!=adjEnd(i);j++)
+          os << " " << tags[*j];
+        os << std::endl;
+      }
+  }
+
+//! @brief Insertion in an output stream.
+std::ostream &XC::operator<<(std::ostream &os, const CSRGraph &g)
+  {
+    g.Print(os);
+    return os;
+  }
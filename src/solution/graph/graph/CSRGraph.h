@@ -0,0 +1,124 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+#include <vector>
+#include <iostream>
+
+namespace XC {
+class Graph;
+class ID;
+class AnalysisModel;
+
+//! @ingroup Graph
+//
+//! @brief Graph stored in compressed sparse row format.
+//!
+//! Compact (read-only once built) representation of the DOF and DOF
+//! group graphs of the analysis model. The vertices are identified by
+//! its index (0 through numVertex-1) and sorted by tag, so iterating
+//! over the indexes visits the vertices in the same order than the
+//! VertexIter of the equivalent Graph object. The adjacency of the
+//! vertex i is stored (sorted and without duplicates) in the positions
+//! rowStart[i] through rowStart[i+1]-1 of the adjacency vector.
+//!
+//! Unlike Graph, which allocates a Vertex object (and a std::set for
+//! its adjacency) for each vertex, this representation uses five
+//! contiguous integer arrays. The numberers and the systems of
+//! equations read it directly; the Graph class remains available
+//! as an adapter (see fill) for the classes that still need it.
+class CSRGraph
+  {
+  private:
+    std::vector<int> tags; //!< tags of the vertices (ascending order).
+    std::vector<int> refs; //!< reference of each vertex (node tag,...).
+    std::vector<int> colors; //!< color of each vertex (number of free DOFs,...).
+    std::vector<int> rowStart; //!< start of the adjacency of each vertex.
+    std::vector<int> adjacency; //!< indexes of the adjacent vertices.
+
+    void alloc_rows(void);
+    void add_clique_count(const std::vector<int> &);
+    void add_clique(const std::vector<int> &, std::vector<int> &);
+    void compress(void);
+  public:
+    CSRGraph(void);
+    explicit CSRGraph(const Graph &);
+
+    void clear(void);
+    void buildDOFGraph(const AnalysisModel &);
+    void buildDOFGroupGraph(const AnalysisModel &);
+
+    //! @brief Return the number of vertices.
+    inline int getNumVertex(void) const
+      { return tags.size(); }
+    //! @brief Return the number of (undirected) edges.
+    inline int getNumEdge(void) const
+      { return adjacency.size()/2; }
+    //! @brief Return the degree of the i-th vertex.
+    inline int getDegree(const int &i) const
+      { return rowStart[i+1]-rowStart[i]; }
+    //! @brief Return a pointer to the first adjacent vertex of the i-th vertex.
+    inline const int *adjBegin(const int &i) const
+      { return adjacency.data()+rowStart[i]; }
+    //! @brief Return a pointer past the last adjacent vertex of the i-th vertex.
+    inline const int *adjEnd(const int &i) const
+      { return adjacency.data()+rowStart[i+1]; }
+    //! @brief Return the tag of the i-th vertex.
+    inline int getTag(const int &i) const
+      { return tags[i]; }
+    //! @brief Return the reference of the i-th vertex.
+    inline int getRef(const int &i) const
+      { return refs[i]; }
+    //! @brief Return the color of the i-th vertex.
+    inline int getColor(const int &i) const
+      { return colors[i]; }
+    //! @brief Return the row pointers (size numVertex+1).
+    inline const std::vector<int> &getRowStarts(void) const
+      { return rowStart; }
+    //! @brief Return the concatenated adjacency lists.
+    inline const std::vector<int> &getAdjacency(void) const
+      { return adjacency; }
+    int getIndex(const int &) const;
+    //! @brief Return true if the vertex tags are 0 through numVertex-1
+    //! (the index of each vertex is equal to its tag).
+    inline bool hasConsecutiveTags(void) const
+      { return (tags.empty() || ((tags.front()==0) && (tags.back()==int(tags.size())-1))); }
+
+    int getPattern(ID &, ID &, bool withDiagonal= true) const;
+    void getBand(int &,int &) const;
+    int getVertexDiffMaxima(void) const;
+
+    void fill(Graph &) const;
+    void Print(std::ostream &os) const;
+  };
+
+std::ostream &operator<<(std::ostream &, const CSRGraph &);
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FillReport.cc
+
+#include "FillReport.h"
+#include "CSRGraph.h"
+#include <vector>
+
+//! @brief Constructor (empty report).
+XC::FillReport::FillReport(void)
+  : numEqn(0), nnzA(0), nnzL(0), flops(0.0), profile(0), bandwidth(0) {}
+
+//! @brief Constructor.
+//!
+//! @param theGraph: graph of the matrix.
+XC::FillReport::FillReport(const CSRGraph &theGraph)
+  : numEqn(0), nnzA(0), nnzL(0), flops(0.0), profile(0), bandwidth(0)
+  { compute(theGraph); }
+
+//! @brief Compute the statistics of the factorization of the matrix
+//! whose graph is being passed as parameter.
+//!
+//! The structure of the factor is obtained from the elimination tree
+//! (Liu's algorithm with path compression): the entries of the row i
+//! of the factor are the vertices of the subtree obtained climbing
+//! the tree from each j<i adjacent to i. The operation count is the
+//! one used by the AMD library: the number of divisions plus twice
+//! the number of multiply-subtract pairs of the LDL' factorization.
+void XC::FillReport::compute(const CSRGraph &theGraph)
+  {
+    numEqn= theGraph.getNumVertex();
+    nnzA= numEqn+theGraph.getNumEdge();
+    nnzL= numEqn;
+    flops= 0.0;
+    profile= 0;
+    bandwidth= 0;
+
+    // elimination tree.
+    std::vector<int> parent(numEqn,-1);
+    std::vector<int> ancestor(numEqn,-1);
+    for(int i= 0;i<numEqn;i++)
+      for(const int *j= theGraph.adjBegin(i);(j!=theGraph.adjEnd(i)) && (*j<i);j++)
+        {
+          int r= *j;
+          while((ancestor[r]!=-1) && (ancestor[r]!=i))
+            {
+              const int next= ancestor[r];
+              ancestor[r]= i;
+              r= next;
+            }
+          if(ancestor[r]==-1)
+            {
+              ancestor[r]= i;
+              parent[r]= i;
+            }
+        }
+
+    // column counts (off-diagonal entries of each column of L).
+    std::vector<long> colCount(numEqn,0);
+    std::vector<int> mark(numEqn,-1);
+    for(int i= 0;i<numEqn;i++)
+      {
+        mark[i]= i;
+        const int *first= theGraph.adjBegin(i);
+        if((first!=theGraph.adjEnd(i)) && (*first<i))
+          {
+            const int rowBand= i-*first;
+            profile+= rowBand;
+            if(rowBand>bandwidth)
+              bandwidth= rowBand;
+          }
+        for(const int *j= first;(j!=theGraph.adjEnd(i)) && (*j<i);j++)
+          for(int k= *j;mark[k]!=i;k= parent[k])
+            {
+              colCount[k]++;
+              mark[k]= i;
+            }
+      }
+    for(int k= 0;k<numEqn;k++)
+      {
+        const double c= colCount[k];
+        nnzL+= colCount[k];
+        flops+= c*(c+2.0);
+      }
+  }
+
+//! @brief Return the ratio between the entries of the factor and
+//! the entries of the (lower triangle of the) matrix.
+double XC::FillReport::getFillRatio(void) const
+  {
+    double retval= 0.0;
+    if(nnzA>0)
+      retval= double(nnzL)/double(nnzA);
+    return retval;
+  }
+
+//! @brief Print stuff.
+void XC::FillReport::Print(std::ostream &os) const
+  {
+    os << "number of equations: " << numEqn
+       << " nnz(A): " << nnzA
+       << " nnz(L): " << nnzL
+       << " fill ratio: " << getFillRatio()
+       << " flops: " << flops
+       << " profile: " << profile
+       << " bandwidth: " << bandwidth << std::endl;
+  }
+
+//! @brief Print stuff.
+std::ostream &XC::operator<<(std::ostream &os, const FillReport &fr)
+  {
+    fr.Print(os);
+    return os;
+  }
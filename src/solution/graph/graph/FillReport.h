@@ -0,0 +1,94 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FillReport.h
+
+#ifndef FillReport_h
+#define FillReport_h
+
+#include <iostream>
+
+namespace XC {
+class CSRGraph;
+
+//! @ingroup Graph
+//
+//! @brief Fill and operation count of the factorization of a sparse
+//! symmetric matrix.
+//!
+//! Computed from the graph of the matrix (the DOF graph of the
+//! analysis model), taking the vertices in the order of their tags
+//! (the equation numbers), by means of the elimination tree and the
+//! row subtrees of the factor (symbolic factorization). It allows
+//! comparing the numberers (see DOF_Numberer::useAlgorithm) on a
+//! given model.
+class FillReport
+  {
+  private:
+    int numEqn; //!< number of equations.
+    long nnzA; //!< entries of the lower triangle of the matrix (diagonal included).
+    long nnzL; //!< entries of the factor (diagonal included).
+    double flops; //!< operation count of the LDL' factorization.
+    long profile; //!< entries under the skyline (diagonal excluded).
+    int bandwidth; //!< half bandwidth.
+  public:
+    FillReport(void);
+    explicit FillReport(const CSRGraph &);
+    void compute(const CSRGraph &);
+
+    //! @brief Return the number of equations.
+    inline int getNumEqn(void) const
+      { return numEqn; }
+    //! @brief Return the number of entries of the lower triangle
+    //! of the matrix (diagonal included).
+    inline long getNnzA(void) const
+      { return nnzA; }
+    //! @brief Return the number of entries of the factor
+    //! (diagonal included).
+    inline long getNnzL(void) const
+      { return nnzL; }
+    //! @brief Return the number of entries of the factor that
+    //! are zero in the matrix.
+    inline long getFill(void) const
+      { return nnzL-nnzA; }
+    //! @brief Return the operation count of the factorization.
+    inline double getFlops(void) const
+      { return flops; }
+    //! @brief Return the number of entries under the skyline
+    //! (profile storage, diagonal excluded).
+    inline long getProfile(void) const
+      { return profile; }
+    //! @brief Return the half bandwidth.
+    inline int getBandwidth(void) const
+      { return bandwidth; }
+    double getFillRatio(void) const;
+    void Print(std::ostream &os) const;
+  };
+
+std::ostream &operator<<(std::ostream &, const FillReport &);
+} // end of XC namespace
+
+#endif
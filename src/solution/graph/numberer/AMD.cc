@@ -0,0 +1,280 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMD.cc
+
+#include "AMD.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <utility/matrix/ID.h>
+#include <set>
+#include <algorithm>
+
+//! @brief Constructor
+XC::AMD::AMD(int classTag)
+  :BaseNumberer(classTag) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::AMD::getCopy(void) const
+  { return new AMD(*this); }
+
+//! @brief Return the weight of each vertex of the graph (its color,
+//! that is the number of free DOFs of the DOF group, but not less
+//! than one).
+void XC::AMD::get_weights(const CSRGraph &theGraph, std::vector<int> &weights)
+  {
+    const int numVertex= theGraph.getNumVertex();
+    weights.resize(numVertex);
+    for(int i= 0;i<numVertex;i++)
+      weights[i]= std::max(1,theGraph.getColor(i));
+  }
+
+//! @brief Approximate minimum degree ordering of the graph defined by
+//! the arguments.
+//!
+//! @param xadj: start of the adjacency of each vertex (size n+1).
+//! @param adj: adjacent vertices (without self-loops).
+//! @param weights: weight of each vertex (greater than zero).
+//! @param perm: vertex indexes in elimination order.
+void XC::AMD::amd_order(const std::vector<int> &xadj, const std::vector<int> &adj, const std::vector<int> &weights, std::vector<int> &perm)
+  {
+    const int n= xadj.size()-1;
+    perm.clear();
+    if(n<1)
+      return;
+    perm.reserve(n);
+
+    // Quotient graph: each eliminated vertex becomes an element
+    // (identified by the index of the vertex) whose variables are
+    // the ones that form a clique in the filled graph.
+    std::vector<std::vector<int> > A(n); // adjacent variables.
+    std::vector<std::vector<int> > E(n); // adjacent elements.
+    std::vector<std::vector<int> > L(n); // variables of each element.
+    std::vector<int> status(n,0); // 0: variable, 1: element, 2: absorbed.
+    std::vector<long> wL(n,0); // weight of the variables of each element.
+    std::vector<long> wDiff(n,-1); // weight of Le\Lp.
+    std::vector<long> degree(n,0); // approximate external degree.
+    std::vector<int> mark(n,-1);
+    std::set<std::pair<long,int> > queue;
+    long totalWeight= 0;
+    for(int i= 0;i<n;i++)
+      {
+        A[i].assign(adj.begin()+xadj[i],adj.begin()+xadj[i+1]);
+        for(std::vector<int>::const_iterator j= A[i].begin();j!=A[i].end();j++)
+          degree[i]+= weights[*j];
+        totalWeight+= weights[i];
+        queue.insert(std::make_pair(degree[i],i));
+      }
+
+    while(!queue.empty())
+      {
+        // eliminate the variable of minimum approximate degree.
+        const int p= queue.begin()->second;
+        queue.erase(queue.begin());
+        status[p]= 1;
+        perm.push_back(p);
+        totalWeight-= weights[p];
+
+        // new element: variables of the elements adjacent to p
+        // (which are absorbed) and variables adjacent to p.
+        std::vector<int> &Lp= L[p];
+        mark[p]= p;
+        for(std::vector<int>::const_iterator e= E[p].begin();e!=E[p].end();e++)
+          if(status[*e]==1)
+            {
+              for(std::vector<int>::const_iterator v= L[*e].begin();v!=L[*e].end();v++)
+                if((status[*v]==0) && (mark[*v]!=p))
+                  { mark[*v]= p; Lp.push_back(*v); }
+              status[*e]= 2;
+              std::vector<int>().swap(L[*e]);
+            }
+        for(std::vector<int>::const_iterator v= A[p].begin();v!=A[p].end();v++)
+          if((status[*v]==0) && (mark[*v]!=p))
+            { mark[*v]= p; Lp.push_back(*v); }
+        std::vector<int>().swap(A[p]);
+        std::vector<int>().swap(E[p]);
+        for(std::vector<int>::const_iterator v= Lp.begin();v!=Lp.end();v++)
+          wL[p]+= weights[*v];
+
+        // weight of Le\Lp for the elements adjacent to Lp.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          for(std::vector<int>::const_iterator e= E[*i].begin();e!=E[*i].end();e++)
+            if(status[*e]==1)
+              {
+                if(wDiff[*e]<0) wDiff[*e]= wL[*e];
+                wDiff[*e]-= weights[*i];
+              }
+
+        // update the variables of the new element.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            queue.erase(std::make_pair(degree[*i],*i));
+            // elements: remove the absorbed ones, absorb the ones
+            // contained in Lp (aggressive absorption) and add p.
+            std::vector<int> &Ei= E[*i];
+            size_t k= 0;
+            long dE= 0;
+            for(size_t j= 0;j<Ei.size();j++)
+              {
+                const int e= Ei[j];
+                if(status[e]!=1)
+                  continue;
+                if(wDiff[e]==0)
+                  {
+                    status[e]= 2;
+                    std::vector<int>().swap(L[e]);
+                  }
+                else
+                  {
+                    Ei[k++]= e;
+                    dE+= wDiff[e];
+                  }
+              }
+            Ei.resize(k);
+            Ei.push_back(p);
+            // variables: remove the ones already in Lp.
+            std::vector<int> &Ai= A[*i];
+            k= 0;
+            long dA= 0;
+            for(size_t j= 0;j<Ai.size();j++)
+              {
+                const int v= Ai[j];
+                if((status[v]==0) && (mark[v]!=p))
+                  {
+                    Ai[k++]= v;
+                    dA+= weights[v];
+                  }
+              }
+            Ai.resize(k);
+            // approximate external degree.
+            const long dLp= wL[p]-weights[*i];
+            long d= dA+dLp+dE;
+            d= std::min(d,degree[*i]+dLp);
+            d= std::min(d,totalWeight-weights[*i]);
+            degree[*i]= d;
+            queue.insert(std::make_pair(d,*i));
+          }
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          for(std::vector<int>::const_iterator e= E[*i].begin();e!=E[*i].end();e++)
+            wDiff[*e]= -1;
+      }
+  }
+
+//! @brief Compute the elimination order of the vertices (indexes) of
+//! the graph.
+void XC::AMD::compute_order(const CSRGraph &theGraph, std::vector<int> &perm) const
+  {
+    std::vector<int> weights;
+    get_weights(theGraph,weights);
+    amd_order(theGraph.getRowStarts(),theGraph.getAdjacency(),weights,perm);
+  }
+
+//! @brief Store in theRefResult the tags of the vertices in the order
+//! being passed as parameter, moving the vertices of the last argument
+//! to the end.
+const XC::ID &XC::AMD::set_result(const CSRGraph &theGraph, const std::vector<int> &perm, const std::vector<int> &lastIndexes)
+  {
+    const int numVertex= getNumVertex();
+    std::vector<bool> isLast(numVertex,false);
+    for(std::vector<int>::const_iterator i= lastIndexes.begin();i!=lastIndexes.end();i++)
+      isLast[*i]= true;
+    int count= 0;
+    for(std::vector<int>::const_iterator i= perm.begin();i!=perm.end();i++)
+      if(!isLast[*i])
+        theRefResult(count++)= theGraph.getTag(*i);
+    for(std::vector<int>::const_iterator i= lastIndexes.begin();i!=lastIndexes.end();i++)
+      if(isLast[*i])
+        {
+          theRefResult(count++)= theGraph.getTag(*i);
+          isLast[*i]= false; // avoid repetitions.
+        }
+    return theRefResult;
+  }
+
+//! @brief Numbers the vertices of the graph. If lastVertex is not -1
+//! the vertex with this tag is numbered last.
+const XC::ID &XC::AMD::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph))
+      return theRefResult;
+
+    std::vector<int> lastIndexes;
+    if(lastVertex != -1)
+      {
+        const int last= theGraph.getIndex(lastVertex);
+        if(last<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; WARNING: no vertex with tag "
+                    << lastVertex << " exists.\n";
+        else
+          lastIndexes.push_back(last);
+      }
+    std::vector<int> perm;
+    compute_order(theGraph,perm);
+    return set_result(theGraph,perm,lastIndexes);
+  }
+
+//! @brief Numbers the vertices of the graph, the vertices whose tags
+//! are in the argument are numbered last.
+const XC::ID &XC::AMD::number(const CSRGraph &theGraph, const ID &lastVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph))
+      return theRefResult;
+
+    std::vector<int> lastIndexes;
+    const int sz= lastVertices.Size();
+    for(int i= 0;i<sz;i++)
+      {
+        const int last= theGraph.getIndex(lastVertices(i));
+        if(last<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; WARNING: no vertex with tag "
+                    << lastVertices(i) << " exists.\n";
+        else
+          lastIndexes.push_back(last);
+      }
+    std::vector<int> perm;
+    compute_order(theGraph,perm);
+    return set_result(theGraph,perm,lastIndexes);
+  }
+
+//! @brief Numbers the vertices of the graph (see
+//! number(const CSRGraph &,int)).
+const XC::ID &XC::AMD::number(Graph &theGraph, int lastVertex)
+  { return number(CSRGraph(theGraph),lastVertex); }
+
+//! @brief Numbers the vertices of the graph (see
+//! number(const CSRGraph &,const ID &)).
+const XC::ID &XC::AMD::number(Graph &theGraph, const ID &lastVertices)
+  { return number(CSRGraph(theGraph),lastVertices); }
+
+int XC::AMD::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::AMD::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMD.h
+
+#ifndef AMD_h
+#define AMD_h
+
+#include "BaseNumberer.h"
+#include <vector>
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Approximate minimum degree numbering of the vertices of a graph.
+//!
+//! Orders the vertices to reduce the fill of the sparse factorization
+//! (see SymSparseLinSOE and SparseGenColLinSOE) using the quotient graph
+//! formulation of the approximate minimum degree algorithm by Amestoy,
+//! Davis and Duff: at each step the vertex with the smallest approximate
+//! external degree is eliminated and replaced, together with the
+//! elements it is adjacent to, by a new element. Element absorption
+//! (including aggressive absorption) keeps the quotient graph size
+//! bounded by the size of the original one.
+//!
+//! The degrees are weighted by the color of the vertices (the number of
+//! free DOFs of each DOF group), so the DOF group graph (where each
+//! vertex is already a supervariable) is ordered as the DOF graph.
+class AMD: public BaseNumberer
+  {
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    AMD(int classTag= GraphNUMBERER_TAG_AMD);
+    GraphNumberer *getCopy(void) const;
+
+    static void get_weights(const CSRGraph &, std::vector<int> &);
+    static void amd_order(const std::vector<int> &, const std::vector<int> &, const std::vector<int> &, std::vector<int> &);
+    virtual void compute_order(const CSRGraph &, std::vector<int> &) const;
+    const ID &set_result(const CSRGraph &, const std::vector<int> &, const std::vector<int> &);
+  public:
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
@@ -62,6 +62,7 @@
 
 #include <solution/graph/numberer/BaseNumberer.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
@@ -83,3 +84,12 @@ bool XC::BaseNumberer::checkSize(const Graph &theGraph)
     return (nvg!=0);
   }
 
+//! @brief Allocates space enough for the theRefResult vector.
+//! Returns true if the number of vertices is not zero.
+bool XC::BaseNumberer::checkSize(const CSRGraph &theGraph)
+  {
+    const int nvg= theGraph.getNumVertex();
+    if(theRefResult.Size() != nvg)
+      theRefResult.resize(nvg);
+    return (nvg!=0);
+  }
@@ -59,6 +59,9 @@
 
 
 #include "GraphNumberer.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include "utility/matrix/ID.h"
 
 //! @brief Constructor.
 //!
@@ -68,6 +71,30 @@ XC::GraphNumberer::GraphNumberer(int classTag)
   :MovableObject(classTag)
   {}
 
+//! @brief Graph numbering.
+//!
+//! Numbers the vertices of the graph in compressed sparse row
+//! format. The returned ID contains the vertex tags in the order of
+//! the numbering. This default implementation builds a Graph
+//! object from \p theGraph and calls number(Graph &,int); the
+//! subclasses can override it to work directly with the compressed
+//! representation.
+const XC::ID &XC::GraphNumberer::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    Graph tmp(theGraph.getNumVertex()+1);
+    theGraph.fill(tmp);
+    return this->number(tmp,lastVertex);
+  }
 
-
-
+//! @brief Graph numbering.
+//!
+//! Numbers the vertices of the graph in compressed sparse row
+//! format starting from one of the vertices whose tag is in
+//! \p lastVertices. This default implementation builds a Graph
+//! object from \p theGraph and calls number(Graph &,const ID &).
+const XC::ID &XC::GraphNumberer::number(const CSRGraph &theGraph, const ID &lastVertices)
+  {
+    Graph tmp(theGraph.getNumVertex()+1);
+    theGraph.fill(tmp);
+    return this->number(tmp,lastVertices);
+  }
@@ -69,6 +69,7 @@
 namespace XC {
 class ID;
 class Graph;
+class CSRGraph;
 class Channel;
 class ObjectBroker;
 
@@ -119,6 +120,9 @@ class GraphNumberer : public MovableObject, public CommandEntity
     //! is not \f$-1\f$ the Vertex whose tag is given by \p lastVertex
     //! should be numbered last (it does not have to be though THIS MAY CHANGE).
     virtual const ID &number(Graph &theGraph, const ID &lastVertices) =0;
+
+    virtual const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    virtual const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
   };
 } // end of XC namespace
 
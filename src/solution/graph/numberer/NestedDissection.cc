@@ -0,0 +1,267 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissection.cc
+
+#include "NestedDissection.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <utility/matrix/ID.h>
+#include <algorithm>
+
+//! @brief Constructor
+//!
+//! @param sz: subgraphs with less vertices than this value are
+//! ordered with the approximate minimum degree algorithm.
+XC::NestedDissection::NestedDissection(int sz)
+  :AMD(GraphNUMBERER_TAG_NestedDissection), leafSize(std::max(sz,3)) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::NestedDissection::getCopy(void) const
+  { return new NestedDissection(*this); }
+
+namespace XC {
+//! @brief Subgraph pending to be ordered.
+struct NDSubgraph
+  {
+    std::vector<int> vertices; //!< vertex indexes.
+    int first; //!< first position in the elimination order.
+    NDSubgraph(int f= 0)
+      : first(f) {}
+  };
+
+//! @brief Breadth first search from the start vertex that visits the
+//! vertices of the subgraph (the ones with inSub==stamp). Return
+//! the visited vertices sorted by level in the visited argument and
+//! the start of each level in the levels argument.
+void nd_bfs(const CSRGraph &theGraph, const int &start, const std::vector<int> &inSub, const int &stamp, std::vector<int> &level, std::vector<int> &visited, std::vector<int> &levels)
+  {
+    visited.clear();
+    levels.clear();
+    visited.push_back(start);
+    level[start]= 0;
+    levels.push_back(0);
+    size_t head= 0;
+    int currentLevel= 0;
+    while(head<visited.size())
+      {
+        const int v= visited[head];
+        if(level[v]!=currentLevel)
+          {
+            currentLevel= level[v];
+            levels.push_back(head);
+          }
+        head++;
+        for(const int *j= theGraph.adjBegin(v);j!=theGraph.adjEnd(v);j++)
+          if((inSub[*j]==stamp) && (level[*j]<0))
+            {
+              level[*j]= currentLevel+1;
+              visited.push_back(*j);
+            }
+      }
+    levels.push_back(visited.size());
+  }
+} // end of XC namespace
+
+//! @brief Compute the elimination order of the vertices (indexes) of
+//! the graph.
+void XC::NestedDissection::compute_order(const CSRGraph &theGraph, std::vector<int> &perm) const
+  {
+    const int numVertex= theGraph.getNumVertex();
+    std::vector<int> weights;
+    get_weights(theGraph,weights);
+    perm.assign(numVertex,-1);
+    if(numVertex<1)
+      return;
+
+    std::vector<int> inSub(numVertex,-1); // subgraph stamp.
+    std::vector<int> level(numVertex,-1); // level or part of each vertex.
+    std::vector<int> local(numVertex,-1); // local index for the leaves.
+    std::vector<int> visited, levels;
+    std::vector<NDSubgraph> pending(1);
+    pending.back().vertices.resize(numVertex);
+    for(int i= 0;i<numVertex;i++)
+      pending.back().vertices[i]= i;
+    int stamp= 0;
+    while(!pending.empty())
+      {
+        NDSubgraph sub;
+        std::swap(sub,pending.back());
+        pending.pop_back();
+        const std::vector<int> &S= sub.vertices;
+        const int sz= S.size();
+        if(sz<1)
+          continue;
+        stamp++;
+        for(std::vector<int>::const_iterator i= S.begin();i!=S.end();i++)
+          {
+            inSub[*i]= stamp;
+            level[*i]= -1;
+          }
+
+        bool isLeaf= (sz<leafSize);
+        if(!isLeaf)
+          {
+            // level structure rooted at a pseudo-peripheral vertex.
+            int start= S.front();
+            nd_bfs(theGraph,start,inSub,stamp,level,visited,levels);
+            for(int iter= 0;iter<5;iter++)
+              {
+                const int numLevels= levels.size()-1;
+                int candidate= visited[levels[numLevels-1]];
+                for(int j= levels[numLevels-1];j<levels[numLevels];j++)
+                  if(theGraph.getDegree(visited[j])<theGraph.getDegree(candidate))
+                    candidate= visited[j];
+                for(std::vector<int>::const_iterator j= visited.begin();j!=visited.end();j++)
+                  level[*j]= -1;
+                std::vector<int> v2, l2;
+                nd_bfs(theGraph,candidate,inSub,stamp,level,v2,l2);
+                if(l2.size()<=levels.size())
+                  {
+                    // no improvement, restore the previous structure.
+                    for(std::vector<int>::const_iterator j= v2.begin();j!=v2.end();j++)
+                      level[*j]= -1;
+                    nd_bfs(theGraph,start,inSub,stamp,level,visited,levels);
+                    break;
+                  }
+                start= candidate;
+                visited.swap(v2);
+                levels.swap(l2);
+              }
+            if(int(visited.size())<sz)
+              {
+                // disconnected subgraph: the reached component and
+                // the rest are ordered independently.
+                NDSubgraph rest(sub.first+visited.size());
+                for(std::vector<int>::const_iterator i= S.begin();i!=S.end();i++)
+                  if(level[*i]<0)
+                    rest.vertices.push_back(*i);
+                pending.push_back(rest);
+                pending.push_back(NDSubgraph(sub.first));
+                pending.back().vertices= visited;
+                continue;
+              }
+            const int numLevels= levels.size()-1;
+            if(numLevels<3)
+              isLeaf= true; // no separator available.
+            else
+              {
+                // separator: the lightest level among the ones that
+                // leave at least a quarter of the weight on each side
+                // (the middle one if there is none).
+                long totalWeight= 0;
+                for(std::vector<int>::const_iterator i= S.begin();i!=S.end();i++)
+                  totalWeight+= weights[*i];
+                long before= 0;
+                int sepLevel= -1, midLevel= -1;
+                long sepWeight= 0;
+                for(int k= 0;k<numLevels;k++)
+                  {
+                    long levelWeight= 0;
+                    for(int j= levels[k];j<levels[k+1];j++)
+                      levelWeight+= weights[visited[j]];
+                    const long after= totalWeight-before-levelWeight;
+                    if((midLevel<0) && (2*(before+levelWeight)>=totalWeight))
+                      midLevel= k;
+                    if((k>0) && (k<numLevels-1) && (4*before>=totalWeight) && (4*after>=totalWeight))
+                      if((sepLevel<0) || (levelWeight<sepWeight))
+                        {
+                          sepLevel= k;
+                          sepWeight= levelWeight;
+                        }
+                    before+= levelWeight;
+                  }
+                if(sepLevel<0)
+                  sepLevel= std::max(1,std::min(midLevel,numLevels-2));
+                // part of each vertex: 0 (first part), 1 (second part)
+                // or 2 (separator).
+                for(std::vector<int>::const_iterator i= visited.begin();i!=visited.end();i++)
+                  {
+                    const int l= level[*i];
+                    level[*i]= (l<sepLevel ? 0 : (l>sepLevel ? 1 : 2));
+                  }
+                // move to the parts the vertices of the separator
+                // that are not adjacent to the other part.
+                for(int side= 0;side<2;side++)
+                  for(int j= levels[sepLevel];j<levels[sepLevel+1];j++)
+                    {
+                      const int v= visited[j];
+                      if(level[v]!=2)
+                        continue;
+                      bool adjacentToOther= false;
+                      for(const int *k= theGraph.adjBegin(v);k!=theGraph.adjEnd(v);k++)
+                        if((inSub[*k]==stamp) && (level[*k]==1-side))
+                          { adjacentToOther= true; break; }
+                      if(!adjacentToOther)
+                        level[v]= side;
+                    }
+                NDSubgraph first(sub.first);
+                std::vector<int> separator;
+                std::vector<int> second;
+                for(std::vector<int>::const_iterator i= visited.begin();i!=visited.end();i++)
+                  {
+                    if(level[*i]==0)
+                      first.vertices.push_back(*i);
+                    else if(level[*i]==1)
+                      second.push_back(*i);
+                    else
+                      separator.push_back(*i);
+                  }
+                // the separator is numbered after the two parts.
+                int pos= sub.first+first.vertices.size()+second.size();
+                for(std::vector<int>::const_iterator i= separator.begin();i!=separator.end();i++)
+                  perm[pos++]= *i;
+                pending.push_back(NDSubgraph(sub.first+first.vertices.size()));
+                pending.back().vertices.swap(second);
+                pending.push_back(first);
+              }
+          }
+        if(isLeaf)
+          {
+            // order the subgraph with the minimum degree algorithm.
+            std::vector<int> xadj(sz+1,0), adj, w(sz), localPerm;
+            for(int i= 0;i<sz;i++)
+              local[S[i]]= i;
+            for(int i= 0;i<sz;i++)
+              {
+                const int v= S[i];
+                for(const int *j= theGraph.adjBegin(v);j!=theGraph.adjEnd(v);j++)
+                  if(inSub[*j]==stamp)
+                    adj.push_back(local[*j]);
+                xadj[i+1]= adj.size();
+                w[i]= weights[v];
+              }
+            amd_order(xadj,adj,w,localPerm);
+            for(int i= 0;i<sz;i++)
+              perm[sub.first+i]= S[localPerm[i]];
+          }
+      }
+  }
+
+int XC::NestedDissection::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::NestedDissection::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,64 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissection.h
+
+#ifndef NestedDissection_h
+#define NestedDissection_h
+
+#include "AMD.h"
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Nested dissection numbering of the vertices of a graph.
+//!
+//! The graph is split recursively by vertex separators, which are
+//! numbered after the two parts they separate. The separators are
+//! obtained from the level structure rooted on a pseudo-peripheral
+//! vertex (the middle level, by weight, is taken as separator and the
+//! vertices of the separator that are not adjacent to one of the parts
+//! are moved to it). The subgraphs with less than leafSize vertices
+//! are ordered with the approximate minimum degree algorithm (see AMD).
+//! Unlike the Metis numberer, no external library is needed.
+class NestedDissection: public AMD
+  {
+  private:
+    int leafSize; //!< size of the subgraphs that are not dissected.
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    NestedDissection(int leafSize= 64);
+    GraphNumberer *getCopy(void) const;
+
+    void compute_order(const CSRGraph &, std::vector<int> &) const;
+  public:
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
@@ -63,6 +63,7 @@
 #include <solution/graph/graph/Graph.h>
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include <solution/graph/graph/CSRGraph.h>
 #include <utility/matrix/ID.h>
 
 //! @brief  Constructor.
@@ -474,11 +475,182 @@ const XC::ID &XC::RCM::number(Graph &theGraph, const ID &startVertices)
     return theRefResult;
   }
 
+//! @brief Reverse Cuthill-McKee sweep over the graph in compressed
+//! sparse row format starting from the vertex with index \p start.
+//!
+//! Stores in \p theRefResult the vertex indexes in the order of the
+//! numbering (the level sets are numbered from the end) and in
+//! \p mark the position assigned to each vertex. If the graph is
+//! disconnected the sweep continues with the first vertex not yet
+//! numbered. Returns the sum of the distances between each vertex and
+//! the vertices it adds to the numbering (the avgProfile of
+//! number(Graph &,const ID &)).
+int XC::RCM::sweep(const CSRGraph &theGraph, const int &start, std::vector<int> &mark)
+  {
+    const int numVertex= getNumVertex();
+    mark.assign(numVertex,-1);
+    int currentMark= numVertex-1;  // marks current vertex visiting.
+    int nextMark= currentMark -1;  // where to put next vertex.
+    theRefResult(currentMark)= start;
+    mark[start]= currentMark;
+    int avgProfile= 0;
+    int cursor= 0; // first vertex that can be not numbered yet.
+    while(nextMark >= 0)
+      {
+        const int v= theRefResult(currentMark);
+        for(const int *j= theGraph.adjBegin(v);j!=theGraph.adjEnd(v);j++)
+          if(mark[*j] == -1)
+            {
+              mark[*j]= nextMark;
+              avgProfile+= (currentMark-nextMark);
+              theRefResult(nextMark--)= *j;
+            }
+        // we decrement because we are doing reverse Cuthill-McKee
+        currentMark--;
+        // check to see if graph is disconnected
+        if((currentMark == nextMark) && (currentMark >= 0))
+          {
+            while(mark[cursor] != -1)
+              cursor++;
+            nextMark--;
+            mark[cursor]= currentMark;
+            theRefResult(currentMark)= cursor;
+          }
+      }
+    return avgProfile;
+  }
 
+//! @brief Method to perform the Reverse Cuthill-McKee numbering scheme
+//! on a graph in compressed sparse row format.
+//!
+//! Same algorithm (and same numbering) than number(Graph &,int), but
+//! working with the vertex indexes of \p theGraph instead of looking
+//! up the Vertex objects. The result contains the vertex tags. The
+//! \p tmp values of the vertices are not modified (there are not
+//! Vertex objects).
+const XC::ID &XC::RCM::number(const CSRGraph &theGraph, int startVertexTag)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
 
+    const int numVertex= getNumVertex();
+    int start= -1;
+    if(startVertexTag != -1)
+      {
+        start= theGraph.getIndex(startVertexTag);
+        if(start < 0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; WARNING: no vertex with tag "
+                    << startVertexTag
+                    << " exists - using first come from iter\n";
+      }
 
+    std::vector<int> mark(numVertex,-1);
+    if(start < 0)
+      {
+        int v= 0; // first vertex.
+        // if GPS true use gibbs-poole-stodlmyer determine the last 
+        // level set assuming a starting vertex and then use one of the 
+        // nodes in this set to base the numbering on        
+        if(GPS)
+          {
+            int currentMark= numVertex-1;  // marks current vertex visiting.
+            int nextMark= currentMark -1;  // marks where to put next vertex
+            int startLastLevelSet= nextMark;
+            theRefResult(currentMark)= v;
+            mark[v]= currentMark;
+            int cursor= 0;
+            while(nextMark >= 0)
+              {
+                v= theRefResult(currentMark);
+                for(const int *j= theGraph.adjBegin(v);j!=theGraph.adjEnd(v);j++)
+                  {
+                    v= *j;
+                    if(mark[v] == -1)
+                      {
+                        mark[v]= nextMark;
+                        theRefResult(nextMark--)= v;
+                      }
+                  }
+                currentMark--;
+                if(startLastLevelSet == currentMark)
+                  startLastLevelSet= nextMark;
+                // check to see if graph is disconneted
+                if((currentMark == nextMark) && (currentMark >= 0))
+                  {
+                    while(mark[cursor] != -1)
+                      cursor++;
+                    v= cursor;
+                    nextMark--;
+                    startLastLevelSet= nextMark;
+                    mark[v]= currentMark;
+                    theRefResult(currentMark)= v;
+                  }
+              }
+            // create an id of the last level set
+            if(startLastLevelSet > 0)
+              {
+                ID lastLevelSet(startLastLevelSet);
+                for(int i=0; i<startLastLevelSet; i++)
+                  lastLevelSet(i)= theGraph.getTag(theRefResult(i)); 
+                return this->number(theGraph,lastLevelSet);
+              }
+          }
+        start= v;
+      }
+    sweep(theGraph,start,mark);
+    
+    // now set the vertex tags instead of the vertex indexes.
+    for(int i=0; i<numVertex; i++)
+      theRefResult(i)= theGraph.getTag(theRefResult(i));
+    return theRefResult;
+  }
 
+//! @brief Determine the best starting vertex on a graph in compressed
+//! sparse row format.
+//!
+//! Same algorithm (and same numbering) than number(Graph &,const ID &):
+//! the vertex of \p startVertices that gives the smallest profile
+//! is chosen as the starting vertex.
+const XC::ID &XC::RCM::number(const CSRGraph &theGraph, const ID &startVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
 
+    const int numVertex= getNumVertex();
+    std::vector<int> mark(numVertex,-1);
+    int minStart= -1;
+    int minAvgProfile= 0;
+    int lastStart= -1;
+    const int startVerticesSize= startVertices.Size();
+    for(int i=0; i<startVerticesSize; i++)
+      {
+        const int start= theGraph.getIndex(startVertices(i));
+        if(start < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: no vertex with tag "
+                      << startVertices(i) << " exists.\n";
+            continue;
+          }
+        const int avgProfile= sweep(theGraph,start,mark);
+        lastStart= start;
+        if((minStart<0) || (minAvgProfile > avgProfile))
+          {
+            minStart= start;
+            minAvgProfile= avgProfile;
+          }
+      }
+    if(minStart<0) // no valid starting vertex.
+      return this->number(theGraph,-1);
+    // we number based on minStart
+    if(minStart != lastStart)
+      sweep(theGraph,minStart,mark);
 
-
-
+    // now set the vertex tags instead of the vertex indexes.
+    for(int j=0; j<numVertex; j++)
+      theRefResult(j)= theGraph.getTag(theRefResult(j));
+    return theRefResult;
+  }
@@ -67,6 +67,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include <solution/graph/graph/CSRGraph.h>
 
 /* stuff needed to get the program working on the clump & NOW machines*/
 
@@ -517,6 +518,72 @@ const XC::ID &XC::Metis::number(Graph &theGraph, int lastVertex)
 const XC::ID &XC::Metis::number(Graph &theGraph, const ID &lastVertices)
   { return this->number(theGraph); }
 
+//! @brief Numbers the vertices of a graph in compressed sparse row
+//! format.
+//!
+//! The row pointers and the adjacency of \p theGraph are the
+//! \p xadj and \p adjncy arrays required by METIS, so they are passed
+//! (copied, because the METIS interface takes non-const pointers)
+//! without looking up any Vertex object. The vertices of partition i
+//! are numbered before the vertices of partition i+1. The returned ID
+//! contains the vertex tags (the tags of the DOF groups when numbering
+//! the DOF group graph), as expected by DOF_Numberer.
+const XC::ID &XC::Metis::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    int numVertex= theGraph.getNumVertex();
+    theRefResult.resize(numVertex);
+
+    if(checkOptions() == false)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "ERROR: check options failed\n";
+        return theRefResult;
+      }
+    if(numVertex==0)
+      return theRefResult;
+
+    std::vector<int> options(5,0);
+    std::vector<int> partition(numVertex+1,0);    
+    std::vector<int> xadj(theGraph.getRowStarts());
+    std::vector<int> adjncy(theGraph.getAdjacency());
+    if(adjncy.empty())
+      adjncy.push_back(0); // avoid passing a null pointer.
+    int *vwgts= nullptr;
+    int *ewgts= nullptr;
+    int numbering= 0; // C numbering (indexes start at 0).
+    int weightflag= 0; // no weights on our graphs yet
+    int edgecut;
+
+    if(defaultOptions == true) 
+      options[0]= 0;
+    else
+      {
+	options[0]= 1;
+	options[1]= myCoarsenTo;
+	options[2]= myMtype;
+	options[3]= myIPtype;
+	options[4]= myRtype;
+      }
+    
+    if(myPtype == 1) 
+      METIS_PartGraphRecursive(&numVertex, &xadj[0], &adjncy[0], vwgts, ewgts, &weightflag,&numbering, &numPartitions, &options[0], &edgecut, &partition[0]);
+    else		
+      METIS_PartGraphKway(&numVertex, &xadj[0], &adjncy[0], vwgts, ewgts, &weightflag, 
+	     &numbering, &numPartitions, &options[0], &edgecut, &partition[0]);
+
+    // each vertex in partion i is assigned a number less than
+    // those in partion i+1.
+    int count= 0;
+    for(int i=0; i<numPartitions; i++)
+      for(int vert=0; vert<numVertex; vert++)
+	if(partition[vert] == i)
+	  theRefResult(count++)= theGraph.getTag(vert);
+    return theRefResult;
+  }
+
+const XC::ID &XC::Metis::number(const CSRGraph &theGraph, const ID &lastVertices)
+  { return this->number(theGraph); }
+
 int XC::Metis::sendSelf(CommParameters &cp)
   { return 0; }
 
@@ -200,6 +200,8 @@ class Metis : public GraphPartitioner, public GraphNumberer
     // the follwing methods are if the object is to be used as a numberer
     const ID &number(Graph &theGraph, int lastVertex = -1);
     const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
 
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
@@ -63,6 +63,7 @@
 #include <solution/analysis/model/AnalysisModel.h>
 #include "solution/AnalysisAggregation.h"
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 
 //! @brief Constructor. The integer \p classTag is provided to
 //! the constructor for the base class MovableObject.
@@ -106,3 +107,12 @@ int XC::SystemOfEqn::checkSize(Graph &theGraph) const
     return retval;
   }
 
+//! @brief Check number of DOFs in the graph.
+int XC::SystemOfEqn::checkSize(const CSRGraph &theGraph) const
+  {
+    const int retval= theGraph.getNumVertex();
+    if(retval==0)
+      std::cerr << "WARNING! " << getClassName() << "::" << __FUNCTION__
+	        << "; model has zero DOFs, add nodes or reduce constraints." << std::endl;
+    return retval;
+  }
@@ -70,6 +70,7 @@
 
 namespace XC {
 class Graph;
+class CSRGraph;
 class AnalysisModel;
 class FEM_ObjectBroker;
 class AnalysisAggregation;
@@ -101,6 +102,7 @@ class SystemOfEqn: public MovableObject, public CommandEntity
   public:
     inline virtual ~SystemOfEqn(void) {}
     int checkSize(Graph &theGraph) const;
+    int checkSize(const CSRGraph &theGraph) const;
     //! @brief Invoked to cause the system of equation object to solve
     //! itself. To return 0 if successful, negative number if not.
     virtual int solve(void)= 0;
@@ -43,6 +43,10 @@ class FactoredSOEBase: public LinearSOEData
     bool factored; //!< True if the system is factored.
 
     FactoredSOEBase(AnalysisAggregation *,int classTag,int N= 0);
+  public:
+    //! @brief Return true if the matrix is already factored.
+    virtual bool isFactored(void) const
+      { return factored; }
   };
 } // end of XC namespace
 
@@ -67,7 +67,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
-//#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/DomainSolver.h>
 
@@ -84,7 +84,7 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
@@ -95,8 +95,14 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SupernodalLDLSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/PCGSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/MINRESSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/GMRESSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
 
@@ -105,7 +111,8 @@
 //! @param owr: analysis aggregation that owns this object.
 //! @param classTag: identifier of the class.
 XC::LinearSOE::LinearSOE(AnalysisAggregation *owr,int classTag)
-  :SystemOfEqn(owr,classTag), theSolver(nullptr) {}
+  :SystemOfEqn(owr,classTag), theSolver(nullptr),
+   numSolves(0), numFactorizations(0) {}
 
 //! @brief Frees memory.
 void XC::LinearSOE::free_memory(void)
@@ -168,8 +175,8 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new BandGenLinLapackSolver());
     else if(type=="band_spd_lin_lapack_solver")
       setSolver(new BandSPDLinLapackSolver());
-//     else if(type=="band_spd_lin_thread_solver")
-//       setSolver(new BandSPDLinThreadSolver());
+    else if(type=="band_spd_lin_thread_solver")
+      setSolver(new BandSPDLinThreadSolver());
 //     else if(type=="conjugate_gradient_solver")
 //       setSolver(new ConjugateGradientSolver());
     else if(type=="diagonal_direct_solver")
@@ -186,14 +193,22 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new ProfileSPDLinDirectBlockSolver());
     else if(type=="profile_spd_lin_direct_skypack_solver")
      setSolver(new ProfileSPDLinDirectSkypackSolver());
-//     else if(type=="profile_spd_lin_direct_thread_solver")
-//       setSolver(new ProfileSPDLinDirectThreadSolver());
+    else if(type=="profile_spd_lin_direct_thread_solver")
+      setSolver(new ProfileSPDLinDirectThreadSolver());
 //     else if(type=="profile_spd_lin_substr_solver")
 //       setSolver(new ProfileSPDLinSubstrSolver());
     else if(type=="super_lu_solver")
       setSolver(new SuperLU());
     else if(type=="sym_sparse_lin_solver")
       setSolver(new SymSparseLinSolver());
+    else if(type=="supernodal_ldl_solver")
+      setSolver(new SupernodalLDLSolver());
+    else if(type=="pcg_solver")
+      setSolver(new PCGSolver());
+    else if(type=="minres_solver")
+      setSolver(new MINRESSolver());
+    else if(type=="gmres_solver")
+      setSolver(new GMRESSolver());
 //     else if(type=="umfpack_gen_lin_solver")
 //       setSolver(new UmfpackGenLinSolver());
     else
@@ -213,9 +228,70 @@ XC::LinearSOE::~LinearSOE(void)
 //! associated solver object. Returns a $0$ if successful,
 //! negative number if not; the actual value depending on the
 //! LinearSOESolver. To solve a linear system of equations means to find
-//! $x$ such that the equation $Ax=b$ is satisfied. 
+//! $x$ such that the equation $Ax=b$ is satisfied. Updates the
+//! solution counters (see getNumSolves and getNumFactorizations).
 int XC::LinearSOE::solve(void)
-  { return (getSolver()->solve()); }
+  {
+    const bool alreadyFactored= isFactored();
+    const int retval= getSolver()->solve();
+    numSolves++;
+    if(!alreadyFactored && (retval>=0))
+      numFactorizations++;
+    return retval;
+  }
+
+//! @brief Sets to zero the solution counters.
+void XC::LinearSOE::resetCounters(void)
+  {
+    numSolves= 0;
+    numFactorizations= 0;
+  }
+
+//! @brief Computes the solution of the system for each of the
+//! right hand sides being passed as parameter.
+//!
+//! The matrix $A$ is factored (if needed) only once: the solvers
+//! that keep the factorization (see FactoredSOEBase::factored) reuse
+//! it for all the right hand sides, so only the forward and backward
+//! substitutions are repeated for each of them. The vector $b$ of the
+//! system is overwritten. Returns $0$ if successful, otherwise the
+//! value returned by the solver for the first failed right hand side.
+//!
+//! @param rhs: right hand sides.
+//! @param x: solution for each of the right hand sides.
+int XC::LinearSOE::solveMultipleRHS(const std::vector<Vector> &rhs,std::vector<Vector> &x)
+  {
+    int retval= 0;
+    const size_t numRHS= rhs.size();
+    x.resize(numRHS);
+    for(size_t i= 0;i<numRHS;i++)
+      {
+        setB(rhs[i]);
+        retval= solve();
+        if(retval<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; solver failed for the right hand side: "
+		      << i << std::endl;
+            break;
+          }
+        x[i]= getX();
+      }
+    return retval;
+  }
+
+//! @brief Determines and sets the size of the system from a graph in
+//! compressed sparse row format.
+//!
+//! This default implementation builds an equivalent Graph object and
+//! calls setSize(Graph &). The systems that can read their sparsity
+//! directly from the compressed format override it.
+int XC::LinearSOE::setSize(const CSRGraph &theGraph)
+  {
+    Graph tmp(theGraph.getNumVertex()+1);
+    theGraph.fill(tmp);
+    return this->setSize(tmp);
+  }
 
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
@@ -62,6 +62,7 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <solution/system_of_eqn/SystemOfEqn.h>
+#include <vector>
 
 namespace XC {
 class LinearSOESolver;
@@ -92,6 +93,8 @@ class LinearSOE : public SystemOfEqn
   {
   private:
     LinearSOESolver *theSolver;
+    size_t numSolves; //!< Number of calls to solve.
+    size_t numFactorizations; //!< Number of solutions that factored the matrix.
     void free_memory(void);
     void copy(const LinearSOESolver *);
   protected:
@@ -104,6 +107,18 @@ class LinearSOE : public SystemOfEqn
     virtual ~LinearSOE(void);
 
     virtual int solve(void);    
+    //! @brief Return true if the matrix $A$ is already factored
+    //! (the next solution will reuse the factorization).
+    virtual bool isFactored(void) const
+      { return false; }
+    //! @brief Return the number of calls to solve.
+    inline size_t getNumSolves(void) const
+      { return numSolves; }
+    //! @brief Return the number of solutions that needed to factor $A$.
+    inline size_t getNumFactorizations(void) const
+      { return numFactorizations; }
+    void resetCounters(void);
+    virtual int solveMultipleRHS(const std::vector<Vector> &,std::vector<Vector> &);
 
     //! @brief Determines and sets the size of the system.
     //!
@@ -113,6 +128,7 @@ class LinearSOE : public SystemOfEqn
     //! the connectivity between the vertices in the Graph object \p theGraph.
     //! To return $0$ if sucessfull, a negative number if not.
     virtual int setSize(Graph &theGraph) =0;
+    virtual int setSize(const CSRGraph &theGraph);
     //! @brief Returns the number of equations in the system.
     virtual int getNumEqn(void) const =0;
     
@@ -59,6 +59,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -147,6 +148,11 @@ bool XC::BandGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! has increased, new Vector objects for \f$x\f$ and \f$b\f$ using the {\em (do//! uble*,int)} Vector constructor are created. Finally, the result of
 //! invoking setSize() on the associated Solver object is returned.
 int XC::BandGenLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+int XC::BandGenLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
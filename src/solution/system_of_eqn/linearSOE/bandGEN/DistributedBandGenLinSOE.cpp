@@ -75,6 +75,12 @@ void XC::DistributedBandGenLinSOE::calcBand(Graph &theGraph)
     theGraph.getBand(numSubD,numSuperD);
   }
 
+//! @brief Set the size of the system from the compressed graph. The
+//! distributed system exchanges Graph objects between processes so the
+//! call is routed to setSize(Graph &).
+int XC::DistributedBandGenLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedBandGenLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
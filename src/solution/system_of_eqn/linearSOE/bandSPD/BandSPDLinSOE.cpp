@@ -63,6 +63,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -162,6 +163,11 @@ bool XC::BandSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! invoking setSize() on the associated Solver object is
 //! returned. 
 int XC::BandSPDLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+int XC::BandSPDLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -53,281 +53,238 @@
 //
 // Written: fmk 
 // Created: Mar, 1998
-// Revision: A
-//
 // Description: This file contains the class definition for 
-// BandSPDLinThreadSolver. It solves the XC::BandSPDLinSOE object by calling
-// Thread routines.
+// BandSPDLinThreadSolver. It solves the XC::BandSPDLinSOE object
+// in parallel using threads.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
-#include <glibmm/thread.h>
-#include <mysql/my_pthread.h>
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int n, kd;
-  int blockSize, currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_BandSPDLinThreadSolver;
-
-
-XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver()
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(1), 
- running(false), blockSize(1)
-{
-  
-}
-
-XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(int numProcessors, int blckSize)
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(numProcessors),
- running(false), blockSize(blckSize)
-{
-
-}
-
-extern "C" int dpbsv_(char *UPLO, int *N, int *KD, int *NRHS, 
-		      double *A, int *LDA, double *B, int *LDB, 
-		      int *INFO);
-
-extern "C" int dpbtrf_(char *UPLO, int *N, int *KD, double *A, 
-		       int *LDA, int *INFO);
-
-extern "C" int dpbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
-		       double *A, int *LDA, double *B, int *LDB, 
-		       int *INFO);
-		       
-
-void *BandSPDLinThreadSolver_Worker(void *arg);
+#include "utility/parallel/ThreadPool.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Default constructor (as many threads as the hardware supports).
+XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(void)
+  :BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver),
+   NP(ThreadPool::getDefaultNumThreads()), blockSize(64) {}
+
+//! @brief Constructor.
+//!
+//! @param numThreads: number of threads to use.
+//! @param blckSize: number of columns of each block.
+XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(int numThreads, int blckSize)
+  :BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(1), blockSize(64)
+  {
+    setNumThreads(numThreads);
+    setBlockSize(blckSize);
+  }
 
+//! @brief Set the number of threads (0: as many as the hardware supports).
+void XC::BandSPDLinThreadSolver::setNumThreads(const size_t &n)
+  {
+    if(n>0)
+      NP= n;
+    else
+      NP= ThreadPool::getDefaultNumThreads();
+  }
+
+//! @brief Set the number of columns of each block.
+void XC::BandSPDLinThreadSolver::setBlockSize(const int &sz)
+  { blockSize= std::max(sz,1); }
+
+//! @brief Factors the matrix (\f$A=U^tU\f$) in place.
+//!
+//! Column \f$j\f$ of the band is stored in \f$A\f$ from position
+//! \f$j\cdot(kd+1)\f$ (rows \f$j-kd\f$ to \f$j\f$), so the coefficient
+//! \f$u_{ij}\f$ is stored in \f$A[kd+i-j+j\cdot(kd+1)]\f$.
+int XC::BandSPDLinThreadSolver::factor(void)
+  {
+    const int n= theSOE->size;
+    const int kd= theSOE->half_band-1;
+    const int ldA= kd+1;
+    double *A= theSOE->A.getDataPtr();
+    // pointer to the column j shifted so that col(j)[i] is u_ij.
+    auto col= [&](const int &j) { return A+size_t(j)*ldA+kd-j; };
+    ThreadPool &pool= ThreadPool::getThreadPool();
+
+    for(int c0= 0;c0<n;c0+= blockSize)
+      {
+        const int c1= std::min(c0+blockSize,n)-1; // last column of the block.
+        // factor the diagonal block.
+        for(int j= c0;j<=c1;j++)
+          {
+            double *uj= col(j);
+            const int top= std::max(c0,j-kd);
+            for(int i= top;i<j;i++)
+              {
+                const double *ui= col(i);
+                double tmp= uj[i];
+                for(int m= top;m<i;m++)
+                  tmp-= ui[m]*uj[m];
+                uj[i]= tmp/ui[i];
+              }
+            double ujj= uj[j];
+            for(int m= top;m<j;m++)
+              ujj-= uj[m]*uj[m];
+            if(ujj<=0.0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; WARNING - the matrix is not positive"
+                          << " definite (i, aii): (" << j << ", "
+                          << ujj << ")." << std::endl;
+                return -(j+1);
+              }
+            uj[j]= sqrt(ujj);
+          }
+        const int lastCol= std::min(c1+kd,n-1); // last column affected by the block.
+        if(lastCol<=c1)
+          continue;
+        // rows of the block in the columns to the right.
+        pool.parallel_for(c1+1,lastCol+1,[&](const size_t &ic, const size_t &)
+          {
+            const int c= ic;
+            double *uc= col(c);
+            const int top= std::max(c0,c-kd);
+            for(int i= top;i<=c1;i++)
+              {
+                const double *ui= col(i);
+                double tmp= uc[i];
+                for(int m= top;m<i;m++)
+                  tmp-= ui[m]*uc[m];
+                uc[i]= tmp/ui[i];
+              }
+          },NP);
+        // update of the trailing matrix.
+        pool.parallel_for(c1+1,lastCol+1,[&](const size_t &ic, const size_t &)
+          {
+            const int c= ic;
+            double *uc= col(c);
+            const int top= std::max(c0,c-kd);
+            for(int r= std::max(c1+1,c-kd);r<=int(c);r++)
+              {
+                const double *ur= col(r);
+                double tmp= 0.0;
+                for(int m= top;m<=c1;m++)
+                  tmp+= ur[m]*uc[m];
+                uc[r]-= tmp;
+              }
+          },NP);
+      }
+    return 0;
+  }
 
+//! @brief Solves \f$U^tUx=b\f$ overwriting \p x (that contains \f$b\f$
+//! on entry) with the solution.
+void XC::BandSPDLinThreadSolver::substitute(double *x) const
+  {
+    const int n= theSOE->size;
+    const int kd= theSOE->half_band-1;
+    const int ldA= kd+1;
+    const double *A= theSOE->A.getDataPtr();
+    auto col= [&](const int &j) { return A+size_t(j)*ldA+kd-j; };
+    ThreadPool &pool= ThreadPool::getThreadPool();
+
+    // forward substitution (U^t y= b).
+    for(int c0= 0;c0<n;c0+= blockSize)
+      {
+        const int c1= std::min(c0+blockSize,n)-1;
+        for(int j= c0;j<=c1;j++)
+          {
+            const double *uj= col(j);
+            double tmp= x[j];
+            for(int m= std::max(c0,j-kd);m<j;m++)
+              tmp-= uj[m]*x[m];
+            x[j]= tmp/uj[j];
+          }
+        const int lastCol= std::min(c1+kd,n-1);
+        pool.parallel_for(c1+1,lastCol+1,[&](const size_t &ic, const size_t &)
+          {
+            const int c= ic;
+            const double *uc= col(c);
+            double tmp= 0.0;
+            for(int m= std::max(c0,c-kd);m<=c1;m++)
+              tmp+= uc[m]*x[m];
+            x[c]-= tmp;
+          },NP);
+      }
+    // back substitution (U x= y).
+    const int nBlocks= (n+blockSize-1)/blockSize;
+    for(int b= nBlocks-1;b>=0;b--)
+      {
+        const int c0= b*blockSize;
+        const int c1= std::min(c0+blockSize,n)-1;
+        for(int j= c1;j>=c0;j--)
+          {
+            const double *uj= col(j);
+            const double xj= x[j]/uj[j];
+            x[j]= xj;
+            for(int m= std::max(c0,j-kd);m<j;m++)
+              x[m]-= uj[m]*xj;
+          }
+        const int firstRow= std::max(0,c0-kd);
+        pool.parallel_for(firstRow,c0,[&](const size_t &im, const size_t &)
+          {
+            const int m= im;
+            double tmp= 0.0;
+            const int last= std::min(c1,m+kd);
+            for(int j= c0;j<=last;j++)
+              tmp+= col(j)[m]*x[j];
+            x[m]-= tmp;
+          },NP);
+      }
+  }
+
+//! @brief Computes the solution.
+//!
+//! The solver first copies the B vector into X, factors the matrix if
+//! the system is marked as not having been factored and then performs
+//! the forward and back substitutions. The solve process changes
+//! \f$A\f$ and \f$X\f$.
 int XC::BandSPDLinThreadSolver::solve(void)
   {
-    if(theSOE == 0)
+    if(!theSOE)
       {
-	std::cerr << "XC::BandSPDLinThreadSolver::solve(void)- ";
-	std::cerr << " No XC::LinearSOE object has been set\n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
 	return -1;
       }
 
-    int n = theSOE->size;
-    int kd = theSOE->half_band -1;
-    int ldA = kd +1;
-    int nrhs = 1;
-    int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+    double *Xptr= theSOE->getPtrX();
+    const double *Bptr= theSOE->getPtrB();
 
     // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
+    std::copy(Bptr,Bptr+n,Xptr);
 
-    // now solve AX = Y
-    if (theSOE->factored == false) {
-
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_BandSPDLinThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_BandSPDLinThreadSolver.workToDo = 0;
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(nullptr,0, BandSPDLinThreadSolver_Worker, nullptr, 
-		     THR_BOUND|THR_DAEMON, nullptr);
-
-        running = true;
+    if(theSOE->factored == false)
+      {
+        const int info= factor();
+        if(info!=0)
+          return info;
+        theSOE->factored= true;
       }
-      
-  
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-        // assign the global variables the threads will need
-        TCB_BandSPDLinThreadSolver.A = Aptr;
-	TCB_BandSPDLinThreadSolver.X = Xptr;
-	TCB_BandSPDLinThreadSolver.B = Bptr;
-	TCB_BandSPDLinThreadSolver.n = n;
-	TCB_BandSPDLinThreadSolver.kd = kd;
-	TCB_BandSPDLinThreadSolver.info = 0;
-        TCB_BandSPDLinThreadSolver.workToDo = NP;
-        TCB_BandSPDLinThreadSolver.blockSize = blockSize;
-        TCB_BandSPDLinThreadSolver.currentBlock = -1;
-	TCB_BandSPDLinThreadSolver.threadID = 0;
-	TCB_BandSPDLinThreadSolver.numThreads = NP;
-        TCB_BandSPDLinThreadSolver.threadsDone = 0;
-        TCB_BandSPDLinThreadSolver.threadsDoneBlock = NP;
-
-        // wake up the threads
-        cond_broadcast(&TCB_BandSPDLinThreadSolver.start_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-
-         while (TCB_BandSPDLinThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_BandSPDLinThreadSolver.end_cond, &TCB_BandSPDLinThreadSolver.end_mutex);
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    }
-
-    // solve using factored matrix
-    dpbtrs_("U",&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-    
-
-    // check if successfull
-    if (info != 0)
-	return info;
-
-    theSOE->factored = true;
+    substitute(Xptr);
     return 0;
-}
+  }
     
-
-
-int XC::BandSPDLinThreadSolver::setSize()
-{
+int XC::BandSPDLinThreadSolver::setSize(void)
+  {
     // nothing to do    
     return 0;
-}
-
+  }
 
 int XC::BandSPDLinThreadSolver::sendSelf(CommParameters &cp)
-{
+  {
     // nothing to do
     return 0;
-}
+  }
 
 int XC::BandSPDLinThreadSolver::recvSelf(const CommParameters &cp)
-{
+  {
     // nothing to do
     return 0;
-}
-
-// Thread routine called from thr_create() as a Bound Daemon Thread
-void *BandSPDLinThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-        while (TCB_BandSPDLinThreadSolver.workToDo == 0)
-          cond_wait(&TCB_BandSPDLinThreadSolver.start_cond, &TCB_BandSPDLinThreadSolver.start_mutex);
-
-        TCB_BandSPDLinThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_BandSPDLinThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-      // do some initialisation for the factorization
-      int currentBlock =0;
-      int n = TCB_BandSPDLinThreadSolver.n;
-      int kd = TCB_BandSPDLinThreadSolver.kd;
-      int blckSize = TCB_BandSPDLinThreadSolver.blockSize;
-      double *Aptr = TCB_BandSPDLinThreadSolver.A;
-      double *Bptr = TCB_BandSPDLinThreadSolver.B;
-      double *Xptr = TCB_BandSPDLinThreadSolver.X;
-      int numThreads = TCB_BandSPDLinThreadSolver.numThreads;
-    
-      int nBlocks = n/blckSize;
-
-      for (int i=0; i<nBlocks; i++) {
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // wait till last block row is done
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-            while(TCB_BandSPDLinThreadSolver.threadsDoneBlock < numThreads)
-	      cond_wait(&TCB_BandSPDLinThreadSolver.endBlock_cond, &TCB_BandSPDLinThreadSolver.endBlock_mutex);
-
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock = 0;
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);        
-
-          // FACTOR DIAG BLOCK
-       
-          // allow other threads to now proceed
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_BandSPDLinThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);        
-
-          
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                   
-	}
-        else {
-
-          // wait till diag i is done 
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-             while (TCB_BandSPDLinThreadSolver.currentBlock < i)
-                cond_wait(&TCB_BandSPDLinThreadSolver.startBlock_cond, 
-			  &TCB_BandSPDLinThreadSolver.startBlock_mutex); 
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                             
-	}
-      }
-
-      // signal the XC::main thread that this thread is done with the work
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-         TCB_BandSPDLinThreadSolver.threadsDone++;
-
-         cond_signal(&TCB_BandSPDLinThreadSolver.end_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    } 
-  return nullptr;
-}
-
-
-
-
-
-
-
+  }
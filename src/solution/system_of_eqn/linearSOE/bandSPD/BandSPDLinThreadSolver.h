@@ -57,7 +57,7 @@
 //
 // Description: This file contains the class definition for 
 // BandSPDLinThreadSolver. It solves the BandSPDLinSOE in parallel
-// using solaris threads.
+// using threads.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
@@ -69,22 +69,44 @@
 namespace XC {
 //! @ingroup LinearSolver
 //
-//! @brief Solves the BandSPDLinSOE in parallel
-//! using solaris threads.
+//! @brief Solves the BandSPDLinSOE in parallel using threads.
+//!
+//! The matrix is factored (\f$A=U^tU\f$, same storage as the LAPACK
+//! routine dpbtrf) one block of \p blockSize columns at a time: the
+//! diagonal block is factored by the calling thread, while the
+//! computation of the rows of the block in the columns to the right
+//! and the update of the trailing matrix are shared by the threads
+//! column by column. The forward and back substitutions are performed
+//! by blocks too, sharing the update of the remaining right hand side
+//! terms among the threads. The results don't depend on the number of
+//! threads.
 class BandSPDLinThreadSolver : public BandSPDLinSolver
   {
   private:
-    int NP;
-    int running;
-    int blockSize;
+    size_t NP; //!< number of threads.
+    int blockSize; //!< number of columns of each block.
 
+    int factor(void);
+    void substitute(double *) const;
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
     BandSPDLinThreadSolver(void);    
-    BandSPDLinThreadSolver(int numProcessors, int blockSize);        
+    BandSPDLinThreadSolver(int numThreads, int blockSize);        
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     int solve(void);
     int setSize(void);
+
+    //! @brief Return the number of threads.
+    inline size_t getNumThreads(void) const
+      { return NP; }
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of columns of each block.
+    inline int getBlockSize(void) const
+      { return blockSize; }
+    void setBlockSize(const int &);
     
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);  
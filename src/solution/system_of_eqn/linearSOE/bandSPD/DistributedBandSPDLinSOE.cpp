@@ -79,6 +79,12 @@ void XC::DistributedBandSPDLinSOE::calcBand(Graph &theGraph)
     half_band += 1; // include the diagonal
   }
 
+//! @brief Set the size of the system from the compressed graph. The
+//! distributed system exchanges Graph objects between processes so the
+//! call is routed to setSize(Graph &).
+int XC::DistributedBandSPDLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedBandSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
@@ -62,6 +62,7 @@
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
 #include <utility/matrix/Matrix.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -120,6 +121,11 @@ bool XC::FullGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! *,int)} Vector constructor are created. Finally, the result of
 //! invoking setSize() on the associated Solver object is returned.
 int XC::FullGenLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+int XC::FullGenLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -0,0 +1,361 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMGPreconditioner.cc
+
+#include "AMGPreconditioner.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);		       
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, 
+		       int *iPiv, int *INFO);
+
+//! @brief Constructor.
+XC::AMGPreconditioner::AMGPreconditioner(void)
+  : Preconditioner(), strengthThreshold(0.08), maxNumLevels(10),
+    coarseSize(500), numSweeps(1) {}
+
+//! @brief Virtual constructor.
+XC::Preconditioner *XC::AMGPreconditioner::getCopy(void) const
+  { return new AMGPreconditioner(*this); }
+
+//! @brief Return the ratio between the number of coefficients of
+//! all the matrices of the hierarchy and the number of coefficients
+//! of the system matrix.
+double XC::AMGPreconditioner::getOperatorComplexity(void) const
+  {
+    double retval= 0.0;
+    if(!A.empty() && (A[0].getNNZ()>0))
+      {
+        for(std::vector<CSRMatrix>::const_iterator i= A.begin();i!=A.end();i++)
+          retval+= i->getNNZ();
+        retval/= A[0].getNNZ();
+      }
+    return retval;
+  }
+
+//! @brief Group the unknowns into aggregates.
+//!
+//! Three passes over the graph of strong connections: first the
+//! unknowns whose strong neighbours are not aggregated yet form a
+//! new aggregate with them; then the remaining unknowns join the
+//! aggregate of one of their strong neighbours (if any was formed in
+//! the first pass) and finally the rest form aggregates with their
+//! non aggregated strong neighbours. The unknowns without strong
+//! connections are not aggregated (-1). Returns the number of
+//! aggregates.
+int XC::AMGPreconditioner::aggregate(const CSRMatrix &Af,std::vector<int> &agg) const
+  {
+    const int n= Af.getNumRows();
+    const std::vector<int> &rowStart= Af.getRowStarts();
+    const std::vector<int> &cols= Af.getCols();
+    const std::vector<double> &values= Af.getValues();
+    std::vector<double> diag;
+    Af.getDiagonal(diag);
+    // Strong connections.
+    std::vector<int> sStart(n+1,0);
+    std::vector<int> sAdj;
+    const double theta2= strengthThreshold*strengthThreshold;
+    for(int i= 0;i<n;i++)
+      {
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          {
+            const int j= cols[k];
+            const double a= values[k];
+            if((j!=i) && (a*a>=theta2*fabs(diag[i]*diag[j])) && (a!=0.0))
+              sAdj.push_back(j);
+          }
+        sStart[i+1]= sAdj.size();
+      }
+    agg.assign(n,-1);
+    int retval= 0;
+    // First pass.
+    for(int i= 0;i<n;i++)
+      {
+        if((agg[i]>=0) || (sStart[i]==sStart[i+1]))
+          continue;
+        bool free= true;
+        for(int k= sStart[i];k<sStart[i+1];k++)
+          if(agg[sAdj[k]]>=0)
+            {
+              free= false;
+              break;
+            }
+        if(free)
+          {
+            agg[i]= retval;
+            for(int k= sStart[i];k<sStart[i+1];k++)
+              agg[sAdj[k]]= retval;
+            retval++;
+          }
+      }
+    // Second pass.
+    const std::vector<int> firstPass(agg);
+    for(int i= 0;i<n;i++)
+      if(agg[i]<0)
+        for(int k= sStart[i];k<sStart[i+1];k++)
+          if(firstPass[sAdj[k]]>=0)
+            {
+              agg[i]= firstPass[sAdj[k]];
+              break;
+            }
+    // Third pass.
+    for(int i= 0;i<n;i++)
+      if((agg[i]<0) && (sStart[i]<sStart[i+1]))
+        {
+          agg[i]= retval;
+          for(int k= sStart[i];k<sStart[i+1];k++)
+            if(agg[sAdj[k]]<0)
+              agg[sAdj[k]]= retval;
+          retval++;
+        }
+    return retval;
+  }
+
+//! @brief Return the smoothed prolongator from the aggregates.
+//!
+//! @param Af: matrix of the fine level.
+//! @param agg: aggregate of each unknown.
+//! @param numAgg: number of aggregates.
+XC::CSRMatrix XC::AMGPreconditioner::getProlongator(const CSRMatrix &Af,const std::vector<int> &agg,const int &numAgg) const
+  {
+    const int n= Af.getNumRows();
+    // Tentative prolongator (normalized columns).
+    std::vector<int> aggSize(numAgg,0);
+    for(int i= 0;i<n;i++)
+      if(agg[i]>=0)
+        aggSize[agg[i]]++;
+    std::vector<int> pStart(n+1,0);
+    std::vector<int> pCols;
+    std::vector<double> pValues;
+    for(int i= 0;i<n;i++)
+      {
+        if(agg[i]>=0)
+          {
+            pCols.push_back(agg[i]);
+            pValues.push_back(1.0/sqrt(double(aggSize[agg[i]])));
+          }
+        pStart[i+1]= pCols.size();
+      }
+    const CSRMatrix P0(n,numAgg,pStart,pCols,pValues);
+
+    // Spectral radius of D^{-1}A (power iteration).
+    std::vector<double> invDiag;
+    Af.getDiagonal(invDiag);
+    for(int i= 0;i<n;i++)
+      invDiag[i]= (invDiag[i]!=0.0 ? 1.0/invDiag[i] : 0.0);
+    std::vector<double> v(n), w(n);
+    for(int i= 0;i<n;i++)
+      v[i]= 1.0+double(i%7)/7.0;
+    double rho= 0.0;
+    const int numPowerIter= 20;
+    for(int k= 0;k<numPowerIter;k++)
+      {
+        double vNorm= 0.0;
+        for(int i= 0;i<n;i++)
+          vNorm+= v[i]*v[i];
+        vNorm= sqrt(vNorm);
+        if(vNorm==0.0)
+          break;
+        for(int i= 0;i<n;i++)
+          v[i]/= vNorm;
+        Af.product(v.data(),w.data());
+        double wNorm= 0.0;
+        for(int i= 0;i<n;i++)
+          {
+            w[i]*= invDiag[i];
+            wNorm+= w[i]*w[i];
+          }
+        rho= sqrt(wNorm);
+        v.swap(w);
+      }
+    if(rho==0.0)
+      return P0;
+
+    // P= P0 - omega/rho D^{-1} A P0
+    const double omega= 4.0/3.0/rho;
+    CSRMatrix S= Af;
+    std::vector<double> &sValues= S.getValues();
+    const std::vector<int> &sStart= S.getRowStarts();
+    const std::vector<int> &sCols= S.getCols();
+    for(int i= 0;i<n;i++)
+      for(int k= sStart[i];k<sStart[i+1];k++)
+        {
+          sValues[k]*= -omega*invDiag[i];
+          if(sCols[k]==i)
+            sValues[k]+= 1.0;
+        }
+    return S*P0;
+  }
+
+//! @brief Compute the LU factorization of the coarsest matrix.
+int XC::AMGPreconditioner::factorCoarsest(void)
+  {
+    const CSRMatrix &Ac= A.back();
+    int n= Ac.getNumRows();
+    coarseLU.assign(n*n,0.0);
+    coarsePivots.assign(n,0);
+    if(n==0)
+      return 0;
+    const std::vector<int> &rowStart= Ac.getRowStarts();
+    const std::vector<int> &cols= Ac.getCols();
+    const std::vector<double> &values= Ac.getValues();
+    for(int i= 0;i<n;i++)
+      for(int k= rowStart[i];k<rowStart[i+1];k++)
+        coarseLU[cols[k]*n+i]= values[k]; // column major.
+    int info= 0;
+    dgetrf_(&n,&n,coarseLU.data(),&n,coarsePivots.data(),&info);
+    if(info!=0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; LU factorization of the coarsest matrix failed"
+                  << " (info= " << info << ")." << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Build the multigrid hierarchy.
+int XC::AMGPreconditioner::setUp(const CSRMatrix &Af)
+  {
+    Preconditioner::setUp(Af);
+    A.clear();
+    P.clear();
+    R.clear();
+    A.push_back(Af);
+    while((A.back().getNumRows()>coarseSize) && (int(A.size())<maxNumLevels))
+      {
+        const CSRMatrix &Ak= A.back();
+        std::vector<int> agg;
+        const int numAgg= aggregate(Ak,agg);
+        if((numAgg==0) || (numAgg>=Ak.getNumRows()))
+          break; // no coarsening.
+        P.push_back(getProlongator(Ak,agg,numAgg));
+        R.push_back(P.back().getTranspose());
+        const CSRMatrix Ac= R.back()*(Ak*P.back());
+        A.push_back(Ac);
+      }
+    const size_t numLevels= A.size();
+    diagPos.resize(numLevels);
+    x.resize(numLevels);
+    b.resize(numLevels);
+    r.resize(numLevels);
+    for(size_t l= 0;l<numLevels;l++)
+      {
+        const int n= A[l].getNumRows();
+        A[l].getDiagonalPositions(diagPos[l]);
+        x[l].assign(n,0.0);
+        b[l].assign(n,0.0);
+        r[l].assign(n,0.0);
+      }
+    return factorCoarsest();
+  }
+
+//! @brief Gauss-Seidel sweeps on the level being passed as parameter.
+//!
+//! @param l: level.
+//! @param forward: if true sweep the rows in ascending order, otherwise
+//!                 in descending order.
+void XC::AMGPreconditioner::smooth(const size_t &l,const bool &forward) const
+  {
+    const CSRMatrix &Al= A[l];
+    const int n= Al.getNumRows();
+    const std::vector<int> &rowStart= Al.getRowStarts();
+    const std::vector<int> &cols= Al.getCols();
+    const std::vector<double> &values= Al.getValues();
+    const std::vector<int> &dp= diagPos[l];
+    std::vector<double> &xl= x[l];
+    const std::vector<double> &bl= b[l];
+    for(int sweep= 0;sweep<numSweeps;sweep++)
+      for(int ii= 0;ii<n;ii++)
+        {
+          const int i= (forward ? ii : n-1-ii);
+          if(dp[i]<0)
+            continue;
+          double s= bl[i];
+          for(int k= rowStart[i];k<rowStart[i+1];k++)
+            s-= values[k]*xl[cols[k]];
+          xl[i]+= s/values[dp[i]];
+        }
+  }
+
+//! @brief Solve approximately the system of the level being passed as
+//! parameter (right hand side in b[l], solution in x[l]).
+void XC::AMGPreconditioner::vcycle(const size_t &l) const
+  {
+    std::vector<double> &xl= x[l];
+    if(l+1==A.size()) // coarsest level.
+      {
+        xl= b[l];
+        int n= xl.size();
+        if(n>0)
+          {
+            int nrhs= 1;
+            int info= 0;
+            char trans[]= "N";
+            dgetrs_(trans,&n,&nrhs,const_cast<double *>(coarseLU.data()),&n,const_cast<int *>(coarsePivots.data()),xl.data(),&n,&info);
+          }
+        return;
+      }
+    std::fill(xl.begin(),xl.end(),0.0);
+    smooth(l,true);
+    // Restrict the residual.
+    std::vector<double> &rl= r[l];
+    A[l].product(xl.data(),rl.data());
+    const int n= rl.size();
+    for(int i= 0;i<n;i++)
+      rl[i]= b[l][i]-rl[i];
+    R[l].product(rl.data(),b[l+1].data());
+    vcycle(l+1);
+    // Interpolate the correction.
+    P[l].product(x[l+1].data(),rl.data());
+    for(int i= 0;i<n;i++)
+      xl[i]+= rl[i];
+    smooth(l,false);
+  }
+
+//! @brief Apply one V-cycle to the system \f$A z= r\f$.
+int XC::AMGPreconditioner::apply(const Vector &rhs,Vector &z) const
+  {
+    if(A.empty())
+      {
+        z= rhs;
+        return 0;
+      }
+    const double *pr= rhs.getDataPtr();
+    b[0].assign(pr,pr+size);
+    vcycle(0);
+    if(z.Size()!=size)
+      z.resize(size);
+    double *pz= z.getDataPtr();
+    std::copy(x[0].begin(),x[0].end(),pz);
+    return 0;
+  }
@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AMGPreconditioner.h
+
+#ifndef AMGPreconditioner_h
+#define AMGPreconditioner_h
+
+#include "Preconditioner.h"
+#include "CSRMatrix.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Smoothed aggregation algebraic multigrid preconditioner.
+//!
+//! The unknowns of each level are grouped into aggregates using the
+//! graph of the strong connections of the matrix
+//! (\f$|a_{ij}| \geq \theta \sqrt{|a_{ii} a_{jj}|}\f$). The tentative
+//! prolongator interpolates a constant on each aggregate; it's
+//! smoothed with a damped Jacobi iteration
+//! (\f$P= (I-\frac{4}{3\rho} D^{-1} A) P_0\f$) and the matrix of the
+//! next level is the Galerkin product \f$P^T A P\f$. The coarsening
+//! stops when the order of the matrix is not greater than
+//! coarseSize (or the maximum number of levels is reached), the
+//! coarsest system is solved with a dense LU factorization.
+//!
+//! The preconditioner applies one V-cycle with symmetric Gauss-Seidel
+//! smoothing (forward sweeps before the coarse grid correction and
+//! backward sweeps after it), so it's symmetric and can be used
+//! with the PCG and MINRES solvers.
+class AMGPreconditioner: public Preconditioner
+  {
+  private:
+    double strengthThreshold; //!< threshold of the strong connections.
+    int maxNumLevels; //!< maximum number of levels.
+    int coarseSize; //!< maximum order of the coarsest matrix.
+    int numSweeps; //!< number of smoothing sweeps.
+    std::vector<CSRMatrix> A; //!< matrix of each level.
+    std::vector<CSRMatrix> P; //!< prolongator from each level to the previous one.
+    std::vector<CSRMatrix> R; //!< restrictor from each level to the next one.
+    std::vector<std::vector<int> > diagPos; //!< position of the diagonal coefficients of each matrix.
+    std::vector<double> coarseLU; //!< LU factorization of the coarsest matrix.
+    std::vector<int> coarsePivots; //!< pivots of the LU factorization.
+    mutable std::vector<std::vector<double> > x; //!< solution on each level.
+    mutable std::vector<std::vector<double> > b; //!< right hand side on each level.
+    mutable std::vector<std::vector<double> > r; //!< residual on each level.
+
+    int aggregate(const CSRMatrix &,std::vector<int> &) const;
+    CSRMatrix getProlongator(const CSRMatrix &,const std::vector<int> &,const int &) const;
+    int factorCoarsest(void);
+    void smooth(const size_t &,const bool &) const;
+    void vcycle(const size_t &) const;
+  public:
+    AMGPreconditioner(void);
+    virtual Preconditioner *getCopy(void) const;
+    //! @brief Return the name of the class.
+    virtual std::string getClassName(void) const
+      { return "AMGPreconditioner"; }
+
+    //! @brief Return the threshold of the strong connections.
+    inline double getStrengthThreshold(void) const
+      { return strengthThreshold; }
+    //! @brief Set the threshold of the strong connections.
+    inline void setStrengthThreshold(const double &d)
+      { strengthThreshold= d; }
+    //! @brief Return the maximum number of levels.
+    inline int getMaxNumLevels(void) const
+      { return maxNumLevels; }
+    //! @brief Set the maximum number of levels.
+    inline void setMaxNumLevels(const int &i)
+      { maxNumLevels= i; }
+    //! @brief Return the maximum order of the coarsest matrix.
+    inline int getCoarseSize(void) const
+      { return coarseSize; }
+    //! @brief Set the maximum order of the coarsest matrix.
+    inline void setCoarseSize(const int &i)
+      { coarseSize= i; }
+    //! @brief Return the number of smoothing sweeps.
+    inline int getNumSweeps(void) const
+      { return numSweeps; }
+    //! @brief Set the number of smoothing sweeps.
+    inline void setNumSweeps(const int &i)
+      { numSweeps= i; }
+    //! @brief Return the number of levels of the hierarchy.
+    inline int getNumLevels(void) const
+      { return A.size(); }
+    double getOperatorComplexity(void) const;
+
+    virtual int setUp(const CSRMatrix &);
+    virtual int apply(const Vector &,Vector &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,236 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRMatrix.cc
+
+#include "CSRMatrix.h"
+#include <algorithm>
+#include <utility>
+
+//! @brief Constructor (matrix without coefficients).
+//!
+//! @param nRows: number of rows.
+//! @param nCols: number of columns.
+XC::CSRMatrix::CSRMatrix(const int &nRows,const int &nCols)
+  :numRows(nRows), numCols(nCols), rowStart(nRows+1,0) {}
+
+//! @brief Constructor.
+//!
+//! @param nRows: number of rows.
+//! @param nCols: number of columns.
+//! @param start: position of the first coefficient of each row (nRows+1 values).
+//! @param idx: column of each coefficient.
+//! @param val: value of each coefficient.
+XC::CSRMatrix::CSRMatrix(const int &nRows,const int &nCols,const std::vector<int> &start,const std::vector<int> &idx,const std::vector<double> &val)
+  :numRows(nRows), numCols(nCols), rowStart(start), cols(idx), values(val)
+  { sortRows(); }
+
+//! @brief Sort the coefficients of each row by column index.
+void XC::CSRMatrix::sortRows(void)
+  {
+    std::vector<std::pair<int,double> > tmp;
+    for(int i= 0;i<numRows;i++)
+      {
+        const int k0= rowStart[i];
+        const int k1= rowStart[i+1];
+        if(std::is_sorted(cols.begin()+k0,cols.begin()+k1))
+          continue;
+        tmp.clear();
+        for(int k= k0;k<k1;k++)
+          tmp.push_back(std::make_pair(cols[k],values[k]));
+        std::sort(tmp.begin(),tmp.end());
+        for(int k= k0;k<k1;k++)
+          {
+            cols[k]= tmp[k-k0].first;
+            values[k]= tmp[k-k0].second;
+          }
+      }
+  }
+
+//! @brief Copy a square matrix stored in compressed sparse row format.
+//!
+//! @param n: order of the matrix.
+//! @param start: position of the first coefficient of each row (n+1 values).
+//! @param idx: column of each coefficient.
+//! @param val: value of each coefficient.
+void XC::CSRMatrix::setFromRows(const int &n,const int *start,const int *idx,const double *val)
+  {
+    numRows= n;
+    numCols= n;
+    rowStart.assign(start,start+n+1);
+    const int nnz= rowStart[n];
+    cols.assign(idx,idx+nnz);
+    values.assign(val,val+nnz);
+    sortRows();
+  }
+
+//! @brief Expand a symmetric matrix whose lower triangle is stored
+//! in compressed sparse column format (see SymSparseColLinSOE).
+//!
+//! The column \f$j\f$ of the lower triangle gives the coefficients of
+//! the row \f$j\f$ to the right of the diagonal (diagonal included)
+//! and the ones of the column \f$j\f$ below the diagonal.
+//!
+//! @param n: order of the matrix.
+//! @param start: position of the first coefficient of each column (n+1 values).
+//! @param idx: row of each coefficient.
+//! @param val: value of each coefficient.
+void XC::CSRMatrix::setFromSymmetricColumns(const int &n,const int *start,const int *idx,const double *val)
+  {
+    numRows= n;
+    numCols= n;
+    rowStart.assign(n+1,0);
+    for(int j= 0;j<n;j++)
+      for(int k= start[j];k<start[j+1];k++)
+        {
+          rowStart[j+1]++;
+          if(idx[k]!=j)
+            rowStart[idx[k]+1]++;
+        }
+    for(int i= 0;i<n;i++)
+      rowStart[i+1]+= rowStart[i];
+    const int nnz= rowStart[n];
+    cols.resize(nnz);
+    values.resize(nnz);
+    std::vector<int> next(rowStart.begin(),rowStart.end()-1);
+    // Coefficients below the diagonal first (sorted by column)...
+    for(int j= 0;j<n;j++)
+      for(int k= start[j];k<start[j+1];k++)
+        if(idx[k]!=j)
+          {
+            const int pos= next[idx[k]]++;
+            cols[pos]= j;
+            values[pos]= val[k];
+          }
+    // ...then the diagonal and the ones to its right.
+    for(int j= 0;j<n;j++)
+      for(int k= start[j];k<start[j+1];k++)
+        {
+          const int pos= next[j]++;
+          cols[pos]= idx[k];
+          values[pos]= val[k];
+        }
+    sortRows();
+  }
+
+//! @brief Compute the position of the diagonal coefficient of each row
+//! (-1 if it's not stored). Returns the number of rows without
+//! diagonal coefficient.
+int XC::CSRMatrix::getDiagonalPositions(std::vector<int> &diagPos) const
+  {
+    int retval= 0;
+    diagPos.assign(numRows,-1);
+    for(int i= 0;i<numRows;i++)
+      {
+        const std::vector<int>::const_iterator b= cols.begin()+rowStart[i];
+        const std::vector<int>::const_iterator e= cols.begin()+rowStart[i+1];
+        const std::vector<int>::const_iterator it= std::lower_bound(b,e,i);
+        if((it!=e) && (*it==i))
+          diagPos[i]= it-cols.begin();
+        else
+          retval++;
+      }
+    return retval;
+  }
+
+//! @brief Return the diagonal of the matrix.
+void XC::CSRMatrix::getDiagonal(std::vector<double> &diag) const
+  {
+    std::vector<int> diagPos;
+    getDiagonalPositions(diagPos);
+    diag.assign(numRows,0.0);
+    for(int i= 0;i<numRows;i++)
+      if(diagPos[i]>=0)
+        diag[i]= values[diagPos[i]];
+  }
+
+//! @brief Compute the product \f$y= A x\f$.
+void XC::CSRMatrix::product(const double *x,double *y) const
+  {
+    for(int i= 0;i<numRows;i++)
+      {
+        double s= 0.0;
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          s+= values[k]*x[cols[k]];
+        y[i]= s;
+      }
+  }
+
+//! @brief Return the transpose of the matrix.
+XC::CSRMatrix XC::CSRMatrix::getTranspose(void) const
+  {
+    CSRMatrix retval(numCols,numRows);
+    const int nnz= getNNZ();
+    retval.cols.resize(nnz);
+    retval.values.resize(nnz);
+    for(int k= 0;k<nnz;k++)
+      retval.rowStart[cols[k]+1]++;
+    for(int j= 0;j<numCols;j++)
+      retval.rowStart[j+1]+= retval.rowStart[j];
+    std::vector<int> next(retval.rowStart.begin(),retval.rowStart.end()-1);
+    for(int i= 0;i<numRows;i++) // rows in ascending order: sorted result.
+      for(int k= rowStart[i];k<rowStart[i+1];k++)
+        {
+          const int pos= next[cols[k]]++;
+          retval.cols[pos]= i;
+          retval.values[pos]= values[k];
+        }
+    return retval;
+  }
+
+//! @brief Return the product of this matrix by the one being passed
+//! as parameter.
+XC::CSRMatrix XC::CSRMatrix::operator*(const CSRMatrix &other) const
+  {
+    CSRMatrix retval(numRows,other.numCols);
+    std::vector<int> pos(other.numCols,-1); // position of each column in the current row.
+    for(int i= 0;i<numRows;i++)
+      {
+        const int rowBegin= retval.cols.size();
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          {
+            const int j= cols[k];
+            const double a= values[k];
+            for(int m= other.rowStart[j];m<other.rowStart[j+1];m++)
+              {
+                const int c= other.cols[m];
+                if(pos[c]<0)
+                  {
+                    pos[c]= retval.cols.size();
+                    retval.cols.push_back(c);
+                    retval.values.push_back(a*other.values[m]);
+                  }
+                else
+                  retval.values[pos[c]]+= a*other.values[m];
+              }
+          }
+        for(size_t k= rowBegin;k<retval.cols.size();k++)
+          pos[retval.cols[k]]= -1;
+        retval.rowStart[i+1]= retval.cols.size();
+      }
+    retval.sortRows();
+    return retval;
+  }
@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRMatrix.h
+
+#ifndef CSRMatrix_h
+#define CSRMatrix_h
+
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Sparse matrix stored in compressed sparse row format.
+//!
+//! The coefficients of the row \f$i\f$ are stored in the positions
+//! \f$rowStart[i]\f$ through \f$rowStart[i+1]-1\f$ of the arrays
+//! of column indexes and values, sorted by column index. Used by the
+//! preconditioners of the iterative solvers (see KrylovLinSolver) to
+//! store the matrix of the system, its incomplete factors and the
+//! operators of the multigrid hierarchy.
+class CSRMatrix
+  {
+  private:
+    int numRows; //!< number of rows.
+    int numCols; //!< number of columns.
+    std::vector<int> rowStart; //!< position of the first coefficient of each row.
+    std::vector<int> cols; //!< column of each coefficient.
+    std::vector<double> values; //!< value of each coefficient.
+
+    void sortRows(void);
+  public:
+    CSRMatrix(const int &nRows= 0,const int &nCols= 0);
+    CSRMatrix(const int &,const int &,const std::vector<int> &,const std::vector<int> &,const std::vector<double> &);
+    void setFromRows(const int &,const int *,const int *,const double *);
+    void setFromSymmetricColumns(const int &,const int *,const int *,const double *);
+
+    //! @brief Return the number of rows.
+    inline int getNumRows(void) const
+      { return numRows; }
+    //! @brief Return the number of columns.
+    inline int getNumCols(void) const
+      { return numCols; }
+    //! @brief Return the number of stored coefficients.
+    inline int getNNZ(void) const
+      { return cols.size(); }
+    //! @brief Return the positions of the first coefficient of each row.
+    inline const std::vector<int> &getRowStarts(void) const
+      { return rowStart; }
+    //! @brief Return the column indexes of the coefficients.
+    inline const std::vector<int> &getCols(void) const
+      { return cols; }
+    //! @brief Return the values of the coefficients.
+    inline const std::vector<double> &getValues(void) const
+      { return values; }
+    //! @brief Return the values of the coefficients.
+    inline std::vector<double> &getValues(void)
+      { return values; }
+
+    int getDiagonalPositions(std::vector<int> &) const;
+    void getDiagonal(std::vector<double> &) const;
+    void product(const double *,double *) const;
+    CSRMatrix getTranspose(void) const;
+    CSRMatrix operator*(const CSRMatrix &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GMRESSolver.cc
+
+#include "GMRESSolver.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <vector>
+
+//! @brief Constructor.
+XC::GMRESSolver::GMRESSolver(void)
+  :KrylovLinSolver(SOLVER_TAGS_GMRESSolver), restart(50) {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::GMRESSolver::getCopy(void) const
+  { return new GMRESSolver(*this); }
+
+//! @brief Restarted GMRES iterations.
+int XC::GMRESSolver::iterate(const Vector &b,Vector &x)
+  {
+    const double bNorm= b.Norm();
+    const int m= restart;
+    std::vector<Vector> V(m+1,Vector(size));
+    std::vector<double> H((m+1)*m,0.0); // Hessenberg matrix (column major).
+    std::vector<double> cs(m), sn(m), g(m+1), y(m);
+    Vector r(size), z(size), w(size);
+    numIter= 0;
+    while(true)
+      {
+        const double beta= getResidualNorm(b,x,r); // r= b-Ax
+        residualNorm= beta/bNorm;
+        if(residualNorm<=tolerance)
+          return 0;
+        if(numIter>=maxNumIter)
+          return -1;
+        V[0]= r;
+        V[0]*= 1.0/beta;
+        std::fill(g.begin(),g.end(),0.0);
+        g[0]= beta;
+        int k= 0;
+        while((k<m) && (numIter<maxNumIter))
+          {
+            // Arnoldi step.
+            precondition(V[k],z);
+            formAp(z,w);
+            double *hk= H.data()+k*(m+1);
+            for(int i= 0;i<=k;i++)
+              {
+                hk[i]= w^V[i];
+                w.addVector(1.0,V[i],-hk[i]);
+              }
+            const double hNext= w.Norm();
+            hk[k+1]= hNext;
+            // Apply the previous rotations and compute the new one.
+            for(int i= 0;i<k;i++)
+              {
+                const double tmp= cs[i]*hk[i]+sn[i]*hk[i+1];
+                hk[i+1]= -sn[i]*hk[i]+cs[i]*hk[i+1];
+                hk[i]= tmp;
+              }
+            const double d= sqrt(hk[k]*hk[k]+hNext*hNext);
+            if(d==0.0)
+              {
+                cs[k]= 1.0;
+                sn[k]= 0.0;
+              }
+            else
+              {
+                cs[k]= hk[k]/d;
+                sn[k]= hNext/d;
+              }
+            hk[k]= d;
+            hk[k+1]= 0.0;
+            g[k+1]= -sn[k]*g[k];
+            g[k]*= cs[k];
+            numIter++;
+            k++;
+            if((fabs(g[k])/bNorm<=tolerance) || (hNext==0.0))
+              break;
+            V[k]= w;
+            V[k]*= 1.0/hNext;
+          }
+        // Solve the triangular system and update the solution.
+        for(int i= k-1;i>=0;i--)
+          {
+            double s= g[i];
+            for(int j= i+1;j<k;j++)
+              s-= H[j*(m+1)+i]*y[j];
+            y[i]= (H[i*(m+1)+i]!=0.0 ? s/H[i*(m+1)+i] : 0.0);
+          }
+        w.Zero();
+        for(int i= 0;i<k;i++)
+          w.addVector(1.0,V[i],y[i]);
+        precondition(w,z);
+        x.addVector(1.0,z,1.0);
+      }
+    return -1;
+  }
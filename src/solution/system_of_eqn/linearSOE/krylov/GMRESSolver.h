@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GMRESSolver.h
+
+#ifndef GMRESSolver_h
+#define GMRESSolver_h
+
+#include "KrylovLinSolver.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Restarted generalized minimum residual solver.
+//!
+//! For general (nonsymmetric) matrices. Preconditioned from the
+//! right, so it minimizes the norm of the true residual over the
+//! Krylov subspace; the subspace is built with the modified
+//! Gram-Schmidt process and discarded each restart iterations.
+class GMRESSolver: public KrylovLinSolver
+  {
+  private:
+    int restart; //!< iterations between restarts.
+  protected:
+    virtual int iterate(const Vector &,Vector &);
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    GMRESSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    //! @brief Return the number of iterations between restarts.
+    inline int getRestart(void) const
+      { return restart; }
+    //! @brief Set the number of iterations between restarts.
+    inline void setRestart(const int &i)
+      { restart= (i>0 ? i : 1); }
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ILUPreconditioner.cc
+
+#include "ILUPreconditioner.h"
+#include "utility/matrix/Vector.h"
+#include <iostream>
+
+//! @brief Virtual constructor.
+XC::Preconditioner *XC::ILUPreconditioner::getCopy(void) const
+  { return new ILUPreconditioner(*this); }
+
+//! @brief Compute the incomplete factorization of the matrix.
+//!
+//! Row oriented (IKJ) Gaussian elimination restricted to the
+//! sparsity pattern of the matrix. Returns \f$-(i+1)\f$ if the pivot
+//! of the row \f$i\f$ is zero.
+int XC::ILUPreconditioner::setUp(const CSRMatrix &A)
+  {
+    Preconditioner::setUp(A);
+    LU= A;
+    if(LU.getDiagonalPositions(diagPos)>0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the matrix has zero diagonal coefficients."
+                  << std::endl;
+        return -1;
+      }
+    const std::vector<int> &rowStart= LU.getRowStarts();
+    const std::vector<int> &cols= LU.getCols();
+    std::vector<double> &values= LU.getValues();
+    std::vector<int> pos(size,-1); // position of each column in row i.
+    for(int i= 0;i<size;i++)
+      {
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          pos[cols[k]]= k;
+        for(int k= rowStart[i];k<diagPos[i];k++)
+          {
+            const int kk= cols[k];
+            const double lik= values[k]/values[diagPos[kk]];
+            values[k]= lik;
+            for(int m= diagPos[kk]+1;m<rowStart[kk+1];m++)
+              {
+                const int p= pos[cols[m]];
+                if(p>=0)
+                  values[p]-= lik*values[m];
+              }
+          }
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          pos[cols[k]]= -1;
+        if(values[diagPos[i]]==0.0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; zero pivot at row: " << i << std::endl;
+            return -(i+1);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Compute \f$z= (L U)^{-1} r\f$.
+int XC::ILUPreconditioner::apply(const Vector &r,Vector &z) const
+  {
+    z= r;
+    double *x= z.getDataPtr();
+    const std::vector<int> &rowStart= LU.getRowStarts();
+    const std::vector<int> &cols= LU.getCols();
+    const std::vector<double> &values= LU.getValues();
+    for(int i= 0;i<size;i++) // L y= r
+      {
+        double s= x[i];
+        for(int k= rowStart[i];k<diagPos[i];k++)
+          s-= values[k]*x[cols[k]];
+        x[i]= s;
+      }
+    for(int i= size-1;i>=0;i--) // U z= y
+      {
+        double s= x[i];
+        for(int k= diagPos[i]+1;k<rowStart[i+1];k++)
+          s-= values[k]*x[cols[k]];
+        x[i]= s/values[diagPos[i]];
+      }
+    return 0;
+  }
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ILUPreconditioner.h
+
+#ifndef ILUPreconditioner_h
+#define ILUPreconditioner_h
+
+#include "Preconditioner.h"
+#include "CSRMatrix.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Incomplete LU factorization without fill-in (ILU(0)).
+//!
+//! \f$M= L U\f$ where \f$L\f$ (unit lower triangular) and \f$U\f$
+//! (upper triangular) have the sparsity pattern of \f$A\f$. It doesn't
+//! need the matrix to be symmetric; if it is, \f$M\f$ is symmetric too
+//! (it's the \f$LDL^T\f$ form of IC(0)) but, unlike the incomplete
+//! Cholesky factorization, it doesn't need it to be positive definite.
+class ILUPreconditioner: public Preconditioner
+  {
+  private:
+    CSRMatrix LU; //!< L (below the diagonal) and U.
+    std::vector<int> diagPos; //!< position of the diagonal of each row in LU.
+  public:
+    virtual Preconditioner *getCopy(void) const;
+    //! @brief Return the name of the class.
+    virtual std::string getClassName(void) const
+      { return "ILUPreconditioner"; }
+
+    virtual int setUp(const CSRMatrix &);
+    virtual int apply(const Vector &,Vector &) const;
+  };
+} // end of XC namespace
+
+#endif
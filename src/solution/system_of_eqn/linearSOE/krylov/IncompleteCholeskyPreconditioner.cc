@@ -0,0 +1,154 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//IncompleteCholeskyPreconditioner.cc
+
+#include "IncompleteCholeskyPreconditioner.h"
+#include "CSRMatrix.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <iostream>
+
+//! @brief Constructor.
+XC::IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(void)
+  : Preconditioner(), shift(0.0) {}
+
+//! @brief Virtual constructor.
+XC::Preconditioner *XC::IncompleteCholeskyPreconditioner::getCopy(void) const
+  { return new IncompleteCholeskyPreconditioner(*this); }
+
+//! @brief Factor in place the upper triangle stored in values.
+//!
+//! Row oriented (right-looking) elimination: once the row \f$k\f$ of
+//! \f$U\f$ is computed, it updates the coefficients of the rows
+//! below it that belong to the sparsity pattern, the rest of the
+//! fill-in is discarded. Returns \f$-(k+1)\f$ if the pivot of the
+//! row \f$k\f$ is not positive.
+int XC::IncompleteCholeskyPreconditioner::factor(void)
+  {
+    std::vector<int> pos(size,-1); // position of each column in the row being updated.
+    for(int k= 0;k<size;k++)
+      {
+        const int kDiag= rowStart[k];
+        const int kEnd= rowStart[k+1];
+        const double d= values[kDiag];
+        if(!(d>0.0))
+          return -(k+1);
+        const double ukk= sqrt(d);
+        values[kDiag]= ukk;
+        for(int m= kDiag+1;m<kEnd;m++)
+          values[m]/= ukk;
+        for(int m1= kDiag+1;m1<kEnd;m1++)
+          {
+            const int j= cols[m1];
+            const double ukj= values[m1];
+            for(int p= rowStart[j];p<rowStart[j+1];p++)
+              pos[cols[p]]= p;
+            for(int m2= m1;m2<kEnd;m2++)
+              {
+                const int p= pos[cols[m2]];
+                if(p>=0)
+                  values[p]-= ukj*values[m2];
+              }
+            for(int p= rowStart[j];p<rowStart[j+1];p++)
+              pos[cols[p]]= -1;
+          }
+      }
+    return 0;
+  }
+
+//! @brief Compute the incomplete factorization of the matrix.
+int XC::IncompleteCholeskyPreconditioner::setUp(const CSRMatrix &A)
+  {
+    Preconditioner::setUp(A);
+    std::vector<int> diagPos;
+    if(A.getDiagonalPositions(diagPos)>0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the matrix has zero diagonal coefficients."
+                  << std::endl;
+        return -1;
+      }
+    // Upper triangle of A.
+    const std::vector<int> &aStart= A.getRowStarts();
+    const std::vector<int> &aCols= A.getCols();
+    const std::vector<double> &aValues= A.getValues();
+    rowStart.assign(size+1,0);
+    cols.clear();
+    std::vector<double> upper;
+    for(int i= 0;i<size;i++)
+      {
+        for(int k= diagPos[i];k<aStart[i+1];k++)
+          {
+            cols.push_back(aCols[k]);
+            upper.push_back(aValues[k]);
+          }
+        rowStart[i+1]= cols.size();
+      }
+    const int maxNumTrials= 20;
+    shift= 0.0;
+    int retval= -1;
+    for(int trial= 0;trial<maxNumTrials;trial++)
+      {
+        values= upper;
+        if(shift>0.0)
+          for(int i= 0;i<size;i++)
+            values[rowStart[i]]*= (1.0+shift);
+        retval= factor();
+        if(retval==0)
+          break;
+        shift= (shift>0.0 ? 2.0*shift : 1e-3);
+      }
+    if(retval<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; incomplete factorization failed at row: "
+                << -retval-1 << std::endl;
+    return retval;
+  }
+
+//! @brief Compute \f$z= (U^T U)^{-1} r\f$.
+int XC::IncompleteCholeskyPreconditioner::apply(const Vector &r,Vector &z) const
+  {
+    z= r;
+    double *x= z.getDataPtr();
+    // Solve U^T y= r (U^T is stored by columns).
+    for(int k= 0;k<size;k++)
+      {
+        const double yk= x[k]/values[rowStart[k]];
+        x[k]= yk;
+        for(int m= rowStart[k]+1;m<rowStart[k+1];m++)
+          x[cols[m]]-= values[m]*yk;
+      }
+    // Solve U z= y.
+    for(int k= size-1;k>=0;k--)
+      {
+        double s= x[k];
+        for(int m= rowStart[k]+1;m<rowStart[k+1];m++)
+          s-= values[m]*x[cols[m]];
+        x[k]= s/values[rowStart[k]];
+      }
+    return 0;
+  }
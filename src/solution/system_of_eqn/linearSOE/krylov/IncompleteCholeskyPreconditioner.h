@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//IncompleteCholeskyPreconditioner.h
+
+#ifndef IncompleteCholeskyPreconditioner_h
+#define IncompleteCholeskyPreconditioner_h
+
+#include "Preconditioner.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Incomplete Cholesky factorization without fill-in (IC(0)).
+//!
+//! \f$M= U^T U\f$ where \f$U\f$ is an upper triangular matrix with
+//! the sparsity pattern of the upper triangle of \f$A\f$ (which must
+//! be symmetric). If the incomplete factorization breaks down (a non
+//! positive pivot appears) the diagonal of \f$A\f$ is increased by a
+//! factor \f$(1+\alpha)\f$ and the factorization is tried again,
+//! doubling \f$\alpha\f$ each time (see getShift).
+class IncompleteCholeskyPreconditioner: public Preconditioner
+  {
+  private:
+    std::vector<int> rowStart; //!< position of the first coefficient of each row of U.
+    std::vector<int> cols; //!< column of each coefficient of U (the diagonal first).
+    std::vector<double> values; //!< coefficients of U.
+    double shift; //!< diagonal shift used in the last factorization.
+
+    int factor(void);
+  public:
+    IncompleteCholeskyPreconditioner(void);
+    virtual Preconditioner *getCopy(void) const;
+    //! @brief Return the name of the class.
+    virtual std::string getClassName(void) const
+      { return "IncompleteCholeskyPreconditioner"; }
+
+    //! @brief Return the diagonal shift \f$\alpha\f$ used in the last
+    //! factorization.
+    inline double getShift(void) const
+      { return shift; }
+
+    virtual int setUp(const CSRMatrix &);
+    virtual int apply(const Vector &,Vector &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//JacobiPreconditioner.cc
+
+#include "JacobiPreconditioner.h"
+#include "CSRMatrix.h"
+#include "utility/matrix/Vector.h"
+
+//! @brief Virtual constructor.
+XC::Preconditioner *XC::JacobiPreconditioner::getCopy(void) const
+  { return new JacobiPreconditioner(*this); }
+
+//! @brief Compute the inverse of the diagonal of the matrix.
+int XC::JacobiPreconditioner::setUp(const CSRMatrix &A)
+  {
+    Preconditioner::setUp(A);
+    A.getDiagonal(invDiag);
+    for(int i= 0;i<size;i++)
+      invDiag[i]= (invDiag[i]!=0.0 ? 1.0/invDiag[i] : 1.0);
+    return 0;
+  }
+
+//! @brief Compute \f$z_i= r_i/a_{ii}\f$.
+int XC::JacobiPreconditioner::apply(const Vector &r,Vector &z) const
+  {
+    if(z.Size()!=size)
+      z.resize(size);
+    const double *pr= r.getDataPtr();
+    double *pz= z.getDataPtr();
+    for(int i= 0;i<size;i++)
+      pz[i]= invDiag[i]*pr[i];
+    return 0;
+  }
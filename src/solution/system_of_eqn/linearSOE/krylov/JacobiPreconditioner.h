@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//JacobiPreconditioner.h
+
+#ifndef JacobiPreconditioner_h
+#define JacobiPreconditioner_h
+
+#include "Preconditioner.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Jacobi (diagonal) preconditioner.
+//!
+//! \f$M\f$ is the diagonal of \f$A\f$. The rows with zero diagonal
+//! are not scaled.
+class JacobiPreconditioner: public Preconditioner
+  {
+  private:
+    std::vector<double> invDiag; //!< inverse of the diagonal.
+  public:
+    virtual Preconditioner *getCopy(void) const;
+    //! @brief Return the name of the class.
+    virtual std::string getClassName(void) const
+      { return "JacobiPreconditioner"; }
+
+    virtual int setUp(const CSRMatrix &);
+    virtual int apply(const Vector &,Vector &) const;
+  };
+} // end of XC namespace
+
+#endif
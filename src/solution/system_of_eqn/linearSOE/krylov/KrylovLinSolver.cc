@@ -0,0 +1,302 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovLinSolver.cc
+
+#include "KrylovLinSolver.h"
+#include "Preconditioner.h"
+#include "JacobiPreconditioner.h"
+#include "CSRMatrix.h"
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSOE.h>
+#include "utility/matrix/Vector.h"
+
+//! @brief Constructor.
+//!
+//! @param classTag: class identifier.
+//! @param tol: relative tolerance.
+//! @param maxIter: maximum number of iterations.
+XC::KrylovLinSolver::KrylovLinSolver(int classTag,const double &tol,const int &maxIter)
+  :LinearSOESolver(classTag), theGenSOE(nullptr), theSymSOE(nullptr),
+   thePreconditioner(new JacobiPreconditioner()), tolerance(tol),
+   maxNumIter(maxIter), numIter(0), residualNorm(0.0), size(0) {}
+
+//! @brief Copy constructor.
+XC::KrylovLinSolver::KrylovLinSolver(const KrylovLinSolver &other)
+  :LinearSOESolver(other), theGenSOE(other.theGenSOE),
+   theSymSOE(other.theSymSOE), thePreconditioner(nullptr),
+   tolerance(other.tolerance), maxNumIter(other.maxNumIter),
+   numIter(other.numIter), residualNorm(other.residualNorm),
+   size(other.size)
+  { copy_preconditioner(other.thePreconditioner); }
+
+//! @brief Assignment operator.
+XC::KrylovLinSolver &XC::KrylovLinSolver::operator=(const KrylovLinSolver &other)
+  {
+    LinearSOESolver::operator=(other);
+    theGenSOE= other.theGenSOE;
+    theSymSOE= other.theSymSOE;
+    copy_preconditioner(other.thePreconditioner);
+    tolerance= other.tolerance;
+    maxNumIter= other.maxNumIter;
+    numIter= other.numIter;
+    residualNorm= other.residualNorm;
+    size= other.size;
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::KrylovLinSolver::~KrylovLinSolver(void)
+  { free_preconditioner(); }
+
+//! @brief Free the preconditioner.
+void XC::KrylovLinSolver::free_preconditioner(void)
+  {
+    if(thePreconditioner)
+      {
+        delete thePreconditioner;
+        thePreconditioner= nullptr;
+      }
+  }
+
+//! @brief Copy the preconditioner.
+void XC::KrylovLinSolver::copy_preconditioner(const Preconditioner *other)
+  {
+    if(other!=thePreconditioner)
+      {
+        free_preconditioner();
+        if(other)
+          thePreconditioner= other->getCopy();
+      }
+  }
+
+//! @brief Create a new preconditioner of the type being passed as
+//! parameter ("none", "jacobi", "incomplete_cholesky", "ilu0" or "amg").
+XC::Preconditioner &XC::KrylovLinSolver::newPreconditioner(const std::string &type)
+  {
+    Preconditioner *tmp= new_preconditioner(type);
+    if(tmp)
+      {
+        free_preconditioner();
+        thePreconditioner= tmp;
+        if(theGenSOE)
+          theGenSOE->factored= false;
+        if(theSymSOE)
+          theSymSOE->factored= false;
+      }
+    return *thePreconditioner;
+  }
+
+//! @brief Return a reference to the preconditioner.
+XC::Preconditioner &XC::KrylovLinSolver::getPreconditioner(void)
+  { return *thePreconditioner; }
+
+//! @brief Sets the system of equations to solve.
+bool XC::KrylovLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    theGenSOE= dynamic_cast<SparseGenRowLinSOE *>(soe);
+    theSymSOE= dynamic_cast<SymSparseColLinSOE *>(soe);
+    if(theGenSOE || theSymSOE)
+      retval= true;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; not a suitable system of equations." << std::endl;
+    return retval;
+  }
+
+//! @brief Sets the system of equations to solve.
+bool XC::KrylovLinSolver::setLinearSOE(SparseGenRowLinSOE &theSOE)
+  { return setLinearSOE(&theSOE); }
+
+//! @brief Sets the system of equations to solve.
+bool XC::KrylovLinSolver::setLinearSOE(SymSparseColLinSOE &theSOE)
+  { return setLinearSOE(&theSOE); }
+
+//! @brief Sets the number of equations.
+int XC::KrylovLinSolver::setSize(void)
+  {
+    size= 0;
+    if(theGenSOE)
+      size= theGenSOE->size;
+    else if(theSymSOE)
+      size= theSymSOE->size;
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set." << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Copy the matrix of the system of equations.
+int XC::KrylovLinSolver::getMatrix(CSRMatrix &A) const
+  {
+    if(theGenSOE)
+      A.setFromRows(size,theGenSOE->rowStartA.getDataPtr(),theGenSOE->colA.getDataPtr(),theGenSOE->A.getDataPtr());
+    else if(theSymSOE)
+      A.setFromSymmetricColumns(size,theSymSOE->colStartA.getDataPtr(),theSymSOE->rowA.getDataPtr(),theSymSOE->A.getDataPtr());
+    else
+      return -1;
+    return 0;
+  }
+
+//! @brief Compute the product \f$Ap\f$ of the matrix of the system
+//! by the vector being passed as parameter.
+int XC::KrylovLinSolver::formAp(const Vector &p,Vector &Ap) const
+  {
+    if(Ap.Size()!=size)
+      Ap.resize(size);
+    const double *x= p.getDataPtr();
+    double *y= Ap.getDataPtr();
+    if(theGenSOE)
+      {
+        const int *rowStart= theGenSOE->rowStartA.getDataPtr();
+        const int *cols= theGenSOE->colA.getDataPtr();
+        const double *a= theGenSOE->A.getDataPtr();
+        for(int i= 0;i<size;i++)
+          {
+            double s= 0.0;
+            for(int k= rowStart[i];k<rowStart[i+1];k++)
+              s+= a[k]*x[cols[k]];
+            y[i]= s;
+          }
+      }
+    else if(theSymSOE)
+      {
+        const int *colStart= theSymSOE->colStartA.getDataPtr();
+        const int *rows= theSymSOE->rowA.getDataPtr();
+        const double *a= theSymSOE->A.getDataPtr();
+        Ap.Zero();
+        for(int j= 0;j<size;j++)
+          {
+            const double xj= x[j];
+            double s= 0.0;
+            for(int k= colStart[j];k<colStart[j+1];k++)
+              {
+                const int i= rows[k];
+                y[i]+= a[k]*xj;
+                if(i!=j)
+                  s+= a[k]*x[i];
+              }
+            y[j]+= s;
+          }
+      }
+    else
+      return -1;
+    return 0;
+  }
+
+//! @brief Compute \f$z= M^{-1} r\f$ where \f$M\f$ is the preconditioner.
+int XC::KrylovLinSolver::precondition(const Vector &r,Vector &z) const
+  { return thePreconditioner->apply(r,z); }
+
+//! @brief Compute the residual \f$r= b-Ax\f$ and return its norm.
+double XC::KrylovLinSolver::getResidualNorm(const Vector &b,const Vector &x,Vector &r) const
+  {
+    formAp(x,r);
+    r.addVector(-1.0,b,1.0);
+    return r.Norm();
+  }
+
+//! @brief Solve the system of equations.
+//!
+//! If the matrix has changed since the last solution the
+//! preconditioner is computed again. The iteration starts from
+//! \f$x=0\f$. Returns 0 if the iterations converge, a negative
+//! number otherwise.
+int XC::KrylovLinSolver::solve(void)
+  {
+    LinearSOEData *theSOE= nullptr;
+    bool factored= false;
+    if(theGenSOE)
+      {
+        theSOE= theGenSOE;
+        factored= theGenSOE->factored;
+      }
+    else if(theSymSOE)
+      {
+        theSOE= theSymSOE;
+        factored= theSymSOE->factored;
+      }
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set." << std::endl;
+        return -1;
+      }
+    if(size!=theSOE->getNumEqn())
+      setSize();
+    numIter= 0;
+    residualNorm= 0.0;
+    if(size==0)
+      return 0;
+    if(!factored)
+      {
+        CSRMatrix A;
+        getMatrix(A);
+        const int ok= thePreconditioner->setUp(A);
+        if(ok<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; can't compute the preconditioner." << std::endl;
+            return -2;
+          }
+        if(theGenSOE)
+          theGenSOE->factored= true;
+        else
+          theSymSOE->factored= true;
+      }
+    const Vector &b= theSOE->getB();
+    Vector x(size);
+    int retval= 0;
+    if(b.Norm()>0.0)
+      {
+        retval= iterate(b,x);
+        if(retval<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; iterations didn't converge; number of iterations: "
+		    << numIter << ", relative residual norm: "
+		    << residualNorm << std::endl;
+      }
+    theSOE->setX(x);
+    return retval;
+  }
+
+//! @brief Send object members through the channel being passed as parameter.
+int XC::KrylovLinSolver::sendSelf(CommParameters &cp)
+  {
+    // nothing to do
+    return 0;
+  }
+
+//! @brief Receives object members through the channel being passed as parameter.
+int XC::KrylovLinSolver::recvSelf(const CommParameters &cp)
+  {
+    // nothing to do
+    return 0;
+  }
@@ -0,0 +1,124 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovLinSolver.h
+
+#ifndef KrylovLinSolver_h
+#define KrylovLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <string>
+
+namespace XC {
+class SparseGenRowLinSOE;
+class SymSparseColLinSOE;
+class Preconditioner;
+class CSRMatrix;
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the preconditioned Krylov subspace solvers
+//! (see PCGSolver, MINRESSolver and GMRESSolver).
+//!
+//! The iterative solvers don't factor the matrix, so they need
+//! much less memory than the direct ones and can solve models
+//! whose factorization doesn't fit in memory. They can be used with the
+//! sparse systems of equations SparseGenRowLinSOE and
+//! SymSparseColLinSOE. The preconditioner (Jacobi by default, see
+//! newPreconditioner) is computed each time the matrix of the system
+//! changes.
+//!
+//! The iterations stop when the norm of the residual
+//! \f$||b-Ax||\f$ is not greater than the tolerance times the norm
+//! of the right hand side \f$||b||\f$. The product of the matrix by a
+//! vector is computed by formAp, so the subclasses can override it to
+//! provide a matrix-free operator.
+class KrylovLinSolver: public LinearSOESolver
+  {
+  private:
+    SparseGenRowLinSOE *theGenSOE; //!< system of equations (general storage).
+    SymSparseColLinSOE *theSymSOE; //!< system of equations (symmetric storage).
+    Preconditioner *thePreconditioner; //!< preconditioner.
+
+    void free_preconditioner(void);
+    void copy_preconditioner(const Preconditioner *);
+  protected:
+    double tolerance; //!< relative tolerance.
+    int maxNumIter; //!< maximum number of iterations.
+    int numIter; //!< number of iterations performed in the last solution.
+    double residualNorm; //!< relative residual norm at the end of the last solution.
+    int size; //!< number of equations.
+
+    virtual bool setLinearSOE(LinearSOE *theSOE);
+    int getMatrix(CSRMatrix &) const;
+    int precondition(const Vector &,Vector &) const;
+    double getResidualNorm(const Vector &,const Vector &,Vector &) const;
+    //! @brief Solve the system \f$Ax=b\f$ (x contains the initial
+    //! guess on entry).
+    virtual int iterate(const Vector &b,Vector &x)= 0;
+
+    KrylovLinSolver(int classTag,const double &tol= 1e-8,const int &maxIter= 1000);
+    KrylovLinSolver(const KrylovLinSolver &);
+    KrylovLinSolver &operator=(const KrylovLinSolver &);
+  public:
+    virtual ~KrylovLinSolver(void);
+
+    virtual bool setLinearSOE(SparseGenRowLinSOE &);
+    virtual bool setLinearSOE(SymSparseColLinSOE &);
+    virtual int formAp(const Vector &,Vector &) const;
+    int setSize(void);
+    int solve(void);
+
+    //! @brief Return the relative tolerance.
+    inline double getTolerance(void) const
+      { return tolerance; }
+    //! @brief Set the relative tolerance.
+    inline void setTolerance(const double &d)
+      { tolerance= d; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxNumIter(void) const
+      { return maxNumIter; }
+    //! @brief Set the maximum number of iterations.
+    inline void setMaxNumIter(const int &i)
+      { maxNumIter= i; }
+    //! @brief Return the number of iterations performed in the last
+    //! solution.
+    inline int getNumIter(void) const
+      { return numIter; }
+    //! @brief Return the relative residual norm
+    //! (\f$||b-Ax||/||b||\f$) at the end of the last solution.
+    inline double getRelativeResidualNorm(void) const
+      { return residualNorm; }
+
+    Preconditioner &newPreconditioner(const std::string &);
+    Preconditioner &getPreconditioner(void);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MINRESSolver.cc
+
+#include "MINRESSolver.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <limits>
+
+//! @brief Constructor.
+XC::MINRESSolver::MINRESSolver(void)
+  :KrylovLinSolver(SOLVER_TAGS_MINRESSolver) {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::MINRESSolver::getCopy(void) const
+  { return new MINRESSolver(*this); }
+
+//! @brief Preconditioned MINRES iterations.
+//!
+//! The norm of the residual is estimated by the recurrences of the
+//! algorithm; when the estimate reaches the tolerance the true
+//! residual is computed to confirm the convergence.
+int XC::MINRESSolver::iterate(const Vector &b,Vector &x)
+  {
+    const double bNorm= b.Norm();
+    Vector r1(size), r2(size), y(size), v(size), w(size), w1(size), w2(size), tmp(size);
+    residualNorm= getResidualNorm(b,x,r1)/bNorm; // r1= b-Ax
+    if(residualNorm<=tolerance)
+      return 0;
+    precondition(r1,y);
+    double beta1= r1^y;
+    if(!(beta1>0.0))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the preconditioner is not positive definite." << std::endl;
+        return -3;
+      }
+    beta1= sqrt(beta1);
+    r2= r1;
+    double oldb= 0.0, beta= beta1, dbar= 0.0, epsln= 0.0;
+    double phibar= beta1, cs= -1.0, sn= 0.0;
+    const double eps= std::numeric_limits<double>::epsilon();
+    for(numIter= 1;numIter<=maxNumIter;numIter++)
+      {
+        // Lanczos step.
+        v= y;
+        v*= 1.0/beta;
+        formAp(v,y);
+        if(numIter>=2)
+          y.addVector(1.0,r1,-beta/oldb);
+        const double alfa= v^y;
+        y.addVector(1.0,r2,-alfa/beta);
+        r1= r2;
+        r2= y;
+        precondition(r2,y);
+        oldb= beta;
+        beta= r2^y;
+        if(beta<0.0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; the preconditioner is not positive definite." << std::endl;
+            return -3;
+          }
+        beta= sqrt(beta);
+        // QR factorization of the tridiagonal matrix.
+        const double oldeps= epsln;
+        const double delta= cs*dbar+sn*alfa;
+        const double gbar= sn*dbar-cs*alfa;
+        epsln= sn*beta;
+        dbar= -cs*beta;
+        double gamma= sqrt(gbar*gbar+beta*beta);
+        if(gamma<eps)
+          gamma= eps;
+        cs= gbar/gamma;
+        sn= beta/gamma;
+        const double phi= cs*phibar;
+        phibar*= sn;
+        // Update the solution.
+        w1= w2;
+        w2= w;
+        w= v;
+        w.addVector(1.0,w1,-oldeps);
+        w.addVector(1.0,w2,-delta);
+        w*= 1.0/gamma;
+        x.addVector(1.0,w,phi);
+        if((phibar/beta1<=tolerance) || (beta==0.0))
+          {
+            residualNorm= getResidualNorm(b,x,tmp)/bNorm;
+            if(residualNorm<=tolerance)
+              return 0;
+            if(beta==0.0) // the Krylov subspace is exhausted.
+              return -1;
+          }
+      }
+    numIter= maxNumIter;
+    residualNorm= getResidualNorm(b,x,tmp)/bNorm;
+    return -1;
+  }
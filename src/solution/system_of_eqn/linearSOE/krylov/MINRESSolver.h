@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MINRESSolver.h
+
+#ifndef MINRESSolver_h
+#define MINRESSolver_h
+
+#include "KrylovLinSolver.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned minimum residual solver.
+//!
+//! For symmetric matrices, not necessarily positive definite (the
+//! preconditioner must be symmetric positive definite). Minimizes
+//! the norm of the residual (in the norm defined by the inverse of
+//! the preconditioner) on the Krylov subspace built with the
+//! Lanczos process (Paige and Saunders algorithm).
+class MINRESSolver: public KrylovLinSolver
+  {
+  protected:
+    virtual int iterate(const Vector &,Vector &);
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    MINRESSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PCGSolver.cc
+
+#include "PCGSolver.h"
+#include "utility/matrix/Vector.h"
+
+//! @brief Constructor.
+XC::PCGSolver::PCGSolver(void)
+  :KrylovLinSolver(SOLVER_TAGS_PCGSolver) {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::PCGSolver::getCopy(void) const
+  { return new PCGSolver(*this); }
+
+//! @brief Preconditioned conjugate gradient iterations.
+int XC::PCGSolver::iterate(const Vector &b,Vector &x)
+  {
+    const double bNorm= b.Norm();
+    Vector r(size), z(size), p(size), q(size);
+    residualNorm= getResidualNorm(b,x,r)/bNorm; // r= b-Ax
+    if(residualNorm<=tolerance)
+      return 0;
+    precondition(r,z);
+    p= z;
+    double rz= r^z;
+    for(numIter= 1;numIter<=maxNumIter;numIter++)
+      {
+        formAp(p,q);
+        const double pq= p^q;
+        if(!(pq>0.0))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; the matrix is not positive definite." << std::endl;
+            return -3;
+          }
+        const double alpha= rz/pq;
+        x.addVector(1.0,p,alpha);
+        r.addVector(1.0,q,-alpha);
+        residualNorm= r.Norm()/bNorm;
+        if(residualNorm<=tolerance)
+          return 0;
+        precondition(r,z);
+        const double rzOld= rz;
+        rz= r^z;
+        p.addVector(rz/rzOld,z,1.0);
+      }
+    numIter= maxNumIter;
+    return -1;
+  }
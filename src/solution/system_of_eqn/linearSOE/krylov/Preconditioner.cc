@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//Preconditioner.cc
+
+#include "Preconditioner.h"
+#include "JacobiPreconditioner.h"
+#include "IncompleteCholeskyPreconditioner.h"
+#include "ILUPreconditioner.h"
+#include "AMGPreconditioner.h"
+#include "CSRMatrix.h"
+#include "utility/matrix/Vector.h"
+#include <iostream>
+
+//! @brief Constructor.
+XC::Preconditioner::Preconditioner(void)
+  : size(0) {}
+
+//! @brief Virtual constructor.
+XC::Preconditioner *XC::Preconditioner::getCopy(void) const
+  { return new Preconditioner(*this); }
+
+//! @brief Compute the preconditioner from the matrix of the system.
+//!
+//! Invoked by the solver each time the matrix changes. Returns 0 if
+//! successful, a negative number otherwise.
+int XC::Preconditioner::setUp(const CSRMatrix &A)
+  {
+    size= A.getNumRows();
+    return 0;
+  }
+
+//! @brief Compute \f$z= M^{-1} r\f$.
+int XC::Preconditioner::apply(const Vector &r,Vector &z) const
+  {
+    z= r;
+    return 0;
+  }
+
+//! @brief Create a preconditioner of the type being passed as parameter.
+//!
+//! @param type: "none", "jacobi", "incomplete_cholesky", "ilu0" or "amg".
+XC::Preconditioner *XC::new_preconditioner(const std::string &type)
+  {
+    Preconditioner *retval= nullptr;
+    if(type=="none")
+      retval= new Preconditioner();
+    else if(type=="jacobi")
+      retval= new JacobiPreconditioner();
+    else if(type=="incomplete_cholesky")
+      retval= new IncompleteCholeskyPreconditioner();
+    else if(type=="ilu0")
+      retval= new ILUPreconditioner();
+    else if(type=="amg")
+      retval= new AMGPreconditioner();
+    else
+      std::cerr << __FUNCTION__ << "; preconditioner of type: '"
+                << type << "' unknown." << std::endl;
+    return retval;
+  }
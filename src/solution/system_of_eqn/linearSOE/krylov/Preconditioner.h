@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//Preconditioner.h
+
+#ifndef Preconditioner_h
+#define Preconditioner_h
+
+#include <string>
+
+namespace XC {
+class Vector;
+class CSRMatrix;
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the preconditioners of the iterative
+//! solvers (see KrylovLinSolver).
+//!
+//! A preconditioner is an approximation \f$M\f$ of the matrix
+//! \f$A\f$ of the system such that \f$M^{-1}r\f$ is cheap to
+//! compute. This base class implements the identity (no
+//! preconditioning).
+class Preconditioner
+  {
+  protected:
+    int size; //!< order of the matrix.
+  public:
+    Preconditioner(void);
+    //! @brief Destructor.
+    virtual ~Preconditioner(void)
+      {}
+    virtual Preconditioner *getCopy(void) const;
+    //! @brief Return the name of the class.
+    virtual std::string getClassName(void) const
+      { return "Preconditioner"; }
+
+    virtual int setUp(const CSRMatrix &);
+    virtual int apply(const Vector &,Vector &) const;
+  };
+
+Preconditioner *new_preconditioner(const std::string &);
+} // end of XC namespace
+
+#endif
@@ -68,6 +68,12 @@ XC::DistributedProfileSPDLinSOE::DistributedProfileSPDLinSOE(AnalysisAggregation
    DistributedBandLinSOE() {}
 
 
+//! @brief Set the size of the system from the compressed graph. The
+//! distributed system exchanges Graph objects between processes so the
+//! call is routed to setSize(Graph &).
+int XC::DistributedProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
@@ -64,542 +64,291 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
+#include "utility/parallel/ThreadPool.h"
 #include <cmath>
+#include <algorithm>
 
-#define _REENTRANT    /* basic 3-lines for threads */
-// #include <pthread.h>
-#include <thread.h>
-
-#include <utility/Timer.h>
-
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int *iDiagLoc;
-  int size;
-  int blockSize;
-  int  maxColHeight;
-  double minDiagTol;
-  int *RowTop;
-  double **topRowPtr, *invD;
-
-  int currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_ProfileSPDDirectThreadSolver;
-
-
-void *ProfileSPDLinDirectThreadSolver_Worker(void *arg);
-
-//! @brief Default constructor.
+//! @brief Default constructor (as many threads as the hardware supports).
 XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(void)
   :ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,1.0e-12),
- NP(2), running(false), blockSize(4), maxColHeight(0) {}
+   NP(ThreadPool::getDefaultNumThreads()), blockSize(64), maxColHeight(0) {}
 
 //! @brief Constructor.
 //!
-//! @param numProcessors: number of processors to use.
-XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(int numProcessors, int blckSize, double tol) 
-:ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,tol),
- NP(numProcessors), running(false), blockSize(blckSize), maxColHeight(0)
-  {}
+//! @param numThreads: number of threads to use.
+//! @param blckSize: number of rows of each block.
+//! @param tol: minimum absolute value of the diagonal terms.
+XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(int numThreads, int blckSize, double tol) 
+  :ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,tol),
+   NP(1), blockSize(64), maxColHeight(0)
+  {
+    setNumThreads(numThreads);
+    setBlockSize(blckSize);
+  }
+
+//! @brief Set the number of threads (0: as many as the hardware supports).
+void XC::ProfileSPDLinDirectThreadSolver::setNumThreads(const size_t &n)
+  {
+    if(n>0)
+      NP= n;
+    else
+      NP= ThreadPool::getDefaultNumThreads();
+  }
+
+//! @brief Set the number of rows of each block.
+void XC::ProfileSPDLinDirectThreadSolver::setBlockSize(const int &sz)
+  { blockSize= std::max(sz,1); }
 
 //! @brief Set system size.    
 int XC::ProfileSPDLinDirectThreadSolver::setSize(void)
   {
     if(!theSOE)
       {
-	std::cerr << getClassName() << "::" << __FUNCTION__;
-	std::cerr << " No system has been set\n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system has been set\n";
 	return -1;
       }
 
-    // check for XC::quick return 
-    if (theSOE->size == 0)
-	return 0;
+    // check for quick return 
+    if(theSOE->size == 0)
+      return 0;
     if(size != theSOE->size)
       {    
-        size = theSOE->size;
+        size= theSOE->size;
         RowTop= ID(size);
         topRowPtr= std::vector<double *>(size);
         invD= Vector(size); 
       }
 
-
     // set some pointers
-    double *A = theSOE->A.getDataPtr();
-    int *iDiagLoc = theSOE->iDiagLoc.getDataPtr();
+    double *A= theSOE->A.getDataPtr();
+    const int *iDiagLoc= theSOE->iDiagLoc.getDataPtr();
 
     // set RowTop and topRowPtr info
+    maxColHeight= 1;
+    RowTop[0]= 0;
+    topRowPtr[0]= A;
+    for(int j=1; j<size; j++)
+      {
+	const int icolsz= iDiagLoc[j] - iDiagLoc[j-1];
+        maxColHeight= std::max(maxColHeight,icolsz);
+	RowTop[j]= j - icolsz +  1;
+	topRowPtr[j]= &A[iDiagLoc[j-1]]; // FORTRAN array indexing in iDiagLoc
+      }
+    return 0;
+  }
 
-    maxColHeight = 0;
-    RowTop[0] = 0;
-    topRowPtr[0] = A;
-    for (int j=1; j<size; j++) {
-	int icolsz = iDiagLoc[j] - iDiagLoc[j-1];
-        if (icolsz > maxColHeight) maxColHeight = icolsz;
-	RowTop[j] = j - icolsz +  1;
-	topRowPtr[j] = &A[iDiagLoc[j-1]]; // FORTRAN array indexing in iDiagLoc
-    }
-
-    size = theSOE->size;
+//! @brief Factors the matrix into \f$U^tDU\f$ storing \f$D^{-1}\f$
+//! in invD.
+//!
+//! For every block of rows the diagonal block is factored first by
+//! the calling thread, then the rows of the block are computed in the
+//! columns to the right, sharing the columns among the threads.
+int XC::ProfileSPDLinDirectThreadSolver::factor(void)
+  {
+    ThreadPool &pool= ThreadPool::getThreadPool();
+    for(int startRow= 0;startRow<size;startRow+= blockSize)
+      {
+        const int lastRow= std::min(startRow+blockSize,size)-1;
+	// first factor the diagonal block into Ui,i and Di
+        for(int j= startRow;j<=lastRow;j++)
+          {
+            const int rowjTop= RowTop[j];
+            double *aj= topRowPtr[j]-rowjTop; // aj[k] is the coefficient (k,j).
+            for(int k= std::max(rowjTop,startRow);k<j;k++)
+              {
+                const double *ak= topRowPtr[k]-RowTop[k];
+                double tmp= aj[k];
+                for(int l= std::max(rowjTop,RowTop[k]);l<k;l++)
+                  tmp-= ak[l]*aj[l];
+                aj[k]= tmp;
+              }
+            double ajj= aj[j];
+            for(int k= rowjTop;k<j;k++)
+              {
+                const double akj= aj[k];
+                const double lkj= akj*invD[k];
+                aj[k]= lkj;
+                ajj-= lkj*akj;
+              }
+	    // check that the diag > the tolerance specified
+	    if(ajj == 0.0)
+	      {
+		std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; aii < 0 (i, aii): (" << j << ", "
+			  << ajj << ")\n"; 
+		return(-2);
+	      }
+	    if(fabs(ajj) <= minDiagTol)
+	      {
+		std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; aii < minDiagTol (i, aii): (" << j
+			  << ", " << ajj << ")\n"; 
+		return(-2);
+	      }		
+            invD[j]= 1.0/ajj;
+          }
+        // now do the rest of the block row, forming Ui,j*Di
+        const int lastCol= std::min(lastRow+maxColHeight-1,size-1);
+        pool.parallel_for(lastRow+1,lastCol+1,[&](const size_t &ic, const size_t &)
+          {
+            const int c= ic;
+            const int rowcTop= RowTop[c];
+            if(rowcTop<=lastRow)
+              {
+                double *ac= topRowPtr[c]-rowcTop;
+                for(int l= std::max(rowcTop,startRow);l<=lastRow;l++)
+                  {
+                    const double *al= topRowPtr[l]-RowTop[l];
+                    double tmp= ac[l];
+                    for(int m= std::max(rowcTop,RowTop[l]);m<l;m++)
+                      tmp-= al[m]*ac[m];
+                    ac[l]= tmp;
+                  }
+              }
+          },NP);
+      }
     return 0;
-}
+  }
 
+//! @brief Solves \f$U^tDUx=b\f$ overwriting \p x (that contains \f$b\f$
+//! on entry) with the solution.
+void XC::ProfileSPDLinDirectThreadSolver::substitute(double *x) const
+  {
+    ThreadPool &pool= ThreadPool::getThreadPool();
+    // forward substitution.
+    for(int startRow= 0;startRow<size;startRow+= blockSize)
+      {
+        const int lastRow= std::min(startRow+blockSize,size)-1;
+        // terms of the rows above the block.
+        pool.parallel_for(startRow,lastRow+1,[&](const size_t &ii, const size_t &)
+          {
+            const int i= ii;
+            const int rowiTop= RowTop[i];
+            if(rowiTop<startRow)
+              {
+                const double *ai= topRowPtr[i]-rowiTop;
+                double tmp= 0.0;
+                for(int j= rowiTop;j<startRow;j++)
+                  tmp+= ai[j]*x[j];
+                x[i]-= tmp;
+              }
+          },NP);
+        // terms of the block.
+        for(int i= startRow;i<=lastRow;i++)
+          {
+            const double *ai= topRowPtr[i]-RowTop[i];
+            double tmp= 0.0;
+            for(int j= std::max(RowTop[i],startRow);j<i;j++)
+              tmp+= ai[j]*x[j];
+            x[i]-= tmp;
+          }
+      }
+
+    // divide by diag term 
+    for(int j= 0;j<size;j++)
+      x[j]*= invD[j];
+
+    // now do the back substitution storing result in x
+    const int nBlocks= (size+blockSize-1)/blockSize;
+    for(int b= nBlocks-1;b>=0;b--)
+      {
+        const int startRow= b*blockSize;
+        const int lastRow= std::min(startRow+blockSize,size)-1;
+        int minRowTop= startRow;
+        for(int k= lastRow;k>=startRow;k--)
+          {
+            const int rowkTop= RowTop[k];
+            minRowTop= std::min(minRowTop,rowkTop);
+            const double *ak= topRowPtr[k]-rowkTop;
+            const double xk= x[k];
+            for(int j= std::max(rowkTop,startRow);j<k;j++)
+              x[j]-= ak[j]*xk;
+          }
+        // rows above the block.
+        pool.parallel_for(minRowTop,startRow,[&](const size_t &ij, const size_t &)
+          {
+            const int j= ij;
+            double tmp= 0.0;
+            for(int k= startRow;k<=lastRow;k++)
+              {
+                const int rowkTop= RowTop[k];
+                if(rowkTop<=j)
+                  tmp+= topRowPtr[k][j-rowkTop]*x[k];
+              }
+            x[j]-= tmp;
+          },NP);
+      }
+  }
 
-//! The solver first copies the B vector into X.
-//! FILL IN
+//! The solver first copies the B vector into X, factors the matrix if
+//! the system is marked as not having been factored and then performs
+//! the forward and back substitutions.
 //! The solve process changes \f$A\f$ and \f$X\f$.   
 int XC::ProfileSPDLinDirectThreadSolver::solve(void)
   {
-    // check for XC::quick returns
-    if (theSOE == 0) {
-	std::cerr << getClassName() << "::" << __FUNCTION__;
-	std::cerr << " - No ProfileSPDSOE has been assigned\n";
+    // check for quick returns
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned\n";
 	return -1;
-    }
+      }
     
-    if (theSOE->size == 0)
-	return 0;
-
-    // set some pointers
-    double *A = theSOE->A;
-    double *B = theSOE->B;
-    double *X = theSOE->X;
-    int *iDiagLoc = theSOE->iDiagLoc;
-    int size = theSOE->size;
+    if(theSOE->size == 0)
+      return 0;
+    if(size != theSOE->size)
+      setSize();
 
     // copy B into X
-    for (int ii=0; ii<size; ii++)
-	X[ii] = B[ii];
-    
-    if (theSOE->isAfactored == false)  {
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_ProfileSPDDirectThreadSolver.workToDo = 0;
-
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(nullptr,0, ProfileSPDLinDirectThreadSolver_Worker, 
-		     nullptr, THR_BOUND|THR_DAEMON, nullptr);
-
-        running = true;
-      }
-      
-  
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.start_mutex); 
-
-	invD[0] = 1.0/A[0];	
-
-        // assign the global variables the threads will need
-        TCB_ProfileSPDDirectThreadSolver.A = A;
-	TCB_ProfileSPDDirectThreadSolver.X = X;
-	TCB_ProfileSPDDirectThreadSolver.B = B;
-	TCB_ProfileSPDDirectThreadSolver.size = size;
-	TCB_ProfileSPDDirectThreadSolver.minDiagTol = minDiagTol;
-	TCB_ProfileSPDDirectThreadSolver.maxColHeight = maxColHeight;
-	TCB_ProfileSPDDirectThreadSolver.RowTop = RowTop;
-	TCB_ProfileSPDDirectThreadSolver.topRowPtr = topRowPtr;
-	TCB_ProfileSPDDirectThreadSolver.invD = invD;
-        TCB_ProfileSPDDirectThreadSolver.blockSize = blockSize;
-        TCB_ProfileSPDDirectThreadSolver.iDiagLoc = iDiagLoc;
-	
-	TCB_ProfileSPDDirectThreadSolver.info = 0;
-        TCB_ProfileSPDDirectThreadSolver.workToDo = NP;
-        TCB_ProfileSPDDirectThreadSolver.currentBlock = -1;
-	TCB_ProfileSPDDirectThreadSolver.threadID = 0;
-	TCB_ProfileSPDDirectThreadSolver.numThreads = NP;
-        TCB_ProfileSPDDirectThreadSolver.threadsDone = 0;
-        TCB_ProfileSPDDirectThreadSolver.threadsDoneBlock = NP;
-
-        // wake up the threads
-        cond_broadcast(&TCB_ProfileSPDDirectThreadSolver.start_cond);
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.start_mutex); 
+    const double *B= theSOE->getPtrB();
+    double *X= theSOE->getPtrX();
+    std::copy(B,B+size,X);
 
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-         while (TCB_ProfileSPDDirectThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_ProfileSPDDirectThreadSolver.end_cond, &TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-
-      theSOE->isAfactored = true;
-	
-      // divide by diag term 
-      double *bjPtr = X; 
-      double *aiiPtr = invD;
-      for (int j=0; j<size; j++) 
-	*bjPtr++ = *aiiPtr++ * X[j];
-
-    
-      // now do the back substitution storing result in X
-      for (int k=(size-1); k>0; k--) {
-      
-	int rowktop = RowTop[k];
-	double bk = X[k];
-	double *ajiPtr = topRowPtr[k]; 		
-      
-	for (int j=rowktop; j<k; j++) 
-	  X[j] -= *ajiPtr++ * bk;
-      }   	 
-    } else { // just do forward and back substitution
-      
-      // do forward substitution 
-      for (int i=1; i<size; i++) {
-	    
-	int rowitop = RowTop[i];	    
-	double *ajiPtr = topRowPtr[i];
-	double *bjPtr  = &X[rowitop];  
-	double tmp = 0;	    
-	    
-	for (int j=rowitop; j<i; j++) 
-	  tmp -= *ajiPtr++ * *bjPtr++; 
-	    
-	X[i] += tmp;
+    if(theSOE->factored == false)
+      {
+        const int retval= factor();
+        if(retval<0)
+          return retval;
+	theSOE->factored= true;
       }
-
-      // divide by diag term 
-      double *bjPtr = X; 
-      double *aiiPtr = invD;
-      for (int j=0; j<size; j++) 
-	*bjPtr++ = *aiiPtr++ * X[j];
-
-    
-      // now do the back substitution storing result in X
-      for (int k=(size-1); k>0; k--) {
-      
-	int rowktop = RowTop[k];
-	double bk = X[k];
-	double *ajiPtr = topRowPtr[k]; 		
-
-	for (int j=rowktop; j<k; j++) 
-	  X[j] -= *ajiPtr++ * bk;
-      }   	 
-    }    
+    substitute(X);
     return 0;
-}
+  }
 
-int 
-XC::ProfileSPDLinDirectThreadSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
-{
-    if (theSOE != 0) {
-	std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-	std::cerr << " has already been called \n";	
-	return -1;
-    }
-    
-    theSOE = &theNewSOE;
-    return 0;
-}
+//! @brief Returns the determinant.
+double XC::ProfileSPDLinDirectThreadSolver::getDeterminant(void) 
+  {
+    double determinant= 1.0;
+    for(int i=0; i<size; i++)
+      determinant*= invD[i];
+    determinant= 1.0/determinant;
+    return determinant;
+  }
+
+//! @brief Sets the system of equations to solve.
+int XC::ProfileSPDLinDirectThreadSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
+  {
+    int retval= 0;
+    if(theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << ";  has already been called \n";	
+	retval= -1;
+      }
+    else
+      theSOE= &theNewSOE;
+    return retval;
+  }
 	
 int XC::ProfileSPDLinDirectThreadSolver::sendSelf(CommParameters &cp)
-{
-    if (size != 0)
-	std::cerr << "XC::ProfileSPDLinDirectThreadSolver::sendSelf - does not send itself YET\n"; 
+  {
+    // nothing to do
     return 0;
-}
-
+  }
 
-int 
-XC::ProfileSPDLinDirectThreadSolver::recvSelf(const CommParameters &cp)
-{
+int XC::ProfileSPDLinDirectThreadSolver::recvSelf(const CommParameters &cp)
+  {
+    // nothing to do
     return 0;
-}
-
-
-
-void *ProfileSPDLinDirectThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-        while (TCB_ProfileSPDDirectThreadSolver.workToDo == 0)
-          cond_wait(&TCB_ProfileSPDDirectThreadSolver.start_cond, &TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-        TCB_ProfileSPDDirectThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_ProfileSPDDirectThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-      // do some initialisation for the factorization
-      double *A = TCB_ProfileSPDDirectThreadSolver.A;
-      double *B = TCB_ProfileSPDDirectThreadSolver.B;
-      double *X = TCB_ProfileSPDDirectThreadSolver.X;
-      int *iDiagLoc = TCB_ProfileSPDDirectThreadSolver.iDiagLoc;
-      int size = TCB_ProfileSPDDirectThreadSolver.size;
-      double minDiagTol = TCB_ProfileSPDDirectThreadSolver.minDiagTol;
-      int maxColHeight = TCB_ProfileSPDDirectThreadSolver.maxColHeight;
-      int *RowTop = TCB_ProfileSPDDirectThreadSolver.RowTop;
-      double **topRowPtr = TCB_ProfileSPDDirectThreadSolver.topRowPtr;
-      double *invD = TCB_ProfileSPDDirectThreadSolver.invD;
-      int blockSize = TCB_ProfileSPDDirectThreadSolver.blockSize;
-
-      int currentBlock =0;
-      int numThreads = TCB_ProfileSPDDirectThreadSolver.numThreads;
-
-
-      // FACTOR 
-      int startRow = 0;
-      int lastRow = startRow+blockSize-1;
-      int lastColEffected = lastRow+maxColHeight -1;
-      int nBlck = size/blockSize;
-      if ((size % blockSize) != 0)
-	nBlck++;
-
-      // for every block across      
-      for (int i=0; i<nBlck; i++) {
-
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // first factor the diagonal block int Ui,i and Di
-          int j;
-	  for (j=0; j<blockSize; j++) {
-            int currentRow = startRow + j;
-
-	    if (currentRow < size) { // this is for case when size%blockSize != 0
-
-	      int rowjTop = RowTop[currentRow];
-	      //	      double *akjPtr = &A[iDiagLoc[currentRow-1]];
-	      double *akjPtr = topRowPtr[currentRow];
-	      int maxRowijTop;
-	      if (rowjTop < startRow) {
-		akjPtr += startRow-rowjTop; // pointer to start of block row
-		maxRowijTop = startRow;
-	      } else
-		maxRowijTop = rowjTop;
-
-	      int k;
-	      for (k=maxRowijTop; k<currentRow; k++) {
-		double tmp = *akjPtr;
-		int rowkTop = RowTop[k];
-		int maxRowkjTop;
-		double *alkPtr, *aljPtr;
-		if (rowkTop < rowjTop) {
-		  alkPtr = topRowPtr[k] + (rowjTop - rowkTop);
-		  aljPtr = topRowPtr[currentRow];
-		  maxRowkjTop = rowjTop;
-		} else {
-		  alkPtr = topRowPtr[k];
-		  aljPtr = topRowPtr[currentRow] + (rowkTop - rowjTop);
-		  maxRowkjTop = rowkTop;
-		}
-
-		for (int l = maxRowkjTop; l<k; l++) 
-		  tmp -= *alkPtr++ * *aljPtr++;
-		
-		*akjPtr++ = tmp;
-	      }
-
-	      double ajj = *akjPtr;
-	      akjPtr = topRowPtr[currentRow];
-	      //	      akjPtr = &A[iDiagLoc[currentRow-1]];
-	      double *bjPtr  = &X[rowjTop];  
-	      double tmp = 0;	    
-
-	      for (k=rowjTop; k<currentRow; k++){
-		double akj = *akjPtr;
-		double lkj = akj * invD[k];
-		tmp -= lkj * *bjPtr++; 		
-		*akjPtr++ = lkj;
-		ajj = ajj -lkj * akj;
-	      }
-
-	      X[currentRow] += tmp;
-
-	      // check that the diag > the tolerance specified
-	      if (ajj <= 0.0) {
-		std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-		std::cerr << " aii < 0 (i, aii): (" << currentRow << ", " << ajj << ")\n"; 
-		TCB_ProfileSPDDirectThreadSolver.info = -2;
-		return nullptr;
-	      }
-	      if (ajj <= minDiagTol) {
-		std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-		std::cerr << " aii < minDiagTol (i, aii): (" << currentRow;
-		std::cerr << ", " << ajj << ")\n"; 
-		TCB_ProfileSPDDirectThreadSolver.info = -2;
-		return nullptr;
-	      }		
-	      invD[currentRow] = 1.0/ajj; 
-
-	    } else 
-	      j = blockSize;
-
-	  }
-
-          // allow other threads to now proceed
-          mutex_lock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-	    TCB_ProfileSPDDirectThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);        
-
-
-	  // now do rest of i'th block row belonging to thread
-	  // doing a block of columns at a time forming Ui,j*Di
-	  int currentCol = startRow + blockSize;
-	  for (j=i+1; j<nBlck; j++) {
-
-	    if (j%numThreads == myID) {
-
-	      for (int k=0; k<blockSize; k++) {
-
-		if (currentCol < size) { // this is for case when size%blockSize != 0
-
-		  int rowkTop = RowTop[currentCol];
-		  double *alkPtr = topRowPtr[currentCol];
-		  // double *alkPtr = &A[iDiagLoc[currentCol-1]];
-		  int maxRowikTop;
-		  if (rowkTop < startRow) {
-		    alkPtr += startRow-rowkTop; // pointer to start of block row
-		    maxRowikTop = startRow;
-		  } else
-		    maxRowikTop = rowkTop;
-
-		  for (int l=maxRowikTop; l<=lastRow; l++) {
-		    double tmp = *alkPtr;
-		    int rowlTop = RowTop[l];
-		    int maxRowklTop;
-		    double *amlPtr, *amkPtr;
-		    if (rowlTop < rowkTop) {
-		      amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
-		      amkPtr = topRowPtr[currentCol];
-		      maxRowklTop = rowkTop;
-		    } else {
-		      amlPtr = topRowPtr[l];
-		      amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
-		      maxRowklTop = rowlTop;
-		    }
-		  
-		    for (int m = maxRowklTop; m<l; m++) 
-		      tmp -= *amkPtr++ * *amlPtr++;
-		  
-		    *alkPtr++ = tmp;
-		  }
-		  currentCol++;
-		  if (currentCol > lastColEffected) {
-		    k = blockSize;
-		    j = nBlck;
-		  }
-		  
-		} else
-		  k = blockSize;
-	      }
-	    } else
-	      currentCol += blockSize;
-	  }
-	} else {
-          // wait till diag i is done 
-          mutex_lock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-             while (TCB_ProfileSPDDirectThreadSolver.currentBlock < i)
-                cond_wait(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond, &TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-          mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-	  // now do rest of i'th block row belonging to thread
-	  // doing a block of columns at a time forming Ui,j*Di
-	  int currentCol = startRow + blockSize;
-	  for (int j=i+1; j<nBlck; j++) {
-
-	    if (j%numThreads == myID) {
-
-	      for (int k=0; k<blockSize; k++) {
-
-		if (currentCol < size) { // this is for case when size%blockSize != 0
-
-		  int rowkTop = RowTop[currentCol];
-		  double *alkPtr = topRowPtr[currentCol];
-		  // double *alkPtr = &A[iDiagLoc[currentCol-1]];
-		  int maxRowikTop;
-		  if (rowkTop < startRow) {
-		    alkPtr += startRow-rowkTop; // pointer to start of block row
-		    maxRowikTop = startRow;
-		  } else
-		    maxRowikTop = rowkTop;
-
-		  for (int l=maxRowikTop; l<=lastRow; l++) {
-		    double tmp = *alkPtr;
-		    int rowlTop = RowTop[l];
-		    int maxRowklTop;
-		    double *amlPtr, *amkPtr;
-		    if (rowlTop < rowkTop) {
-		      amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
-		      amkPtr = topRowPtr[currentCol];
-		      maxRowklTop = rowkTop;
-		    } else {
-		      amlPtr = topRowPtr[l];
-		      amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
-		      maxRowklTop = rowlTop;
-		    } 
-
-		    for (int m = maxRowklTop; m<l; m++) 
-		      tmp -= *amkPtr++ * *amlPtr++;
-		  
-		    *alkPtr++ = tmp;
-		  }
-		  currentCol++;
-		  if (currentCol > lastColEffected) {
-		    k = blockSize;
-		    j = nBlck;
-		  }
-		  
-		} else
-		  k = blockSize;
-	      }
-	    } else
-	      currentCol += blockSize;
-	  
-	  }
-
-	}
-
-	// update the data for the next block
-	startRow += blockSize;
-	lastRow = startRow + blockSize -1;
-	lastColEffected = lastRow + maxColHeight -1;
-      }
-
-      // signal the XC::main thread that this thread is done with the work
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-         TCB_ProfileSPDDirectThreadSolver.threadsDone++;
-
-         cond_signal(&TCB_ProfileSPDDirectThreadSolver.end_cond);
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-    } 
-}
+  }
@@ -79,32 +79,53 @@ class ProfileSPDLinSOE;
 //! solve a ProfileSPDLinSOE object. It does this in parallel using
 //! threads by direct means, using the \f$LDL^t\f$ variation of the cholesky
 //! factorization. The matrx \f$A\f$ is factored one row block at a time using
-//! a left-looking approach. Within a row block the factorization is
-//! performed by \f$NP\f$ threads. No BLAS or LAPACK routines are called 
-//! for the factorization or subsequent substitution.
+//! a left-looking approach: the diagonal block is factored by the
+//! calling thread and the rest of the row block is computed by
+//! \f$NP\f$ threads, column by column. The forward and back
+//! substitutions are performed by blocks too. No BLAS or LAPACK
+//! routines are called for the factorization or subsequent substitution.
+//! The factor is the same that the one computed by
+//! ProfileSPDLinDirectSolver and the results don't depend on the
+//! number of threads.
 class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinDirectBase
   {
   protected:
-    int NP;
-    int running;
-    
-    int blockSize;
-    int maxColHeight;
+    size_t NP; //!< number of threads.
+    int blockSize; //!< number of rows of each block.
+    int maxColHeight; //!< maximum height of the columns.
 
-    ProfileSPDLinDirectThreadSolver();      
-    ProfileSPDLinDirectThreadSolver(int numProcessors, int blockSize, double tol);    
+    int factor(void);
+    void substitute(double *) const;
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    ProfileSPDLinDirectThreadSolver(void);      
+    ProfileSPDLinDirectThreadSolver(int numThreads, int blockSize, double tol);    
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     virtual int solve(void);        
     virtual int setSize(void);    
+    double getDeterminant(void);
 
     virtual int setProfileSOE(ProfileSPDLinSOE &theSOE);
 
+    //! @brief Return the number of threads.
+    inline size_t getNumThreads(void) const
+      { return NP; }
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of rows of each block.
+    inline int getBlockSize(void) const
+      { return blockSize; }
+    void setBlockSize(const int &);
+
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
   };
 
+//! @brief Virtual constructor.
+inline LinearSOESolver *ProfileSPDLinDirectThreadSolver::getCopy(void) const
+   { return new ProfileSPDLinDirectThreadSolver(*this); }
 } // end of XC namespace
 
 
@@ -58,6 +58,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/Vector.h>
@@ -159,6 +160,12 @@ bool XC::ProfileSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! invoking setSize() on the associated Solver object is
 //! returned. 
 int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations. The height of each column is
+//! given by the lowest equation adjacent to the diagonal one.
+int XC::ProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
@@ -174,31 +181,16 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
     // now we go through the vertices to find the height of each col and
     // width of each row from the connectivity information.
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-
-    while ((vertexPtr = theVertices()) != 0)
-      {
-        int vertexNum = vertexPtr->getTag();
-        const std::set<int> &theAdjacency = vertexPtr->getAdjacency();
-        int iiDiagLoc = iDiagLoc(vertexNum);
-        int *iiDiagLocPtr = &(iDiagLoc(vertexNum));
-
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-          {
-            const int otherNum= *i;
-            const int diff= vertexNum-otherNum;
-            if(diff > 0)
-              {
-                if(iiDiagLoc < diff)
-                  {
-                    iiDiagLoc = diff;
-                    *iiDiagLocPtr = diff;
-                  }
-              } 
-          }
-      }
-
+    const int numVertex= theGraph.getNumVertex();
+    for(int i= 0;i<numVertex;i++)
+      if(theGraph.getDegree(i)>0)
+        {
+          // adjacency is sorted, so the lowest equation comes first.
+          const int vertexNum= theGraph.getTag(i);
+          const int diff= vertexNum-theGraph.getTag(*theGraph.adjBegin(i));
+          if(iDiagLoc(vertexNum) < diff)
+            iDiagLoc(vertexNum)= diff;
+        }
 
     // now go through iDiagLoc, adding 1 for the diagonal element
     // and then adding previous entry to give current location.
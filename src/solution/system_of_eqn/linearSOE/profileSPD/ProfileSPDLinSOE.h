@@ -134,6 +134,7 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     
     virtual void zeroA(void);
@@ -22,7 +22,10 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
+.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'band_spd_lin_thread_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'profile_spd_lin_direct_thread_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'supernodal_ldl_solver', 'pcg_solver', 'minres_solver', 'gmres_solver'" )
+  .add_property("numSolves", &XC::LinearSOE::getNumSolves,"Number of times the system has been solved.")
+  .add_property("numFactorizations", &XC::LinearSOE::getNumFactorizations,"Number of solutions that needed to factor the matrix (the others reused the previous factorization).")
+  .def("resetCounters", &XC::LinearSOE::resetCounters,"Sets to zero the solution counters.")
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -98,6 +101,10 @@ class_<XC::SparseGenRowLinSOE, bases<XC::SparseGenSOEBase>, boost::noncopyable >
 class_<XC::SymSparseLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SymSparseLinSOE", no_init)
     ;
 
+class_<XC::SymSparseColLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SymSparseColLinSOE", no_init)
+  .add_property("nnz", &XC::SymSparseColLinSOE::getNNZ,"Number of coefficients stored (lower triangle).")
+    ;
+
 // class_<XC::UmfpackGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("UmfpackGenLinSOE", no_init)
 //     ;
 
@@ -111,7 +118,10 @@ class_<XC::BandSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("B
 
 class_<XC::BandSPDLinLapackSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinLapackSolver", no_init);
 
-// class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init);
+class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init)
+  .add_property("numThreads", &XC::BandSPDLinThreadSolver::getNumThreads, &XC::BandSPDLinThreadSolver::setNumThreads,"Number of threads (0: as many as the hardware supports).")
+  .add_property("blockSize", &XC::BandSPDLinThreadSolver::getBlockSize, &XC::BandSPDLinThreadSolver::setBlockSize,"Number of columns of each block.")
+  ;
 
 class_<XC::ConjugateGradientSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ConjugateGradientSolver", no_init);
 
@@ -135,7 +145,10 @@ class_<XC::ProfileSPDLinDirectBlockSolver, bases<XC::ProfileSPDLinDirectBase>, b
 
 class_<XC::ProfileSPDLinDirectSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectSolver", no_init);
 
-// class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init);
+class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init)
+  .add_property("numThreads", &XC::ProfileSPDLinDirectThreadSolver::getNumThreads, &XC::ProfileSPDLinDirectThreadSolver::setNumThreads,"Number of threads (0: as many as the hardware supports).")
+  .add_property("blockSize", &XC::ProfileSPDLinDirectThreadSolver::getBlockSize, &XC::ProfileSPDLinDirectThreadSolver::setBlockSize,"Number of rows of each block.")
+  ;
 
 class_<XC::ProfileSPDLinSubstrSolver, bases<XC::ProfileSPDLinDirectBase,XC::DomainSolver>, boost::noncopyable >("ProfileSPDLinSubstrSolver", no_init);
 
@@ -151,6 +164,50 @@ class_<XC::SparseGenRowLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable
 
 class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SymSparseLinSolver", no_init);
 
+class_<XC::SymSparseColLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SymSparseColLinSolver", no_init);
+
+class_<XC::SupernodalLDLSolver, bases<XC::SymSparseColLinSolver>, boost::noncopyable >("SupernodalLDLSolver", no_init)
+  .add_property("numThreads", &XC::SupernodalLDLSolver::getNumThreads, &XC::SupernodalLDLSolver::setNumThreads,"Number of threads used in the numerical factorization (0: as many as the hardware supports).")
+  .add_property("numSupernodes", &XC::SupernodalLDLSolver::getNumSupernodes,"Number of supernodes of the factor.")
+  .add_property("factorSize", &XC::SupernodalLDLSolver::getFactorSize,"Number of coefficients of the factor.")
+  ;
+
+class_<XC::Preconditioner, boost::noncopyable >("Preconditioner", no_init);
+
+class_<XC::JacobiPreconditioner, bases<XC::Preconditioner>, boost::noncopyable >("JacobiPreconditioner", no_init);
+
+class_<XC::IncompleteCholeskyPreconditioner, bases<XC::Preconditioner>, boost::noncopyable >("IncompleteCholeskyPreconditioner", no_init)
+  .add_property("shift", &XC::IncompleteCholeskyPreconditioner::getShift,"Diagonal shift used in the last factorization (0 if the factorization didn't break down).")
+  ;
+
+class_<XC::ILUPreconditioner, bases<XC::Preconditioner>, boost::noncopyable >("ILUPreconditioner", no_init);
+
+class_<XC::AMGPreconditioner, bases<XC::Preconditioner>, boost::noncopyable >("AMGPreconditioner", no_init)
+  .add_property("strengthThreshold", &XC::AMGPreconditioner::getStrengthThreshold, &XC::AMGPreconditioner::setStrengthThreshold,"Threshold of the strong connections used to build the aggregates.")
+  .add_property("maxNumLevels", &XC::AMGPreconditioner::getMaxNumLevels, &XC::AMGPreconditioner::setMaxNumLevels,"Maximum number of levels of the hierarchy.")
+  .add_property("coarseSize", &XC::AMGPreconditioner::getCoarseSize, &XC::AMGPreconditioner::setCoarseSize,"Maximum order of the coarsest matrix (solved with a direct method).")
+  .add_property("numSweeps", &XC::AMGPreconditioner::getNumSweeps, &XC::AMGPreconditioner::setNumSweeps,"Number of Gauss-Seidel sweeps before and after the coarse grid correction.")
+  .add_property("numLevels", &XC::AMGPreconditioner::getNumLevels,"Number of levels of the hierarchy.")
+  .add_property("operatorComplexity", &XC::AMGPreconditioner::getOperatorComplexity,"Number of coefficients of all the levels divided by the number of coefficients of the system matrix.")
+  ;
+
+class_<XC::KrylovLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("KrylovLinSolver", no_init)
+  .def("newPreconditioner", &XC::KrylovLinSolver::newPreconditioner,return_internal_reference<>(),"newPreconditioner(type): define the preconditioner. Available types: 'none', 'jacobi', 'incomplete_cholesky', 'ilu0' and 'amg'.")
+  .add_property("preconditioner", make_function(&XC::KrylovLinSolver::getPreconditioner, return_internal_reference<>()),"Return the preconditioner.")
+  .add_property("tolerance", &XC::KrylovLinSolver::getTolerance, &XC::KrylovLinSolver::setTolerance,"Tolerance (relative to the norm of the right hand side) of the residual norm.")
+  .add_property("maxNumIter", &XC::KrylovLinSolver::getMaxNumIter, &XC::KrylovLinSolver::setMaxNumIter,"Maximum number of iterations.")
+  .add_property("numIter", &XC::KrylovLinSolver::getNumIter,"Number of iterations performed in the last solution.")
+  .add_property("relativeResidualNorm", &XC::KrylovLinSolver::getRelativeResidualNorm,"Norm of the residual divided by the norm of the right hand side at the end of the last solution.")
+  ;
+
+class_<XC::PCGSolver, bases<XC::KrylovLinSolver>, boost::noncopyable >("PCGSolver", no_init);
+
+class_<XC::MINRESSolver, bases<XC::KrylovLinSolver>, boost::noncopyable >("MINRESSolver", no_init);
+
+class_<XC::GMRESSolver, bases<XC::KrylovLinSolver>, boost::noncopyable >("GMRESSolver", no_init)
+  .add_property("restart", &XC::GMRESSolver::getRestart, &XC::GMRESSolver::setRestart,"Number of iterations between restarts.")
+  ;
+
 // class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init);
 
 
@@ -83,6 +83,12 @@ void XC::DistributedSparseGenColLinSOE::calcNonZeros(Graph &theGraph)
       }
   }
 
+//! @brief Set the size of the system from the compressed graph. The
+//! distributed system exchanges Graph objects between processes so the
+//! call is routed to setSize(Graph &).
+int XC::DistributedSparseGenColLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
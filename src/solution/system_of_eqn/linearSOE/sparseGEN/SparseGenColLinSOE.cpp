@@ -60,8 +60,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 //! @brief Constructor.
@@ -120,83 +119,40 @@ bool XC::SparseGenColLinSOE::setSolver(LinearSOESolver *newSolver)
 //! ascending order. Finally, the result of invoking setSize() on
 //! the associated Solver object is returned.
 int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+//!
+//! The adjacency of each vertex, plus the diagonal term, gives the
+//! rows of the non-zero entries of the corresponding column (the
+//! matrix pattern is symmetric), see CSRGraph::getPattern.
+int XC::SparseGenColLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while((theVertex = theVertices()) != 0)
+    // fill in colStartA and rowA (diagonal entries included).
+    const int newNNZ= theGraph.getPattern(colStartA,rowA);
+    if(newNNZ < 0)
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertices must be numbered from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
     nnz = newNNZ;
 
     if(newNNZ > A.Size())
-      { // we have to get more space for A and rowA
-	A.resize(newNNZ);
-        rowA.resize(newNNZ);
-      }
+      A.resize(newNNZ);
     A.Zero();
 	
     factored = false;
     
     if(size > B.Size())
-      { // we have to get space for the vectors
-	
-        inic(size);
-	colStartA.resize(size+1);	
-      }
+      inic(size);
 
-    // fill in colStartA and rowA
-    if(size != 0)
-      {
-        colStartA(0)= 0;
-        int startLoc = 0;
-        int lastLoc = 0;
-        for(int a=0;a<size;a++)
-          {
-            theVertex = theGraph.getVertexPtr(a);
-	    if(theVertex == 0)
-              {
-	        std::cerr << getClassName() << "::" << __FUNCTION__
-			  << "; WARNING :"
-			  << " vertex " << a
-			  << " not in graph! - size set to 0.\n";
-	        size = 0;
-	        return -1;
-	      }
-            rowA(lastLoc++) = theVertex->getTag(); // place diag in first
-	    const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	    // now we have to place the entries in the ID into order in rowA
-            for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-              {
-                int row = *i;
-	        bool foundPlace = false;
-	        // find a place in rowA for current col
-	        for(int j=startLoc; j<lastLoc; j++)
-	          if(rowA(j) > row)
-                    { 
-	              // move the entries already there one further on
-	              // and place col in current location
-	              for(int k=lastLoc; k>j; k--)
-			rowA(k) = rowA(k-1);
-	              rowA(j) = row;
-	              foundPlace = true;
-	              j = lastLoc;
-	            }
-	        if(!foundPlace) // put in at the end
-	          rowA(lastLoc)= row;
-                lastLoc++;
-	      }
-	    colStartA(a+1)= lastLoc;;	    
-	    startLoc = lastLoc;
-          }
-      }
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
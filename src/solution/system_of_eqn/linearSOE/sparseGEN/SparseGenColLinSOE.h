@@ -145,6 +145,7 @@ class SparseGenColLinSOE : public SparseGenSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     
     virtual int sendSelf(CommParameters &);
@@ -55,11 +55,11 @@
 
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 //! @brief Constructor.
@@ -72,8 +72,11 @@ bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
   {
     bool retval= false;
     SparseGenRowLinSolver *tmp= dynamic_cast<SparseGenRowLinSolver *>(newSolver);
+    KrylovLinSolver *tmpKrylov= dynamic_cast<KrylovLinSolver *>(newSolver);
     if(tmp)
       retval= SparseGenSOEBase::setSolver(tmp);
+    else if(tmpKrylov)
+      retval= SparseGenSOEBase::setSolver(tmpKrylov);
     else
       std::cerr << "SparseGenRowLinSOE::setSolver; solver incompatible con system of equations." << std::endl;
     return retval;
@@ -81,93 +84,52 @@ bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
 
 //! @brief Sets the size of the system from the number of vertices in the graph.
 int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+//!
+//! The adjacency of each vertex, plus the diagonal term, gives the
+//! columns of the non-zero entries of the corresponding row, see
+//! CSRGraph::getPattern.
+int XC::SparseGenRowLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0)
+    // fill in rowStartA and colA (diagonal entries included).
+    const int newNNZ= theGraph.getPattern(rowStartA,colA);
+    if(newNNZ < 0)
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertices must be numbered from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
     nnz = newNNZ;
 
     if(newNNZ > A.Size())
-      { // we have to get more space for A and colA
-	A.resize(newNNZ);
-	colA.resize(newNNZ);
-      }
+      A.resize(newNNZ);
     A.Zero();
 	
     factored = false;
     
     if(size > B.Size())
-      {	
-        inic(size);
-	rowStartA.resize(size+1); 
-      }
-
-    // fill in rowStartA and colA
-    if(size != 0)
-      {
-        rowStartA(0) = 0;
-        int startLoc = 0;
-        int lastLoc = 0;
-        for(int a=0; a<size; a++)
-          {
-            theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	  std::cerr << "WARNING:XC::SparseGenRowLinSOE::setSize :";
-	  std::cerr << " vertex " << a << " not in graph! - size set to 0\n";
-	  size = 0;
-	  return -1;
-	}
-
-	colA(lastLoc++) = theVertex->getTag(); // place diag in first
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	// now we have to place the entries in the XC::ID into order in colA
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-	  {
+      inic(size);
 
-	  int row = *i;
-	  bool foundPlace = false;
-	  // find a place in colA for current col
-	  for (int j=startLoc; j<lastLoc; j++)
-	    if (colA(j) > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	      for (int k=lastLoc; k>j; k--)
-		
-		colA(k) = colA(k-1);
-	      colA(j) = row;
-	      foundPlace = true;
-	      j = lastLoc;
-	    }
-	  if(foundPlace == false) // put in at the end
-	    colA(lastLoc) = row;
-
-	  lastLoc++;
-	}
-	rowStartA(a+1)= lastLoc;;	    
-	startLoc = lastLoc;
-      }
-    }
-    
-    // invoke setSize() on the XC::Solver   
-     LinearSOESolver *the_Solver = this->getSolver();
+    // invoke setSize() on the Solver    
+    LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
-    if (solverOK < 0) {
-	std::cerr << "WARNING:XC::SparseGenRowLinSOE::setSize :";
-	std::cerr << " solver failed setSize()\n";
+    if(solverOK < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING :"
+		  << " solver failed setSize()\n";
 	return solverOK;
-    }    
+      }   
     return result;
-}
+  }
 
 int 
 XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
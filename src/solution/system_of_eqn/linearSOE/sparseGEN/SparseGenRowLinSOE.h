@@ -66,6 +66,7 @@
 
 namespace XC {
 class SparseGenRowLinSolver;
+class KrylovLinSolver;
 
 //! @ingroup SOE
 //
@@ -83,11 +84,13 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
     friend class PetscSparseSeqSolver;    
+    friend class KrylovLinSolver;
   };
 inline SystemOfEqn *SparseGenRowLinSOE::getCopy(void) const
   { return new SparseGenRowLinSOE(*this); }
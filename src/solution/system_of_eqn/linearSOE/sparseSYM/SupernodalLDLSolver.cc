@@ -0,0 +1,573 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalLDLSolver.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SupernodalLDLSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSOE.h>
+#include "utility/parallel/ThreadPool.h"
+#include <algorithm>
+
+extern "C" int dgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		      double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		      double *BETA, double *C, int *LDC);
+
+extern "C" int dtrsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		      int *M, int *N, double *ALPHA, double *A, int *LDA,
+		      double *B, int *LDB);
+
+//! @brief Constructor.
+XC::SupernodalLDLSolver::SupernodalLDLSolver(void)
+  :SymSparseColLinSolver(SOLVER_TAGS_SupernodalLDLSolver), numThreads(1), numEqn(0) {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::SupernodalLDLSolver::getCopy(void) const
+  { return new SupernodalLDLSolver(*this); }
+
+//! @brief Set the number of threads used in the numerical factorization
+//! (0: as many as the hardware supports).
+void XC::SupernodalLDLSolver::setNumThreads(const size_t &n)
+  {
+    if(n>0)
+      numThreads= n;
+    else
+      numThreads= ThreadPool::getDefaultNumThreads();
+  }
+
+//! @brief Return the number of coefficients (diagonal included) of
+//! the factor.
+size_t XC::SupernodalLDLSolver::getFactorSize(void) const
+  {
+    size_t retval= 0;
+    const int numSnodes= getNumSupernodes();
+    for(int J= 0;J<numSnodes;J++)
+      {
+        const size_t w= getNumCols(J);
+        retval+= w*getNumRows(J)-w*(w-1)/2;
+      }
+    return retval;
+  }
+
+//! @brief Symbolic analysis of the matrix.
+//!
+//! Computes the elimination tree and the column counts of the factor,
+//! groups the columns into (relaxed) supernodes and computes the
+//! row indexes of each supernode, the supernodes that update each
+//! one and the levels of the supernodal elimination tree.
+int XC::SupernodalLDLSolver::symbolic(void)
+  {
+    numEqn= theSOE->size;
+    const int n= numEqn;
+    const int *colStart= theSOE->colStartA.getDataPtr();
+    const int *rowIdx= theSOE->rowA.getDataPtr();
+
+    // rows of the lower triangle (columns less than the row).
+    std::vector<int> rowPtr(n+1,0);
+    for(int j= 0;j<n;j++)
+      for(int k= colStart[j]+1;k<colStart[j+1];k++)
+        rowPtr[rowIdx[k]+1]++;
+    for(int i= 0;i<n;i++)
+      rowPtr[i+1]+= rowPtr[i];
+    std::vector<int> rowCols(rowPtr[n]);
+    std::vector<int> pos(rowPtr.begin(),rowPtr.end()-1);
+    for(int j= 0;j<n;j++)
+      for(int k= colStart[j]+1;k<colStart[j+1];k++)
+        rowCols[pos[rowIdx[k]]++]= j;
+
+    // elimination tree (with path compression).
+    std::vector<int> parent(n,-1), ancestor(n,-1);
+    for(int i= 0;i<n;i++)
+      for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+        {
+          int r= rowCols[k];
+          while((ancestor[r]!=-1) && (ancestor[r]!=i))
+            {
+              const int next= ancestor[r];
+              ancestor[r]= i;
+              r= next;
+            }
+          if(ancestor[r]==-1)
+            {
+              ancestor[r]= i;
+              parent[r]= i;
+            }
+        }
+
+    // column counts (diagonal included) traversing the row subtrees.
+    std::vector<int> colCount(n,1), mark(n,-1);
+    for(int i= 0;i<n;i++)
+      {
+        mark[i]= i;
+        for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+          for(int j= rowCols[k];mark[j]!=i;j= parent[j])
+            {
+              mark[j]= i;
+              colCount[j]++;
+            }
+      }
+
+    // supernodes: the column j is appended to the supernode of the
+    // column j-1 if it is its parent and the number of explicit zeros
+    // stored in the resulting dense block is small (relaxed supernodes).
+    // The rows of the supernode are its columns and the rows of the
+    // last one.
+    snodeStart.clear();
+    colSnode.resize(n);
+    size_t nzSnode= 0; // nonzeros of the columns of the current supernode.
+    for(int j= 0;j<n;j++)
+      {
+        bool merge= false;
+        if((j>0) && (parent[j-1]==j))
+          {
+            const size_t w= j-snodeStart.back()+1;
+            const size_t m= w-1+colCount[j];
+            const size_t stored= w*m-w*(w-1)/2;
+            const double zeros= stored-(nzSnode+colCount[j]);
+            merge= (zeros==0) || (w<=4) || ((w<=16) && (zeros<0.8*stored)) || ((w<=48) && (zeros<0.1*stored)) || (zeros<0.05*stored);
+          }
+        if(merge)
+          nzSnode+= colCount[j];
+        else
+          {
+            snodeStart.push_back(j);
+            nzSnode= colCount[j];
+          }
+        colSnode[j]= snodeStart.size()-1;
+      }
+    snodeStart.push_back(n);
+    const int numSnodes= snodeStart.size()-1;
+
+    // row indexes of each supernode.
+    rowStart.resize(numSnodes+1);
+    valueStart.resize(numSnodes+1);
+    rowStart[0]= 0;
+    valueStart[0]= 0;
+    for(int J= 0;J<numSnodes;J++)
+      {
+        const int w= getNumCols(J);
+        const int m= w-1+colCount[snodeStart[J+1]-1];
+        rowStart[J+1]= rowStart[J]+m;
+        valueStart[J+1]= valueStart[J]+size_t(m)*w;
+      }
+    rows.resize(rowStart[numSnodes]);
+    pos.resize(numSnodes);
+    for(int J= 0;J<numSnodes;J++)
+      {
+        pos[J]= rowStart[J];
+        for(int j= snodeStart[J];j<snodeStart[J+1]-1;j++)
+          rows[pos[J]++]= j;
+      }
+    std::fill(mark.begin(),mark.end(),-1);
+    for(int i= 0;i<n;i++)
+      {
+        mark[i]= i;
+        if(snodeStart[colSnode[i]+1]-1==i)
+          rows[pos[colSnode[i]]++]= i;
+        for(int k= rowPtr[i];k<rowPtr[i+1];k++)
+          for(int j= rowCols[k];mark[j]!=i;j= parent[j])
+            {
+              mark[j]= i;
+              if(snodeStart[colSnode[j]+1]-1==j)
+                rows[pos[colSnode[j]]++]= i;
+            }
+      }
+
+    // supernodes updating each supernode (those having rows in
+    // its columns), sorted in ascending order.
+    std::vector<int> updCount(numSnodes+1,0);
+    for(int K= 0;K<numSnodes;K++)
+      {
+        int last= -1;
+        for(int p= rowStart[K]+getNumCols(K);p<rowStart[K+1];p++)
+          {
+            const int J= colSnode[rows[p]];
+            if(J!=last)
+              {
+                updCount[J+1]++;
+                last= J;
+              }
+          }
+      }
+    updStart.resize(numSnodes+1);
+    updStart[0]= 0;
+    for(int J= 0;J<numSnodes;J++)
+      updStart[J+1]= updStart[J]+updCount[J+1];
+    updaters.resize(updStart[numSnodes]);
+    pos.assign(updStart.begin(),updStart.end()-1);
+    for(int K= 0;K<numSnodes;K++)
+      {
+        int last= -1;
+        for(int p= rowStart[K]+getNumCols(K);p<rowStart[K+1];p++)
+          {
+            const int J= colSnode[rows[p]];
+            if(J!=last)
+              {
+                updaters[pos[J]++]= K;
+                last= J;
+              }
+          }
+      }
+
+    // levels of the supernodal elimination tree (leaves first); the
+    // supernodes on the same level are independent.
+    std::vector<int> height(numSnodes,0);
+    int numLevels= 0;
+    for(int J= 0;J<numSnodes;J++)
+      {
+        numLevels= std::max(numLevels,height[J]+1);
+        const int p= parent[snodeStart[J+1]-1];
+        if(p>=0)
+          {
+            const int P= colSnode[p];
+            height[P]= std::max(height[P],height[J]+1);
+          }
+      }
+    levelStart.assign(numLevels+1,0);
+    for(int J= 0;J<numSnodes;J++)
+      levelStart[height[J]+1]++;
+    for(int l= 0;l<numLevels;l++)
+      levelStart[l+1]+= levelStart[l];
+    levelSnodes.resize(numSnodes);
+    pos.assign(levelStart.begin(),levelStart.end()-1);
+    for(int J= 0;J<numSnodes;J++)
+      levelSnodes[pos[height[J]]++]= J;
+
+    values.clear();
+    return 0;
+  }
+
+//! @brief Performs the symbolic analysis of the system of equations.
+int XC::SupernodalLDLSolver::setSize(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned."
+		  << std::endl;
+	return -1;
+      }
+    return symbolic();
+  }
+
+//! @brief Computes the columns of the supernode \p J.
+//!
+//! Scatters the coefficients of the matrix into the dense block of
+//! the supernode, subtracts the updates of its descendants and
+//! factors the block.
+//!
+//! @param J: index of the supernode.
+//! @param relMap: work array (size numEqn) to map rows into block positions.
+//! @param work: work array for the updates.
+int XC::SupernodalLDLSolver::factor_supernode(const int &J, std::vector<int> &relMap, std::vector<double> &work)
+  {
+    const int f= snodeStart[J];
+    int w= getNumCols(J);
+    int m= getNumRows(J);
+    const int *R= &rows[rowStart[J]];
+    double *Lj= &values[valueStart[J]];
+    for(int p= 0;p<m;p++)
+      relMap[R[p]]= p;
+
+    // scatter the columns of the matrix.
+    std::fill(Lj,Lj+size_t(m)*w,0.0);
+    const double *a= theSOE->A.getDataPtr();
+    const int *colStart= theSOE->colStartA.getDataPtr();
+    const int *rowIdx= theSOE->rowA.getDataPtr();
+    for(int c= 0;c<w;c++)
+      {
+        double *col= Lj+size_t(c)*m;
+        for(int k= colStart[f+c];k<colStart[f+c+1];k++)
+          col[relMap[rowIdx[k]]]= a[k];
+      }
+
+    // updates from the descendants: L(rows,cols)-= L_K(rows,:)*D_K*L_K(cols,:)^T
+    char strN[]= "N";
+    char strT[]= "T";
+    double one= 1.0;
+    double zero= 0.0;
+    for(int u= updStart[J];u<updStart[J+1];u++)
+      {
+        const int K= updaters[u];
+        int wK= getNumCols(K);
+        int mK= getNumRows(K);
+        const int *RK= &rows[rowStart[K]];
+        double *LK= &values[valueStart[K]];
+        const int *p1= std::lower_bound(RK+wK,RK+mK,f);
+        const int *p2= std::lower_bound(p1,RK+mK,f+w);
+        const int o= p1-RK;
+        int nr= mK-o;
+        int nc= p2-p1;
+        work.resize(size_t(nc)*wK+size_t(nr)*nc);
+        double *Y= work.data();
+        double *W= Y+size_t(nc)*wK;
+        for(int k= 0;k<wK;k++)
+          {
+            const double *colK= LK+size_t(k)*mK;
+            const double d= colK[k];
+            for(int i= 0;i<nc;i++)
+              Y[size_t(k)*nc+i]= colK[o+i]*d;
+          }
+        dgemm_(strN,strT,&nr,&nc,&wK,&one,LK+o,&mK,Y,&nc,&zero,W,&nr);
+        for(int b= 0;b<nc;b++)
+          {
+            double *col= Lj+size_t(RK[o+b]-f)*m;
+            const double *wCol= W+size_t(b)*nr;
+            for(int i= b;i<nr;i++)
+              col[relMap[RK[o+i]]]-= wCol[i];
+          }
+      }
+
+    // blocked LDL^T factorization of the dense block.
+    const int blockSize= 64;
+    for(int p= 0;p<w;p+= blockSize)
+      {
+        int nb= std::min(blockSize,w-p);
+        double *Lp= Lj+size_t(p)*m+p; // diagonal block of the panel.
+        // panel diagonal block.
+        for(int j= 0;j<nb;j++)
+          {
+            double *colJ= Lp+size_t(j)*m;
+            const double d= colJ[j];
+            if(d==0.0)
+              return -1;
+            for(int i= j+1;i<nb;i++)
+              colJ[i]/= d;
+            for(int c= j+1;c<nb;c++)
+              {
+                const double t= colJ[c]*d;
+                double *col= Lp+size_t(c)*m;
+                for(int i= c;i<nb;i++)
+                  col[i]-= colJ[i]*t;
+              }
+          }
+        int nr= m-p-nb;
+        if(nr>0)
+          {
+            // panel rows below: L21= A21*L11^-T*D^-1
+            char strR[]= "R";
+            char strL[]= "L";
+            char strU[]= "U";
+            dtrsm_(strR,strL,strT,strU,&nr,&nb,&one,Lp,&m,Lp+nb,&m);
+            for(int j= 0;j<nb;j++)
+              {
+                double *colJ= Lp+size_t(j)*m;
+                const double d= colJ[j];
+                for(int i= nb;i<m-p;i++)
+                  colJ[i]/= d;
+              }
+            // trailing columns of the supernode: A22-= L21*D*L21^T
+            int nc= w-p-nb;
+            if(nc>0)
+              {
+                work.resize(size_t(nc)*nb);
+                double *Y= work.data();
+                for(int j= 0;j<nb;j++)
+                  {
+                    const double *colJ= Lp+size_t(j)*m;
+                    const double d= colJ[j];
+                    for(int i= 0;i<nc;i++)
+                      Y[size_t(j)*nc+i]= colJ[nb+i]*d;
+                  }
+                double minusOne= -1.0;
+                dgemm_(strN,strT,&nr,&nc,&nb,&minusOne,Lp+nb,&m,Y,&nc,&one,Lp+size_t(nb)*m+nb,&m);
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Numerical factorization of the matrix.
+//!
+//! The supernodes are factored level by level of the elimination
+//! tree; the supernodes of each level are distributed among the
+//! threads. The results don't depend on the number of threads.
+int XC::SupernodalLDLSolver::factor(void)
+  {
+    const int numSnodes= getNumSupernodes();
+    values.resize(valueStart[numSnodes]);
+    std::vector<int> status(numSnodes,0);
+    if(numThreads<2)
+      {
+        std::vector<int> relMap(numEqn);
+        std::vector<double> work;
+        for(int J= 0;J<numSnodes;J++)
+          status[J]= factor_supernode(J,relMap,work);
+      }
+    else
+      {
+        ThreadPool &pool= ThreadPool::getThreadPool();
+        const size_t nt= pool.getNumThreads(numThreads);
+        std::vector<std::vector<int> > relMaps(nt,std::vector<int>(numEqn));
+        std::vector<std::vector<double> > work(nt);
+        const size_t numLevels= levelStart.size()-1;
+        for(size_t l= 0;l<numLevels;l++)
+          pool.parallel_for(levelStart[l],levelStart[l+1],[&](const size_t &i, const size_t &threadIdx)
+            {
+              const int J= levelSnodes[i];
+              status[J]= factor_supernode(J,relMaps[threadIdx],work[threadIdx]);
+            },numThreads);
+      }
+    int retval= 0;
+    for(int J= 0;J<numSnodes;J++)
+      if(status[J]<0)
+        {
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; WARNING zero pivot in the equations "
+                    << snodeStart[J] << " to " << snodeStart[J+1]-1
+                    << " - the matrix is singular"
+                    << " or needs pivoting." << std::endl;
+          retval= -2;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Solves \f$LDL^Tx=b\f$ overwriting the right hand side
+//! \p x with the solution.
+void XC::SupernodalLDLSolver::solve_factored(double *x) const
+  {
+    const int numSnodes= getNumSupernodes();
+    // forward substitution.
+    for(int J= 0;J<numSnodes;J++)
+      {
+        const int f= snodeStart[J];
+        const int w= getNumCols(J);
+        const int m= getNumRows(J);
+        const int *R= &rows[rowStart[J]];
+        const double *Lj= &values[valueStart[J]];
+        for(int j= 0;j<w;j++)
+          {
+            const double *colJ= Lj+size_t(j)*m;
+            const double xj= x[f+j];
+            for(int i= j+1;i<w;i++)
+              x[f+i]-= colJ[i]*xj;
+            for(int i= w;i<m;i++)
+              x[R[i]]-= colJ[i]*xj;
+          }
+      }
+    // diagonal.
+    for(int J= 0;J<numSnodes;J++)
+      {
+        const int f= snodeStart[J];
+        const int w= getNumCols(J);
+        const int m= getNumRows(J);
+        const double *Lj= &values[valueStart[J]];
+        for(int j= 0;j<w;j++)
+          x[f+j]/= Lj[size_t(j)*m+j];
+      }
+    // backward substitution.
+    for(int J= numSnodes-1;J>=0;J--)
+      {
+        const int f= snodeStart[J];
+        const int w= getNumCols(J);
+        const int m= getNumRows(J);
+        const int *R= &rows[rowStart[J]];
+        const double *Lj= &values[valueStart[J]];
+        for(int j= w-1;j>=0;j--)
+          {
+            const double *colJ= Lj+size_t(j)*m;
+            double s= 0.0;
+            for(int i= j+1;i<w;i++)
+              s+= colJ[i]*x[f+i];
+            for(int i= w;i<m;i++)
+              s+= colJ[i]*x[R[i]];
+            x[f+j]-= s;
+          }
+      }
+  }
+
+//! @brief Computes the solution of the system of equations.
+//!
+//! If the system has not been factored yet, the numerical
+//! factorization is performed (reusing the symbolic analysis)
+//! before the forward and backward substitutions.
+int XC::SupernodalLDLSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned."
+		  << std::endl;
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+    if(numEqn!=n)
+      symbolic();
+    if(!theSOE->factored)
+      {
+        const int retval= factor();
+        if(retval<0)
+          return retval;
+        theSOE->factored= true;
+      }
+    double *x= theSOE->X.getDataPtr();
+    const double *b= theSOE->B.getDataPtr();
+    std::copy(b,b+n,x);
+    solve_factored(x);
+    return 0;
+  }
+
+//! @brief Return the determinant of the matrix (product of the
+//! diagonal of D).
+double XC::SupernodalLDLSolver::getDeterminant(void)
+  {
+    double retval= 1.0;
+    if(theSOE && theSOE->factored)
+      {
+        const int numSnodes= getNumSupernodes();
+        for(int J= 0;J<numSnodes;J++)
+          {
+            const int w= getNumCols(J);
+            const int m= getNumRows(J);
+            const double *Lj= &values[valueStart[J]];
+            for(int j= 0;j<w;j++)
+              retval*= Lj[size_t(j)*m+j];
+          }
+      }
+    return retval;
+  }
+
+int XC::SupernodalLDLSolver::sendSelf(CommParameters &cp)
+  {
+    // nothing to do
+    return 0;
+  }
+
+int XC::SupernodalLDLSolver::recvSelf(const CommParameters &cp)
+  {
+    // nothing to do
+    return 0;
+  }
+
+//! @brief Print stuff.
+void XC::SupernodalLDLSolver::Print(std::ostream &os) const
+  {
+    os << getClassName() << " number of equations: " << numEqn
+       << " number of supernodes: " << getNumSupernodes()
+       << " factor size: " << getFactorSize() << std::endl;
+  }
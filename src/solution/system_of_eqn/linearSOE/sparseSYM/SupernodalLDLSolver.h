@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalLDLSolver.h
+
+#ifndef SupernodalLDLSolver_h
+#define SupernodalLDLSolver_h
+
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSolver.h>
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Supernodal \f$LDL^T\f$ solver for sparse symmetric systems
+//! of equations (see SymSparseColLinSOE).
+//!
+//! The symbolic analysis (elimination tree, column counts and
+//! supernodes) is performed when the size of the system is set, so
+//! it is reused by all the factorizations of a given sparsity pattern.
+//! The consecutive columns of the factor sharing the same structure
+//! are grouped into supernodes whose coefficients are stored as dense
+//! blocks, so most of the floating point work of the (left-looking)
+//! numerical factorization is done by the BLAS level 3 routines. The
+//! supernodes on the same level of the elimination tree are independent
+//! and can be factored by several threads (see setNumThreads).
+//!
+//! The factorization is performed without pivoting, so it can be used
+//! with symmetric matrices whose leading principal minors are not
+//! singular (i.e. positive definite matrices and most of the
+//! indefinite ones arising from penalty or transformation
+//! constraint handlers). The fill of the factor depends on the
+//! numbering of the equations ('amd' and 'nested_dissection' DOF
+//! numberers are the recommended ones).
+class SupernodalLDLSolver: public SymSparseColLinSolver
+  {
+  private:
+    size_t numThreads; //!< number of threads used in the numerical factorization.
+    // symbolic analysis.
+    int numEqn; //!< number of equations of the analyzed system.
+    std::vector<int> snodeStart; //!< first column of each supernode (and total number of columns at the end).
+    std::vector<int> colSnode; //!< supernode of each column.
+    std::vector<int> rowStart; //!< position of the first row index of each supernode.
+    std::vector<int> rows; //!< row indexes of each supernode.
+    std::vector<size_t> valueStart; //!< position of the dense block of each supernode.
+    std::vector<int> updStart; //!< position of the first updating supernode of each supernode.
+    std::vector<int> updaters; //!< descendants that update each supernode.
+    std::vector<int> levelStart; //!< position of the first supernode of each level of the tree.
+    std::vector<int> levelSnodes; //!< supernodes sorted by level of the tree.
+    // numerical factorization.
+    std::vector<double> values; //!< dense blocks of L (unit diagonal) with D on its diagonal.
+
+    //! @brief Return the number of columns of the supernode.
+    inline int getNumCols(const int &J) const
+      { return snodeStart[J+1]-snodeStart[J]; }
+    //! @brief Return the number of rows of the supernode.
+    inline int getNumRows(const int &J) const
+      { return rowStart[J+1]-rowStart[J]; }
+    int symbolic(void);
+    int factor_supernode(const int &, std::vector<int> &, std::vector<double> &);
+    int factor(void);
+    void solve_factored(double *) const;
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    SupernodalLDLSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    int solve(void);
+    int setSize(void);
+    double getDeterminant(void);
+
+    //! @brief Return the number of threads used in the factorization.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of supernodes.
+    inline int getNumSupernodes(void) const
+      { return (snodeStart.empty() ? 0 : snodeStart.size()-1); }
+    size_t getFactorSize(void) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+
+    void Print(std::ostream &os) const;
+  };
+} // end of XC namespace
+
+#endif
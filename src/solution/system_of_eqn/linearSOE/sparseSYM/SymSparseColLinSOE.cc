@@ -0,0 +1,177 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SymSparseColLinSOE.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h>
+#include <utility/matrix/Matrix.h>
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+XC::SymSparseColLinSOE::SymSparseColLinSOE(AnalysisAggregation *owr)
+  :SparseSOEBase(owr,LinSOE_TAGS_SymSparseColLinSOE) {}
+
+//! @brief Set the solver to use.
+bool XC::SymSparseColLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    SymSparseColLinSolver *tmp= dynamic_cast<SymSparseColLinSolver *>(newSolver);
+    KrylovLinSolver *tmpKrylov= dynamic_cast<KrylovLinSolver *>(newSolver);
+    if(tmp)
+      retval= SparseSOEBase::setSolver(tmp);
+    else if(tmpKrylov)
+      retval= SparseSOEBase::setSolver(tmpKrylov);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; solver type incompatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the graph of the equations.
+int XC::SymSparseColLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+//!
+//! The graph must contain \p size vertices labelled \f$0\f$ through
+//! \f$size-1\f$. The rows of the column \f$i\f$ are \f$i\f$ and the
+//! vertices adjacent to \f$i\f$ greater than \f$i\f$. Finally the
+//! result of invoking setSize() on the associated solver (which
+//! performs the symbolic analysis of the matrix) is returned.
+int XC::SymSparseColLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    if(!theGraph.hasConsecutiveTags())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertices must be numbered from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
+      }
+
+    // fill in colStartA and rowA (lower triangle, diagonal first).
+    nnz= size;
+    for(int i= 0;i<size;i++)
+      nnz+= theGraph.adjEnd(i)-std::upper_bound(theGraph.adjBegin(i),theGraph.adjEnd(i),i);
+    if(colStartA.Size()<size+1)
+      colStartA.resize(size+1);
+    if(rowA.Size()<nnz)
+      rowA.resize(nnz);
+    int pos= 0;
+    for(int i= 0;i<size;i++)
+      {
+        colStartA(i)= pos;
+        rowA(pos++)= i;
+        for(const int *j= std::upper_bound(theGraph.adjBegin(i),theGraph.adjEnd(i),i);j!=theGraph.adjEnd(i);j++)
+          rowA(pos++)= *j;
+      }
+    colStartA(size)= pos;
+
+    if(nnz > A.Size())
+      A.resize(nnz);
+    A.Zero();
+    factored= false;
+    if(size > B.Size())
+      inic(size);
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver= this->getSolver();
+    const int solverOK= the_Solver->setSize();
+    if(solverOK < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solver failed setSize()\n";
+	return solverOK;
+      }
+    return 0;
+  }
+
+//! @brief Assembles the product fact*m into the system matrix.
+//!
+//! Only the coefficients of the lower triangle (row greater or equal
+//! than the column) are added; the ones whose location is outside
+//! the range (i.e. \f$-1\f$) are ignored.
+int XC::SymSparseColLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return
+    if(fact == 0.0)
+      return 0;
+
+    const int idSize= id.Size();
+    // check that m and id are of similar size
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+
+    const int *rows= rowA.getDataPtr();
+    for(int i= 0;i<idSize;i++)
+      {
+        const int col= id(i);
+        if((col < size) && (col >= 0))
+          {
+            const int *colBegin= rows+colStartA(col);
+            const int *colEnd= rows+colStartA(col+1);
+            for(int j= 0;j<idSize;j++)
+              {
+                const int row= id(j);
+                if((row < size) && (row >= col))
+                  {
+                    // find place in A using rowA
+                    const int *k= std::lower_bound(colBegin,colEnd,row);
+                    if((k!=colEnd) && (*k==row))
+                      A[k-rows]+= fact*m(j,i);
+                  }
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Zeros the entries in the 1d array for \f$A\f$ and marks the system
+//! as not having been factored.
+void XC::SymSparseColLinSOE::zeroA(void)
+  {
+    A.Zero();
+    factored= false;
+  }
+
+int XC::SymSparseColLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SymSparseColLinSOE::recvSelf(const CommParameters &cp)
+  { return 0; }
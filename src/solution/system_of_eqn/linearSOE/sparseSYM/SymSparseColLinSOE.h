@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SymSparseColLinSOE.h
+
+#ifndef SymSparseColLinSOE_h
+#define SymSparseColLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/SparseSOEBase.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class SymSparseColLinSolver;
+class SupernodalLDLSolver;
+class KrylovLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Sparse symmetric matrix linear system of equations
+//! (column-compacted storage of the lower triangle).
+//!
+//! Stores the matrix equation \f$Ax=b\f$ of order \f$size\f$ keeping
+//! only the lower triangle of \f$A\f$ (diagonal included) in
+//! compressed sparse column format: the \f$nnz\f$ coefficients are
+//! stored in the 1d double array \f$A\f$, column by column, with
+//! \f$colStartA(i)\f$ storing the position in \f$A\f$ of the start of
+//! column \f$i\f$ and \f$rowA(j)\f$ the row of the \f$j'th\f$
+//! coefficient. The rows of each column are sorted in ascending order,
+//! so the first coefficient of each column is the diagonal one.
+//! Unlike SymSparseLinSOE, the matrix is stored in the order given by
+//! the DOF numberer (use the 'amd' or 'nested_dissection' numberers
+//! to reduce the fill of the factorization). The system can be solved
+//! with the SupernodalLDLSolver or with the iterative solvers (see
+//! KrylovLinSolver).
+class SymSparseColLinSOE: public SparseSOEBase
+  {
+  protected:
+    Vector A; //!< coefficients of the lower triangle of A.
+    ID rowA; //!< row of each coefficient.
+    ID colStartA; //!< position of the first coefficient of each column.
+
+    virtual bool setSolver(LinearSOESolver *);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    SymSparseColLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual void zeroA(void);
+
+    //! @brief Return the number of non-zero coefficients stored.
+    inline int getNNZ(void) const
+      { return nnz; }
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+
+    friend class SymSparseColLinSolver;
+    friend class SupernodalLDLSolver;
+    friend class KrylovLinSolver;
+  };
+inline SystemOfEqn *SymSparseColLinSOE::getCopy(void) const
+  { return new SymSparseColLinSOE(*this); }
+} // end of XC namespace
+
+#endif
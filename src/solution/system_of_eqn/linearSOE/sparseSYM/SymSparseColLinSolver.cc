@@ -0,0 +1,59 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SymSparseColLinSolver.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSOE.h>
+
+//! @brief Constructor.
+//!
+//! @param classTag: class identifier.
+XC::SymSparseColLinSolver::SymSparseColLinSolver(int classTag)    
+  :LinearSOESolver(classTag), theSOE(nullptr) {}    
+
+//! @brief Sets the system of equations to solve.
+bool XC::SymSparseColLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    SymSparseColLinSOE *tmp= dynamic_cast<SymSparseColLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; the system of equations has not"
+	        << " a suitable type." << std::endl;
+    return retval;
+  }
+
+//! @brief Sets the link to the SymSparseColLinSOE object \p theSymSparseColSOE.
+//! This is the object on which the solver will perform the numerical
+//! computations.
+bool XC::SymSparseColLinSolver::setLinearSOE(SymSparseColLinSOE &theSymSparseColSOE)
+  { return setLinearSOE(&theSymSparseColSOE); }
@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SymSparseColLinSolver.h
+
+#ifndef SymSparseColLinSolver_h
+#define SymSparseColLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+namespace XC {
+class SymSparseColLinSOE;
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the solvers of sparse symmetric systems of
+//! equations stored in compressed sparse column format
+//! (see SymSparseColLinSOE).
+class SymSparseColLinSolver: public LinearSOESolver
+  {
+  protected:
+    SymSparseColLinSOE *theSOE; //!< System of equations to solve.
+
+    SymSparseColLinSolver(int classTag);
+    virtual bool setLinearSOE(LinearSOE *theSOE);
+  public:
+    virtual bool setLinearSOE(SymSparseColLinSOE &theSOE);
+  };
+} // end of XC namespace
+
+#endif
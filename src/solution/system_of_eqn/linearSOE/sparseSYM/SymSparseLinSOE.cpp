@@ -49,8 +49,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 
@@ -130,90 +129,41 @@ XC::SymSparseLinSOE::~SymSparseLinSOE(void)
  * Then perform the symbolic factorization by calling symFactorization().
  */
 int XC::SymSparseLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Set the size of the system from the graph (compressed sparse
+//! row format) of the equations.
+//!
+//! The row pointers and the adjacency of the graph are the pair
+//! (rowStartA, colA), so they are copied without any search
+//! (see CSRGraph::getPattern).
+int XC::SymSparseLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
 
-    // first iterarte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while((theVertex = theVertices()) != 0)
+    // fill in rowStartA and colA (no diagonal entries).
+    nnz= theGraph.getPattern(rowStartA,colA,false);
+    if(nnz < 0)
       {
-        const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size(); 
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertices must be numbered from 0 to "
+                  << size-1 << " - size set to 0\n";
+        size= 0; nnz= 0;
+        return -1;
       }
-    nnz = newNNZ;
- 
-    colA= ID(newNNZ);	
-    if(colA.isEmpty())
-      {
-        std::cerr << "WARNING SymSparseLinSOE::setSize :";
-	std::cerr << " ran out of memory for colA with nnz = ";
-      	std::cerr << newNNZ << " \n";
-       	size = 0; nnz = 0;
-       	result =  -1;
-      } 
 	
     factored = false;
     
     if(size > B.Size())
-      {
-	inic(size);
-	rowStartA= ID(size+1); 
-      }
-
-    // fill in rowStartA and colA
-    if(size != 0)
-      {
-        rowStartA(0) = 0;
-        int startLoc = 0;
-	int lastLoc = 0;
-
-	for (int a=0; a<size; a++) {
-	   theVertex = theGraph.getVertexPtr(a);
-	   if(theVertex == 0) {
-	        std::cerr << "WARNING:XC::SymSparseLinSOE::setSize :";
-	        std::cerr << " vertex " << a << " not in graph! - size set to 0\n";
-	        size = 0;
-	        return -1;
-	   }
-
-	   const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	// now we have to place the entries in the ID into order in colA
-           for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-  	     {
-	      const int row= *i;
-	      bool foundPlace = false;
-	 
-	      for (int j=startLoc; j<lastLoc; j++)
-		if(colA(j) > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	              for (int k=lastLoc; k>j; k--)
-			colA(k)= colA(k-1);
-                      colA(j) = row;
-		      foundPlace = true;
-    	              j = lastLoc;
-		  }
-		  
-	      if(foundPlace == false) // put in at the end
-		colA(lastLoc) = row;
-
-	      lastLoc++;
-	   }
-	   rowStartA(a+1)= lastLoc;	    
-	   startLoc = lastLoc;
-	}
-    }
+      inic(size);
     
     // call "C" function to form elimination tree and to do the symbolic factorization.
     nblks = symFactorization(rowStartA.getDataPtr(), colA.getDataPtr(), size, this->LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
 
     return result;
-}
+  }
 
 
 /* Perform the element stiffness assembly here.
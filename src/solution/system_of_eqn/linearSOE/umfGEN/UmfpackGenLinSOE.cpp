@@ -66,8 +66,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 
@@ -91,18 +90,24 @@ bool XC::UmfpackGenLinSOE::setSolver(LinearSOESolver *newSolver)
 
 //! @brief Sets the size of the system from the number of vertices in the graph.
 int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
+  { return setSize(CSRGraph(theGraph)); }
+
+//! @brief Sets the size of the system from the graph (compressed sparse
+//! row format) of the equations (see CSRGraph::getPattern).
+int XC::UmfpackGenLinSOE::setSize(const CSRGraph &theGraph)
   {
     int result = 0;
     size= checkSize(theGraph);
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0)
+    // fill in rowStartA and colA (diagonal entries included).
+    const int newNNZ= theGraph.getPattern(rowStartA,colA);
+    if(newNNZ < 0)
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: vertices must be numbered from 0 to "
+                  << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
     nnz = newNNZ;
     lValue = 20*nnz; // 20 because 3 (10 also) was not working for some instances
@@ -110,68 +115,15 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
     std::cerr << "XC::UmfpackGenLinSOE::setSize - n " << size << " nnz " << nnz << " lVal " << lValue << std::endl;
 
     if(lValue > A.Size())
-      { // we have to get more space for A and colA
+      { // we have to get more space for A and index
         A= Vector(lValue); // 3 if job =1, otherie 2 will do
-        colA= ID(newNNZ);
         index= ID(2*nnz);
       }
     A.Zero();
     factored = false;
     
     if(size > B.Size())
-      { // we have to get space for the vectors
-	
-        inic(size);	
-	rowStartA= ID(size+1);	
-      }
-
-    // fill in rowStartA and colA
-    if(size != 0)
-      {
-        rowStartA(0) = 0;
-      int startLoc = 0;
-      int lastLoc = 0;
-      for (int a=0; a<size; a++) {
-
-	theVertex = theGraph.getVertexPtr(a);
-	if(theVertex == 0)
-          {
-	    std::cerr << "WARNING:XC::UmfpackGenLinSOE::setSize :";
-	    std::cerr << " vertex " << a << " not in graph! - size set to 0\n";
-	    size = 0;
-	    return -1;
-	  }
-
-	colA(lastLoc++) = theVertex->getTag(); // place diag in first
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	// now we have to place the entries in the XC::ID into order in colA
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-          {
-	    const int row= *i;
-	  bool foundPlace = false;
-	  // find a place in colA for current col
-	  for (int j=startLoc; j<lastLoc; j++)
-	    if(colA[j] > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	      for (int k=lastLoc; k>j; k--)
-		
-		colA[k] = colA[k-1];
-	      colA[j] = row;
-	      foundPlace = true;
-	      j = lastLoc;
-	    }
-	  if(foundPlace == false) // put in at the end
-	    colA[lastLoc] = row;
-
-	  lastLoc++;
-	}
-	rowStartA[a+1] = lastLoc;;	    
-	startLoc = lastLoc;
-      }
-    }
-    
+      inic(size);
 
     // fill out index
     int *indexRowPtr = &index[0];
@@ -196,7 +148,7 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
 	return solverOK;
     }    
     return result;
-}
+  }
 
 int XC::UmfpackGenLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
 {
@@ -39,7 +39,7 @@
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 #include "solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h"
-//#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/DistributedBandSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DiagonalSOE.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DistributedDiagonalSOE.h>
@@ -55,7 +55,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h"
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h"
@@ -107,7 +107,16 @@
 #endif
 #endif
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseColLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/SupernodalLDLSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/PCGSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/MINRESSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/GMRESSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/JacobiPreconditioner.h>
+#include <solution/system_of_eqn/linearSOE/krylov/IncompleteCholeskyPreconditioner.h>
+#include <solution/system_of_eqn/linearSOE/krylov/ILUPreconditioner.h>
+#include <solution/system_of_eqn/linearSOE/krylov/AMGPreconditioner.h>
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #ifdef _PARALLEL_PROCESSING
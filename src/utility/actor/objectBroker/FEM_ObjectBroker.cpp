@@ -127,6 +127,10 @@ XC::GraphNumberer *XC::FEM_ObjectBroker::getPtrNewGraphNumberer(int classTag)
         return new MyRCM();
       case GraphNUMBERER_TAG_SimpleNumberer:
         return new SimpleNumberer();
+      case GraphNUMBERER_TAG_AMD:
+        return new AMD();
+      case GraphNUMBERER_TAG_NestedDissection:
+        return new NestedDissection();
       default:
         std::cerr << "ObjectBrokerAllClasses::getPtrNewGraphNumberer - ";
         std::cerr << " - no GraphNumberer type exists for class tag " ;
@@ -1284,6 +1288,14 @@ XC::LinearSOE *XC::FEM_ObjectBroker::getNewLinearSOE(int classTagSOE, int classT
               lastLinearSolver = theBandSPDSolver;
               return theSOE;
             }
+          else if(classTagSolver == SOLVER_TAGS_BandSPDLinThreadSolver)
+            {
+              theBandSPDSolver = new BandSPDLinThreadSolver();
+              theSOE= new BandSPDLinSOE(nullptr);
+              theSOE->setSolver(theBandSPDSolver);
+              lastLinearSolver = theBandSPDSolver;
+              return theSOE;
+            }
           else
             {
               std::cerr << "FEM_ObjectBroker::getNewLinearSOE - ";
@@ -1302,6 +1314,14 @@ XC::LinearSOE *XC::FEM_ObjectBroker::getNewLinearSOE(int classTagSOE, int classT
               lastLinearSolver = theProfileSPDSolver;
               return theSOE;
             }
+          else if(classTagSolver == SOLVER_TAGS_ProfileSPDLinDirectThreadSolver)
+            {
+              theProfileSPDSolver = new ProfileSPDLinDirectThreadSolver();
+              theSOE= new ProfileSPDLinSOE(nullptr);
+              theSOE->setSolver(theProfileSPDSolver);
+              lastLinearSolver = theProfileSPDSolver;
+              return theSOE;
+            }
           else if(classTagSolver == SOLVER_TAGS_ProfileSPDLinSubstrSolver)
             {
               theProfileSPDSolver = new ProfileSPDLinSubstrSolver();
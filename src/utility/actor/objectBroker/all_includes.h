@@ -14,6 +14,8 @@
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/MyRCM.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
+#include "solution/graph/numberer/AMD.h"
+#include "solution/graph/numberer/NestedDissection.h"
 
 
 // uniaxial material model header files
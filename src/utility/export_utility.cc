@@ -23,6 +23,7 @@
 
 #include "FEProblem.h"
 #include "python_interface.h"
+#include "utility/parallel/ThreadPool.h"
 
 void export_utility(void)
   {
@@ -43,5 +44,7 @@ void export_utility(void)
 #include "database/python_interface.tcc"
 #include "recorder/python_interface.tcc"
 
+    def("setThreadPoolSize",&XC::ThreadPool::setPoolSize,"Set the number of threads of the pool shared by the whole program (0: as many as the hardware supports). Must be called before the pool is first used; return false otherwise.");
+
   }
 
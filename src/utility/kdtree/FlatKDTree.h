@@ -0,0 +1,559 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FlatKDTree.h
+
+#ifndef FlatKDTree_h
+#define FlatKDTree_h
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cmath>
+#include "utility/parallel/ThreadPool.h"
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Three-dimensional KD-tree stored in flat arrays.
+//!
+//! The items are stored in balanced trees built in bulk: the items of
+//! each tree are reordered so the median (along the axis of maximum
+//! spread) of each range [b,e) of the array lies at (b+e)/2, so no node
+//! pointers are needed. Adding a batch of items rebuilds everything
+//! into one tree. Items inserted one by one go to a small buffer that
+//! is searched linearly; when it fills up it is merged with the trees
+//! whose size it reaches (logarithmic method), so single insertions
+//! cost O(log^2 n) amortized and the queries visit O(log n) trees.
+//! Erased items are flagged and removed when their tree is rebuilt.
+//!
+//! The Pos class must return its coordinates with operator[] (0,1,2)
+//! and define operator== (used to find the items to erase).
+template <class Pos>
+class FlatKDTree
+  {
+  public:
+    typedef std::vector<Pos> pos_container;
+    typedef std::vector<const Pos *> result_type;
+  private:
+    typedef std::pair<double,const Pos *> candidate; //!< (squared distance, item).
+
+    //! @brief Balanced tree stored in a flat array.
+    class Block
+      {
+        pos_container items; //!< tree items (flat layout).
+        std::vector<unsigned char> axes; //!< split axis of each item.
+        std::vector<bool> erased; //!< true if the item has been erased.
+        size_t numErased; //!< number of erased items.
+
+        void build(const size_t &,const size_t &);
+        bool erase(const size_t &,const size_t &,const Pos &);
+        void nearest(const size_t &,const size_t &,const Pos &,candidate &) const;
+        void k_nearest(const size_t &,const size_t &,const Pos &,const size_t &,std::vector<candidate> &) const;
+        void within_range(const size_t &,const size_t &,const Pos &,const double &,std::vector<candidate> &) const;
+        void within_box(const size_t &,const size_t &,const Pos &,const Pos &,result_type &) const;
+      public:
+        Block(void)
+          : numErased(0) {}
+        //! @brief Return the number of (not erased) items.
+        inline size_t size(void) const
+          { return items.size()-numErased; }
+        void append_to(pos_container &) const;
+        void assign(pos_container &);
+        bool erase(const Pos &);
+        void nearest(const Pos &target,candidate &best) const
+          { nearest(0,items.size(),target,best); }
+        void k_nearest(const Pos &target,const size_t &k,std::vector<candidate> &heap) const
+          { k_nearest(0,items.size(),target,k,heap); }
+        void within_range(const Pos &target,const double &r2,std::vector<candidate> &found) const
+          { within_range(0,items.size(),target,r2,found); }
+        void within_box(const Pos &lo,const Pos &hi,result_type &found) const
+          { within_box(0,items.size(),lo,hi,found); }
+      };
+
+    std::vector<Block> levels; //!< trees (the i-th one stores up to bufferSize*2^i items).
+    pos_container pending; //!< items inserted one by one not yet in a tree.
+    static const size_t bufferSize= 32; //!< capacity of the buffer of single insertions.
+
+    static double dist2(const Pos &,const Pos &);
+    static bool closer(const candidate &a,const candidate &b)
+      { return a.first<b.first; }
+    static void accept_nearest(const Pos &,const Pos &,candidate &);
+    static bool in_box(const Pos &,const Pos &,const Pos &);
+    static void push_candidate(std::vector<candidate> &,const candidate &,const size_t &);
+    static result_type get_items(std::vector<candidate> &);
+  public:
+    size_t size(void) const;
+    //! @brief Return true if the tree is empty.
+    inline bool empty(void) const
+      { return (size()==0); }
+    void insert(const Pos &);
+    template <class InputIterator>
+    void insert(InputIterator, InputIterator);
+    bool erase(const Pos &);
+    void clear(void);
+    void optimise(void);
+
+    const Pos *find_nearest(const Pos &,const double &maxDist= std::numeric_limits<double>::max()) const;
+    result_type find_k_nearest(const Pos &,const size_t &) const;
+    result_type find_within_range(const Pos &,const double &) const;
+    result_type find_within_box(const Pos &,const Pos &) const;
+    result_type find_nearest(const pos_container &,const size_t &nThreads= 1) const;
+    std::vector<result_type> find_k_nearest(const pos_container &,const size_t &,const size_t &nThreads= 1) const;
+    std::vector<result_type> find_within_range(const pos_container &,const double &,const size_t &nThreads= 1) const;
+  };
+
+//! @brief Return the squared distance between the positions.
+template <class Pos>
+double FlatKDTree<Pos>::dist2(const Pos &a,const Pos &b)
+  {
+    const double dx= a[0]-b[0];
+    const double dy= a[1]-b[1];
+    const double dz= a[2]-b[2];
+    return dx*dx+dy*dy+dz*dz;
+  }
+
+//! @brief Replaces the best candidate with p if it's closer to the target
+//! (or if there is no candidate yet and p lies within the search radius).
+template <class Pos>
+void FlatKDTree<Pos>::accept_nearest(const Pos &p,const Pos &target,candidate &best)
+  {
+    const double d2= dist2(p,target);
+    if((d2<best.first) || (!best.second && (d2<=best.first)))
+      best= candidate(d2,&p);
+  }
+
+//! @brief Return true if p lies inside the box [lo,hi] (boundary included).
+template <class Pos>
+bool FlatKDTree<Pos>::in_box(const Pos &p,const Pos &lo,const Pos &hi)
+  {
+    return ((p[0]>=lo[0]) && (p[0]<=hi[0]) &&
+            (p[1]>=lo[1]) && (p[1]<=hi[1]) &&
+            (p[2]>=lo[2]) && (p[2]<=hi[2]));
+  }
+
+//! @brief Keeps in the heap the k closest candidates.
+template <class Pos>
+void FlatKDTree<Pos>::push_candidate(std::vector<candidate> &heap,const candidate &c,const size_t &k)
+  {
+    if(heap.size()<k)
+      {
+        heap.push_back(c);
+        std::push_heap(heap.begin(),heap.end(),closer);
+      }
+    else if(c.first<heap.front().first)
+      {
+        std::pop_heap(heap.begin(),heap.end(),closer);
+        heap.back()= c;
+        std::push_heap(heap.begin(),heap.end(),closer);
+      }
+  }
+
+//! @brief Return the items of the candidates sorted by distance.
+template <class Pos>
+typename FlatKDTree<Pos>::result_type FlatKDTree<Pos>::get_items(std::vector<candidate> &candidates)
+  {
+    std::stable_sort(candidates.begin(),candidates.end(),closer);
+    result_type retval;
+    retval.reserve(candidates.size());
+    for(typename std::vector<candidate>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      retval.push_back(i->second);
+    return retval;
+  }
+
+//! @brief Builds the subtree corresponding to the range [b,e)
+//! of the array.
+template <class Pos>
+void FlatKDTree<Pos>::Block::build(const size_t &b,const size_t &e)
+  {
+    if(e-b<2)
+      return;
+    // Axis of maximum spread.
+    double lo[3]= {items[b][0],items[b][1],items[b][2]};
+    double hi[3]= {lo[0],lo[1],lo[2]};
+    for(size_t i= b+1;i<e;i++)
+      for(size_t j= 0;j<3;j++)
+        {
+          const double x= items[i][j];
+          if(x<lo[j]) lo[j]= x;
+          else if(x>hi[j]) hi[j]= x;
+        }
+    unsigned char ax= 0;
+    for(unsigned char j= 1;j<3;j++)
+      if((hi[j]-lo[j])>(hi[ax]-lo[ax]))
+        ax= j;
+    const size_t m= (b+e)/2;
+    std::nth_element(items.begin()+b,items.begin()+m,items.begin()+e,
+                     [ax](const Pos &p,const Pos &q) { return p[ax]<q[ax]; });
+    axes[m]= ax;
+    build(b,m);
+    build(m+1,e);
+  }
+
+//! @brief Appends the (not erased) items to the container.
+template <class Pos>
+void FlatKDTree<Pos>::Block::append_to(pos_container &c) const
+  {
+    for(size_t i= 0;i<items.size();i++)
+      if(!erased[i])
+        c.push_back(items[i]);
+  }
+
+//! @brief Builds the tree with the items of the container
+//! (that is left empty).
+template <class Pos>
+void FlatKDTree<Pos>::Block::assign(pos_container &c)
+  {
+    items.swap(c);
+    c.clear();
+    const size_t sz= items.size();
+    axes.assign(sz,0);
+    erased.assign(sz,false);
+    numErased= 0;
+    build(0,sz);
+  }
+
+//! @brief Flags as erased the item of the subtree [b,e) equal to p.
+template <class Pos>
+bool FlatKDTree<Pos>::Block::erase(const size_t &b,const size_t &e,const Pos &p)
+  {
+    if(e<=b)
+      return false;
+    const size_t m= (b+e)/2;
+    if(!erased[m] && (items[m]==p))
+      {
+        erased[m]= true;
+        numErased++;
+        return true;
+      }
+    if(e-b<2)
+      return false;
+    const unsigned char ax= axes[m];
+    const double d= p[ax]-items[m][ax];
+    if((d<=0) && erase(b,m,p))
+      return true;
+    if((d>=0) && erase(m+1,e,p))
+      return true;
+    return false;
+  }
+
+//! @brief Erases the item (the tree is rebuilt when a quarter
+//! of its items are erased). Returns false if not found.
+template <class Pos>
+bool FlatKDTree<Pos>::Block::erase(const Pos &p)
+  {
+    const bool retval= erase(0,items.size(),p);
+    if(retval && (4*numErased>items.size()))
+      {
+        pos_container tmp;
+        tmp.reserve(size());
+        append_to(tmp);
+        assign(tmp);
+      }
+    return retval;
+  }
+
+//! @brief Search the nearest item in the subtree [b,e).
+template <class Pos>
+void FlatKDTree<Pos>::Block::nearest(const size_t &b,const size_t &e,const Pos &target,candidate &best) const
+  {
+    if(e<=b)
+      return;
+    const size_t m= (b+e)/2;
+    const Pos &p= items[m];
+    if(!erased[m])
+      accept_nearest(p,target,best);
+    if(e-b<2)
+      return;
+    const unsigned char ax= axes[m];
+    const double d= target[ax]-p[ax];
+    if(d<0)
+      {
+        nearest(b,m,target,best);
+        if(d*d<=best.first)
+          nearest(m+1,e,target,best);
+      }
+    else
+      {
+        nearest(m+1,e,target,best);
+        if(d*d<=best.first)
+          nearest(b,m,target,best);
+      }
+  }
+
+//! @brief Search the k nearest items in the subtree [b,e).
+template <class Pos>
+void FlatKDTree<Pos>::Block::k_nearest(const size_t &b,const size_t &e,const Pos &target,const size_t &k,std::vector<candidate> &heap) const
+  {
+    if(e<=b)
+      return;
+    const size_t m= (b+e)/2;
+    const Pos &p= items[m];
+    if(!erased[m])
+      push_candidate(heap,candidate(dist2(p,target),&p),k);
+    if(e-b<2)
+      return;
+    const unsigned char ax= axes[m];
+    const double d= target[ax]-p[ax];
+    const size_t nb= (d<0 ? b : m+1); //Near side.
+    const size_t ne= (d<0 ? m : e);
+    const size_t fb= (d<0 ? m+1 : b); //Far side.
+    const size_t fe= (d<0 ? e : m);
+    k_nearest(nb,ne,target,k,heap);
+    if((heap.size()<k) || (d*d<heap.front().first))
+      k_nearest(fb,fe,target,k,heap);
+  }
+
+//! @brief Search the items of the subtree [b,e) whose squared distance
+//! to the target is not greater than r2.
+template <class Pos>
+void FlatKDTree<Pos>::Block::within_range(const size_t &b,const size_t &e,const Pos &target,const double &r2,std::vector<candidate> &found) const
+  {
+    if(e<=b)
+      return;
+    const size_t m= (b+e)/2;
+    const Pos &p= items[m];
+    if(!erased[m])
+      {
+        const double d2= dist2(p,target);
+        if(d2<=r2)
+          found.push_back(candidate(d2,&p));
+      }
+    if(e-b<2)
+      return;
+    const unsigned char ax= axes[m];
+    const double d= target[ax]-p[ax];
+    if((d<=0) || (d*d<=r2))
+      within_range(b,m,target,r2,found);
+    if((d>=0) || (d*d<=r2))
+      within_range(m+1,e,target,r2,found);
+  }
+
+//! @brief Search the items of the subtree [b,e) that lie inside
+//! the box [lo,hi].
+template <class Pos>
+void FlatKDTree<Pos>::Block::within_box(const size_t &b,const size_t &e,const Pos &lo,const Pos &hi,result_type &found) const
+  {
+    if(e<=b)
+      return;
+    const size_t m= (b+e)/2;
+    const Pos &p= items[m];
+    if(!erased[m] && in_box(p,lo,hi))
+      found.push_back(&p);
+    if(e-b<2)
+      return;
+    const unsigned char ax= axes[m];
+    if(lo[ax]<=p[ax])
+      within_box(b,m,lo,hi,found);
+    if(hi[ax]>=p[ax])
+      within_box(m+1,e,lo,hi,found);
+  }
+
+//! @brief Return the number of items.
+template <class Pos>
+size_t FlatKDTree<Pos>::size(void) const
+  {
+    size_t retval= pending.size();
+    for(typename std::vector<Block>::const_iterator i= levels.begin();i!=levels.end();i++)
+      retval+= i->size();
+    return retval;
+  }
+
+//! @brief Rebuilds all the items into one balanced tree.
+template <class Pos>
+void FlatKDTree<Pos>::optimise(void)
+  {
+    pos_container tmp;
+    tmp.reserve(size());
+    for(typename std::vector<Block>::const_iterator i= levels.begin();i!=levels.end();i++)
+      i->append_to(tmp);
+    tmp.insert(tmp.end(),pending.begin(),pending.end());
+    pending.clear();
+    size_t level= 0; //Smallest level that can store all the items.
+    while((bufferSize<<level)<tmp.size())
+      level++;
+    levels.assign(level+1,Block());
+    levels[level].assign(tmp);
+  }
+
+//! @brief Inserts the item.
+template <class Pos>
+void FlatKDTree<Pos>::insert(const Pos &p)
+  {
+    pending.push_back(p);
+    if(pending.size()>=bufferSize)
+      {
+        // Merge the buffer with the consecutive non-empty levels
+        // and store the result in the first empty one.
+        pos_container carry;
+        carry.swap(pending);
+        size_t level= 0;
+        for(;level<levels.size();level++)
+          {
+            if(levels[level].size()==0)
+              break;
+            levels[level].append_to(carry);
+            levels[level]= Block();
+          }
+        if(level==levels.size())
+          levels.push_back(Block());
+        levels[level].assign(carry);
+      }
+  }
+
+//! @brief Inserts the items in the range [first,last) and
+//! rebuilds the tree.
+template <class Pos> template <class InputIterator>
+void FlatKDTree<Pos>::insert(InputIterator first, InputIterator last)
+  {
+    pending.insert(pending.end(),first,last);
+    optimise();
+  }
+
+//! @brief Erases the item. Returns false if not found.
+template <class Pos>
+bool FlatKDTree<Pos>::erase(const Pos &p)
+  {
+    typename pos_container::iterator i= std::find(pending.begin(),pending.end(),p);
+    if(i!=pending.end())
+      {
+        pending.erase(i);
+        return true;
+      }
+    for(typename std::vector<Block>::iterator j= levels.begin();j!=levels.end();j++)
+      if(j->erase(p))
+        return true;
+    return false;
+  }
+
+//! @brief Removes all the items.
+template <class Pos>
+void FlatKDTree<Pos>::clear(void)
+  {
+    levels.clear();
+    pending.clear();
+  }
+
+//! @brief Return the item nearest to the target whose distance
+//! is not greater than maxDist (nullptr if none).
+template <class Pos>
+const Pos *FlatKDTree<Pos>::find_nearest(const Pos &target,const double &maxDist) const
+  {
+    const double max2= (maxDist<std::sqrt(std::numeric_limits<double>::max()) ? maxDist*maxDist : std::numeric_limits<double>::max());
+    candidate best(max2,nullptr);
+    for(typename std::vector<Block>::const_iterator i= levels.begin();i!=levels.end();i++)
+      i->nearest(target,best);
+    for(typename pos_container::const_iterator i= pending.begin();i!=pending.end();i++)
+      accept_nearest(*i,target,best);
+    return best.second;
+  }
+
+//! @brief Return the k items nearest to the target sorted by distance.
+template <class Pos>
+typename FlatKDTree<Pos>::result_type FlatKDTree<Pos>::find_k_nearest(const Pos &target,const size_t &k) const
+  {
+    std::vector<candidate> heap;
+    if(k>0)
+      {
+        heap.reserve(k);
+        for(typename std::vector<Block>::const_iterator i= levels.begin();i!=levels.end();i++)
+          i->k_nearest(target,k,heap);
+        for(typename pos_container::const_iterator i= pending.begin();i!=pending.end();i++)
+          push_candidate(heap,candidate(dist2(*i,target),&(*i)),k);
+      }
+    return get_items(heap);
+  }
+
+//! @brief Return the items whose distance to the target is not greater
+//! than r sorted by distance.
+template <class Pos>
+typename FlatKDTree<Pos>::result_type FlatKDTree<Pos>::find_within_range(const Pos &target,const double &r) const
+  {
+    std::vector<candidate> found;
+    const double r2= r*r;
+    for(typename std::vector<Block>::const_iterator i= levels.begin();i!=levels.end();i++)
+      i->within_range(target,r2,found);
+    for(typename pos_container::const_iterator i= pending.begin();i!=pending.end();i++)
+      {
+        const double d2= dist2(*i,target);
+        if(d2<=r2)
+          found.push_back(candidate(d2,&(*i)));
+      }
+    return get_items(found);
+  }
+
+//! @brief Return the items that lie inside the box [lo,hi]
+//! (in no particular order).
+template <class Pos>
+typename FlatKDTree<Pos>::result_type FlatKDTree<Pos>::find_within_box(const Pos &lo,const Pos &hi) const
+  {
+    result_type retval;
+    for(typename std::vector<Block>::const_iterator i= levels.begin();i!=levels.end();i++)
+      i->within_box(lo,hi,retval);
+    for(typename pos_container::const_iterator i= pending.begin();i!=pending.end();i++)
+      if(in_box(*i,lo,hi))
+        retval.push_back(&(*i));
+    return retval;
+  }
+
+//! @brief Return the items nearest to each one of the targets
+//! (queries are distributed among nThreads threads).
+template <class Pos>
+typename FlatKDTree<Pos>::result_type FlatKDTree<Pos>::find_nearest(const pos_container &targets,const size_t &nThreads) const
+  {
+    result_type retval(targets.size(),nullptr);
+    ThreadPool::for_each_index(targets.size(),nThreads,[&](const size_t &i)
+      { retval[i]= find_nearest(targets[i]); });
+    return retval;
+  }
+
+//! @brief Return the k items nearest to each one of the targets
+//! (queries are distributed among nThreads threads).
+template <class Pos>
+std::vector<typename FlatKDTree<Pos>::result_type> FlatKDTree<Pos>::find_k_nearest(const pos_container &targets,const size_t &k,const size_t &nThreads) const
+  {
+    std::vector<result_type> retval(targets.size());
+    ThreadPool::for_each_index(targets.size(),nThreads,[&](const size_t &i)
+      { retval[i]= find_k_nearest(targets[i],k); });
+    return retval;
+  }
+
+//! @brief Return the items whose distance to each one of the targets is
+//! not greater than r (queries are distributed among nThreads threads).
+template <class Pos>
+std::vector<typename FlatKDTree<Pos>::result_type> FlatKDTree<Pos>::find_within_range(const pos_container &targets,const double &r,const size_t &nThreads) const
+  {
+    std::vector<result_type> retval(targets.size());
+    ThreadPool::for_each_index(targets.size(),nThreads,[&](const size_t &i)
+      { retval[i]= find_within_range(targets[i],r); });
+    return retval;
+  }
+
+} // end of XC namespace
+
+#endif
@@ -33,12 +33,21 @@ XC::AuxMatrix::AuxMatrix(const size_t &szDoubleWork,const size_t &szIntWork)
   :sizeDoubleWork(szDoubleWork), sizeIntWork(szIntWork), matrixWork(szDoubleWork), intWork(szIntWork)
   {}
 
+//! @brief Make sure that the work areas can hold at least szd doubles
+//! and szi integers. The work areas never shrink, so alternating
+//! small and large matrices does not reallocate them over and over.
 void XC::AuxMatrix::resize(const size_t &szd,const size_t &szi)
   {
-    matrixWork.resize(szd);
-    sizeDoubleWork= szd;
-    intWork.resize(szi);
-    sizeIntWork= szi;
+    if(szd>sizeDoubleWork)
+      {
+        matrixWork.resize(szd);
+        sizeDoubleWork= szd;
+      }
+    if(szi>sizeIntWork)
+      {
+        intWork.resize(szi);
+        sizeIntWork= szi;
+      }
   }
     
 const size_t &XC::AuxMatrix::getSizeDoubleWork(void) const
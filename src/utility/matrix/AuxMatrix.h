@@ -39,6 +39,8 @@ namespace XC {
 
 //! @ingroup Matrix
 //
+//! @brief Work areas used by the LAPACK wrappers of the Matrix class
+//! (Solve, Invert,...). Each thread must use its own object.
 class AuxMatrix: public CommandEntity
   {
   private:
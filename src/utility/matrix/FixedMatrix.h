@@ -0,0 +1,168 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedMatrix.h
+
+#ifndef FixedMatrix_h
+#define FixedMatrix_h
+
+#include "FixedVector.h"
+#include "Matrix.h"
+
+namespace XC {
+
+//! @ingroup Matrix
+//!
+//! @brief Matrix with its dimensions fixed at compile time.
+//!
+//! The components are stored in the object itself, column by
+//! column like in Matrix, so no heap memory is used (see FixedVector).
+template <size_t NR, size_t NC>
+class FixedMatrix
+  {
+  private:
+    double p[NR*NC];
+  public:
+    //! @brief Constructor (all components are set to value).
+    explicit FixedMatrix(const double &value= 0.0)
+      { std::fill(p,p+NR*NC,value); }
+    //! @brief Constructor from a Matrix: copies the upper left
+    //! block (the components outside the matrix are set to zero).
+    explicit FixedMatrix(const Matrix &m)
+      {
+        Zero();
+        const size_t nr= std::min(size_t(m.noRows()),NR);
+        const size_t nc= std::min(size_t(m.noCols()),NC);
+        for(size_t j= 0;j<nc;j++)
+          for(size_t i= 0;i<nr;i++)
+            (*this)(i,j)= m(i,j);
+      }
+
+    //! @brief Return the number of rows.
+    inline static size_t noRows(void)
+      { return NR; }
+    //! @brief Return the number of columns.
+    inline static size_t noCols(void)
+      { return NC; }
+    inline const double *getDataPtr(void) const
+      { return p; }
+    inline double *getDataPtr(void)
+      { return p; }
+    inline const double &operator()(const size_t &i,const size_t &j) const
+      { return p[j*NR+i]; }
+    inline double &operator()(const size_t &i,const size_t &j)
+      { return p[j*NR+i]; }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(p,p+NR*NC,0.0); }
+
+    //! @brief Return the product of this matrix by the vector.
+    FixedVector<NR> operator*(const FixedVector<NC> &v) const
+      {
+        FixedVector<NR> retval;
+        for(size_t j= 0;j<NC;j++)
+          {
+            const double vj= v[j];
+            const double *col= p+j*NR;
+            for(size_t i= 0;i<NR;i++)
+              retval[i]+= col[i]*vj;
+          }
+        return retval;
+      }
+    //! @brief Return the product of the transpose of this matrix
+    //! by the vector.
+    FixedVector<NC> transposeProduct(const FixedVector<NR> &v) const
+      {
+        FixedVector<NC> retval;
+        for(size_t j= 0;j<NC;j++)
+          {
+            const double *col= p+j*NR;
+            double tmp= 0.0;
+            for(size_t i= 0;i<NR;i++)
+              tmp+= col[i]*v[i];
+            retval[j]= tmp;
+          }
+        return retval;
+      }
+    //! @brief Return the product of this matrix by other.
+    template <size_t NC2>
+    FixedMatrix<NR,NC2> operator*(const FixedMatrix<NC,NC2> &other) const
+      {
+        FixedMatrix<NR,NC2> retval;
+        for(size_t j= 0;j<NC2;j++)
+          for(size_t k= 0;k<NC;k++)
+            {
+              const double okj= other(k,j);
+              for(size_t i= 0;i<NR;i++)
+                retval(i,j)+= (*this)(i,k)*okj;
+            }
+        return retval;
+      }
+    FixedMatrix &operator+=(const FixedMatrix &other)
+      {
+        for(size_t i= 0;i<NR*NC;i++)
+          p[i]+= other.p[i];
+        return *this;
+      }
+    FixedMatrix &operator-=(const FixedMatrix &other)
+      {
+        for(size_t i= 0;i<NR*NC;i++)
+          p[i]-= other.p[i];
+        return *this;
+      }
+    FixedMatrix &operator*=(const double &fact)
+      {
+        for(size_t i= 0;i<NR*NC;i++)
+          p[i]*= fact;
+        return *this;
+      }
+
+    //! @brief Copy the components to the matrix being passed as parameter
+    //! (whose dimensions must be at least NR x NC).
+    void copyTo(Matrix &m) const
+      {
+        for(size_t j= 0;j<NC;j++)
+          for(size_t i= 0;i<NR;i++)
+            m(i,j)= (*this)(i,j);
+      }
+    //! @brief Return a Matrix with the components of this one.
+    Matrix getMatrix(void) const
+      {
+        Matrix retval(NR,NC);
+        copyTo(retval);
+        return retval;
+      }
+  };
+
+typedef FixedMatrix<2,2> FixedMatrix2;
+typedef FixedMatrix<3,3> FixedMatrix3;
+typedef FixedMatrix<6,6> FixedMatrix6;
+typedef FixedMatrix<12,12> FixedMatrix12;
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,204 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedVector.h
+
+#ifndef FixedVector_h
+#define FixedVector_h
+
+#include "Vector.h"
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup Matrix
+//!
+//! @brief Vector with a size fixed at compile time.
+//!
+//! The components are stored in the object itself (no heap memory
+//! is used), so it can be used for the small temporaries (coordinates,
+//! rotations, nodal displacements,...) computed again and again in the
+//! state determination. It doesn't derive from CommandEntity; it
+//! can be created from a Vector and its values can be copied to
+//! a Vector (see copyTo and getVector).
+template <size_t N>
+class FixedVector
+  {
+  private:
+    double p[N];
+  public:
+    //! @brief Constructor (all components are set to value).
+    explicit FixedVector(const double &value= 0.0)
+      { std::fill(p,p+N,value); }
+    //! @brief Constructor from a Vector: copies the first N components
+    //! (if the vector is shorter, the remaining components are zero).
+    explicit FixedVector(const Vector &v)
+      {
+        const size_t sz= std::min(size_t(v.Size()),N);
+        const double *data= v.getDataPtr();
+        std::copy(data,data+sz,p);
+        std::fill(p+sz,p+N,0.0);
+      }
+    //! @brief Constructor from the first N values of the array.
+    explicit FixedVector(const double *data)
+      { std::copy(data,data+N,p); }
+
+    //! @brief Return the number of components.
+    inline static size_t Size(void)
+      { return N; }
+    inline const double *getDataPtr(void) const
+      { return p; }
+    inline double *getDataPtr(void)
+      { return p; }
+    inline const double &operator()(const size_t &i) const
+      { return p[i]; }
+    inline double &operator()(const size_t &i)
+      { return p[i]; }
+    inline const double &operator[](const size_t &i) const
+      { return p[i]; }
+    inline double &operator[](const size_t &i)
+      { return p[i]; }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(p,p+N,0.0); }
+    //! @brief Return the squared euclidean norm.
+    double Norm2(void) const
+      {
+        double retval= 0.0;
+        for(size_t i= 0;i<N;i++)
+          retval+= p[i]*p[i];
+        return retval;
+      }
+    //! @brief Return the euclidean norm.
+    inline double Norm(void) const
+      { return sqrt(Norm2()); }
+    //! @brief Return the dot product.
+    double dot(const FixedVector &other) const
+      {
+        double retval= 0.0;
+        for(size_t i= 0;i<N;i++)
+          retval+= p[i]*other.p[i];
+        return retval;
+      }
+    //! @brief Return the dot product.
+    inline double operator^(const FixedVector &other) const
+      { return dot(other); }
+
+    //! @brief this= factThis*this+factOther*other.
+    void addVector(const double &factThis, const FixedVector &other, const double &factOther)
+      {
+        for(size_t i= 0;i<N;i++)
+          p[i]= factThis*p[i]+factOther*other.p[i];
+      }
+    //! @brief this= factThis*this+factOther*other (only the first
+    //! min(N,other.Size()) components of other are used).
+    void addVector(const double &factThis, const Vector &other, const double &factOther)
+      {
+        const size_t sz= std::min(size_t(other.Size()),N);
+        for(size_t i= 0;i<sz;i++)
+          p[i]= factThis*p[i]+factOther*other(i);
+        for(size_t i= sz;i<N;i++)
+          p[i]*= factThis;
+      }
+    FixedVector &operator+=(const FixedVector &other)
+      {
+        for(size_t i= 0;i<N;i++)
+          p[i]+= other.p[i];
+        return *this;
+      }
+    FixedVector &operator-=(const FixedVector &other)
+      {
+        for(size_t i= 0;i<N;i++)
+          p[i]-= other.p[i];
+        return *this;
+      }
+    FixedVector &operator*=(const double &fact)
+      {
+        for(size_t i= 0;i<N;i++)
+          p[i]*= fact;
+        return *this;
+      }
+    FixedVector &operator/=(const double &fact)
+      {
+        for(size_t i= 0;i<N;i++)
+          p[i]/= fact;
+        return *this;
+      }
+    inline FixedVector operator+(const FixedVector &other) const
+      { FixedVector retval(*this); retval+= other; return retval; }
+    inline FixedVector operator-(const FixedVector &other) const
+      { FixedVector retval(*this); retval-= other; return retval; }
+    inline FixedVector operator*(const double &fact) const
+      { FixedVector retval(*this); retval*= fact; return retval; }
+    inline FixedVector operator/(const double &fact) const
+      { FixedVector retval(*this); retval/= fact; return retval; }
+
+    //! @brief Copy the components to the vector being passed as parameter
+    //! (whose size must be at least N).
+    void copyTo(Vector &v) const
+      {
+        for(size_t i= 0;i<N;i++)
+          v(i)= p[i];
+      }
+    //! @brief Return a Vector with the components of this one.
+    Vector getVector(void) const
+      {
+        Vector retval(N);
+        copyTo(retval);
+        return retval;
+      }
+  };
+
+typedef FixedVector<2> FixedVector2;
+typedef FixedVector<3> FixedVector3;
+typedef FixedVector<6> FixedVector6;
+typedef FixedVector<12> FixedVector12;
+
+//! @brief Return the product of the vector by the scalar.
+template <size_t N>
+inline FixedVector<N> operator*(const double &fact, const FixedVector<N> &v)
+  { return v*fact; }
+
+//! @brief Print stuff.
+template <size_t N>
+std::ostream &operator<<(std::ostream &os, const FixedVector<N> &v)
+  {
+    os << '[';
+    for(size_t i= 0;i<N;i++)
+      {
+        if(i>0) os << ',';
+        os << v[i];
+      }
+    os << ']';
+    return os;
+  }
+
+} // end of XC namespace
+
+#endif
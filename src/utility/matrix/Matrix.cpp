@@ -72,12 +72,8 @@
 #define MATRIX_WORK_AREA 400
 #define INT_WORK_AREA 20
 
-XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
+thread_local XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
 double XC::Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-int XC::Matrix::sizeDoubleWork= MATRIX_WORK_AREA;
-int XC::Matrix::sizeIntWork= INT_WORK_AREA;
-double *XC::Matrix::matrixWork= nullptr;
-int *XC::Matrix::intWork= nullptr;
 
 //! @brief Default constructor.
 XC::Matrix::Matrix(void)
@@ -298,6 +294,15 @@ extern "C" int dgerfs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
 //! during factorization a warning message is printed and the Vector \p x
 //! is returned. 
 int XC::Matrix::Solve(const Vector &b, Vector &x) const
+  { return Solve(b,x,auxMatrix); }
+
+//! @brief Solve the equation {\em \f$Ax=V\f$} using the work area
+//! provided by the caller.
+//!
+//! @param b: right hand side vector.
+//! @param x: solution vector.
+//! @param work: work area for the LAPACK routines (it is enlarged if needed).
+int XC::Matrix::Solve(const Vector &b, Vector &x, AuxMatrix &work) const
   {
 
     int n= numRows;
@@ -331,9 +336,9 @@ int XC::Matrix::Solve(const Vector &b, Vector &x) const
     
     // check work area can hold all the data
     const int dataSize= data.Size();
-    auxMatrix.resize(dataSize,n);
+    work.resize(dataSize,n);
 
-    double *matrixWork= auxMatrix.getMatrixWork();
+    double *matrixWork= work.getMatrixWork();
     for(int i=0; i<dataSize; i++)
       matrixWork[i]= data(i);
 
@@ -346,7 +351,7 @@ int XC::Matrix::Solve(const Vector &b, Vector &x) const
     int info;
     double *Aptr= matrixWork;
     double *Xptr= x.theData;
-    int *iPIV= auxMatrix.getIntWork();
+    int *iPIV= work.getIntWork();
     
 
     dgesv_(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
@@ -355,7 +360,17 @@ int XC::Matrix::Solve(const Vector &b, Vector &x) const
   }
 
 
+//! @brief Solve the equation {\em \f$AX=B\f$} for the Matrix \p x.
 int XC::Matrix::Solve(const Matrix &b, Matrix &x) const
+  { return Solve(b,x,auxMatrix); }
+
+//! @brief Solve the equation {\em \f$AX=B\f$} using the work area
+//! provided by the caller.
+//!
+//! @param b: right hand side matrix.
+//! @param x: solution matrix.
+//! @param work: work area for the LAPACK routines (it is enlarged if needed).
+int XC::Matrix::Solve(const Matrix &b, Matrix &x, AuxMatrix &work) const
   {
 
     int n= numRows;
@@ -398,12 +413,12 @@ int XC::Matrix::Solve(const Matrix &b, Matrix &x) const
 
     // check work area can hold all the data
     const int dataSize= data.Size();
-    auxMatrix.resize(dataSize,n);
+    work.resize(dataSize,n);
     
     x= b;
 
     // copy the data
-    double *matrixWork= auxMatrix.getMatrixWork();
+    double *matrixWork= work.getMatrixWork();
     for(int i=0; i<dataSize; i++)
       matrixWork[i]= data(i);
 
@@ -414,7 +429,7 @@ int XC::Matrix::Solve(const Matrix &b, Matrix &x) const
     double *Aptr= matrixWork;
     double *Xptr= x.getDataPtr();
     
-    int *iPIV= auxMatrix.getIntWork();
+    int *iPIV= work.getIntWork();
     
 
 #ifdef _WIN32
@@ -442,6 +457,14 @@ int XC::Matrix::Solve(const Matrix &b, Matrix &x) const
 
 //! @brief Return the inverse matrix in the argument.
 int XC::Matrix::Invert(Matrix &theInverse) const
+  { return Invert(theInverse,auxMatrix); }
+
+//! @brief Return the inverse matrix in the argument using the work area
+//! provided by the caller.
+//!
+//! @param theInverse: inverse matrix.
+//! @param work: work area for the LAPACK routines (it is enlarged if needed).
+int XC::Matrix::Invert(Matrix &theInverse, AuxMatrix &work) const
   {
 
     int n= numRows;
@@ -466,12 +489,12 @@ int XC::Matrix::Invert(Matrix &theInverse) const
       }
 #endif
     const int dataSize= data.Size();
-    auxMatrix.resize(dataSize,n);
+    work.resize(dataSize,n);
     
     // copy the data
     theInverse= *this;
     
-    double *matrixWork= auxMatrix.getMatrixWork();
+    double *matrixWork= work.getMatrixWork();
     for(int i=0; i<dataSize; i++)
       matrixWork[i]= data(i);
 
@@ -480,9 +503,9 @@ int XC::Matrix::Invert(Matrix &theInverse) const
     int info;
     double *Wptr= matrixWork;
     double *Aptr= theInverse.getDataPtr();
-    int workSize= auxMatrix.getSizeDoubleWork();
+    int workSize= work.getSizeDoubleWork();
     
-    int *iPIV= auxMatrix.getIntWork();
+    int *iPIV= work.getIntWork();
     
 
     dgetrf_(&n,&n,Aptr,&ldA,iPIV,&info);
@@ -843,16 +866,17 @@ int XC::Matrix::addMatrixTripleProduct(double thisFact,
 #endif
 
     // cheack work area can hold the temporary matrix
-    int sizeWork = B.numRows * numCols;
+    const size_t sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (sizeWork > auxMatrix.getSizeDoubleWork()) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
     }
 
     // zero out the work area
+    double *matrixWork= auxMatrix.getMatrixWork();
     double *matrixWorkPtr = matrixWork;
-    for (int l=0; l<sizeWork; l++)
+    for (size_t l=0; l<sizeWork; l++)
       *matrixWorkPtr++ = 0.0;
 
     // now form B * C * fact store in matrixWork == A area
@@ -109,11 +109,7 @@ class Matrix: public CommandEntity
   {
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static AuxMatrix auxMatrix;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    static thread_local AuxMatrix auxMatrix; //!< Work area for Solve, Invert,... (one per thread).
 
     int numRows;
     int numCols;
@@ -151,8 +147,11 @@ class Matrix: public CommandEntity
     int  Assemble(const Matrix &,const ID &rows, const ID &cols, double fact = 1.0);
 
     int Solve(const Vector &V, Vector &res) const;
+    int Solve(const Vector &V, Vector &res, AuxMatrix &) const;
     int Solve(const Matrix &M, Matrix &res) const;
+    int Solve(const Matrix &M, Matrix &res, AuxMatrix &) const;
     int Invert(Matrix &res) const;
+    int Invert(Matrix &res, AuxMatrix &) const;
     Matrix getInverse(void) const;
 
     double rowSum(int i) const;
@@ -66,6 +66,7 @@
 
 #include <cstdlib>
 #include <cmath>
+#include <atomic>
 
 
 #include "xc_utils/src/geom/pos_vec/Vector2d.h"
@@ -73,6 +74,19 @@
 
 double XC::Vector::VECTOR_NOT_VALID_ENTRY =0.0;
 
+namespace
+  {
+    //! @brief Number of data arrays allocated by the vectors (see getNumAllocations).
+    std::atomic<size_t> num_allocations(0);
+  }
+
+//! @brief Return the number of data arrays allocated in the heap by
+//! the vectors (and so by the matrices, that store their data in a
+//! Vector) since the program started. Useful to check that a
+//! computation doesn't create vector or matrix temporaries.
+size_t XC::Vector::getNumAllocations(void)
+  { return num_allocations.load(std::memory_order_relaxed); }
+
 //! @brief Free memory.
 void XC::Vector::free_mem(void)
   {
@@ -95,6 +109,7 @@ void XC::Vector::alloc(const size_t &size)
           {
             theData= new double[sz];
             fromFree= 0;
+            num_allocations.fetch_add(1,std::memory_order_relaxed);
           }
       }
     else
@@ -114,6 +114,8 @@ class Vector: public CommandEntity
     Vector(const boost::python::list &);
     virtual ~Vector(void);
 
+    static size_t getNumAllocations(void);
+
     iterator begin(void);
     iterator end(void);
     // utility methods
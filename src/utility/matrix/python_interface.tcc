@@ -66,6 +66,7 @@ class_<XC::Vector, bases<CommandEntity> >("Vector")
   .def("putComponents",&XC::Vector::putComponents,"Assigns the specified values to the specified set of vector components")
   .def("addComponents",&XC::Vector::addComponents,"Sums the specified values to the specified set of vector components")
   .def("Normalized",&XC::Vector::Normalized,"Returns normalizxed vector.")
+  .def("getNumAllocations",&XC::Vector::getNumAllocations,"Return the number of data arrays allocated by the vectors and the matrices since the program started.").staticmethod("getNumAllocations")
   ;
 
 
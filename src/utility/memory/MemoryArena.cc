@@ -0,0 +1,178 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryArena.cc
+
+#include "MemoryArena.h"
+#include <new>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <atomic>
+
+namespace
+  {
+    //! @brief Arena that receives the objects allocated by the current thread.
+    thread_local XC::MemoryArena *current_arena= nullptr;
+
+    //! @brief Address ranges of the blocks of all the arenas (first
+    //! byte -> one past the last byte), used by deallocate_object to
+    //! tell the arena objects from the heap ones.
+    std::map<const char *,const char *> arena_blocks;
+    std::mutex arena_blocks_mutex; //!< protects arena_blocks.
+    std::atomic<size_t> num_arena_blocks(0); //!< size of arena_blocks.
+
+    //! @brief Round up the argument to a multiple of the alignment.
+    inline size_t align_up(const size_t &sz)
+      { return (sz+XC::MemoryArena::alignment-1)&~(XC::MemoryArena::alignment-1); }
+
+    //! @brief Return true if the address belongs to the block of an arena.
+    bool in_arena_block(const void *ptr)
+      {
+        const char *p= static_cast<const char *>(ptr);
+        std::lock_guard<std::mutex> lock(arena_blocks_mutex);
+        std::map<const char *,const char *>::const_iterator i= arena_blocks.upper_bound(p);
+        if(i==arena_blocks.begin())
+          return false;
+        --i;
+        return (p<i->second);
+      }
+  }
+
+const size_t XC::MemoryArena::alignment;
+const size_t XC::MemoryArena::defaultBlockSize;
+
+//! @brief Constructor.
+XC::MemoryArena::MemoryArena(void)
+  : numBytes(0), numObjects(0) {}
+
+//! @brief Destructor.
+XC::MemoryArena::~MemoryArena(void)
+  { release(); }
+
+//! @brief Allocates a new block with room for at least sz bytes.
+void XC::MemoryArena::new_block(const size_t &sz)
+  {
+    Block b;
+    b.size= std::max(align_up(sz),defaultBlockSize);
+    b.data= static_cast<char *>(::operator new(b.size));
+    b.used= 0;
+    blocks.push_back(b);
+    std::lock_guard<std::mutex> lock(arena_blocks_mutex);
+    arena_blocks[b.data]= b.data+b.size;
+    num_arena_blocks++;
+  }
+
+//! @brief Makes sure that the next sz bytes can be allocated
+//! in a single block.
+void XC::MemoryArena::reserve(const size_t &sz)
+  {
+    if(sz>0)
+      {
+        if(blocks.empty() || (blocks.back().size-blocks.back().used)<sz)
+          new_block(sz);
+      }
+  }
+
+//! @brief Return the address of sz bytes aligned to the
+//! value of the alignment member.
+void *XC::MemoryArena::allocate(const size_t &sz)
+  {
+    const size_t n= align_up(sz>0 ? sz : 1);
+    if(blocks.empty() || (blocks.back().size-blocks.back().used)<n)
+      new_block(n);
+    Block &b= blocks.back();
+    void *retval= b.data+b.used;
+    b.used+= n;
+    numBytes+= n;
+    return retval;
+  }
+
+//! @brief Frees all the memory of the arena. The objects
+//! allocated on it must have been destroyed before.
+void XC::MemoryArena::release(void)
+  {
+    if(!blocks.empty())
+      {
+        std::lock_guard<std::mutex> lock(arena_blocks_mutex);
+        for(std::vector<Block>::iterator i= blocks.begin();i!=blocks.end();i++)
+          {
+            arena_blocks.erase((*i).data);
+            num_arena_blocks--;
+            ::operator delete((*i).data);
+          }
+      }
+    blocks.clear();
+    numBytes= 0;
+    numObjects= 0;
+  }
+
+//! @brief Return the total size of the allocated blocks.
+size_t XC::MemoryArena::getCapacity(void) const
+  {
+    size_t retval= 0;
+    for(std::vector<Block>::const_iterator i= blocks.begin();i!=blocks.end();i++)
+      retval+= (*i).size;
+    return retval;
+  }
+
+//! @brief Return the arena that receives the objects allocated
+//! by the current thread (nullptr if they go to the heap).
+XC::MemoryArena *XC::MemoryArena::getCurrentArena(void)
+  { return current_arena; }
+
+//! @brief Allocates an object of sz bytes in the current arena
+//! or in the heap if there is no current arena.
+void *XC::MemoryArena::allocate_object(const size_t &sz)
+  {
+    MemoryArena *arena= current_arena;
+    if(!arena)
+      return ::operator new(sz);
+    arena->numObjects++;
+    return arena->allocate(sz);
+  }
+
+//! @brief Frees an object allocated with allocate_object. The memory
+//! of the objects allocated in an arena is given back when the arena is
+//! released, so nothing is done for them. While no arena has memory
+//! blocks the object is freed without searching them.
+void XC::MemoryArena::deallocate_object(void *ptr)
+  {
+    if(ptr)
+      {
+        if((num_arena_blocks==0) || !in_arena_block(ptr))
+          ::operator delete(ptr);
+      }
+  }
+
+//! @brief Constructor.
+XC::MemoryArena::Scope::Scope(MemoryArena *arena)
+  : previous(current_arena)
+  { current_arena= arena; }
+
+//! @brief Destructor (restores the previous arena).
+XC::MemoryArena::Scope::~Scope(void)
+  { current_arena= previous; }
@@ -0,0 +1,118 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryArena.h
+
+#ifndef MemoryArena_h
+#define MemoryArena_h
+
+#include <cstddef>
+#include <vector>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Bump allocator that carves objects out of a few large blocks.
+//!
+//! The memory is given back all at once by release (or by the destructor);
+//! the individual objects are never freed. Classes that want to be
+//! allocated in an arena route their operator new and operator delete
+//! through allocate_object and deallocate_object: while a Scope is alive
+//! the objects created by the current thread go to its arena, otherwise
+//! they go to the heap as usual (with no extra bytes). operator delete
+//! looks up the address in the blocks of the existing arenas: it frees
+//! the heap objects and does nothing with the arena ones (their
+//! destructors still run).
+class MemoryArena
+  {
+  public:
+    static const size_t alignment= 16; //!< alignment of the returned addresses.
+    static const size_t defaultBlockSize= 64*1024; //!< size of the blocks allocated on demand.
+  private:
+    struct Block
+      {
+        char *data; //!< block memory.
+        size_t size; //!< block size.
+        size_t used; //!< bytes already handed out.
+      };
+    std::vector<Block> blocks; //!< allocated blocks (the last one is the current one).
+    size_t numBytes; //!< bytes handed out so far.
+    size_t numObjects; //!< objects allocated so far.
+
+    void new_block(const size_t &);
+
+    MemoryArena(const MemoryArena &);
+    MemoryArena &operator=(const MemoryArena &);
+  public:
+    //! @brief Makes the arena the destination of the objects allocated
+    //! by the current thread while the scope is alive.
+    //!
+    //! Every object of a class that routes its operator new through
+    //! allocate_object (the uniaxial materials and the fibers) created
+    //! in the meantime lands in the arena, even if it doesn't belong to
+    //! the owner of the arena (e.g. a temporary copy of a material made
+    //! by a method called inside the scope). Those objects must be
+    //! destroyed before the arena is released, so keep the scopes
+    //! around the code that creates the objects owned by the arena
+    //! only. The objects of the other classes (vectors, matrices,...)
+    //! are not affected.
+    class Scope
+      {
+        MemoryArena *previous; //!< arena active before this scope.
+        Scope(const Scope &);
+        Scope &operator=(const Scope &);
+      public:
+        explicit Scope(MemoryArena *);
+        ~Scope(void);
+      };
+
+    MemoryArena(void);
+    ~MemoryArena(void);
+
+    void reserve(const size_t &);
+    void *allocate(const size_t &);
+    void release(void);
+
+    //! @brief Return the number of bytes handed out by the arena.
+    inline size_t getNumBytes(void) const
+      { return numBytes; }
+    //! @brief Return the number of objects allocated in the arena.
+    inline size_t getNumObjects(void) const
+      { return numObjects; }
+    size_t getCapacity(void) const;
+    //! @brief Return the number of memory blocks.
+    inline size_t getNumBlocks(void) const
+      { return blocks.size(); }
+
+    static MemoryArena *getCurrentArena(void);
+    static void *allocate_object(const size_t &);
+    static void deallocate_object(void *);
+  };
+
+} // end of XC namespace
+
+#endif
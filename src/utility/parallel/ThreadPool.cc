@@ -0,0 +1,259 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.cc
+
+#include "ThreadPool.h"
+#include <memory>
+#include <iostream>
+#include <algorithm>
+
+namespace
+  {
+    std::mutex poolMutex; //!< guards the creation of the shared pool.
+    std::unique_ptr<XC::ThreadPool> thePool; //!< pool shared by the whole program.
+
+    //! @brief True if the current thread is executing a pool task.
+    thread_local bool inside_pool_task= false;
+
+    //! @brief Sets the flag while alive and restores its value
+    //! on destruction.
+    class ParallelRegionGuard
+      {
+        bool previous;
+      public:
+        ParallelRegionGuard(void)
+	  : previous(inside_pool_task)
+	  { inside_pool_task= true; }
+        ~ParallelRegionGuard(void)
+	  { inside_pool_task= previous; }
+      };
+  }
+
+size_t XC::ThreadPool::poolSize= 0;
+
+//! @brief Constructor.
+//!
+//! @param numThreads: number of threads, including the calling one.
+XC::ThreadPool::ThreadPool(const size_t &numThreads)
+  : currentTask(nullptr), generation(0), pending(0), activeThreads(0), stop(false)
+  {
+    const size_t nWorkers= (numThreads>1 ? numThreads-1 : 0);
+    workers.reserve(nWorkers);
+    for(size_t i= 0;i<nWorkers;i++)
+      workers.push_back(std::thread(&ThreadPool::worker_loop,this,i+1));
+  }
+
+//! @brief Destructor (waits for the workers to finish).
+XC::ThreadPool::~ThreadPool(void)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stop= true;
+    }
+    cvStart.notify_all();
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+  }
+
+//! @brief Return true if the calling thread is running a task of a pool.
+bool XC::ThreadPool::inParallelRegion(void)
+  { return inside_pool_task; }
+
+//! @brief Loop executed by each worker thread.
+//!
+//! @param threadIdx: index of the worker (0 corresponds to the calling thread).
+void XC::ThreadPool::worker_loop(const size_t &threadIdx)
+  {
+    size_t lastGeneration= 0;
+    while(true)
+      {
+        const task_type *task= nullptr;
+	{
+	  std::unique_lock<std::mutex> lock(mtx);
+	  while(!stop && (generation==lastGeneration))
+	    cvStart.wait(lock);
+	  if(stop)
+	    return;
+	  lastGeneration= generation;
+	  if(threadIdx>=activeThreads) //Not used in this task.
+	    continue;
+	  task= currentTask;
+	}
+	try
+	  {
+	    ParallelRegionGuard guard;
+	    (*task)(threadIdx);
+	  }
+	catch(...)
+	  {
+	    std::unique_lock<std::mutex> lock(mtx);
+	    if(!firstError)
+	      firstError= std::current_exception();
+	  }
+	{
+	  std::unique_lock<std::mutex> lock(mtx);
+	  pending--;
+	  if(pending==0)
+	    cvDone.notify_one();
+	}
+      }
+  }
+
+//! @brief Run the task on the first numThreads threads of the pool
+//! and wait until all of them have finished.
+void XC::ThreadPool::launch(const task_type &task, const size_t &numThreads)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      currentTask= &task;
+      activeThreads= numThreads;
+      pending= numThreads-1;
+      firstError= std::exception_ptr();
+      generation++;
+    }
+    cvStart.notify_all();
+    std::exception_ptr callerError;
+    try
+      {
+        ParallelRegionGuard guard;
+        task(0);
+      }
+    catch(...)
+      { callerError= std::current_exception(); }
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      while(pending>0)
+	cvDone.wait(lock);
+      currentTask= nullptr;
+      error= (callerError ? callerError : firstError);
+    }
+    if(error)
+      std::rethrow_exception(error);
+  }
+
+//! @brief Return the number of threads used by a call that asks for
+//! maxThreads threads (0 means all the threads of the pool).
+size_t XC::ThreadPool::getNumThreads(const size_t &maxThreads) const
+  {
+    const size_t n= getNumThreads();
+    return ((maxThreads>0) ? std::min(maxThreads,n) : n);
+  }
+
+//! @brief Execute the task on getNumThreads(maxThreads) threads of the
+//! pool (the argument of the task is the thread index) and return when
+//! all of them have finished.
+//!
+//! If only one thread is to be used, the call is made from inside another
+//! pool task or the pool is busy with a task launched from another thread,
+//! the task is executed by the calling thread only.
+void XC::ThreadPool::run(const task_type &task, const size_t &maxThreads)
+  {
+    const size_t numThreads= getNumThreads(maxThreads);
+    std::unique_lock<std::mutex> busy(launchMtx,std::defer_lock);
+    if((numThreads<2) || inParallelRegion() || !busy.try_lock())
+      task(0);
+    else
+      launch(task,numThreads);
+  }
+
+//! @brief Compute the limits of the i-th block when the range
+//! [first,last) is split in numBlocks contiguous blocks.
+void XC::ThreadPool::getBlock(const size_t &first, const size_t &last, const size_t &numBlocks, const size_t &i, size_t &blockBegin, size_t &blockEnd)
+  {
+    const size_t n= (last>first ? last-first : 0);
+    const size_t q= n/numBlocks;
+    const size_t r= n%numBlocks;
+    blockBegin= first+i*q+(i<r ? i : r);
+    blockEnd= blockBegin+q+(i<r ? 1 : 0);
+  }
+
+//! @brief Execute body(i,threadIdx) for i in [first,last).
+//!
+//! The range is split in getNumThreads(maxThreads) contiguous blocks, the
+//! k-th block being processed by the k-th thread. The loop is executed
+//! by the calling thread only in the cases described in run.
+void XC::ThreadPool::parallel_for(const size_t &first, const size_t &last, const loop_body &body, const size_t &maxThreads)
+  {
+    if(last<=first)
+      return;
+    const size_t numThreads= getNumThreads(maxThreads);
+    std::unique_lock<std::mutex> busy(launchMtx,std::defer_lock);
+    if((numThreads<2) || ((last-first)<2) || inParallelRegion() || !busy.try_lock())
+      {
+        for(size_t i= first;i<last;i++)
+	  body(i,0);
+      }
+    else
+      {
+	const task_type task= [&](const size_t &threadIdx)
+	  {
+	    size_t b= 0, e= 0;
+	    getBlock(first,last,numThreads,threadIdx,b,e);
+	    for(size_t i= b;i<e;i++)
+	      body(i,threadIdx);
+	  };
+	launch(task,numThreads);
+      }
+  }
+
+//! @brief Return the number of concurrent threads supported by
+//! the hardware (at least one).
+size_t XC::ThreadPool::getDefaultNumThreads(void)
+  {
+    const size_t retval= std::thread::hardware_concurrency();
+    return (retval>0 ? retval : 1);
+  }
+
+//! @brief Set the number of threads of the pool shared by the whole
+//! program (0: as many as the hardware supports).
+//!
+//! The pool is created on first use and never resized, so the call has
+//! no effect (and returns false) once the pool exists.
+bool XC::ThreadPool::setPoolSize(const size_t &numThreads)
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    const bool retval= !thePool;
+    if(retval)
+      poolSize= numThreads;
+    else if(thePool->getNumThreads()!=(numThreads>0 ? numThreads : getDefaultNumThreads()))
+      std::cerr << "ThreadPool::" << __FUNCTION__
+		<< "; the pool is already running with "
+		<< thePool->getNumThreads() << " threads; it can't be resized."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Return a reference to the pool shared by the whole program
+//! (created on first call).
+XC::ThreadPool &XC::ThreadPool::getThreadPool(void)
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if(!thePool)
+      thePool.reset(new ThreadPool(poolSize>0 ? poolSize : getDefaultNumThreads()));
+    return *thePool;
+  }
@@ -0,0 +1,125 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.h
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Pool of worker threads used to run loops in parallel.
+//!
+//! The whole program shares one pool, created on first use with the
+//! number of threads set with setPoolSize (by default as many as the
+//! hardware supports); its size never changes afterwards. Each caller
+//! states how many threads it wants to use (maxThreads) and the pool
+//! uses at most that number of them.
+//!
+//! The calling thread takes part in the work as thread number 0,
+//! so a pool of n threads launches n-1 workers. Loops are split in
+//! contiguous blocks of (almost) equal size, so the block assigned to
+//! each thread depends only on the loop bounds and the number of threads
+//! used; that makes it possible to obtain deterministic results by reducing
+//! the per-thread contributions in thread order.
+//!
+//! Calls made from inside a running task (nested parallelism) or while
+//! the pool is busy with a task launched from another thread are executed
+//! serially by the calling thread.
+class ThreadPool
+  {
+  public:
+    typedef std::function<void(const size_t &)> task_type; //!< task (argument: thread index).
+    typedef std::function<void(const size_t &, const size_t &)> loop_body; //!< loop body (arguments: iteration index, thread index).
+  private:
+    std::vector<std::thread> workers; //!< worker threads.
+    std::mutex mtx;
+    std::mutex launchMtx; //!< held by the thread that is running a task on the pool.
+    std::condition_variable cvStart; //!< signals a new task to the workers.
+    std::condition_variable cvDone; //!< signals the end of the task to the caller.
+    const task_type *currentTask; //!< task being executed.
+    size_t generation; //!< number of tasks launched so far.
+    size_t pending; //!< number of workers still running the current task.
+    size_t activeThreads; //!< number of threads used by the current task.
+    bool stop; //!< true when the workers must finish.
+    std::exception_ptr firstError; //!< first exception thrown by a worker.
+
+    static size_t poolSize; //!< number of threads of the shared pool (0: default).
+
+    void worker_loop(const size_t &);
+    void launch(const task_type &, const size_t &);
+
+    ThreadPool(const ThreadPool &);
+    ThreadPool &operator=(const ThreadPool &);
+  public:
+    explicit ThreadPool(const size_t &numThreads);
+    ~ThreadPool(void);
+
+    //! @brief Return the number of threads (including the calling one).
+    inline size_t getNumThreads(void) const
+      { return workers.size()+1; }
+    size_t getNumThreads(const size_t &maxThreads) const;
+    static bool inParallelRegion(void);
+
+    void run(const task_type &, const size_t &maxThreads);
+    void parallel_for(const size_t &first, const size_t &last, const loop_body &, const size_t &maxThreads);
+    static void getBlock(const size_t &first, const size_t &last, const size_t &numBlocks, const size_t &i, size_t &blockBegin, size_t &blockEnd);
+
+    static size_t getDefaultNumThreads(void);
+    static bool setPoolSize(const size_t &);
+    static ThreadPool &getThreadPool(void);
+
+    template <class F>
+    static void for_each_index(const size_t &n, const size_t &maxThreads, const F &f);
+  };
+
+//! @brief Calls f(i) for i in [0,n) using at most maxThreads threads
+//! of the shared pool (the pool is not used when maxThreads<2).
+template <class F>
+void ThreadPool::for_each_index(const size_t &n, const size_t &maxThreads, const F &f)
+  {
+    if((maxThreads<2) || (n<2))
+      {
+        for(size_t i= 0;i<n;i++)
+          f(i);
+      }
+    else
+      getThreadPool().parallel_for(0,n,[&](const size_t &i, const size_t &)
+        { f(i); },maxThreads);
+  }
+
+} // end of XC namespace
+
+#endif
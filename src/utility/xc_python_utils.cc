@@ -32,6 +32,7 @@
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 #include "xc_utils/src/kernel/python_utils.h"
+#include <iostream>
 
 
 boost::python::list XC::xc_id_to_py_list(const XC::ID &id)
@@ -97,6 +98,189 @@ std::vector<int> XC::vector_int_from_py_object(const boost::python::object &o)
     return retval;
   }
 
+//! @brief Constructor.
+//!
+//! @param o: Python object that exports the buffer.
+//! @param defaultNumCols: number of columns for one-dimensional arrays.
+XC::PyBufferView::PyBufferView(const boost::python::object &o,const size_t &defaultNumCols)
+  : valid(false), format(0), numRows(0), numCols(0), rowStride(0), colStride(0)
+  {
+    PyObject *obj= o.ptr();
+    if(PyObject_CheckBuffer(obj) && (PyObject_GetBuffer(obj,&view,PyBUF_STRIDES|PyBUF_FORMAT)==0))
+      {
+        valid= true;
+        const char *fmt= (view.format ? view.format : "B");
+        const int one= 1;
+        const bool littleEndian= (*reinterpret_cast<const char *>(&one)==1);
+        if((*fmt=='@') || (*fmt=='=')) //Native byte order.
+          fmt++;
+        else if((*fmt=='<') && littleEndian)
+          fmt++;
+        else if(((*fmt=='>') || (*fmt=='!')) && !littleEndian)
+          fmt++;
+        format= *fmt;
+        const Py_ssize_t itemSize= view.itemsize;
+        if(view.ndim==2)
+          {
+            numRows= view.shape[0];
+            numCols= view.shape[1];
+            rowStride= (view.strides ? view.strides[0] : numCols*itemSize);
+            colStride= (view.strides ? view.strides[1] : itemSize);
+          }
+        else if((view.ndim==1) && (defaultNumCols>0) && (view.shape[0]%defaultNumCols==0))
+          {
+            numCols= defaultNumCols;
+            numRows= view.shape[0]/numCols;
+            colStride= (view.strides ? view.strides[0] : itemSize);
+            rowStride= numCols*colStride;
+          }
+        else
+          {
+            std::cerr << __FUNCTION__
+                      << "; wrong array dimensions." << std::endl;
+            valid= false;
+          }
+        if(valid && (get_item_ptr(0,0)==nullptr))
+          {
+            std::cerr << __FUNCTION__
+                      << "; unsupported item type: '"
+                      << format << "'." << std::endl;
+            valid= false;
+          }
+        if(!valid)
+          PyBuffer_Release(&view);
+      }
+    else
+      PyErr_Clear();
+  }
+
+//! @brief Destructor.
+XC::PyBufferView::~PyBufferView(void)
+  {
+    if(valid)
+      PyBuffer_Release(&view);
+  }
+
+//! @brief Return a pointer to the (i,j) item or nullptr if the
+//! type of the items is not supported.
+const char *XC::PyBufferView::get_item_ptr(const size_t &i,const size_t &j) const
+  {
+    const char *retval= nullptr;
+    switch(format)
+      {
+      case 'd':
+      case 'f':
+      case 'b':
+      case 'B':
+      case 'h':
+      case 'H':
+      case 'i':
+      case 'I':
+      case 'l':
+      case 'L':
+      case 'q':
+      case 'Q':
+        retval= static_cast<const char *>(view.buf)+i*rowStride+j*colStride;
+        break;
+      default:
+        break;
+      }
+    return retval;
+  }
+
+//! @brief Return true if the rows are stored one after another without gaps.
+bool XC::PyBufferView::isContiguous(void) const
+  { return (valid && (colStride==view.itemsize) && (rowStride==Py_ssize_t(numCols)*view.itemsize)); }
+
+//! @brief Return a pointer to the data if the items are doubles
+//! stored contiguously (nullptr otherwise).
+const double *XC::PyBufferView::getDoublePtr(void) const
+  {
+    const double *retval= nullptr;
+    if(isContiguous() && (format=='d'))
+      retval= static_cast<const double *>(view.buf);
+    return retval;
+  }
+
+//! @brief Return a pointer to the data if the items are int
+//! stored contiguously (nullptr otherwise).
+const int *XC::PyBufferView::getIntPtr(void) const
+  {
+    const int *retval= nullptr;
+    if(isContiguous() && (view.itemsize==sizeof(int)) && ((format=='i') || (format=='l')))
+      retval= static_cast<const int *>(view.buf);
+    return retval;
+  }
+
+//! @brief Return the (i,j) item converted to double.
+double XC::PyBufferView::getDouble(const size_t &i,const size_t &j) const
+  {
+    const char *ptr= get_item_ptr(i,j);
+    double retval= 0.0;
+    switch(format)
+      {
+      case 'd':
+        retval= *reinterpret_cast<const double *>(ptr);
+        break;
+      case 'f':
+        retval= *reinterpret_cast<const float *>(ptr);
+        break;
+      default:
+        retval= getInt(i,j);
+        break;
+      }
+    return retval;
+  }
+
+//! @brief Return the (i,j) item converted to int.
+int XC::PyBufferView::getInt(const size_t &i,const size_t &j) const
+  {
+    const char *ptr= get_item_ptr(i,j);
+    int retval= 0;
+    switch(format)
+      {
+      case 'd':
+        retval= *reinterpret_cast<const double *>(ptr);
+        break;
+      case 'f':
+        retval= *reinterpret_cast<const float *>(ptr);
+        break;
+      case 'b':
+        retval= *reinterpret_cast<const signed char *>(ptr);
+        break;
+      case 'B':
+        retval= *reinterpret_cast<const unsigned char *>(ptr);
+        break;
+      case 'h':
+        retval= *reinterpret_cast<const short *>(ptr);
+        break;
+      case 'H':
+        retval= *reinterpret_cast<const unsigned short *>(ptr);
+        break;
+      case 'i':
+        retval= *reinterpret_cast<const int *>(ptr);
+        break;
+      case 'I':
+        retval= *reinterpret_cast<const unsigned int *>(ptr);
+        break;
+      case 'l':
+        retval= *reinterpret_cast<const long *>(ptr);
+        break;
+      case 'L':
+        retval= *reinterpret_cast<const unsigned long *>(ptr);
+        break;
+      case 'q':
+        retval= *reinterpret_cast<const long long *>(ptr);
+        break;
+      case 'Q':
+        retval= *reinterpret_cast<const unsigned long long *>(ptr);
+        break;
+      default:
+        break;
+      }
+    return retval;
+  }
+
 m_double XC::m_double_from_py_object(const boost::python::object &o)
   {
     m_double retval;
@@ -37,5 +37,43 @@ std::vector<double> vector_double_from_py_object(const boost::python::object &);
 std::vector<int> vector_int_from_py_object(const boost::python::object &);
 m_double m_double_from_py_object(const boost::python::object &);
 
+//! @brief Read-only view of a one or two-dimensional array exported
+//! by a Python object through the buffer protocol (numpy arrays,
+//! memoryviews,...). The data is not copied.
+//!
+//! One-dimensional arrays are seen as matrices with the number of
+//! columns being passed to the constructor.
+class PyBufferView
+  {
+  private:
+    Py_buffer view;
+    bool valid; //!< True if the object exports a suitable buffer.
+    char format; //!< Type code of the items (struct module syntax).
+    size_t numRows;
+    size_t numCols;
+    Py_ssize_t rowStride; //!< Bytes between two consecutive rows.
+    Py_ssize_t colStride; //!< Bytes between two consecutive columns.
+
+    PyBufferView(const PyBufferView &);
+    PyBufferView &operator=(const PyBufferView &);
+    const char *get_item_ptr(const size_t &,const size_t &) const;
+  public:
+    PyBufferView(const boost::python::object &,const size_t &defaultNumCols);
+    ~PyBufferView(void);
+
+    //! @brief Return true if the object exports a suitable buffer.
+    inline bool isValid(void) const
+      { return valid; }
+    inline size_t getNumberOfRows(void) const
+      { return numRows; }
+    inline size_t getNumberOfColumns(void) const
+      { return numCols; }
+    bool isContiguous(void) const;
+    const double *getDoublePtr(void) const;
+    const int *getIntPtr(void) const;
+    double getDouble(const size_t &,const size_t &) const;
+    int getInt(const size_t &,const size_t &) const;
+  };
+
 } // end of XC namespace
 #endif
@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+# Model used by the benchmarks: square slab (ShellMITC4 elements)
+# supported by one fiber-section column (ForceBeamColumn3d) under each
+# slab node. Expects the variables nDiv (number of divisions of each
+# side of the slab) and feProblem to be defined.
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+L= 20.0 # Slab side length.
+H= 3.0 # Column height.
+h= 0.25 # Slab thickness.
+E= 30e9 # Young modulus of the concrete.
+nu= 0.2 # Poisson's ratio.
+fy= 500e6 # Yield stress of the columns steel.
+width= 0.3 # Column width.
+depth= 0.3 # Column depth.
+
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Slab nodes (top) and column base nodes (bottom).
+step= L/nDiv
+topNodes= list()
+baseNodes= list()
+for j in range(0,nDiv+1):
+  for i in range(0,nDiv+1):
+    topNodes.append(nodes.newNodeXYZ(i*step,j*step,H).tag)
+    baseNodes.append(nodes.newNodeXYZ(i*step,j*step,0.0).tag)
+
+# Materials.
+slabMat= typical_materials.defElasticMembranePlateSection(preprocessor, "slabMat",E,nu,0.0,h)
+steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,0.001)
+G= E/(2*(1+nu))
+respT= typical_materials.defElasticMaterial(preprocessor, "respT",G*1e-3)
+respVy= typical_materials.defElasticMaterial(preprocessor, "respVy",1e9)
+respVz= typical_materials.defElasticMaterial(preprocessor, "respVz",1e9)
+materials= preprocessor.getMaterialHandler
+columnGeom= materials.newSectionGeometry("columnGeom")
+region= columnGeom.getRegions.newQuadRegion("steel")
+region.nDivIJ= 8
+region.nDivJK= 8
+region.pMin= geom.Pos2d(-width/2.0,-depth/2.0)
+region.pMax= geom.Pos2d(width/2.0,depth/2.0)
+columnFibers= materials.newMaterial("fiber_section_3d","columnFibers")
+columnFibers.getFiberSectionRepr().setGeomNamed("columnGeom")
+columnFibers.setupFibers()
+agg= materials.newMaterial("section_aggregator","columnSection")
+agg.setSection("columnFibers")
+agg.setAdditions(["T","Vy","Vz"],["respT","respVy","respVz"])
+
+# Elements.
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "slabMat"
+for j in range(0,nDiv):
+  for i in range(0,nDiv):
+    n0= j*(nDiv+1)+i
+    elements.newElement("ShellMITC4",xc.ID([topNodes[n0],topNodes[n0+1],topNodes[n0+nDiv+2],topNodes[n0+nDiv+1]]))
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "columnSection"
+elements.numSections= 3
+for b,t in zip(baseNodes,topNodes):
+  elements.newElement("ForceBeamColumn3d",xc.ID([b,t]))
+
+# Constraints.
+for b in baseNodes:
+  modelSpace.fixNode000_000(b)
+
+# Loads: vertical load on the slab and horizontal load at its corners.
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+for t in topNodes:
+  lp0.newNodalLoad(t,xc.Vector([2e3,1e3,-10e3,0,0,0]))
+lPatterns.addToDomain("0")
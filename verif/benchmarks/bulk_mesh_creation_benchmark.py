@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+# Benchmark of the creation of a quadrilateral mesh: one node and one
+# element at a time (newNodeXY/newElement) against the batch creation
+# (newNodes/newElements), which updates the domain, the sets and the
+# KD-trees only once. If numpy is available, the arrays are passed
+# through the buffer protocol (no copy).
+# Usage: python bulk_mesh_creation_benchmark.py [nx] [ny]
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import sys
+import time
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+nx= 200
+if(len(sys.argv)>1):
+  nx= int(sys.argv[1])
+ny= 200
+if(len(sys.argv)>2):
+  ny= int(sys.argv[2])
+
+try:
+  import numpy
+except ImportError:
+  numpy= None
+
+def createModel():
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",2.1e9,0.3,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast2d"
+  seedElemHandler= elements.seedElemHandler
+  seedElemHandler.defaultMaterial= "elast2d"
+  seedElemHandler.newElement("FourNodeQuad",xc.ID([0,0,0,0]))
+  return feProblem, preprocessor
+
+coords= list()
+for j in range(0,ny+1):
+  for i in range(0,nx+1):
+    coords.append([i*1.0,j*1.0])
+connectivity= list()
+for j in range(0,ny):
+  for i in range(0,nx):
+    n0= j*(nx+1)+i
+    connectivity.append([n0,n0+1,n0+nx+2,n0+nx+1])
+
+# One at a time.
+feProblem, preprocessor= createModel()
+nodes= preprocessor.getNodeHandler
+elements= preprocessor.getElementHandler
+start= time.time()
+for c in coords:
+  nodes.newNodeXY(c[0],c[1])
+for c in connectivity:
+  elements.newElement("FourNodeQuad",xc.ID(c))
+elapsedOneByOne= time.time()-start
+
+# Batch.
+feProblem, preprocessor= createModel()
+nodes= preprocessor.getNodeHandler
+elements= preprocessor.getElementHandler
+if(numpy):
+  coordArray= numpy.array(coords,dtype= numpy.float64)
+  connectivityArray= numpy.array(connectivity,dtype= numpy.intc)
+else:
+  coordArray= xc.Matrix(coords)
+  connectivityArray= xc.ID([n for c in connectivity for n in c])
+start= time.time()
+nodes.newNodes(coordArray)
+elements.newElements(connectivityArray)
+elapsedBatch= time.time()-start
+
+print "nodes: ", len(coords), " elements: ", len(connectivity), " numpy: ", (numpy is not None)
+print "one by one: ", elapsedOneByOne, "s batch: ", elapsedBatch, "s"
@@ -0,0 +1,89 @@
+# -*- coding: utf-8 -*-
+# Benchmark of the state determination of a frame of ElasticBeam3d
+# elements with corotational coordinate transformations (the cost
+# of the small vector and matrix temporaries created by the
+# coordinate transformations and the nodes dominates here).
+# The script reports also the number of vector and matrix data arrays
+# allocated per iteration (see Vector.getNumAllocations); the total
+# number of heap allocations can be obtained by running the script
+# under a heap profiler, e.g.:
+#   heaptrack python corot_frame_update_benchmark.py
+#   valgrind --tool=memcheck python corot_frame_update_benchmark.py
+# (see the "total heap usage: ... allocs" line).
+# Usage: python corot_frame_update_benchmark.py [nDiv] [numIterations]
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import sys
+import time
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+nDiv= 100
+if(len(sys.argv)>1):
+  nDiv= int(sys.argv[1])
+numIterations= 100
+if(len(sys.argv)>2):
+  numIterations= int(sys.argv[2])
+
+L= 5.0 # Bay length.
+H= 3.0 # Column height.
+E= 210e9 # Young modulus of the steel.
+G= 81e9 # Shear modulus of the steel.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+baseNodes= list()
+topNodes= list()
+for i in range(0,nDiv+1):
+  baseNodes.append(nodes.newNodeXYZ(i*L,0.0,0.0).tag)
+  topNodes.append(nodes.newNodeXYZ(i*L,0.0,H).tag)
+
+section= typical_materials.defElasticSection3d(preprocessor, "section",5e-3,E,G,2e-5,3e-5,1e-6)
+corot= modelSpace.newCorotCrdTransf("corot",xc.Vector([0,1,0]))
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "corot"
+elements.defaultMaterial= "section"
+for b,t in zip(baseNodes,topNodes):
+  elements.newElement("ElasticBeam3d",xc.ID([b,t]))
+for t0,t1 in zip(topNodes[:-1],topNodes[1:]):
+  elements.newElement("ElasticBeam3d",xc.ID([t0,t1]))
+
+for b in baseNodes:
+  modelSpace.fixNode000_000(b)
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+for t in topNodes:
+  lp0.newNodalLoad(t,xc.Vector([10e3,5e3,-50e3,0,0,0]))
+lPatterns.addToDomain("0")
+
+analysis= predefined_solutions.simple_static_linear(feProblem)
+analysis.analyze(1)
+domain= feProblem.getDomain
+mesh= domain.getMesh
+
+numElements= mesh.getNumElements()
+allocs= xc.Vector.getNumAllocations()
+start= time.time()
+for i in range(0,numIterations):
+  mesh.update()
+elapsed= time.time()-start
+allocs= xc.Vector.getNumAllocations()-allocs
+print "elements: ", numElements, " iterations: ", numIterations
+print "time per iteration: ", elapsed/numIterations*1e3, "ms (", elapsed/numIterations/numElements*1e6, "us per element)"
+print "vector/matrix allocations per iteration: ", float(allocs)/numIterations, "(", float(allocs)/numIterations/numElements, "per element)"
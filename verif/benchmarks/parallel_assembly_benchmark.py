@@ -0,0 +1,61 @@
+# -*- coding: utf-8 -*-
+# Scaling benchmark of the parallel assembly of the system of equations
+# (see AnalysisAggregation.numThreads). The model has a slab of
+# nDiv x nDiv ShellMITC4 elements over (nDiv+1)^2 ForceBeamColumn3d
+# fiber-section columns.
+# Usage: python parallel_assembly_benchmark.py [nDiv] [maxThreads]
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import sys
+import time
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+
+nDiv= 40
+if(len(sys.argv)>1):
+  nDiv= int(sys.argv[1])
+maxThreads= 16
+if(len(sys.argv)>2):
+  maxThreads= int(sys.argv[2])
+numSteps= 5
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+
+def runAnalysis(numThreads):
+  '''Build the model, solve it with the number of threads being
+     passed as parameter and return the elapsed time and the
+     displacement of a slab corner.'''
+  global feProblem
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  execfile(pth+"/aux/slab_on_columns.py",globals())
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleNewtonRaphson(feProblem)
+  solution.analysisAggregation.numThreads= numThreads
+  start= time.time()
+  analysis.analyze(numSteps)
+  elapsed= time.time()-start
+  nodes= feProblem.getPreprocessor.getNodeHandler
+  disp= nodes.getNode(topNodes[-1]).getDisp
+  return elapsed, disp
+
+numElements= nDiv*nDiv+(nDiv+1)**2
+print "elements: ", numElements, " steps: ", numSteps
+t1, disp1= runAnalysis(1)
+print "threads: ", 1, " time: ", t1, "s"
+n= 2
+while(n<=maxThreads):
+  t, disp= runAnalysis(n)
+  same= (disp-disp1).Norm()==0.0
+  print "threads: ", n, " time: ", t, "s speed-up: ", t1/t, " same result: ", same
+  n*= 2
@@ -0,0 +1,71 @@
+# -*- coding: utf-8 -*-
+# Scaling benchmark of the parallel update, commit and revert of the
+# mesh state (see Mesh.numThreads). The model has a slab of
+# nDiv x nDiv ShellMITC4 elements over (nDiv+1)^2 ForceBeamColumn3d
+# fiber-section columns.
+# Usage: python parallel_mesh_update_benchmark.py [nDiv] [maxThreads]
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import sys
+import time
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+
+nDiv= 40
+if(len(sys.argv)>1):
+  nDiv= int(sys.argv[1])
+maxThreads= 16
+if(len(sys.argv)>2):
+  maxThreads= int(sys.argv[2])
+numSweeps= 10
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+execfile(pth+"/aux/slab_on_columns.py")
+solution= predefined_solutions.SolutionProcedure()
+analysis= solution.simpleNewtonRaphson(feProblem)
+analysis.analyze(1)
+domain= feProblem.getDomain
+mesh= domain.getMesh
+
+def sweeps(numThreads):
+  '''Update, commit and revert the mesh numSweeps times using the
+     number of threads being passed as parameter and return the
+     elapsed times and the sum of the update return codes.'''
+  mesh.numThreads= numThreads
+  start= time.time()
+  ok= 0
+  for i in range(0,numSweeps):
+    ok+= mesh.update()
+  tUpdate= time.time()-start
+  start= time.time()
+  for i in range(0,numSweeps):
+    domain.commit()
+  tCommit= time.time()-start
+  start= time.time()
+  for i in range(0,numSweeps):
+    domain.revertToLastCommit()
+  tRevert= time.time()-start
+  return tUpdate, tCommit, tRevert, ok
+
+numElements= nDiv*nDiv+(nDiv+1)**2
+print "elements: ", numElements, " sweeps: ", numSweeps
+u1, c1, r1, ok1= sweeps(1)
+print "threads: ", 1, " update: ", u1, "s commit: ", c1, "s revert: ", r1, "s"
+n= 2
+while(n<=maxThreads):
+  u, c, r, ok= sweeps(n)
+  print "threads: ", n, " update: ", u, "s (x", u1/u, ") commit: ", c, "s (x", c1/c, ") revert: ", r, "s (x", r1/r, ") same codes: ", ok==ok1
+  n*= 2
@@ -54,6 +54,7 @@ python tests/elements/crd_transf/test_linear_crd_transf_3d_02.py
 python tests/elements/crd_transf/test_pdelta_crd_transf_3d_01.py
 python tests/elements/crd_transf/test_corot_crd_transf_3d_01.py
 python tests/elements/crd_transf/test_corot_crd_transf_3d_02.py
+python tests/elements/crd_transf/test_corot_crd_transf_3d_03.py
 python tests/elements/crd_transf/test_element_axis_01.py
 python tests/elements/crd_transf/test_element_axis_02.py
 python tests/elements/crd_transf/test_element_axis_03.py
@@ -94,6 +95,7 @@ python tests/elements/beam_column/test_force_beam_column_3d_03.py
 python tests/elements/beam_column/test_force_beam_column_3d_04.py
 python tests/elements/beam_column/test_force_beam_column_3d_05.py
 python tests/elements/beam_column/test_force_beam_column_3d_06.py
+python tests/elements/beam_column/test_force_beam_column_3d_07.py
 python tests/elements/beam_column/plastic_hinge_on_cantilever.py
 python tests/elements/beam_column/test_crdTransf_rotation_01.py
 python tests/elements/beam_column/test_frame_01.py
@@ -170,6 +172,16 @@ python tests/elements/kill_elements_02.py
 
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
+python tests/solution/parallel_assembly_test_01.py
+python tests/solution/parallel_mesh_update_test_01.py
+python tests/solution/parallel_matrix_solve_test_01.py
+python tests/solution/linear_superposition_test_01.py
+python tests/solution/factorization_reuse_test_01.py
+python tests/solution/csr_graph_soe_test_01.py
+python tests/solution/numberer_fill_test_01.py
+python tests/solution/supernodal_ldl_solver_test_01.py
+python tests/solution/thread_solvers_test_01.py
+python tests/solution/krylov_solvers_test_01.py
 
 #Constraint handlers tests.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -250,7 +262,10 @@ python tests/preprocessor/test_surface_meshing_02.py
 python tests/preprocessor/test_surface_meshing_03.py
 python tests/preprocessor/test_surface_meshing_04.py
 python tests/preprocessor/test_surface_meshing_05.py
+python tests/preprocessor/test_surface_meshing_06.py
 python tests/preprocessor/test_imposed_meshing.py
+python tests/preprocessor/test_bulk_mesh_creation_01.py
+python tests/preprocessor/test_kdtree_queries_01.py
 echo "$BLEU" "  Sets handling tests." "$NORMAL"
 python tests/preprocessor/sets/test_exist_set.py
 python tests/preprocessor/sets/mueve_set.py
@@ -258,10 +273,13 @@ python tests/preprocessor/sets/test_set_01.py
 python tests/preprocessor/sets/une_sets.py
 python tests/preprocessor/sets/sets_boolean_operations_01.py
 python tests/preprocessor/sets/sets_boolean_operations_02.py
+python tests/preprocessor/sets/sets_boolean_operations_03.py
 python tests/preprocessor/sets/test_resisting_svd01.py
 python tests/preprocessor/sets/test_get_contours_01.py
 python tests/preprocessor/sets/test_get_contours_02.py
 python tests/preprocessor/sets/test_pick_entities.py
+python tests/preprocessor/sets/test_pick_entities_02.py
+python tests/preprocessor/sets/test_pick_entities_03.py
 python tests/preprocessor/sets/test_sets_and_grids.py
 python tests/preprocessor/sets/test_get_bnd_01.py
 python tests/preprocessor/sets/test_fill_downwards_01.py
@@ -441,9 +459,17 @@ python tests/materials/fiber_section/test_interaction_diagram03.py
 python tests/materials/fiber_section/test_interaction_diagram04.py
 python tests/materials/fiber_section/test_interaction_diagram05.py
 python tests/materials/fiber_section/test_interaction_diagram06.py
+python tests/materials/fiber_section/test_interaction_diagram07.py
+python tests/materials/fiber_section/test_interaction_diagram08.py
+python tests/materials/fiber_section/test_interaction_diagram09.py
 python tests/materials/fiber_section/test_shear_01.py
 python tests/materials/fiber_section/test_shear_02.py
 python tests/materials/fiber_section/plastic_hinge_on_IPE200.py
+python tests/materials/fiber_section/test_packed_fiber_layout_01.py
+python tests/materials/fiber_section/test_packed_fiber_layout_02.py
+python tests/materials/fiber_section/test_arena_fiber_storage_01.py
+python tests/materials/fiber_section/test_lazy_elastic_fibers_01.py
+python tests/materials/fiber_section/test_lazy_elastic_fibers_02.py
 echo "$BLEU" "  RC sections test." "$NORMAL"
 python tests/materials/ehe/test_Ecm_concrete.py
 python tests/materials/ehe/test_EHEconcrete.py
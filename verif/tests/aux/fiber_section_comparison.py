@@ -0,0 +1,136 @@
+# -*- coding: utf-8 -*-
+''' Model used by the tests of the alternative state determination
+    procedures of the fiber sections (packed fiber layout, lazy elastic
+    fibers, arena storage): reinforced concrete cross section (optionally
+    strengthened with an elastic plate) and functions to compare the
+    response of two sections that differ only in those properties.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+width= 0.4 # Cross section width.
+depth= 0.6 # Cross section depth.
+cover= 0.05 # Reinforcement cover.
+barArea= 4.91e-4 # Area of a 25 mm bar.
+fc= 30e6 # Concrete strength.
+fy= 500e6 # Steel yield stress.
+
+# Section types and number of generalized strains of each one.
+sectionTypes= [("fiber_section_2d",2),("fiber_section_3d",3),("fiber_section_GJ",4)]
+
+def defRCSectionGeometry(feProblem, materialsFamily= "01", plate= False):
+  ''' Define the materials and the geometry (named "sectionGeom") of
+      a 0.4x0.6 reinforced concrete section.
+
+      :param materialsFamily: "01" for Concrete01 and Steel01, "02"
+                              for Concrete02 (with tensile strength)
+                              and Steel02.
+      :param plate: if true add an elastic plate to the bottom face.
+  '''
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  if(materialsFamily=="01"):
+    concrete= typical_materials.defConcrete01(preprocessor,"concrete",-2e-3,-fc,-0.85*fc,-3.5e-3)
+    steel= typical_materials.defSteel01(preprocessor,"steel",200e9,fy,0.01)
+  else:
+    concrete= typical_materials.defConcrete02(preprocessor,"concrete",-2e-3,-fc,-0.85*fc,-3.5e-3,0.1,0.1*fc,0.1*fc/2e-3)
+    steel= typical_materials.defSteel02(preprocessor,"steel",200e9,fy,0.01,0.0)
+
+  materials= preprocessor.getMaterialHandler
+  sectionGeom= materials.newSectionGeometry("sectionGeom")
+  region= sectionGeom.getRegions.newQuadRegion("concrete")
+  region.nDivIJ= 12
+  region.nDivJK= 20
+  region.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+  region.pMax= geom.Pos2d(depth/2.0,width/2.0)
+  reinforcement= sectionGeom.getReinfLayers
+  for y in [-depth/2.0+cover,depth/2.0-cover]:
+    layer= reinforcement.newStraightReinfLayer("steel")
+    layer.numReinfBars= 5
+    layer.barArea= barArea
+    layer.p1= geom.Pos2d(y,-width/2.0+cover)
+    layer.p2= geom.Pos2d(y,width/2.0-cover)
+  if(plate):
+    typical_materials.defElasticMaterial(preprocessor,"plate",170e9)
+    layer= reinforcement.newStraightReinfLayer("plate")
+    layer.numReinfBars= 8
+    layer.barArea= 1.2e-4
+    layer.p1= geom.Pos2d(-depth/2.0,-width/2.0)
+    layer.p2= geom.Pos2d(-depth/2.0,width/2.0)
+  return sectionGeom
+
+def newFiberSection(feProblem, sectionType, name, properties):
+  ''' Return a new fiber section with the geometry "sectionGeom". The
+      section properties are assigned from the properties dictionary
+      (arenaFiberStorage before creating the fibers, so they are
+      allocated in the arena).'''
+  materials= feProblem.getPreprocessor.getMaterialHandler
+  section= materials.newMaterial(sectionType,name)
+  if("arenaFiberStorage" in properties):
+    section.arenaFiberStorage= properties["arenaFiberStorage"]
+  section.getFiberSectionRepr().setGeomNamed("sectionGeom")
+  section.setupFibers()
+  for key in properties:
+    if(key!="arenaFiberStorage"):
+      setattr(section,key,properties[key])
+  return section
+
+def relativeDifference(mA, mB):
+  ''' Return the norm of the difference between both vectors (or matrices)
+      divided by the norm of the first one.'''
+  return (mA-mB).Norm()/mA.Norm()
+
+def compareSectionResponse(sA, sB, numStrains, strains):
+  ''' Apply the trial deformations to both sections (committing two of
+      each three and reverting the third one) and return the maximum
+      relative difference between their stiffness, stress resultants
+      and fiber stresses.'''
+  retval= relativeDifference(sA.getInitialTangentStiffness(),sB.getInitialTangentStiffness())
+  for i,eps in enumerate(strains):
+    v= xc.Vector((eps+[0.0])[0:numStrains])
+    sA.setTrialSectionDeformation(v)
+    sB.setTrialSectionDeformation(v)
+    retval= max(retval,relativeDifference(sA.getTangentStiffness(),sB.getTangentStiffness()))
+    retval= max(retval,relativeDifference(sA.getStressResultant(),sB.getStressResultant()))
+    if(i%2==1): # Fiber stresses.
+      NA= sA.getFibers().getResultant()
+      retval= max(retval,abs(NA-sB.getFibers().getResultant())/abs(NA))
+    if(i%3!=2):
+      sA.commitState()
+      sB.commitState()
+    else:
+      sA.revertToLastCommit()
+      sB.revertToLastCommit()
+      retval= max(retval,relativeDifference(sA.getStressResultant(),sB.getStressResultant()))
+  retval= max(retval,abs(sA.getFibers().getCenterOfMassY()-sB.getFibers().getCenterOfMassY()))
+  return retval
+
+def compareFiberSections(feProblem, strains, propertiesA, propertiesB):
+  ''' For each section type (2D, 3D and 3D with torsion) create two
+      sections with the properties being passed as parameter and
+      compare their response to the trial deformations. Return the
+      maximum relative difference for each section type and the
+      sections (pairs A, B).
+
+      :param strains: list of generalized strains [axial strain,
+                      curvature about z, curvature about y] (the twist
+                      is zero).
+  '''
+  errors= list()
+  sections= list()
+  for sectionType, numStrains in sectionTypes:
+    sA= newFiberSection(feProblem,sectionType,sectionType+"A",propertiesA)
+    sB= newFiberSection(feProblem,sectionType,sectionType+"B",propertiesB)
+    errors.append(compareSectionResponse(sA,sB,numStrains,strains))
+    sections.append((sA,sB))
+  return errors, sections
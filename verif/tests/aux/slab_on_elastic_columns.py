@@ -0,0 +1,136 @@
+# -*- coding: utf-8 -*-
+''' Model used by the tests of the solution procedures: square slab
+    (ShellMITC4 elements) supported by elastic columns (ElasticBeam3d)
+    under a vertical and a horizontal load at each slab node. Defines
+    the functions that build and solve the model.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+def buildSlabOnColumns(feProblem, L, nDiv, columnStep= 2, braced= False):
+  ''' Build the model and return the tags of the slab nodes and of
+      the column base nodes.
+
+      :param L: slab side length.
+      :param nDiv: number of divisions of each slab side.
+      :param columnStep: one column each columnStep slab nodes in
+                         each direction.
+      :param braced: if true, add trusses between the base of the
+                     columns and the slab along the first row.
+  '''
+  H= 3.0 # Column height.
+  E= 30e9 # Young modulus of the concrete.
+  nu= 0.2 # Poisson's ratio.
+  h= 0.25 # Slab thickness.
+  A= 0.09 # Column cross section area.
+  I= 0.3**4/12.0 # Column moment of inertia.
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  step= L/nDiv
+  topNodes= list()
+  columns= list()
+  for j in range(0,nDiv+1):
+    for i in range(0,nDiv+1):
+      topNodes.append(nodes.newNodeXYZ(i*step,j*step,H).tag)
+      if((i%columnStep==0) and (j%columnStep==0)):
+        columns.append((nodes.newNodeXYZ(i*step,j*step,0.0).tag,topNodes[-1]))
+
+  slabMat= typical_materials.defElasticMembranePlateSection(preprocessor, "slabMat",E,nu,0.0,h)
+  columnSection= typical_materials.defElasticSection3d(preprocessor,"columnSection",A,E,E/(2*(1+nu)),I,I,2*I)
+
+  lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "slabMat"
+  for j in range(0,nDiv):
+    for i in range(0,nDiv):
+      n0= j*(nDiv+1)+i
+      elements.newElement("ShellMITC4",xc.ID([topNodes[n0],topNodes[n0+1],topNodes[n0+nDiv+2],topNodes[n0+nDiv+1]]))
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "columnSection"
+  for b,t in columns:
+    elements.newElement("ElasticBeam3d",xc.ID([b,t]))
+  baseNodes= [b for b,t in columns]
+  if(braced):
+    braceMat= typical_materials.defElasticMaterial(preprocessor, "braceMat",E/10.0)
+    elements.defaultMaterial= "braceMat"
+    elements.dimElem= 3
+    for i in range(0,nDiv//columnStep):
+      truss= elements.newElement("Truss",xc.ID([baseNodes[i],topNodes[(i+1)*columnStep]]))
+      truss.area= 1e-3
+
+  for b in baseNodes:
+    modelSpace.fixNode000_000(b)
+
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  for t in topNodes:
+    lp0.newNodalLoad(t,xc.Vector([2e3,1e3,-10e3,0,0,0]))
+  lPatterns.addToDomain("0")
+  return topNodes, baseNodes
+
+def solveSlabOnColumns(L, nDiv, setup, columnStep= 2, braced= False):
+  ''' Build the model in a new problem, solve it with the solution
+      procedure returned by setup(feProblem) and return the result
+      of the analysis, the displacements of the slab nodes, the
+      reactions at the column bases, the solution procedure and
+      the problem (the solution procedure is valid while the problem
+      exists).'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  topNodes, baseNodes= buildSlabOnColumns(feProblem,L,nDiv,columnStep,braced)
+  solution= setup(feProblem)
+  result= solution.analysis.analyze(1)
+  nodes= feProblem.getPreprocessor.getNodeHandler
+  nodes.calculateNodalReactions(True,1e-7)
+  disp= [nodes.getNode(t).getDisp for t in topNodes]
+  reactions= [nodes.getNode(b).getReaction for b in baseNodes]
+  return result, disp, reactions, solution, feProblem
+
+def linearSolutionSetup(numberer, soeType, solverType, solverProperties= dict()):
+  ''' Return a function that creates a linear static solution procedure
+      that uses the numbering algorithm, the system of equations
+      and the solver being passed as parameter. The solver properties
+      (i.e. numThreads) are assigned from the solverProperties
+      dictionary.'''
+  def setup(feProblem):
+    solution= predefined_solutions.SolutionProcedure()
+    solution.simpleStaticLinear(feProblem)
+    solution.numberer.useAlgorithm(numberer)
+    solution.soe= solution.analysisAggregation.newSystemOfEqn(soeType)
+    solution.solver= solution.soe.newSolver(solverType)
+    for key in solverProperties:
+      setattr(solution.solver,key,solverProperties[key])
+    return solution
+  return setup
+
+def compareLinearSolutions(L, nDiv, cases):
+  ''' Solve the model with each of the cases (arguments of
+      linearSolutionSetup) and return the results of the analyses,
+      the maximum displacement of the slab obtained with the first
+      case and the sum of the differences between the displacements
+      of each case and those of the first one divided by that
+      maximum.'''
+  resultRef, dispRef, reacRef, solution, feProblem= solveSlabOnColumns(L,nDiv,linearSolutionSetup(*cases[0]))
+  maxDisp= max([d.Norm() for d in dispRef])
+  results= [resultRef]
+  err= 0.0
+  for c in cases[1:]:
+    result, disp, reac, solution, feProblem= solveSlabOnColumns(L,nDiv,linearSolutionSetup(*c))
+    results.append(result)
+    for d1,d2 in zip(dispRef,disp):
+      err+= (d1-d2).Norm()
+  return results, maxDisp, err/maxDisp
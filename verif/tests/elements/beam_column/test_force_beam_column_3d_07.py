@@ -0,0 +1,107 @@
+# -*- coding: utf-8 -*-
+# home made test
+''' Horizontal cantilever with yielded sections under vertical load at
+    its front end. Checks that the results obtained computing the
+    section responses in parallel are the same than those obtained
+    with the serial computation.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2018, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import os
+
+# Geometry
+width= .05
+depth= .1
+nDivIJ= 5
+nDivJK= 10
+y0= 0
+z0= 0
+L= 1.5 # Bar length (m)
+F= 18e3 # Load magnitude en N
+fy= 275e6 # Yield stress of the steel.
+E= 210e9 # Young modulus of the steel.
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+
+def solve(numSectionThreads):
+  ''' Computes the cantilever using the number of threads
+      passed as parameter to compute the section responses.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor   
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  nod= nodes.newNodeXYZ(0,0.0,0.0)
+  nod= nodes.newNodeXYZ(L,0.0,0.0)
+  lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+  # Materials definition
+  steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,0.001)
+  respT= typical_materials.defElasticMaterial(preprocessor, "respT",1e10) # Torsion response.
+  respVy= typical_materials.defElasticMaterial(preprocessor, "respVy",1e9) # Shear response in y direction.
+  respVz= typical_materials.defElasticMaterial(preprocessor, "respVz",1e9) # Shear response in z direction.
+  # Sections
+  execfile(pth+"/../../aux/testQuadRegion.py",dict(globals(),preprocessor= preprocessor))
+  materiales= preprocessor.getMaterialHandler
+  quadFibers= materiales.newMaterial("fiber_section_3d","quadFibers")
+  fiberSectionRepr= quadFibers.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed("testQuadRegion")
+  quadFibers.setupFibers()
+  agg= materiales.newMaterial("section_aggregator","agg")
+  agg.setSection("quadFibers")
+  agg.setAdditions(["T","Vy","Vz"],["respT","respVy","respVz"])
+  # Elements definition
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "agg"
+  elements.numSections= 5 # Number of sections along the element.
+  elements.defaultTag= 1
+  el= elements.newElement("ForceBeamColumn3d",xc.ID([1,2]))
+  el.numSectionThreads= numSectionThreads
+  # Constraints
+  modelSpace.fixNode000_000(1)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2,xc.Vector([0,-F,0,0,0,0]))
+  lPatterns.addToDomain("0")
+  # Solution procedure
+  analisis= predefined_solutions.simple_static_modified_newton(feProblem)
+  result= analisis.analyze(10)
+  nodes.calculateNodalReactions(True,1e-7)
+  delta= nodes.getNode(2).getDisp[1]
+  RMz= nodes.getNode(1).getReaction[5]
+  return result, el.numSectionThreads, delta, RMz
+
+result1, nThreads1, delta1, RMz1= solve(1)
+result4, nThreads4, delta4, RMz4= solve(4)
+
+''' 
+print "nThreads1= ",nThreads1
+print "delta1= ",delta1
+print "RMz1= ",RMz1
+print "nThreads4= ",nThreads4
+print "delta4= ",delta4
+print "RMz4= ",RMz4
+   '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result1==0) & (result4==0) & (nThreads1==1) & (nThreads4==4) & (delta1==delta4) & (RMz1==RMz4):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
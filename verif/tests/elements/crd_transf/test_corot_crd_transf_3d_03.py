@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+''' Cantilever of ElasticBeam3d elements with corotational coordinate
+    transformation under an end moment that bends it into a half circle.
+    With no axial force each element keeps its length and its end
+    rotations (relative to the chord) are theta= M*Le/(2*E*I), so the
+    nodes lie on a circle of radius Le/(2*sin(theta)). Checks also
+    that computing the current position of the nodes doesn't create
+    vector temporaries (see Vector.getNumAllocations).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 1e3 # Young modulus.
+G= E/2.6 # Shear modulus.
+A= 1.0 # Cross section area.
+I= 1e-2 # Moments of inertia.
+L= 10.0 # Cantilever length.
+nDiv= 20 # Number of elements.
+M= math.pi*E*I/L # End moment (bends the cantilever into a half circle).
+numSteps= 20
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodeTags= list()
+for i in range(0,nDiv+1):
+  nodeTags.append(nodes.newNodeXYZ(i*L/nDiv,0.0,0.0).tag)
+
+# Materials
+section= typical_materials.defElasticSection3d(preprocessor, "section",A,E,G,I,I,2*I)
+
+# Geometric transformations
+corot= modelSpace.newCorotCrdTransf("corot",xc.Vector([0,1,0]))
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "corot"
+elements.defaultMaterial= "section"
+for i,j in zip(nodeTags[:-1],nodeTags[1:]):
+  elements.newElement("ElasticBeam3d",xc.ID([i,j]))
+
+# Constraints
+modelSpace.fixNode000_000(nodeTags[0])
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(nodeTags[-1],xc.Vector([0,0,0,0,M,0]))
+lPatterns.addToDomain("0")
+
+# Solution
+solution= predefined_solutions.SolutionProcedure()
+solution.maxNumIter= 20
+analysis= solution.simpleNewtonRaphson(feProblem)
+solution.integ.dLambda1= 1.0/numSteps
+result= analysis.analyze(numSteps)
+
+Le= L/nDiv
+theta= M*Le/(2*E*I)
+r= Le/(2.0*math.sin(theta))
+tip= nodes.getNode(nodeTags[-1])
+ratio1= abs(tip.getDisp[0]+L)/L # The tip returns to x= 0.
+ratio2= abs(tip.getDisp[2]+2*r)/(2*r)
+ratio3= abs(tip.getDisp[4]-math.pi)/math.pi
+# All the nodes lie on the circle.
+nodeList= [nodes.getNode(t) for t in nodeTags]
+allocs= xc.Vector.getNumAllocations()
+positions= [n.getCurrentPos3d(1.0) for n in nodeList]
+nodeAllocs= xc.Vector.getNumAllocations()-allocs
+ratio4= 0.0
+for p in positions:
+  ratio4= max(ratio4,abs(math.sqrt(p.x**2+(p.z+r)**2)-r)/r)
+
+'''
+print "result= ", result
+print "tip displacement: ", tip.getDisp
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+print "ratio3= ", ratio3
+print "ratio4= ", ratio4
+print "nodeAllocs= ", nodeAllocs
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((result==0) and (ratio1<1e-6) and (ratio2<1e-6) and (ratio3<1e-6) and (ratio4<1e-6) and (nodeAllocs==0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
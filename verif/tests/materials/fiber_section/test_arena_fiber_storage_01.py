@@ -0,0 +1,75 @@
+# -*- coding: utf-8 -*-
+''' Checks that reinforced concrete fiber sections (2D, 3D and 3D with
+    torsion) whose fibers are allocated in a memory arena (see
+    FiberSectionBase.arenaFiberStorage) give the same stiffness and
+    stress resultant that the sections whose fibers are allocated one
+    by one, along a sequence of trial, commit and revert operations.
+    Checks also that the copies of the section made by a beam element
+    (one for each integration point) have their own arena and that
+    their state is independent of the one of the other copies.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../../aux/fiber_section_comparison.py")
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+defRCSectionGeometry(feProblem,"01")
+
+# Generalized strains: axial strain, curvatures (and twist).
+strains= [[-2e-4,4e-3,-1e-3],[-5e-4,9e-3,3e-3],[1e-4,-6e-3,2e-3],[-1e-3,1.2e-2,-4e-3]]
+
+errors, sections= compareFiberSections(feProblem,strains,{"arenaFiberStorage":False},{"arenaFiberStorage":True})
+# Only the second section uses the arena.
+arenaOk= all([(sA.getFibers().getArenaNumBytes()==0) and (sB.getFibers().getArenaNumBytes()>0) for sA,sB in sections])
+
+# Copies of the section made by the element.
+arenaSection= newFiberSection(feProblem,"fiber_section_GJ","arenaSection",{"arenaFiberStorage":True})
+preprocessor= feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+n1= nodes.newNodeXYZ(0.0,0.0,0.0)
+n2= nodes.newNodeXYZ(3.0,0.0,0.0)
+lin= preprocessor.getTransfCooHandler.newLinearCrdTransf3d("lin")
+lin.xzVector= xc.Vector([0,1,0])
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "arenaSection"
+elements.numSections= 3 # Number of sections along the element.
+beam= elements.newElement("ForceBeamColumn3d",xc.ID([n1.tag,n2.tag]))
+copies= [beam.getSections()[i] for i in range(0,3)]
+copiesOk= all([c.arenaFiberStorage and (c.getFibers().getArenaNumBytes()>0) for c in copies])
+
+# The first copy behaves as a section allocated fiber by fiber...
+reference= newFiberSection(feProblem,"fiber_section_GJ","reference",{"arenaFiberStorage":False})
+errCopy= compareSectionResponse(reference,copies[0],4,strains)
+# ... and the other copies and the original section remain unloaded.
+for s in copies[1:]+[arenaSection]:
+  copiesOk= copiesOk and (s.getStressResultant().Norm()==0.0) and (s.getFibers().getResultant()==0.0)
+
+'''
+print "errors= ", errors
+print "errCopy= ", errCopy
+print "arenaOk= ", arenaOk
+print "copiesOk= ", copiesOk
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(arenaOk and copiesOk and (max(errors)<1e-12) and (errCopy<1e-12)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Checks that the capacity factors obtained in one call for the
+    internal forces triplets (N,My,Mz) stored in the rows of a matrix
+    are the same that those obtained one by one, and that the points
+    on the diagram surface have a capacity factor equal to one. '''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import math
+import xc_base
+import geom
+import xc
+from materials.ehe import EHE_materials
+
+width= 0.4 # Cross-section width [m]
+depth= 0.6 # Cross-section depth [m]
+cover= 0.05 # Cover [m]
+areaFi16= 2.01e-4 # Rebars cross-section area [m2]
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Materials definition
+concr= EHE_materials.HA25
+concr.alfacc=0.85
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+# Section geometry
+geomSecHA= preprocessor.getMaterialHandler.newSectionGeometry("geomSecHA")
+regions= geomSecHA.getRegions
+concrete= regions.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+concrete.nDivIJ= 10
+concrete.nDivJK= 10
+concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+reinforcement= geomSecHA.getReinfLayers
+reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementInf.numReinfBars= 4
+reinforcementInf.barArea= areaFi16
+reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementSup.numReinfBars= 4
+reinforcementSup.barArea= areaFi16
+reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+materiales= preprocessor.getMaterialHandler
+secHA= materiales.newMaterial("fiber_section_3d","secHA")
+fiberSectionRepr= secHA.getFiberSectionRepr()
+fiberSectionRepr.setGeomNamed("geomSecHA")
+secHA.setupFibers()
+
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.reinforcementTag= EHE_materials.B500S.matTagD
+diagIntsecHA= materiales.calcInteractionDiagram("secHA",param)
+
+# Internal forces triplets in all directions.
+triplets= list()
+for i in range(0,12):
+  theta= i*math.pi/12.0
+  for j in range(0,24):
+    phi= j*math.pi/12.0
+    N= 3000e3*math.cos(theta)
+    My= 300e3*math.sin(theta)*math.cos(phi)
+    Mz= 200e3*math.sin(theta)*math.sin(phi)
+    triplets.append([N,My,Mz])
+FCs= diagIntsecHA.getCapacityFactor(xc.Matrix(triplets))
+
+# Capacity factors one by one.
+err= 0.0
+for t,fc in zip(triplets,FCs):
+  err+= abs(fc-diagIntsecHA.getCapacityFactor(geom.Pos3d(t[0],t[1],t[2])))
+
+# Points on the diagram surface.
+errSurface= 0.0
+for t in triplets[0::7]:
+  p= diagIntsecHA.getIntersection(geom.Pos3d(t[0],t[1],t[2]))
+  errSurface+= (diagIntsecHA.getCapacityFactor(p)-1.0)**2
+errSurface= math.sqrt(errSurface)
+
+''' 
+print "len(FCs)= ",len(FCs)
+print "err= ",err
+print "errSurface= ",errSurface
+ '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((len(FCs)==len(triplets)) and (err==0.0) and (errSurface<1e-6)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
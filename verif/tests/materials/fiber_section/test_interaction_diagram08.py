@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+''' Checks that the interaction diagram computed with several threads
+    (see InteractionDiagramParameters.numThreads) is the same that the
+    one computed serially, and that computing the diagram doesn't
+    change the state of the section. '''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import math
+import xc_base
+import geom
+import xc
+from materials.ehe import EHE_materials
+
+width= 0.4 # Cross-section width [m]
+depth= 0.6 # Cross-section depth [m]
+cover= 0.05 # Cover [m]
+areaFi16= 2.01e-4 # Rebars cross-section area [m2]
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Materials definition
+concr= EHE_materials.HA25
+concr.alfacc=0.85
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+# Section geometry
+geomSecHA= preprocessor.getMaterialHandler.newSectionGeometry("geomSecHA")
+regions= geomSecHA.getRegions
+concrete= regions.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+concrete.nDivIJ= 10
+concrete.nDivJK= 10
+concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+reinforcement= geomSecHA.getReinfLayers
+reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementInf.numReinfBars= 4
+reinforcementInf.barArea= areaFi16
+reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementSup.numReinfBars= 4
+reinforcementSup.barArea= areaFi16
+reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+materiales= preprocessor.getMaterialHandler
+sections= list()
+for name in ["secHA1","secHA4"]:
+  sec= materiales.newMaterial("fiber_section_3d",name)
+  fiberSectionRepr= sec.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed("geomSecHA")
+  sec.setupFibers()
+  sections.append(sec)
+
+def calcDiagram(sectionName, numThreads):
+  ''' Compute the interaction diagram of the section using the number
+      of threads being passed as parameter.'''
+  param= xc.InteractionDiagramParameters()
+  param.concreteTag= EHE_materials.HA25.matTagD
+  param.reinforcementTag= EHE_materials.B500S.matTagD
+  param.incTheta= math.pi/12.0
+  param.numThreads= numThreads
+  return materiales.calcInteractionDiagram(sectionName,param)
+
+diag1= calcDiagram("secHA1",1)
+volume1= diag1.getVolume()
+diag4= calcDiagram("secHA4",4)
+volume4= diag4.getVolume()
+strainAfter= sections[0].getSectionDeformation().Norm()+sections[1].getSectionDeformation().Norm()
+
+# Internal forces triplets in all directions.
+triplets= list()
+for i in range(0,12):
+  theta= i*math.pi/12.0
+  for j in range(0,24):
+    phi= j*math.pi/12.0
+    N= 3000e3*math.cos(theta)
+    My= 300e3*math.sin(theta)*math.cos(phi)
+    Mz= 200e3*math.sin(theta)*math.sin(phi)
+    triplets.append([N,My,Mz])
+m= xc.Matrix(triplets)
+FCs1= diag1.getCapacityFactor(m)
+FCs4= diag4.getCapacityFactor(m)
+err= (FCs1-FCs4).Norm()
+
+''' 
+print "volume1= ",volume1, " volume4= ",volume4
+print "err= ",err
+print "strainAfter= ",strainAfter
+ '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((volume1>0.0) and (volume1==volume4) and (err==0.0) and (strainAfter==0.0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+''' Checks the interaction diagram cache (see
+    InteractionDiagramParameters.cacheDirectory): the diagram read
+    from the cache must be the same that the computed one, a
+    change in the parameters must produce a new cache entry and
+    the same materials defined with other tags must not. '''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import copy
+import shutil
+import tempfile
+import math
+import xc_base
+import geom
+import xc
+from materials.ehe import EHE_materials
+
+width= 0.4 # Cross-section width [m]
+depth= 0.6 # Cross-section depth [m]
+cover= 0.05 # Cover [m]
+areaFi16= 2.01e-4 # Rebars cross-section area [m2]
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Materials definition
+concr= EHE_materials.HA25
+concr.alfacc=0.85
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+# Same materials with other tags.
+concr2= copy.copy(concr)
+concr2.setupName("HA25bis")
+concr2.defDiagD(preprocessor)
+steel2= copy.copy(EHE_materials.B500S)
+steel2.setupName("B500Sbis")
+steel2.defDiagD(preprocessor)
+
+def defSectionGeometry(name, concreteRecord, steelRecord):
+  ''' Define the section geometry with the materials being passed
+      as parameter.'''
+  geomSecHA= preprocessor.getMaterialHandler.newSectionGeometry(name)
+  regions= geomSecHA.getRegions
+  concrete= regions.newQuadRegion(concreteRecord.nmbDiagD)
+  concrete.nDivIJ= 10
+  concrete.nDivJK= 10
+  concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+  concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+  reinforcement= geomSecHA.getReinfLayers
+  reinforcementInf= reinforcement.newStraightReinfLayer(steelRecord.nmbDiagD)
+  reinforcementInf.numReinfBars= 4
+  reinforcementInf.barArea= areaFi16
+  reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+  reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+  reinforcementSup= reinforcement.newStraightReinfLayer(steelRecord.nmbDiagD)
+  reinforcementSup.numReinfBars= 4
+  reinforcementSup.barArea= areaFi16
+  reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+  reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+defSectionGeometry("geomSecHA",concr,EHE_materials.B500S)
+defSectionGeometry("geomSecHAbis",concr2,steel2)
+
+materiales= preprocessor.getMaterialHandler
+sections= list()
+for name,geomName in [("secHA1","geomSecHA"),("secHA2","geomSecHA"),("secHA3","geomSecHA"),("secHA4","geomSecHAbis")]:
+  sec= materiales.newMaterial("fiber_section_3d",name)
+  fiberSectionRepr= sec.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed(geomName)
+  sec.setupFibers()
+  sections.append(sec)
+
+cacheDir= tempfile.mkdtemp()
+
+def calcDiagram(sectionName, incTheta, concreteTag= concr.matTagD, reinforcementTag= EHE_materials.B500S.matTagD):
+  ''' Compute the interaction diagram of the section using the
+      cache.'''
+  param= xc.InteractionDiagramParameters()
+  param.concreteTag= concreteTag
+  param.reinforcementTag= reinforcementTag
+  param.incTheta= incTheta
+  param.cacheDirectory= cacheDir
+  return materiales.calcInteractionDiagram(sectionName,param)
+
+diag1= calcDiagram("secHA1",math.pi/8.0) # Computed and stored.
+numEntries1= len(os.listdir(cacheDir))
+diag2= calcDiagram("secHA2",math.pi/8.0) # Read from cache.
+numEntries2= len(os.listdir(cacheDir))
+diag3= calcDiagram("secHA3",math.pi/6.0) # Other parameters.
+numEntries3= len(os.listdir(cacheDir))
+diag4= calcDiagram("secHA4",math.pi/8.0,concr2.matTagD,steel2.matTagD) # Read from cache.
+numEntries4= len(os.listdir(cacheDir))
+shutil.rmtree(cacheDir)
+
+# Internal forces triplets in all directions.
+triplets= list()
+for i in range(0,12):
+  theta= i*math.pi/12.0
+  for j in range(0,24):
+    phi= j*math.pi/12.0
+    N= 3000e3*math.cos(theta)
+    My= 300e3*math.sin(theta)*math.cos(phi)
+    Mz= 200e3*math.sin(theta)*math.sin(phi)
+    triplets.append([N,My,Mz])
+m= xc.Matrix(triplets)
+FCs1= diag1.getCapacityFactor(m)
+FCs2= diag2.getCapacityFactor(m)
+err= (FCs1-FCs2).Norm()
+volume1= diag1.getVolume()
+volume2= diag2.getVolume()
+volume4= diag4.getVolume()
+
+''' 
+print "numEntries= ",numEntries1, numEntries2, numEntries3, numEntries4
+print "volume1= ",volume1, " volume2= ",volume2, " volume4= ",volume4
+print "err= ",err
+ '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((numEntries1==1) and (numEntries2==1) and (numEntries3==2) and (numEntries4==2) and (volume1>0.0) and (volume1==volume2) and (volume1==volume4) and (err==0.0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
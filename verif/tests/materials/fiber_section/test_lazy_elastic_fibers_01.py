@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+''' Checks that skipping the materials of the fibers that remain in
+    their elastic range (see FiberSectionBase.lazyElasticFibers) doesn't
+    change the stiffness and the stress resultant of reinforced concrete
+    fiber sections (2D, 3D and 3D with torsion), nor the stresses of the
+    fibers, along a sequence of trial, commit and revert operations.
+    Checks also a single steel fiber that is skipped while elastic,
+    yields after a commit and then unloads from its new committed
+    state.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../../aux/fiber_section_comparison.py")
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+defRCSectionGeometry(feProblem,"01")
+
+# Generalized strains: axial strain, curvatures (and twist).
+# Small increments (most fibers remain elastic) and yielding ones.
+strains= [[-1e-4,1e-3,-2e-4],[-1.2e-4,1.1e-3,-2.5e-4],[-2e-4,4e-3,-1e-3],[-2.1e-4,4.1e-3,-1e-3],[-5e-4,9e-3,3e-3],[-4.8e-4,8.8e-3,2.9e-3],[1e-4,-6e-3,2e-3],[-1e-3,1.2e-2,-4e-3]]
+
+errors, sections= compareFiberSections(feProblem,strains,{"packedFiberLayout":True},{"packedFiberLayout":True,"lazyElasticFibers":True})
+lazy= [sB.lazyElasticFibers for sA,sB in sections]
+
+# Single Steel01 fiber (E= 200e9, b= 0.01).
+E= 200e9
+Esh= 0.01*E
+epsy= fy/E
+fiberArea= barArea
+materials= feProblem.getPreprocessor.getMaterialHandler
+def newSingleFiberSection(name, lazy):
+  section= materials.newMaterial("fiber_section_2d",name)
+  section.packedFiberLayout= lazy
+  section.lazyElasticFibers= lazy
+  section.addFiber("steel",fiberArea,xc.Vector([0.0]))
+  return section
+sScalar= newSingleFiberSection("scalar",False)
+sLazy= newSingleFiberSection("lazy",True)
+
+# Axial strain, expected stress and expected tangent.
+history= [(0.5*epsy,0.5*fy,E), # Elastic (skipped).
+          (2.0*epsy,fy+Esh*epsy,Esh), # Yields after the commit.
+          (1.5*epsy,fy+Esh*epsy-0.5*epsy*E,E)] # Unloads from the new committed state.
+errFiber= 0.0
+for eps,stress,tangent in history:
+  N= stress*fiberArea
+  EA= tangent*fiberArea
+  for s in [sScalar,sLazy]:
+    s.setTrialSectionDeformation(xc.Vector([eps,0.0]))
+    errFiber= max(errFiber,abs(s.getStressResultant()[0]-N)/N)
+    errFiber= max(errFiber,abs(s.getTangentStiffness().at(1,1)-EA)/EA)
+    s.commitState() # Commits the skipped fiber.
+    errFiber= max(errFiber,abs(s.getFibers().getResultant()-N)/N)
+
+'''
+print "errors= ", errors
+print "errFiber= ", errFiber
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(all(lazy) and (max(errors)<1e-12) and (errFiber<1e-12)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,54 @@
+# -*- coding: utf-8 -*-
+''' Checks the lazy state determination of the fiber sections (see
+    FiberSectionBase.lazyElasticFibers) with Concrete02 (whose tension
+    branches are skipped) and Steel02 (never skipped). The results of the
+    lazy packed section are compared with the ones of the scalar fiber
+    loop (packedFiberLayout= False) along a sequence of trial, commit and
+    revert operations that cracks and reloads the concrete in tension.
+
+    The packed layout accumulates the fiber contributions in four
+    partial sums (see PackedFibers::reduce), so its results are rounded
+    differently from the ones of the scalar loop; the relative
+    difference must be below 1e-10.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../../aux/fiber_section_comparison.py")
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+defRCSectionGeometry(feProblem,"02") # Concrete tensile strength: 0.1*fc.
+
+# Generalized strains: axial strain, curvatures (and twist).
+# Uncracked tension, cracking, unloading and reloading in tension
+# and yielding of the reinforcement.
+strains= [[-2e-5,1e-5,-2e-6],[-2.5e-5,1.2e-5,-2.5e-6],[-1e-4,1e-3,-2e-4],[-1.2e-4,1.1e-3,-2.5e-4],[-6e-5,4e-4,-1e-4],[-5e-5,3e-4,-5e-5],[-1e-4,1e-3,-2e-4],[-2e-4,4e-3,-1e-3],[-5e-4,9e-3,3e-3],[-4.8e-4,8.8e-3,2.9e-3],[1e-4,-6e-3,2e-3],[-1e-3,1.2e-2,-4e-3]]
+
+# Scalar fiber loop vs. packed layout with lazy elastic fibers.
+errors, sections= compareFiberSections(feProblem,strains,{},{"packedFiberLayout":True,"lazyElasticFibers":True})
+lazy= [sB.lazyElasticFibers for sA,sB in sections]
+
+'''
+print "errors= ", errors
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(all(lazy) and (max(errors)<1e-10)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
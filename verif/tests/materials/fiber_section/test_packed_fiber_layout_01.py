@@ -0,0 +1,45 @@
+# -*- coding: utf-8 -*-
+''' Checks that the stiffness and the stress resultant of reinforced
+    concrete fiber sections (2D, 3D and 3D with torsion) computed from
+    the packed fiber arrays (see FiberSectionBase.packedFiberLayout)
+    are the same that those obtained from the fiber container, along
+    a sequence of trial, commit and revert operations.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../../aux/fiber_section_comparison.py")
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+defRCSectionGeometry(feProblem,"01")
+
+# Generalized strains: axial strain, curvatures (and twist).
+strains= [[-2e-4,4e-3,-1e-3],[-5e-4,9e-3,3e-3],[1e-4,-6e-3,2e-3],[-1e-3,1.2e-2,-4e-3]]
+
+errors, sections= compareFiberSections(feProblem,strains,{"packedFiberLayout":False},{"packedFiberLayout":True})
+packed= [sB.packedFiberLayout for sA,sB in sections]
+
+'''
+print "errors= ", errors
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(all(packed) and (max(errors)<1e-12)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,52 @@
+# -*- coding: utf-8 -*-
+''' Checks that the stiffness and the stress resultant of fiber
+    sections (2D, 3D and 3D with torsion) computed from the packed
+    fiber arrays (see FiberSectionBase.packedFiberLayout) are the same
+    that those obtained from the fiber container, when the materials
+    are updated in batches (see UniaxialMaterial.setTrialBatch). The
+    section is made of Concrete02 and Steel02 with an elastic
+    strengthening plate.
+
+    The packed layout accumulates the fiber contributions in four
+    partial sums (see PackedFibers::reduce), so its results are rounded
+    differently from the ones of the fiber container; the relative
+    difference must be below 1e-12.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../../aux/fiber_section_comparison.py")
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+defRCSectionGeometry(feProblem,"02",plate= True)
+
+# Generalized strains: axial strain, curvatures (and twist).
+strains= [[-2e-4,4e-3,-1e-3],[-5e-4,9e-3,3e-3],[1e-4,-6e-3,2e-3],[-1e-3,1.2e-2,-4e-3],[-3e-4,-8e-3,5e-3],[-6e-4,1.5e-2,1e-3]]
+
+errors, sections= compareFiberSections(feProblem,strains,{"packedFiberLayout":False},{"packedFiberLayout":True})
+packed= [sB.packedFiberLayout for sA,sB in sections]
+
+'''
+print "errors= ", errors
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(all(packed) and (max(errors)<1e-12)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
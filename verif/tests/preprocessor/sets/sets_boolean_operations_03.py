@@ -0,0 +1,65 @@
+# -*- coding: utf-8 -*-
+''' Checks the membership of the nodes in the sets and the boolean
+    operations between sets (union, difference and intersection),
+    including the order of the resulting node lists.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+
+numNodes= 2000
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+nodes.defaultTag= 0
+for i in range(0,numNodes):
+  nodes.newNodeXYZ(i,0.0,0.0)
+
+setTotal= preprocessor.getSets.getSet("total")
+s1= preprocessor.getSets.defSet("S1")
+s2= preprocessor.getSets.defSet("S2")
+repeated= 0
+for n in setTotal.getNodes:
+  if(n.tag%2==0):
+    s1.getNodes.append(n)
+  if(n.tag%3==0):
+    s2.getNodes.append(n)
+    if(s2.getNodes.append(n)): # Already there.
+      repeated+= 1
+
+s3= s1+s2
+s4= s1-s2
+s5= s1*s2
+
+tags3= [n.tag for n in s3.getNodes]
+tags4= [n.tag for n in s4.getNodes]
+tags5= [n.tag for n in s5.getNodes]
+
+# Expected values.
+ref1= [i for i in range(0,numNodes) if(i%2==0)]
+ref3= ref1+[i for i in range(0,numNodes) if((i%3==0) and (i%2!=0))]
+ref4= [i for i in ref1 if(i%3!=0)]
+ref5= [i for i in ref1 if(i%3==0)]
+
+'''
+print "total: ", setTotal.getNodes.size
+print "repeated: ", repeated
+print "s3: ", len(tags3), " s4: ", len(tags4), " s5: ", len(tags5)
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((setTotal.getNodes.size==numNodes) and (repeated==0) and (tags3==ref3) and (tags4==ref4) and (tags5==ref5)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
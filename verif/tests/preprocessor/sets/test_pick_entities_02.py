@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+''' Checks the selection of the nodes and elements inside a geometric
+    object (see pickNodesInside and pickElemsInside, with and without
+    using the KD tree of the set to discard the objects far from the
+    geometric object) against a brute force search, for the total set and for
+    a set obtained from a previous selection. The selected objects
+    must keep the order of the original set.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import random
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+random.seed(11)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Nodes added one by one.
+coords= dict()
+for i in range(0,400):
+  x= random.uniform(0,10); y= random.uniform(0,10); z= random.uniform(0,2)
+  n= nodes.newNodeXYZ(x,y,z)
+  coords[n.tag]= (x,y,z)
+# Nodes added in batch.
+batch= list()
+for i in range(0,1600):
+  batch.append([random.uniform(0,10),random.uniform(0,10),random.uniform(0,2)])
+tags= nodes.newNodes(xc.Matrix(batch))
+for i in range(0,len(tags)):
+  coords[tags[i]]= tuple(batch[i])
+
+# Truss elements between consecutive nodes.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e9)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 3
+elemNodes= dict()
+nodeTags= sorted(coords.keys())
+for i in range(0,len(nodeTags)-1,2):
+  n1= nodeTags[i]; n2= nodeTags[i+1]
+  truss= elements.newElement("Truss",xc.ID([n1,n2]))
+  truss.area= 1.0
+  elemNodes[truss.tag]= (n1,n2)
+
+def inBox(c,pMin,pMax):
+  return ((c[0]>=pMin[0]) and (c[0]<=pMax[0]) and (c[1]>=pMin[1]) and (c[1]<=pMax[1]) and (c[2]>=pMin[2]) and (c[2]<=pMax[2]))
+
+def checkPicks(fromSet,numBoxes):
+  ''' Compare the selections with the brute force search.'''
+  retval= True
+  setNodes= [n.tag for n in fromSet.nodes]
+  setElements= [e.tag for e in fromSet.elements]
+  for i in range(0,numBoxes):
+    x0= random.uniform(-1,9); y0= random.uniform(-1,9); z0= random.uniform(-0.5,1.5)
+    pMin= (x0,y0,z0)
+    pMax= (x0+random.uniform(0.5,4),y0+random.uniform(0.5,4),z0+random.uniform(0.2,1.5))
+    box= geom.BND3d(geom.Pos3d(pMin[0],pMin[1],pMin[2]),geom.Pos3d(pMax[0],pMax[1],pMax[2]))
+    pickedNodes= [n.tag for n in fromSet.nodes.pickNodesInside(box,0.0)]
+    pickedElements= [e.tag for e in fromSet.elements.pickElemsInside(box,0.0)]
+    refNodes= [tag for tag in setNodes if inBox(coords[tag],pMin,pMax)]
+    refElements= [tag for tag in setElements if (inBox(coords[elemNodes[tag][0]],pMin,pMax) and inBox(coords[elemNodes[tag][1]],pMin,pMax))]
+    retval= retval and (pickedNodes==refNodes) and (pickedElements==refElements)
+    # Without displacements the scale factor doesn't matter
+    # (the KD tree is not used in this case).
+    retval= retval and ([n.tag for n in fromSet.nodes.pickNodesInside(box,1.0)]==refNodes)
+    retval= retval and ([e.tag for e in fromSet.elements.pickElemsInside(box,1.0)]==refElements)
+  return retval
+
+setTotal= preprocessor.getSets.getSet("total")
+totalOk= checkPicks(setTotal,10)
+setTotal.nodes.useKDTreeForPicking= True
+setTotal.elements.useKDTreeForPicking= True
+totalOk= totalOk and checkPicks(setTotal,25)
+
+# Selection from a selection.
+region= geom.BND3d(geom.Pos3d(2.0,1.0,-1.0),geom.Pos3d(8.0,9.0,3.0))
+subSet= preprocessor.getSets.defSet("subSet")
+subSet.nodes= setTotal.nodes.pickNodesInside(region,0.0)
+subSet.elements= setTotal.elements.pickElemsInside(region,0.0)
+subSet.nodes.useKDTreeForPicking= True
+subSet.elements.useKDTreeForPicking= True
+subSetOk= (len(subSet.nodes)>0) and (len(subSet.elements)>0) and checkPicks(subSet,25)
+
+'''
+print "totalOk= ", totalOk
+print "subSetOk= ", subSetOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(totalOk and subSetOk):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,102 @@
+# -*- coding: utf-8 -*-
+''' Checks that pickNodesInside and pickElemsInside on the total set
+    find the nodes and elements moved by the transformation of a
+    subset (whose KD tree is the only one updated by the transformation).
+    By default the picks test every object of the container; when the
+    KD tree is used (useKDTreeForPicking) it must be updated by calling
+    updateKDTree after the nodes have been moved by other set.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Grid of 10x10 nodes and truss elements along the x axis.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e9)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 3
+sets= preprocessor.getSets
+subSet= sets.defSet("subSet") # nodes and elements with x<4.5
+grid= dict()
+for i in range(0,10):
+  for j in range(0,10):
+    n= nodes.newNodeXYZ(i,j,0.0)
+    grid[(i,j)]= n
+    if(i<5):
+      subSet.nodes.append(n)
+for i in range(0,9):
+  for j in range(0,10):
+    truss= elements.newElement("Truss",xc.ID([grid[(i,j)].tag,grid[(i+1,j)].tag]))
+    truss.area= 1.0
+    if(i<4):
+      subSet.elements.append(truss)
+
+setTotal= sets.getSet("total")
+movedNodes= [n.tag for n in subSet.nodes]
+movedElements= [e.tag for e in subSet.elements]
+
+# Move the subset far away.
+trfs= preprocessor.getMultiBlockTopology.getGeometricTransformations
+transl= trfs.newTransformation("translation")
+transl.setVector(geom.Vector3d(100.0,0.0,0.0))
+subSet.transforms(transl)
+
+region= geom.BND3d(geom.Pos3d(99.5,-0.5,-0.5),geom.Pos3d(104.5,9.5,0.5))
+oldRegion= geom.BND3d(geom.Pos3d(-0.5,-0.5,-0.5),geom.Pos3d(4.5,9.5,0.5))
+
+def checkPicks(s):
+  ''' The moved objects must be found in the new region and not in
+      the old one.'''
+  retval= ([n.tag for n in s.nodes.pickNodesInside(region,0.0)]==movedNodes)
+  retval= retval and ([e.tag for e in s.elements.pickElemsInside(region,0.0)]==movedElements)
+  retval= retval and (len(s.nodes.pickNodesInside(oldRegion,0.0))==0)
+  retval= retval and (len(s.elements.pickElemsInside(oldRegion,0.0))==0)
+  return retval
+
+# Default: all the objects are tested.
+defaultOk= checkPicks(setTotal)
+# Set moved itself: its KD trees are up to date.
+subSet.nodes.useKDTreeForPicking= True
+subSet.elements.useKDTreeForPicking= True
+subSetOk= checkPicks(subSet)
+# KD tree activated after the transformation (the tree is rebuilt).
+setTotal.nodes.useKDTreeForPicking= True
+setTotal.elements.useKDTreeForPicking= True
+kdTreeOk= checkPicks(setTotal)
+# Moving the subset back and updating the KD trees of the total set.
+transl.setVector(geom.Vector3d(-100.0,0.0,0.0))
+subSet.transforms(transl)
+setTotal.nodes.updateKDTree()
+setTotal.elements.updateKDTree()
+region, oldRegion= oldRegion, region
+updateOk= checkPicks(setTotal)
+
+'''
+print "defaultOk= ", defaultOk
+print "subSetOk= ", subSetOk
+print "kdTreeOk= ", kdTreeOk
+print "updateOk= ", updateOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(defaultOk and subSetOk and kdTreeOk and updateOk):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
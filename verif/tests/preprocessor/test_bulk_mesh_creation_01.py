@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+''' Creates a quadrilateral mesh in one batch (see NodeHandler.newNodes
+    and ElementHandler.newElements) and checks the tags, the spatial
+    search and the response of the plate under uniform tension.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+L= 4.0 # Plate length.
+h= 1.0 # Plate height.
+t= 0.1 # Plate thickness.
+nx= 20 # Number of divisions along x.
+ny= 5 # Number of divisions along y.
+E= 2.1e9 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+sigma= 1e6 # Tension.
+
+feProblem= xc.FEProblem()
+feProblem.errFileName= "/tmp/erase.err" # Ignore the message about the rows without coordinates.
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Nodes: one row of the matrix for each node.
+coords= list()
+for j in range(0,ny+1):
+  for i in range(0,nx+1):
+    coords.append([i*L/nx,j*h/ny])
+nodes.defaultTag= 100
+emptyTags= nodes.newNodes(xc.Matrix([[],[]])) # Rows without coordinates: rejected.
+nodeTags= nodes.newNodes(xc.Matrix(coords))
+
+def nodeTag(i,j):
+  return nodeTags[j*(nx+1)+i]
+
+# Elements: copies of the seed element.
+elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,0.0)
+elements= preprocessor.getElementHandler
+seedElemHandler= elements.seedElemHandler
+seedElemHandler.defaultMaterial= "elast2d"
+seedElem= seedElemHandler.newElement("FourNodeQuad",xc.ID([0,0,0,0]))
+seedElem.thickness= t
+connectivity= list()
+for j in range(0,ny):
+  for i in range(0,nx):
+    connectivity.extend([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)])
+elements.defaultTag= 10
+elemTags= elements.newElements(xc.ID(connectivity))
+
+setTotal= preprocessor.getSets.getSet("total")
+numNodes= setTotal.getNodes.size
+numElements= setTotal.getElements.size
+tagsOk= ((len(emptyTags)==0) and (nodeTags[0]==100) and (nodeTags[numNodes-1]==100+numNodes-1) and (nodes.defaultTag==100+numNodes))
+tagsOk= tagsOk and ((elemTags[0]==10) and (elemTags[numElements-1]==10+numElements-1))
+
+# Spatial search (KD-trees of the mesh and of the set).
+mesh= feProblem.getDomain.getMesh
+searchOk= (mesh.getNearestNode(geom.Pos3d(3*L/nx+0.01,2*h/ny-0.01,0.0)).tag==nodeTag(3,2))
+searchOk= searchOk and (setTotal.getNodes.getNearestNode(geom.Pos3d(L,h,0.0)).tag==nodeTag(nx,ny))
+searchOk= searchOk and (mesh.getNearestElement(geom.Pos3d(1.5*L/nx,0.5*h/ny,0.0)).tag==elemTags[1])
+
+# Uniform tension.
+constraints= preprocessor.getBoundaryCondHandler
+for j in range(0,ny+1):
+  spc= constraints.newSPConstraint(nodeTag(0,j),0,0.0)
+spc= constraints.newSPConstraint(nodeTag(0,0),1,0.0)
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+F= sigma*h*t/ny
+for j in range(0,ny+1):
+  factor= 1.0
+  if((j==0) or (j==ny)):
+    factor= 0.5
+  lp0.newNodalLoad(nodeTag(nx,j),xc.Vector([factor*F,0]))
+lPatterns.addToDomain("0")
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+
+ux= nodes.getNode(nodeTag(nx,ny)).getDisp[0]
+uxTeor= sigma/E*L
+ratio1= abs(ux-uxTeor)/uxTeor
+
+'''
+print "numNodes= ", numNodes, " numElements= ", numElements
+print "tagsOk= ", tagsOk, " searchOk= ", searchOk
+print "ux= ", ux, " uxTeor= ", uxTeor, " ratio1= ", ratio1
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((numNodes==(nx+1)*(ny+1)) and (numElements==nx*ny) and tagsOk and searchOk and (result==0) and (ratio1<1e-10)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+''' Checks the k-nearest and radius queries of the mesh (see
+    Mesh.getKNearestNodeTags, Mesh.getNodeTagsInRadius and their
+    element counterparts) against a brute force search, for nodes
+    added one by one and in batch, and with the batched (multithreaded)
+    version of the queries.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import random
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+random.seed(7)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Nodes added one by one.
+coords= dict()
+for i in range(0,500):
+  x= random.uniform(0,10); y= random.uniform(0,10); z= random.uniform(0,2)
+  n= nodes.newNodeXYZ(x,y,z)
+  coords[n.tag]= (x,y,z)
+# Nodes added in batch.
+batch= list()
+for i in range(0,1500):
+  batch.append([random.uniform(0,10),random.uniform(0,10),random.uniform(0,2)])
+tags= nodes.newNodes(xc.Matrix(batch))
+for i in range(0,len(tags)):
+  coords[tags[i]]= tuple(batch[i])
+
+# Truss elements between consecutive nodes.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e9)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 3
+centroids= dict()
+nodeTags= sorted(coords.keys())
+for i in range(0,len(nodeTags)-1,2):
+  n1= nodeTags[i]; n2= nodeTags[i+1]
+  truss= elements.newElement("Truss",xc.ID([n1,n2]))
+  truss.area= 1.0
+  c1= coords[n1]; c2= coords[n2]
+  centroids[truss.tag]= ((c1[0]+c2[0])/2.0,(c1[1]+c2[1])/2.0,(c1[2]+c2[2])/2.0)
+
+mesh= feProblem.getDomain.getMesh
+
+def dist(a,b):
+  return math.sqrt((a[0]-b[0])**2+(a[1]-b[1])**2+(a[2]-b[2])**2)
+
+def checkQueries(points,k,r):
+  ''' Compare the results of the queries with the brute force search.'''
+  retval= True
+  targets= list()
+  for i in range(0,20):
+    targets.append((random.uniform(-1,11),random.uniform(-1,11),random.uniform(-1,3)))
+  positions= [geom.Pos3d(t[0],t[1],t[2]) for t in targets]
+  if(points is coords):
+    kBatch= mesh.getKNearestNodeTags(positions,k)
+    rBatch= mesh.getNodeTagsInRadius(positions,r)
+  else:
+    kBatch= mesh.getKNearestElementTags(positions,k)
+    rBatch= mesh.getElementTagsInRadius(positions,r)
+  for t,p,kb,rb in zip(targets,positions,kBatch,rBatch):
+    distances= sorted([dist(t,c) for c in points.values()])
+    if(points is coords):
+      kNearest= list(mesh.getKNearestNodeTags(p,k))
+      inRadius= list(mesh.getNodeTagsInRadius(p,r))
+    else:
+      kNearest= list(mesh.getKNearestElementTags(p,k))
+      inRadius= list(mesh.getElementTagsInRadius(p,r))
+    kDistances= [dist(t,points[tag]) for tag in kNearest]
+    retval= retval and (len(kNearest)==k)
+    retval= retval and all(abs(a-b)<1e-12 for a,b in zip(kDistances,distances[:k]))
+    retval= retval and (len(inRadius)==len([d for d in distances if d<=r]))
+    retval= retval and all(dist(t,points[tag])<=r for tag in inRadius)
+    retval= retval and (list(kb)==kNearest) and (list(rb)==inRadius)
+  return retval
+
+mesh.numThreads= 4
+nodesOk= checkQueries(coords,5,0.75)
+elementsOk= checkQueries(centroids,3,1.0)
+
+'''
+print "nodesOk= ", nodesOk
+print "elementsOk= ", elementsOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(nodesOk and elementsOk):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
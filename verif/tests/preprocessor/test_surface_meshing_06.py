@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+''' Checks that meshing several quadrilateral surfaces in one batch
+    (see QuadSurface::genMesh) with several threads (see Mesh.numThreads)
+    gives the same nodes and elements (tags, positions and connectivity)
+    that meshing the surfaces one by one, and that the nodes of the
+    shared lines and points are not duplicated.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+nx= 4 # Number of surfaces along x.
+ny= 3 # Number of surfaces along y.
+ndivI= 5 # Number of divisions of each surface along x.
+ndivJ= 3 # Number of divisions of each surface along y.
+L= 2.0 # Surface size.
+
+def genMesh(batch):
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/borrar.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  memb= typical_materials.defElasticMembranePlateSection(preprocessor, "memb",2.1e9,0.3,0.0,0.25)
+  nodes.newSeedNode()
+  seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+  seedElemHandler.defaultMaterial= "memb"
+  elem= seedElemHandler.newElement("ShellMITC4",xc.ID([0,0,0,0]))
+
+  points= preprocessor.getMultiBlockTopology.getPoints
+  pointTags= dict()
+  for j in range(0,ny+1):
+    for i in range(0,nx+1):
+      # Slightly warped surface.
+      pointTags[(i,j)]= points.newPntFromPos3d(geom.Pos3d(i*L,j*L,0.1*i*j)).tag
+  surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+  sfs= list()
+  for j in range(0,ny):
+    for i in range(0,nx):
+      s= surfaces.newQuadSurfacePts(pointTags[(i,j)],pointTags[(i+1,j)],pointTags[(i+1,j+1)],pointTags[(i,j+1)])
+      s.nDivI= ndivI
+      s.nDivJ= ndivJ
+      sfs.append(s)
+  nodes.defaultTag= 10
+  preprocessor.getElementHandler.defaultTag= 5
+  if(batch):
+    feProblem.getDomain.getMesh.numThreads= 4
+    surfSet= preprocessor.getSets.defSet("surfSet")
+    for s in sfs:
+      surfSet.getSurfaces.append(s)
+    surfSet.genMesh(xc.meshDir.I)
+  else:
+    for s in sfs:
+      s.genMesh(xc.meshDir.I)
+  setTotal= preprocessor.getSets.getSet("total")
+  nodePos= dict()
+  for n in setTotal.getNodes:
+    p= n.getInitialPos3d
+    nodePos[n.tag]= (p.x,p.y,p.z)
+  elemNodes= dict()
+  for e in setTotal.getElements:
+    elemNodes[e.tag]= list(e.getNodes.getExternalNodes)
+  return nodePos, elemNodes
+
+nodePos0, elemNodes0= genMesh(False)
+nodePos1, elemNodes1= genMesh(True)
+
+numNodes= (nx*ndivI+1)*(ny*ndivJ+1)
+numElements= nx*ndivI*ny*ndivJ
+countOk= ((len(nodePos1)==numNodes) and (len(elemNodes1)==numElements))
+tagsOk= ((sorted(nodePos1.keys())==range(10,10+numNodes)) and (sorted(elemNodes1.keys())==range(5,5+numElements)))
+sameNodes= (sorted(nodePos0.keys())==sorted(nodePos1.keys()))
+if(sameNodes):
+  for tag in nodePos0:
+    p0= nodePos0[tag]
+    p1= nodePos1[tag]
+    if((abs(p0[0]-p1[0])>1e-12) or (abs(p0[1]-p1[1])>1e-12) or (abs(p0[2]-p1[2])>1e-12)):
+      sameNodes= False
+      break
+sameElements= (elemNodes0==elemNodes1)
+
+'''
+print "numNodes= ", len(nodePos1), " (", numNodes, ")"
+print "numElements= ", len(elemNodes1), " (", numElements, ")"
+print "countOk= ", countOk, " tagsOk= ", tagsOk
+print "sameNodes= ", sameNodes, " sameElements= ", sameElements
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if(countOk and tagsOk and sameNodes and sameElements):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
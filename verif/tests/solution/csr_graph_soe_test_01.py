@@ -0,0 +1,44 @@
+# -*- coding: utf-8 -*-
+''' Checks that the systems of equations sized from the compressed
+    graph of the analysis model (see AnalysisModel.getDOFCSRGraph)
+    give the same results, whatever the storage scheme and the DOF
+    numbering. The model is a slab supported by elastic columns
+    (see aux/slab_on_elastic_columns.py).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../aux/slab_on_elastic_columns.py")
+
+cases= [("rcm","band_spd_lin_soe","band_spd_lin_lapack_solver"),
+        ("rcm","band_gen_lin_soe","band_gen_lin_lapack_solver"),
+        ("rcm","profile_spd_lin_soe","profile_spd_lin_direct_solver"),
+        ("simple","profile_spd_lin_soe","profile_spd_lin_direct_solver"),
+        ("rcm","full_gen_lin_soe","full_gen_lin_lapack_solver"),
+        ("rcm","sparse_gen_col_lin_soe","super_lu_solver"),
+        ("simple","sparse_gen_col_lin_soe","super_lu_solver")]
+
+results, maxDisp, err= compareLinearSolutions(8.0,6,cases)
+
+'''
+print "results= ", results
+print "maxDisp= ", maxDisp
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((max([abs(r) for r in results])==0) and (maxDisp>0.0) and (err<1e-9)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
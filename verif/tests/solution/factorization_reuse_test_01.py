@@ -0,0 +1,126 @@
+# -*- coding: utf-8 -*-
+''' Checks that the Linear algorithm with the factorOnce option
+    reuses the factorization of the system of equations when solving
+    a set of load combinations (see LinearSOE.numFactorizations) and
+    that the results are the same that those obtained forming the
+    tangent on each analysis. Checks also that the tangent is formed
+    again when the model changes.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+L= 5.0 # Bay length.
+H= 3.0 # Column height.
+E= 210e9 # Young modulus of the steel.
+nu= 0.3 # Poisson's ratio.
+A= 53.8e-4 # Cross section area.
+I= 8356e-8 # Cross section moment of inertia.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+n1= nodes.newNodeXYZ(0,0,0)
+n2= nodes.newNodeXYZ(0,0,H)
+n3= nodes.newNodeXYZ(L,0,H)
+n4= nodes.newNodeXYZ(L,0,0)
+
+section= typical_materials.defElasticSection3d(preprocessor,"section",A,E,E/(2*(1+nu)),I,I,2*I)
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.newElement("ElasticBeam3d",xc.ID([n1.tag,n2.tag]))
+elements.newElement("ElasticBeam3d",xc.ID([n2.tag,n3.tag]))
+elements.newElement("ElasticBeam3d",xc.ID([n3.tag,n4.tag]))
+
+modelSpace.fixNode000_000(n1.tag)
+modelSpace.fixNode000_000(n4.tag)
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lpG= lPatterns.newLoadPattern("default","G")
+lpG.newNodalLoad(n2.tag,xc.Vector([0,0,-100e3,0,0,0]))
+lpG.newNodalLoad(n3.tag,xc.Vector([0,0,-100e3,0,0,0]))
+lpW= lPatterns.newLoadPattern("default","W")
+lpW.newNodalLoad(n2.tag,xc.Vector([20e3,0,0,0,0,0]))
+
+combs= loadHandler.getLoadCombinations
+combs.newLoadCombination("ELU01","1.35*G")
+combs.newLoadCombination("ELU02","1.35*G+1.5*W")
+combs.newLoadCombination("ELU03","0.8*G-1.5*W")
+combs.newLoadCombination("ELU04","1.0*G+0.9*W")
+
+solution= predefined_solutions.SolutionProcedure()
+analysis= solution.simpleStaticLinear(feProblem)
+soe= solution.soe
+
+def solve():
+  ''' Analyze all the combinations and return the top displacements.'''
+  disp= list()
+  result= 0
+  for key in combs.getKeys():
+    comb= combs[key]
+    preprocessor.resetLoadCase()
+    comb.addToDomain()
+    result+= analysis.analyze(1)
+    disp.append(n2.getDisp)
+    disp.append(n3.getDisp)
+    comb.removeFromDomain()
+  return result, disp
+
+# Tangent formed on each analysis.
+resultRef, dispRef= solve()
+numFactRef= soe.numFactorizations
+
+# Tangent formed and factored only once.
+solution.solAlgo.factorOnce= True
+soe.resetCounters()
+result, disp= solve()
+numFact= soe.numFactorizations
+numSolves= soe.numSolves
+
+# The model changes: the tangent must be formed again.
+elements.newElement("ElasticBeam3d",xc.ID([n1.tag,n3.tag]))
+soe.resetCounters()
+result2, disp2= solve()
+numFact2= soe.numFactorizations
+
+err= 0.0
+for d1,d2 in zip(dispRef,disp):
+  err+= (d1-d2).Norm()
+err/= max([d.Norm() for d in dispRef])
+dispDiff= 0.0 # Displacements must change with the new element.
+for d1,d2 in zip(disp,disp2):
+  dispDiff+= (d1-d2).Norm()
+
+'''
+print "numFactRef= ", numFactRef
+print "numFact= ", numFact, " numSolves= ", numSolves
+print "numFact2= ", numFact2
+print "err= ", err
+print "dispDiff= ", dispDiff
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((resultRef==0) and (result==0) and (result2==0) and (numFactRef==4) and (numFact==1) and (numSolves==4) and (numFact2==1) and (abs(err)<1e-12) and (dispDiff>0.0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+''' Checks that the iterative solvers (PCG, MINRES and GMRES) with
+    the different preconditioners give the same results that a direct
+    solver. The model is a cantilever block of elastic solid elements
+    (Brick).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+L= 4.0 # Block length.
+B= 1.0 # Block width.
+H= 1.0 # Block height.
+nDivL= 8 # Number of divisions along the length.
+nDivB= 4 # Number of divisions along the width.
+nDivH= 4 # Number of divisions along the height.
+E= 30e9 # Young modulus.
+nu= 0.2 # Poisson's ratio.
+F= 100e3 # Load at the free end.
+
+def solve(numberer, soeType, solverType, preconditionerType= None):
+  ''' Build the model, solve it using the numbering algorithm,
+      the system of equations, the solver and the preconditioner
+      being passed as parameter and return the displacements of
+      the nodes.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+  elast= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d",E,nu,0.0)
+  nodeTags= dict()
+  for i in range(0,nDivL+1):
+    for j in range(0,nDivB+1):
+      for k in range(0,nDivH+1):
+        nodeTags[(i,j,k)]= nodes.newNodeXYZ(i*L/nDivL,j*B/nDivB,k*H/nDivH).tag
+
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast3d"
+  for i in range(0,nDivL):
+    for j in range(0,nDivB):
+      for k in range(0,nDivH):
+        elements.newElement("Brick",xc.ID([nodeTags[(i,j,k)],nodeTags[(i+1,j,k)],nodeTags[(i+1,j+1,k)],nodeTags[(i,j+1,k)],nodeTags[(i,j,k+1)],nodeTags[(i+1,j,k+1)],nodeTags[(i+1,j+1,k+1)],nodeTags[(i,j+1,k+1)]]))
+
+  for j in range(0,nDivB+1):
+    for k in range(0,nDivH+1):
+      modelSpace.fixNode000(nodeTags[(0,j,k)])
+
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  numLoadedNodes= (nDivB+1)*(nDivH+1)
+  for j in range(0,nDivB+1):
+    for k in range(0,nDivH+1):
+      lp0.newNodalLoad(nodeTags[(nDivL,j,k)],xc.Vector([0.1*F/numLoadedNodes,0.0,-F/numLoadedNodes]))
+  lPatterns.addToDomain("0")
+
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleStaticLinear(feProblem)
+  solution.numberer.useAlgorithm(numberer)
+  solution.soe= solution.analysisAggregation.newSystemOfEqn(soeType)
+  solution.solver= solution.soe.newSolver(solverType)
+  numIter= 0
+  if(preconditionerType):
+    solution.solver.tolerance= 1e-10
+    solution.solver.newPreconditioner(preconditionerType)
+  result= analysis.analyze(1)
+  if(preconditionerType):
+    numIter= solution.solver.numIter
+  disp= list()
+  for key in sorted(nodeTags.keys()):
+    disp.append(nodes.getNode(nodeTags[key]).getDisp)
+  return result, disp, numIter
+
+cases= [("rcm","band_spd_lin_soe","band_spd_lin_lapack_solver"),
+        ("rcm","sym_sparse_col_lin_soe","pcg_solver","jacobi"),
+        ("amd","sym_sparse_col_lin_soe","pcg_solver","incomplete_cholesky"),
+        ("rcm","sym_sparse_col_lin_soe","pcg_solver","amg"),
+        ("rcm","sym_sparse_col_lin_soe","minres_solver","incomplete_cholesky"),
+        ("rcm","sparse_gen_row_lin_soe","gmres_solver","ilu0"),
+        ("rcm","sparse_gen_row_lin_soe","pcg_solver","amg")]
+
+resultRef, dispRef, numIterRef= solve(*cases[0])
+maxDisp= max([d.Norm() for d in dispRef])
+results= [resultRef]
+iterations= list()
+err= 0.0
+for c in cases[1:]:
+  result, disp, numIter= solve(*c)
+  results.append(result)
+  iterations.append(numIter)
+  for d1,d2 in zip(dispRef,disp):
+    err+= (d1-d2).Norm()
+err/= maxDisp
+
+'''
+print "results= ", results
+print "iterations= ", iterations
+print "maxDisp= ", maxDisp
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((max([abs(r) for r in results])==0) and (maxDisp>0.0) and (min(iterations)>0) and (err<1e-5)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
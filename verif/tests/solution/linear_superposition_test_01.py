@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+''' Checks that the results of the load combinations obtained by
+    superposition of the load pattern solutions (see
+    LinearSuperpositionAnalysis) are the same that those obtained
+    analyzing each combination. The model is a two bay frame
+    (ElasticBeam3d elements) with nodal and uniform loads.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+from postprocess import limit_state_data as lsd
+
+L= 6.0 # Bay length.
+H= 3.0 # Column height.
+numStories= 3 # Number of stories.
+E= 30e9 # Young modulus of the concrete.
+nu= 0.2 # Poisson's ratio.
+A= 0.09 # Cross section area.
+I= 0.3**4/12.0 # Cross section moment of inertia.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodeTags= list()
+for j in range(0,numStories+1):
+  row= list()
+  for i in range(0,3):
+    row.append(nodes.newNodeXYZ(i*L,0.0,j*H).tag)
+  nodeTags.append(row)
+
+section= typical_materials.defElasticSection3d(preprocessor,"section",A,E,E/(2*(1+nu)),I,I,2*I)
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+columns= list()
+beams= list()
+for j in range(0,numStories):
+  for i in range(0,3):
+    columns.append(elements.newElement("ElasticBeam3d",xc.ID([nodeTags[j][i],nodeTags[j+1][i]])).tag)
+  for i in range(0,2):
+    beams.append(elements.newElement("ElasticBeam3d",xc.ID([nodeTags[j+1][i],nodeTags[j+1][i+1]])).tag)
+
+for n in nodeTags[0]:
+  modelSpace.fixNode000_000(n)
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+# Dead load.
+lpG= lPatterns.newLoadPattern("default","G")
+eleLoad= lpG.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID(beams)
+eleLoad.transComponent= -20e3
+# Live load (first bay only).
+lpQ= lPatterns.newLoadPattern("default","Q")
+eleLoad= lpQ.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID(beams[0::2])
+eleLoad.transComponent= -15e3
+# Wind.
+lpW= lPatterns.newLoadPattern("default","W")
+for j in range(1,numStories+1):
+  lpW.newNodalLoad(nodeTags[j][0],xc.Vector([10e3*j,0,0,0,0,0]))
+
+combs= loadHandler.getLoadCombinations
+combs.newLoadCombination("ELU01","1.35*G")
+combs.newLoadCombination("ELU02","1.35*G+1.5*Q")
+combs.newLoadCombination("ELU03","1.35*G+1.5*W")
+combs.newLoadCombination("ELU04","1.35*G+1.5*Q+0.9*W")
+combs.newLoadCombination("ELU05","0.8*G-1.5*W")
+combs.newLoadCombination("ELU06","1.0*G+1.05*Q-1.5*W")
+
+def solve(analysisToPerform):
+  ''' Analyze all the combinations using the analysis procedure
+      being passed as parameter and return the displacements and the
+      internal forces for each of them.'''
+  disp= list()
+  forces= list()
+  result= 0
+  for key in combs.getKeys():
+    comb= combs[key]
+    preprocessor.resetLoadCase()
+    comb.addToDomain()
+    result+= analysisToPerform(feProblem)
+    for row in nodeTags:
+      for n in row:
+        disp.append(nodes.getNode(n).getDisp)
+    for e in columns+beams:
+      forces.append(elements.getElement(e).getResistingForce())
+    comb.removeFromDomain()
+  return result, disp, forces
+
+resultRef, dispRef, forcesRef= solve(lsd.defaultAnalysis)
+superposition= lsd.LinearSuperpositionAnalysis()
+result, disp, forces= solve(superposition)
+numSolutions= superposition.analysis.numLoadPatternSolutions
+
+errDisp= 0.0
+for d1,d2 in zip(dispRef,disp):
+  errDisp+= (d1-d2).Norm()
+errDisp/= max([d.Norm() for d in dispRef])
+errForces= 0.0
+for f1,f2 in zip(forcesRef,forces):
+  errForces+= (f1-f2).Norm()
+errForces/= max([f.Norm() for f in forcesRef])
+
+'''
+print "resultRef= ", resultRef, " result= ", result
+print "numSolutions= ", numSolutions
+print "errDisp= ", errDisp
+print "errForces= ", errForces
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((resultRef==0) and (result==0) and (numSolutions==3) and (abs(errDisp)<1e-9) and (abs(errForces)<1e-9)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,57 @@
+# -*- coding: utf-8 -*-
+''' Checks that the approximate minimum degree and the nested
+    dissection numberers give the same results as the reverse
+    Cuthill-McKee one and that they reduce the fill of the sparse
+    factorization (see DOFNumberer.getFillReport). The model is a
+    slab supported by elastic columns (see
+    aux/slab_on_elastic_columns.py).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../aux/slab_on_elastic_columns.py")
+
+def solve(numberer):
+  ''' Solve the model using the numbering algorithm being passed
+      as parameter and return the result of the analysis, the
+      displacements of the slab and the fill report of the
+      factorization.'''
+  setup= linearSolutionSetup(numberer,"sparse_gen_col_lin_soe","super_lu_solver")
+  result, disp, reac, solution, feProblem= solveSlabOnColumns(8.0,12,setup)
+  return result, disp, solution.numberer.getFillReport()
+
+resultRCM, dispRCM, fillRCM= solve("rcm")
+resultAMD, dispAMD, fillAMD= solve("amd")
+resultND, dispND, fillND= solve("nested_dissection")
+maxDisp= max([d.Norm() for d in dispRCM])
+
+err= 0.0
+for d1,d2,d3 in zip(dispRCM,dispAMD,dispND):
+  err+= (d1-d2).Norm()+(d1-d3).Norm()
+err/= maxDisp
+
+'''
+print "rcm: ", fillRCM
+print "amd: ", fillAMD
+print "nested dissection: ", fillND
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+sameProblem= (fillRCM.nnzA==fillAMD.nnzA) and (fillRCM.nnzA==fillND.nnzA)
+lessFill= (fillAMD.nnzL<fillRCM.nnzL) and (fillND.nnzL<fillRCM.nnzL)
+if((resultRCM==0) and (resultAMD==0) and (resultND==0) and (maxDisp>0.0) and (err<1e-9) and sameProblem and lessFill):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,55 @@
+# -*- coding: utf-8 -*-
+''' Checks that the parallel assembly of the system of equations
+    (see AnalysisAggregation.numThreads) gives the same results as
+    the serial one. The model is a slab supported by elastic columns
+    and braced with trusses (see aux/slab_on_elastic_columns.py).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../aux/slab_on_elastic_columns.py")
+
+def solve(numThreads):
+  ''' Solve the model assembling the system of equations with the
+      number of threads being passed as parameter and return the
+      result of the analysis, the displacements and the reactions.'''
+  def setup(feProblem):
+    solution= predefined_solutions.SolutionProcedure()
+    solution.simpleNewtonRaphson(feProblem)
+    solution.analysisAggregation.numThreads= numThreads
+    return solution
+  result, disp, reactions, solution, feProblem= solveSlabOnColumns(10.0,12,setup,columnStep= 1,braced= True)
+  return result, disp, reactions
+
+result1, disp1, reac1= solve(1)
+result4, disp4, reac4= solve(4)
+
+err= 0.0
+for d1,d4 in zip(disp1,disp4):
+  err+= (d1-d4).Norm()
+for r1,r4 in zip(reac1,reac4):
+  err+= (r1-r4).Norm()
+maxDisp= max([d.Norm() for d in disp1])
+
+'''
+print "result1= ", result1, " result4= ", result4
+print "maxDisp= ", maxDisp
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((result1==0) and (result4==0) and (maxDisp>0.0) and (err==0.0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+''' Stress test for the work areas of Matrix::Solve and Matrix::Invert.
+    The state of a row of force based cantilevers (ForceBeamColumn3d)
+    is updated with eight threads (see Mesh.numThreads). The columns
+    alternate fiber sections (order 3) and section aggregators (order 6)
+    so the threads factor matrices of different sizes at the same time.
+    The results must be exactly the same as the serial ones.'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+numColumns= 64 # Number of cantilevers.
+H= 3.0 # Cantilever height.
+fy= 275e6 # Yield stress of the steel.
+E= 210e9 # Young modulus of the steel.
+width= 0.2 # Cross section width.
+depth= 0.2 # Cross section depth.
+numSteps= 10
+
+def solve(numThreads):
+  ''' Build the model, solve it using the number of threads
+      being passed as parameter and return the solution results,
+      the top displacements and the axial forces.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  baseNodes= list()
+  topNodes= list()
+  for i in range(0,numColumns):
+    baseNodes.append(nodes.newNodeXYZ(i,0.0,0.0).tag)
+    topNodes.append(nodes.newNodeXYZ(i,0.0,H).tag)
+
+  steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,0.001)
+  materials= preprocessor.getMaterialHandler
+  columnGeom= materials.newSectionGeometry("columnGeom")
+  region= columnGeom.getRegions.newQuadRegion("steel")
+  region.nDivIJ= 4
+  region.nDivJK= 4
+  region.pMin= geom.Pos2d(-width/2.0,-depth/2.0)
+  region.pMax= geom.Pos2d(width/2.0,depth/2.0)
+  columnFibers= materials.newMaterial("fiber_section_3d","columnFibers")
+  columnFibers.getFiberSectionRepr().setGeomNamed("columnGeom")
+  columnFibers.setupFibers()
+  respT= typical_materials.defElasticMaterial(preprocessor, "respT",1e10) # Torsion response.
+  respVy= typical_materials.defElasticMaterial(preprocessor, "respVy",1e9) # Shear response in y direction.
+  respVz= typical_materials.defElasticMaterial(preprocessor, "respVz",1e9) # Shear response in z direction.
+  agg= materials.newMaterial("section_aggregator","agg")
+  agg.setSection("columnFibers")
+  agg.setAdditions(["T","Vy","Vz"],["respT","respVy","respVz"])
+
+  lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.numSections= 5
+  for i,(b,t) in enumerate(zip(baseNodes,topNodes)):
+    if(i%2==0):
+      elements.defaultMaterial= "columnFibers"
+    else:
+      elements.defaultMaterial= "agg"
+    elements.newElement("ForceBeamColumn3d",xc.ID([b,t]))
+
+  for b in baseNodes:
+    modelSpace.fixNode000_000(b)
+
+  # Lateral load increasing with the column index so the
+  # columns reach different states.
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  Fmax= fy*width*depth**2/6.0/H # Yield load.
+  for i,t in enumerate(topNodes):
+    F= 0.4*Fmax*(1.0+i/numColumns)
+    lp0.newNodalLoad(t,xc.Vector([F,0.2*F,-10*F,0.01*F,0,0]))
+  lPatterns.addToDomain("0")
+
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleNewtonRaphson(feProblem)
+  solution.analysisAggregation.numThreads= numThreads
+  domain= feProblem.getDomain
+  domain.getMesh.numThreads= numThreads
+  result= analysis.analyze(numSteps)
+  disp= list()
+  for t in topNodes:
+    disp.append(nodes.getNode(t).getDisp)
+  forces= list()
+  eIter= domain.getMesh.getElementIter
+  elem= eIter.next()
+  while not(elem is None):
+    forces.append(elem.getResistingForce())
+    elem= eIter.next()
+  return result, disp, forces
+
+result1, disp1, forces1= solve(1)
+result8, disp8, forces8= solve(8)
+
+err= 0.0
+for d1,d8 in zip(disp1,disp8):
+  err+= (d1-d8).Norm()
+for f1,f8 in zip(forces1,forces8):
+  err+= (f1-f8).Norm()
+maxDisp= max([d.Norm() for d in disp1])
+
+'''
+print "result1= ", result1, " result8= ", result8
+print "maxDisp= ", maxDisp
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((result1==0) and (result8==0) and (maxDisp>0.0) and (err==0.0)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
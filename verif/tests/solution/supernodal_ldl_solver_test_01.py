@@ -0,0 +1,43 @@
+# -*- coding: utf-8 -*-
+''' Checks the supernodal LDL^T solver (SupernodalLDLSolver) of
+    sparse symmetric systems of equations (SymSparseColLinSOE)
+    comparing its results with those of the band solver, using
+    the numberers that reduce the fill of the factorization and
+    several threads. The model is a slab supported by elastic
+    columns (see aux/slab_on_elastic_columns.py).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../aux/slab_on_elastic_columns.py")
+
+cases= [("rcm","band_spd_lin_soe","band_spd_lin_lapack_solver"),
+        ("amd","sym_sparse_col_lin_soe","supernodal_ldl_solver"),
+        ("nested_dissection","sym_sparse_col_lin_soe","supernodal_ldl_solver"),
+        ("rcm","sym_sparse_col_lin_soe","supernodal_ldl_solver"),
+        ("amd","sym_sparse_col_lin_soe","supernodal_ldl_solver",{"numThreads":4})]
+
+results, maxDisp, err= compareLinearSolutions(8.0,6,cases)
+
+'''
+print "results= ", results
+print "maxDisp= ", maxDisp
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((max([abs(r) for r in results])==0) and (maxDisp>0.0) and (err<1e-9)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
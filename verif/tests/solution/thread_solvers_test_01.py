@@ -0,0 +1,47 @@
+# -*- coding: utf-8 -*-
+''' Checks the threaded solvers of band and profile systems of
+    equations (BandSPDLinThreadSolver and ProfileSPDLinDirectThreadSolver)
+    comparing its results with those of the serial solvers, using
+    several threads and blocks. The model is a slab supported by
+    elastic columns (see aux/slab_on_elastic_columns.py).'''
+
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+
+pth= os.path.dirname(__file__)
+if(not pth):
+  pth= "."
+execfile(pth+"/../aux/slab_on_elastic_columns.py")
+
+def threads(n):
+  ''' Properties of the threaded solvers.'''
+  return {"numThreads":n, "blockSize":16}
+
+cases= [("rcm","band_spd_lin_soe","band_spd_lin_lapack_solver"),
+        ("rcm","band_spd_lin_soe","band_spd_lin_thread_solver",threads(1)),
+        ("rcm","band_spd_lin_soe","band_spd_lin_thread_solver",threads(4)),
+        ("rcm","profile_spd_lin_soe","profile_spd_lin_direct_solver"),
+        ("rcm","profile_spd_lin_soe","profile_spd_lin_direct_thread_solver",threads(1)),
+        ("rcm","profile_spd_lin_soe","profile_spd_lin_direct_thread_solver",threads(4))]
+
+results, maxDisp, err= compareLinearSolutions(8.0,6,cases)
+
+'''
+print "results= ", results
+print "maxDisp= ", maxDisp
+print "err= ", err
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((max([abs(r) for r in results])==0) and (maxDisp>0.0) and (err<1e-9)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')